@@ -1,32 +1,51 @@
 #include "ch.h"
 #include "hal.h"
 
-#include "port_shared.h"
+#include "port.h"
 #include "flash.h"
+#include "bl_block.h"
+#include "lzss.h"
+#include "page_diff.h"
+#include "image_info.h"
+#include "crc_backend.h"
 #include "io_pins.h"
 #include "../../for_rusefi/wideband_can.h"
 
 #include <cstring>
-#include <rusefi/crc.h>
 
 // These are defined in the linker script
 extern uint32_t __appflash_start__[64];
 extern uint32_t __appflash_size__;
 extern uint32_t __ram_vectors_start__[64];
 extern uint32_t __ram_vectors_size__;
+extern Configuration __configflash__start__;
 
-#define SWAP_UINT32(x) ((((x) >> 24) & 0xff) | (((x) << 8) & 0xff0000) | (((x) >> 8) & 0xff00) | (((x) << 24) & 0xff000000))
+// 32k (flash) - 6k (bootloader) - 1k (config)
+#define APP_AREA_SIZE (25 * 1024)
+static_assert(APP_AREA_SIZE == APP_PAGE_COUNT * APP_PAGE_SIZE);
+
+static uint32_t appCrc(const uint8_t* data, size_t size)
+{
+    return Crc32(data, size);
+}
 
 bool isAppValid() {
-    const uint32_t* appFlash = 
-    __appflash_start__;
+    const uint8_t* app = reinterpret_cast<const uint8_t*>(__appflash_start__);
 
-    int appSize = 25600;
+    // This exact image already passed since the last power cycle, skip the CRC
+    uint32_t token = GetImageToken(app, APP_AREA_SIZE);
+    if (ReadBackupRegister(BackupRegister::ValidatedImage) == token)
+    {
+        return true;
+    }
 
-    uint32_t expectedCrc = appFlash[appSize / 4 - 1];
-    uint32_t actualCrc = SWAP_UINT32(crc32(reinterpret_cast<const uint8_t*>(appFlash), appSize - 4));
+    if (!IsImageValid(app, APP_AREA_SIZE, appCrc))
+    {
+        return false;
+    }
 
-    return actualCrc == expectedCrc;
+    WriteBackupRegister(BackupRegister::ValidatedImage, token);
+    return true;
 }
 
 __attribute__((noreturn))
@@ -64,18 +83,23 @@ void boot_app() {
 
 uintptr_t appFlashAddr = (uintptr_t)__appflash_start__;
 
-void EraseAppPages()
+// Erase one page, counting from the start of the app
+void EraseAppPage(size_t appPage)
 {
     uintptr_t blSize = (uintptr_t)(appFlashAddr - 0x08000000);
     size_t pageIdx = blSize / 1024;
 
+    Flash::ErasePage(pageIdx + appPage);
+}
+
+void EraseAppPages()
+{
     // size_t appSizeKb = __appflash_size__ / 1024;
-    size_t appSizeKb = 25;
+    size_t appSizeKb = APP_PAGE_COUNT;
 
     for (size_t i = 0; i < appSizeKb; i++)
     {
-        Flash::ErasePage(pageIdx);
-        pageIdx++;
+        EraseAppPage(i);
     }
 }
 
@@ -107,12 +131,29 @@ void WaitForBootloaderCmd()
     }
 }
 
+// Same index as the app uses, so the host can match bootloader replies to controllers
+static uint8_t canIndex = 0;
+// Send addressed acks, see WB_BL_MULTICAST
+static bool multicast = false;
+
+static uint8_t getCanIndex()
+{
+    int strapped = GetStrappedCanIndex();
+    if (strapped >= 0)
+    {
+        return strapped;
+    }
+
+    const auto& cfg = __configflash__start__;
+    return cfg.IsValid() ? cfg.CanIndexOffset : 0;
+}
+
 void sendAck()
 {
     CANTxFrame frame;
 
     frame.IDE = CAN_IDE_EXT;
-    frame.EID = WB_ACK;   // ascii "rus"
+    frame.EID = multicast ? WB_BL_NODE_ACK(canIndex) : WB_ACK;   // ascii "rus"
     frame.RTR = CAN_RTR_DATA;
     frame.DLC = 0;
 
@@ -124,6 +165,208 @@ void sendNak()
     // TODO: implement
 }
 
+static BlockReceiver blockReceiver;
+
+class AppFlash : public ImageFlash
+{
+public:
+    void Write(uint32_t offset, const uint8_t* data, size_t size) override
+    {
+        Flash::Write(appFlashAddr + offset, data, size);
+    }
+
+    const uint8_t* GetBase() const override
+    {
+        return reinterpret_cast<const uint8_t*>(appFlashAddr);
+    }
+};
+
+static AppFlash appFlash;
+static CompressedImageWriter imageWriter;
+static bool compressedTransfer = false;
+static uint16_t nextCompressedBlock = 0;
+
+static void programBlock(uint32_t offset, uint32_t size)
+{
+    if (!compressedTransfer)
+    {
+        Flash::Write(appFlashAddr + offset, blockReceiver.GetBuffer(), size);
+        blockReceiver.Finish();
+        sendAck();
+        return;
+    }
+
+    if (blockReceiver.GetBlockIndex() == 0)
+    {
+        imageWriter.Begin(appFlash, 25 * 1024);
+        nextCompressedBlock = 0;
+    }
+
+    // The decompressor can only take the stream in order
+    if (blockReceiver.GetBlockIndex() != nextCompressedBlock)
+    {
+        sendNak();
+        return;
+    }
+
+    auto result = imageWriter.Feed(blockReceiver.GetBuffer(), size);
+    blockReceiver.Finish();
+
+    if (result == ImageWriteResult::Error)
+    {
+        // Bad header, corrupt stream or CRC mismatch: the host has to erase and start over
+        sendNak();
+        return;
+    }
+
+    nextCompressedBlock++;
+    sendAck();
+}
+
+static void sendBlockStatus(uint8_t group, uint64_t missing)
+{
+    CANTxFrame frame;
+
+    frame.IDE = CAN_IDE_EXT;
+    frame.EID = WB_BL_BLOCK_STATUS(group, canIndex);
+    frame.RTR = CAN_RTR_DATA;
+    frame.DLC = 8;
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        frame.data8[i] = missing >> (8 * i);
+    }
+
+    canTransmitTimeout(&CAND1, CAN_ANY_MAILBOX, &frame, TIME_INFINITE);
+}
+
+static void handleBlock(uint16_t embeddedData, const CANRxFrame& frame)
+{
+    uint16_t arg = WB_BL_BLOCK_GET_ARG(embeddedData);
+
+    switch (WB_BL_BLOCK_GET_TYPE(embeddedData))
+    {
+        case WB_BL_BLOCK_GET_TYPE(WB_BL_BLOCK_BEGIN(0)):
+            compressedTransfer = WB_BL_BLOCK_IS_COMPRESSED(embeddedData);
+            blockReceiver.Begin(arg);
+            break;
+        case WB_BL_BLOCK_GET_TYPE(WB_BL_BLOCK_DATA(0)):
+            // Lost or stray frames are reported in the STATUS reply to END
+            blockReceiver.OnData(arg, &frame.data8[0], frame.DLC);
+            break;
+        case WB_BL_BLOCK_GET_TYPE(WB_BL_BLOCK_END(0)):
+        {
+            uint8_t frameCount = frame.DLC >= 1 ? frame.data8[0] : 0;
+
+            // END says what kind of block this is too, in case BEGIN got lost
+            compressedTransfer = WB_BL_BLOCK_IS_COMPRESSED(embeddedData);
+
+            uint32_t offset = arg * BL_BLOCK_SIZE;
+            uint32_t size = frameCount * BL_BLOCK_FRAME_SIZE;
+
+            // Don't allow out of bounds writes, a compressed image is bounds checked as it is decompressed
+            if (!compressedTransfer && !IsBlockInArea(arg, frameCount, APP_AREA_SIZE))
+            {
+                sendNak();
+                break;
+            }
+
+            switch (blockReceiver.OnEnd(arg, frameCount))
+            {
+                case BlockEndResult::Program:
+                    programBlock(offset, size);
+                    break;
+                case BlockEndResult::AlreadyDone:
+                    sendAck();
+                    break;
+                case BlockEndResult::Missing:
+                    for (uint8_t group = 0; group < BL_BLOCK_STATUS_COUNT; group++)
+                    {
+                        uint64_t missing = blockReceiver.GetMissing(group, frameCount);
+
+                        if (missing)
+                        {
+                            sendBlockStatus(group, missing);
+                        }
+                    }
+                    break;
+                case BlockEndResult::Invalid:
+                    sendNak();
+                    break;
+            }
+
+            break;
+        }
+        default:
+            sendNak();
+            break;
+    }
+}
+
+static void sendPageCrc(uint8_t page)
+{
+    uint32_t crc = GetPageCrc(reinterpret_cast<const uint8_t*>(appFlashAddr + page * APP_PAGE_SIZE));
+
+    CANTxFrame frame;
+
+    frame.IDE = CAN_IDE_EXT;
+    frame.EID = WB_BL_PAGE_CRC_REPLY(page, canIndex);
+    frame.RTR = CAN_RTR_DATA;
+    frame.DLC = 4;
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        frame.data8[i] = crc >> (8 * i);
+    }
+
+    canTransmitTimeout(&CAND1, CAN_ANY_MAILBOX, &frame, TIME_INFINITE);
+}
+
+static void handlePage(uint16_t embeddedData, const CANRxFrame& frame)
+{
+    switch (WB_BL_PAGE_GET_TYPE(embeddedData))
+    {
+        case WB_BL_PAGE_GET_TYPE(WB_BL_PAGE_CRC_QUERY):
+        {
+            if (frame.DLC < 2)
+            {
+                sendNak();
+                break;
+            }
+
+            uint8_t first = frame.data8[0];
+            uint8_t count = frame.data8[1];
+
+            for (uint8_t page = first; page < first + count && page < APP_PAGE_COUNT; page++)
+            {
+                sendPageCrc(page);
+            }
+
+            break;
+        }
+        case WB_BL_PAGE_GET_TYPE(WB_BL_PAGE_ERASE(0)):
+        {
+            uint8_t page = WB_BL_PAGE_GET_PAGE(embeddedData);
+            uint16_t tag = frame.DLC >= 2 ? frame.data8[0] | (frame.data8[1] << 8) : 0;
+
+            if (tag != WB_ERASE_TAG || page >= APP_PAGE_COUNT)
+            {
+                sendNak();
+                break;
+            }
+
+            EraseAppPage(page);
+            // Anything we remember having programmed may be gone now
+            blockReceiver.Reset();
+            sendAck();
+            break;
+        }
+        default:
+            sendNak();
+            break;
+    }
+}
+
 bool bootloaderBusy = false;
 
 void RunBootloaderLoop()
@@ -174,6 +417,7 @@ void RunBootloaderLoop()
                 if (embeddedData == WB_ERASE_TAG)
                 {
                     EraseAppPages();
+                    blockReceiver.Reset();
                     sendAck();
                 }
                 else
@@ -191,7 +435,7 @@ void RunBootloaderLoop()
                     sendNak();
                 }
                 // Don't allow out of bounds writes
-                else if (embeddedData >= 26 * 1024)
+                else if (embeddedData + frame.DLC > APP_AREA_SIZE)
                 {
                     sendNak();
                 }
@@ -212,6 +456,24 @@ void RunBootloaderLoop()
                 bootloaderBusy = false;
                 // Kill this thread
                 return;
+            case WB_OPCODE_BLOCK: // opcode 10 is windowed "write flash data", see wideband_can.h
+                handleBlock(embeddedData, frame);
+                break;
+            case WB_OPCODE_PAGE: // opcode 11 is per page CRC query and erase, for delta updates
+                handlePage(embeddedData, frame);
+                break;
+            case WB_OPCODE_NODE: // opcode 12 switches addressed replies for multicast updates
+                if (embeddedData == WB_MSG_GET_EXTRA(WB_BL_MULTICAST) && frame.DLC >= 1)
+                {
+                    multicast = frame.data8[0] != 0;
+                    sendAck();
+                }
+                else
+                {
+                    sendNak();
+                }
+
+                break;
             default:
                 sendNak();
                 break;
@@ -227,14 +489,46 @@ THD_FUNCTION(BootloaderThread, arg)
     // turn on CAN
     canStart(&CAND1, &GetCanConfig());
 
-    WaitForBootloaderCmd();
+    canIndex = getCanIndex();
+
+    // The app got an enter command and reset us, no need to wait for another one
+    if (ReadBackupRegister(BackupRegister::StayInBootloader))
+    {
+        WriteBackupRegister(BackupRegister::StayInBootloader, 0);
+    }
+    else
+    {
+        WaitForBootloaderCmd();
+    }
 
     // We've rx'd a BL command, don't load the app!
     bootloaderBusy = true;
 
+    // The app is about to change, it has to be checked again
+    WriteBackupRegister(BackupRegister::ValidatedImage, 0);
+
     RunBootloaderLoop();
 }
 
+// Reads and clears the reset flags, they stick until cleared. The app gets them from a backup register.
+static uint32_t TakeResetCause()
+{
+    uint32_t csr = RCC->CSR;
+    RCC->CSR |= RCC_CSR_RMVF;
+
+    WriteBackupRegister(BackupRegister::ResetCause, csr >> 24);
+
+    return csr;
+}
+
+static bool IsSoftwareResetOnly(uint32_t csr)
+{
+    uint32_t other = RCC_CSR_PORRSTF | RCC_CSR_IWDGRSTF | RCC_CSR_WWDGRSTF | RCC_CSR_LPWRRSTF;
+
+    // The pin flag is set along with the software one, the reset is driven out on NRST
+    return (csr & RCC_CSR_SFTRSTF) && !(csr & other);
+}
+
 /*
  * Application entry point.
  */
@@ -249,11 +543,16 @@ int main(void) {
     palSetPadMode(LED_GREEN_PORT, LED_GREEN_PIN, PAL_MODE_OUTPUT_PUSHPULL);
     palTogglePad(LED_GREEN_PORT, LED_GREEN_PIN);
 
-    for (size_t i = 0; i < 20; i++)
+    // Window for a bootloader command before the app starts. The app makes us stay when it
+    // gets one (see PrepareBootloaderEntry), so after a plain software reset from a working app
+    // a short window is enough. Power-up, the reset pin, watchdogs and brownouts get the full
+    // window: that is how a broken app that still passes its CRC gets recovered.
+    size_t windowSteps = IsSoftwareResetOnly(TakeResetCause()) ? 5 : 40;
+    for (size_t i = 0; i < windowSteps; i++)
     {
         palTogglePad(LED_BLUE_PORT, LED_BLUE_PIN);
         palTogglePad(LED_GREEN_PORT, LED_GREEN_PIN);
-        chThdSleepMilliseconds(40);
+        chThdSleepMilliseconds(20);
     }
 
     // Block until booting the app is allowed and CRC matches
@@ -264,5 +563,8 @@ int main(void) {
         chThdSleepMilliseconds(200);
     }
 
+    // Let the app report how long we took
+    WriteBackupRegister(BackupRegister::BootTime, TIME_I2MS(chVTGetSystemTime()));
+
     boot_app();
 }
@@ -3,6 +3,14 @@
 # clean & build the bootloader
 make clean && make -j4
 
+arm-none-eabi-size build/wideband_bootloader.elf
+
+# The app expects it to take exactly blsize (wideband_layout.ld), padding can't shrink it
+if [ $(stat -c%s build/wideband_bootloader.bin) -gt 6144 ]; then
+    echo "Bootloader is bigger than 6k"
+    exit 1
+fi
+
 # convert bootloader bin output to a linkable .o file
 # first pad the binary out with 0xFF
 arm-none-eabi-objcopy -I binary -O binary --gap-fill 0xFF --pad-to 0x1800 build/wideband_bootloader.bin build/wideband_bootloader.padded.bin
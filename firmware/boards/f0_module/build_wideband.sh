@@ -14,7 +14,7 @@ DELIVER_DIR=deliver/${BOARD}
 
 # delete the elf to force a re-link (it might not pick up the bootloader otherwise)
 rm -rf build/
-rm -f ../for_rusefi/wideband_image.h
+rm -f ../for_rusefi/wideband_image.h ../for_rusefi/wideband_image_lz.h
 
 mkdir -p ${DELIVER_DIR}
 rm -rf ${DELIVER_DIR}/*
@@ -23,18 +23,16 @@ rm -rf ${DELIVER_DIR}/*
 make -j12 BOARD=${BOARD}
 
 
-# Copy the bin without the bootloader (the image consumed by rusEfi has no bootloader on it)
+# Copy the bin without the bootloader (the image consumed by rusEfi has no bootloader on it).
+# 6k is blsize in wideband_layout.ld, build_bootloader.sh checks the bootloader fits in it.
 dd if=build/wideband.bin of=build/wideband_noboot_no_pad.bin skip=6144 bs=1
 
-# extend the image out to full size (32k (flash) - 6k (bootloader) - 1k (config) - 4 (crc) = 25k - 4 = 0x63FC)
-arm-none-eabi-objcopy -I binary -O binary --gap-fill 0xFF --pad-to 0x63FC build/wideband_noboot_no_pad.bin build/wideband_fullsize_nocrc.bin
-
-# compute the crc and write that to a file (in binary)
-crc32 build/wideband_fullsize_nocrc.bin | xxd -r -p - > build/wideband_crc.bin
-[ $? -eq 0 ] || { echo "crc32 computation failed"; exit 1; }
-
-# Now glue the image and CRC together
-cat build/wideband_fullsize_nocrc.bin build/wideband_crc.bin > build/wideband_image.bin
+# pad the image out to full size (32k (flash) - 6k (bootloader) - 1k (config) = 25k), then add
+# the image info (size, CRC, version) and the CRC of the whole area at the end
+g++ -O2 -std=c++17 -Ishared -Ilibfirmware/util/include \
+    tools/wb_image.cpp shared/image_info.cpp libfirmware/util/src/crc.cpp \
+    -o build/wb_image
+build/wb_image build/wideband_noboot_no_pad.bin $(git rev-parse --short=8 HEAD) build/wideband_image.bin
 
 # For good measure build a complete bin that includes the bootloader
 cat boards/f0_module/bootloader/build/wideband_bootloader.padded.bin build/wideband_image.bin > ${DELIVER_DIR}/wideband_image_with_bl.bin
@@ -44,5 +42,16 @@ xxd -i build/wideband_image.bin \
     | cat <(echo -n "static const ") - \
     > ${DELIVER_DIR}/wideband_image.h
 
+# Compressed version of the same image, for compressed CAN block transfers
+g++ -O2 -std=c++17 -Ishared -Ilibfirmware/util/include \
+    tools/wb_compress.cpp shared/lzss.cpp shared/crc_backend.cpp libfirmware/util/src/crc.cpp \
+    -o build/wb_compress
+build/wb_compress build/wideband_image.bin build/wideband_image_lz.bin
+
+xxd -i build/wideband_image_lz.bin \
+    | cat <(echo -n "static const ") - \
+    > ${DELIVER_DIR}/wideband_image_lz.h
+
 cp ${DELIVER_DIR}/wideband_image_with_bl.bin ../for_rusefi/
 cp ${DELIVER_DIR}/wideband_image.h ../for_rusefi/
+cp ${DELIVER_DIR}/wideband_image_lz.h ../for_rusefi/
@@ -77,40 +77,6 @@ AnalogResult AnalogSampleFinish()
     };
 }
 
-// Returns:
-// low -> 0
-// floating -> 1
-// high -> 2
-static uint8_t readSelPin(ioportid_t port, iopadid_t pad)
-{
-    // If we pull the pin down, does the input follow?
-    palSetPadMode(port, pad, PAL_MODE_INPUT_PULLDOWN);
-    chThdSleepMilliseconds(1);
-    auto pd = palReadPad(port, pad);
-
-    // If we pull the pin up, does the input follow?
-    palSetPadMode(port, pad, PAL_MODE_INPUT_PULLUP);
-    chThdSleepMilliseconds(1);
-    auto pu = palReadPad(port, pad);
-
-    // If the pin changed with pullup/down state, it's floating
-    if (pd != pu)
-    {
-        return 1;
-    }
-
-    if (pu)
-    {
-        // Pin was high
-        return 2;
-    }
-    else
-    {
-        // Pin was low
-        return 0;
-    }
-}
-
 extern Configuration __configflash__start__;
 
 int InitConfiguration()
@@ -131,21 +97,10 @@ Configuration* GetConfiguration()
     }
 
     // Now, override the index with a hardware-strapped option (if present)
-    auto sel1 = readSelPin(ID_SEL1_PORT, ID_SEL1_PIN);
-    auto sel2 = readSelPin(ID_SEL2_PORT, ID_SEL2_PIN);
-
-    // See https://github.com/mck1117/wideband/issues/11 to explain this madness
-    switch (3 * sel1 + sel2) {
-        case 0: config.CanIndexOffset = 2; break;
-        case 1: config.CanIndexOffset = 0; break;
-        case 2: config.CanIndexOffset = 3; break;
-        case 3: config.CanIndexOffset = 4; break;
-        case 4: /* both floating, do nothing */ break;
-        case 5: config.CanIndexOffset = 1; break;
-        case 6: config.CanIndexOffset = 5; break;
-        case 7: config.CanIndexOffset = 6; break;
-        case 8: config.CanIndexOffset = 7; break;
-        default: break;
+    int strapped = GetStrappedCanIndex();
+    if (strapped >= 0)
+    {
+        config.CanIndexOffset = strapped;
     }
 
     return &config;
@@ -164,11 +119,31 @@ void SetConfiguration()
     );
 }
 
+void FlushConfiguration()
+{
+    // SetConfiguration writes right away, nothing queued
+}
+
 SensorType GetSensorType()
 {
     return SensorType::LSU49;
 }
 
+void PrepareBootloaderEntry()
+{
+    WriteBackupRegister(BackupRegister::StayInBootloader, 1);
+}
+
+uint16_t GetBootTimeMs()
+{
+    return ReadBackupRegister(BackupRegister::BootTime);
+}
+
+uint8_t GetResetCause()
+{
+    return ReadBackupRegister(BackupRegister::ResetCause);
+}
+
 void SetupESRDriver(SensorType)
 {
     // NOP
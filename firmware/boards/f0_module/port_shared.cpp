@@ -1,4 +1,5 @@
 #include "port_shared.h"
+#include "io_pins.h"
 
 // board-specific stuff shared between bootloader and firmware
 
@@ -14,3 +15,70 @@ static const CANConfig canConfig500 =
 const CANConfig& GetCanConfig() {
     return canConfig500;
 }
+
+// Returns:
+// low -> 0
+// floating -> 1
+// high -> 2
+static uint8_t readSelPin(ioportid_t port, iopadid_t pad)
+{
+    // If we pull the pin down, does the input follow?
+    palSetPadMode(port, pad, PAL_MODE_INPUT_PULLDOWN);
+    chThdSleepMilliseconds(1);
+    auto pd = palReadPad(port, pad);
+
+    // If we pull the pin up, does the input follow?
+    palSetPadMode(port, pad, PAL_MODE_INPUT_PULLUP);
+    chThdSleepMilliseconds(1);
+    auto pu = palReadPad(port, pad);
+
+    // If the pin changed with pullup/down state, it's floating
+    if (pd != pu)
+    {
+        return 1;
+    }
+
+    if (pu)
+    {
+        // Pin was high
+        return 2;
+    }
+    else
+    {
+        // Pin was low
+        return 0;
+    }
+}
+
+uint32_t ReadBackupRegister(BackupRegister reg)
+{
+    return (&RTC->BKP0R)[static_cast<uint8_t>(reg)];
+}
+
+void WriteBackupRegister(BackupRegister reg, uint32_t value)
+{
+    // Backup domain write protection, the HAL normally leaves it open but make sure
+    PWR->CR |= PWR_CR_DBP;
+
+    (&RTC->BKP0R)[static_cast<uint8_t>(reg)] = value;
+}
+
+int GetStrappedCanIndex()
+{
+    auto sel1 = readSelPin(ID_SEL1_PORT, ID_SEL1_PIN);
+    auto sel2 = readSelPin(ID_SEL2_PORT, ID_SEL2_PIN);
+
+    // See https://github.com/mck1117/wideband/issues/11 to explain this madness
+    switch (3 * sel1 + sel2) {
+        case 0: return 2;
+        case 1: return 0;
+        case 2: return 3;
+        case 3: return 4;
+        case 4: /* both floating */ return -1;
+        case 5: return 1;
+        case 6: return 5;
+        case 7: return 6;
+        case 8: return 7;
+        default: return -1;
+    }
+}
@@ -1,6 +1,10 @@
 #include "port.h"
 
 #include "wideband_config.h"
+#include "config_burn.h"
+#include "config_store.h"
+#include "crc_backend.h"
+#include "event_log.h"
 
 #include "hal.h"
 #include "hal_mfs.h"
@@ -42,9 +46,75 @@ static const MFSConfig mfscfg1 = {
 static MFSDriver mfs1;
 static mfs_nocache_buffer_t __nocache_mfsbuf;
 
+#ifdef EVENT_LOG_ENABLED
+/* Event log on its own pages, right below the settings, so its garbage collection never
+ * erases the settings banks. The app ends below these, see wideband_layout.ld */
+static const MFSConfig mfscfg2 = {
+    .flashp           = (BaseFlash *)&EFLD1,
+    .erased           = 0xFFFFFFFFU,
+#ifdef STM32F103xB
+    /* 1K pages 116..119, one bank is 2K */
+    .bank_size        = 2048U,
+    .bank0_start      = 116U,
+    .bank0_sectors    = 2U,
+    .bank1_start      = 118U,
+    .bank1_sectors    = 2U
+#endif
+#ifdef STM32F103xE
+    /* 2K pages 118 and 119, one bank is 2K */
+    .bank_size        = 2048U,
+    .bank0_start      = 118U,
+    .bank0_sectors    = 1U,
+    .bank1_start      = 119U,
+    .bank1_sectors    = 1U
+#endif
+};
+
+// Every slot written once, and room for a couple more writes before a bank has to be collected
+static_assert(sizeof(mfs_bank_header_t) + (EVENT_LOG_SLOTS + 2) * (sizeof(mfs_data_header_t) + sizeof(EventLogRecord)) <= 2048U);
+
+static MFSDriver mfs2;
+static mfs_nocache_buffer_t __nocache_mfsbuf2;
+#endif
+
 // Settings
 static Configuration cfg;
-#define MFS_CONFIGURATION_RECORD_ID     1
+
+class MfsConfigStorage : public ConfigStorage
+{
+public:
+    MfsConfigStorage(MFSDriver* mfs)
+        : m_mfs(mfs)
+    {
+    }
+
+    bool Read(uint16_t id, uint8_t* buffer, size_t& size) override
+    {
+        return mfsReadRecord(m_mfs, id, &size, buffer) == MFS_NO_ERROR;
+    }
+
+    bool Write(uint16_t id, const uint8_t* data, size_t size) override
+    {
+        return mfsWriteRecord(m_mfs, id, size, data) == MFS_NO_ERROR;
+    }
+
+    void Erase(uint16_t id) override
+    {
+        mfsEraseRecord(m_mfs, id);
+    }
+
+private:
+    MFSDriver* const m_mfs;
+};
+
+static MfsConfigStorage configStorage(&mfs1);
+static ConfigStore configStore(configStorage);
+
+#ifdef EVENT_LOG_ENABLED
+static MfsConfigStorage eventLogStorage(&mfs2);
+// Event log pages usable, else the log is RAM only
+static bool eventLogStored = false;
+#endif
 
 #ifndef BOARD_DEFAULT_SENSOR_TYPE
 #define BOARD_DEFAULT_SENSOR_TYPE SensorType::LSU49
@@ -57,6 +127,11 @@ void Configuration::LoadDefaults()
 
     CanIndexOffset = 0;
     sensorType = BOARD_DEFAULT_SENSOR_TYPE;
+    extraCanFormats = 0;
+    canStatsPeriod = 0;
+    // 4 samples, 50 Hz
+    egtAveraging = 2;
+    egtNotch = 1;
 
     /* default auxout curve is 0..5V for AFR 8.5 to 18.0
      * default auxout[n] input is AFR[n] */
@@ -71,10 +146,73 @@ void Configuration::LoadDefaults()
     Tag = ExpectedTag;
 }
 
-int InitConfiguration()
+// The write goes from a copy, TS keeps writing to cfg meanwhile
+static Configuration burnSnapshot;
+
+// BurnQueue is used from the TS, CAN and burn threads. Not a critical section, it reads the time.
+static BSEMAPHORE_DECL(burnLock, false);
+// MFS is not thread safe, held for every flash access after init (burn thread and flush)
+static BSEMAPHORE_DECL(storageLock, false);
+
+// Writes a queued burn, right away if now is set, else only once it is due. Caller holds storageLock.
+static void WriteBurn(bool now)
 {
-    size_t size = GetConfigurationSize();
+    auto& queue = GetBurnQueue();
+
+    chBSemWait(&burnLock);
+
+    bool due = now ? queue.HasPending() : queue.IsDue();
+    if (due)
+    {
+        chSysLock();
+        burnSnapshot = cfg;
+        chSysUnlock();
+    }
+
+    bool changed = due && queue.Begin(Crc32(&burnSnapshot, sizeof(burnSnapshot)));
+
+    chBSemSignal(&burnLock);
+
+    if (!changed)
+    {
+        return;
+    }
+
+    // Only the sections that changed
+    int written = configStore.Save(burnSnapshot);
+
+    chBSemWait(&burnLock);
+    queue.End(written >= 0);
+    chBSemSignal(&burnLock);
+}
 
+static THD_WORKING_AREA(waBurnThread, 512);
+static void BurnThread(void*)
+{
+    chRegSetThreadName("Burn");
+
+    while (true)
+    {
+        chThdSleepMilliseconds(50);
+
+        chBSemWait(&storageLock);
+
+#ifdef EVENT_LOG_ENABLED
+        // Here rather than its own thread, both MFS instances share the flash driver
+        if (eventLogStored)
+        {
+            FlushEventLog(eventLogStorage);
+        }
+#endif
+
+        WriteBurn(false);
+
+        chBSemSignal(&storageLock);
+    }
+}
+
+int InitConfiguration()
+{
     /* Starting EFL driver.*/
     eflStart(&EFLD1, NULL);
 
@@ -85,12 +223,37 @@ int InitConfiguration()
         return -1;
     }
 
-    err = mfsReadRecord(&mfs1, MFS_CONFIGURATION_RECORD_ID, &size, GetConfigurationPtr());
-    if ((err != MFS_NO_ERROR) || (size != GetConfigurationSize() || !cfg.IsValid())) {
-        /* load defaults */
-        cfg.LoadDefaults();
+    /* stored settings on top of defaults, whatever isn't stored keeps its default */
+    cfg.LoadDefaults();
+
+    switch (configStore.Load(cfg)) {
+        case ConfigLoadResult::Migrated:
+            // Store it in the current layout now, rather than migrating again every boot
+            if (configStore.Save(cfg) < 0) {
+                break;
+            }
+            [[fallthrough]];
+        case ConfigLoadResult::Loaded:
+            GetBurnQueue().SetStored(Crc32(&cfg, sizeof(cfg)));
+            break;
+        case ConfigLoadResult::Defaults:
+            break;
+    }
+
+#ifdef EVENT_LOG_ENABLED
+    // Records from before the log had its own pages. Erasing one that isn't there doesn't write.
+    for (uint16_t slot = 0; slot < EVENT_LOG_SLOTS; slot++) {
+        configStorage.Erase(EVENT_LOG_RECORD_FIRST + slot);
     }
 
+    mfsObjectInit(&mfs2, &__nocache_mfsbuf2);
+    eventLogStored = mfsStart(&mfs2, &mfscfg2) == MFS_NO_ERROR;
+    InitEventLog(eventLogStored ? &eventLogStorage : nullptr);
+#endif
+
+    // Below everything that does real work, flash writes can wait
+    chThdCreateStatic(waBurnThread, sizeof(waBurnThread), NORMALPRIO - 6, BurnThread, nullptr);
+
     return 0;
 }
 
@@ -105,15 +268,24 @@ void SetConfiguration()
 }
 
 /* TS stuff */
+// Only queues the burn, BurnThread writes it once things settle down
 int SaveConfiguration() {
-    /* TODO: handle error */
-    mfs_error_t err = mfsWriteRecord(&mfs1, MFS_CONFIGURATION_RECORD_ID, GetConfigurationSize(), GetConfigurationPtr());
-    if (err != MFS_NO_ERROR) {
-        return -1;
-    }
+    chBSemWait(&burnLock);
+    GetBurnQueue().Request();
+    chBSemSignal(&burnLock);
+
     return 0;
 }
 
+// Doesn't wait for the burst to settle, the reset that follows would lose it.
+// Once we hold storageLock the burn thread is not mid write.
+void FlushConfiguration()
+{
+    chBSemWait(&storageLock);
+    WriteBurn(true);
+    chBSemSignal(&storageLock);
+}
+
 uint8_t *GetConfigurationPtr()
 {
     return (uint8_t *)&cfg;
@@ -133,8 +305,27 @@ SensorType GetSensorType()
     return cfg.sensorType;
 }
 
+void PrepareBootloaderEntry()
+{
+    // OpenBLT has its own way in, see rebootToOpenblt
+}
+
+uint16_t GetBootTimeMs()
+{
+    return 0;
+}
+
+uint8_t GetResetCause()
+{
+    // No bootloader of ours to record it, the event log has it
+    return 0;
+}
+
 void rebootNow()
 {
+    // A burn may still be waiting in the queue
+    FlushConfiguration();
+
     NVIC_SystemReset();
 }
 
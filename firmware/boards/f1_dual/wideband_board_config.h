@@ -1,7 +1,7 @@
 #pragma once
 
 // TS settings
-#define TS_SIGNATURE "rusEFI 2023.05.10.wideband_dual"
+#define TS_SIGNATURE "rusEFI 2026.10.19.wideband_dual"
 
 // This board implements two channels
 #define AFR_CHANNELS 2
@@ -63,10 +63,16 @@
 #define TS_PRIMARY_BAUDRATE		115200
 
 // *******************************
-//   MAX31855 spi port
+//   MAX3185x chips
 // *******************************
 #define EGT_SPI_DRIVER			(&SPID1)
 
+// One line per EGT channel: SPI driver, chip select port and pin.
+// Chips may share a bus or sit on different ones.
+#define EGT_CHIPS \
+	{ EGT_SPI_DRIVER, EGT_CS0_PORT, EGT_CS0_PIN }, \
+	{ EGT_SPI_DRIVER, EGT_CS1_PORT, EGT_CS1_PIN },
+
 // Serial connection over BT module
 // enable BT module setup attempt
 #define BT_SERIAL_OVER_JDY33	TRUE
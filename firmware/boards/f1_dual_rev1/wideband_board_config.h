@@ -1,7 +1,7 @@
 #pragma once
 
 // TS settings
-#define TS_SIGNATURE "rusEFI 2023.05.10.wideband_dual"
+#define TS_SIGNATURE "rusEFI 2026.10.19.wideband_dual"
 
 // This board implements two channels
 #define AFR_CHANNELS 2
@@ -64,34 +64,47 @@
 
 // *******************************
 //   TunerStudio Primary Port - Routed to BlueTooth
+//   UART driver with DMA, see UartDmaTsChannel
 // *******************************
-#define TS_PRIMARY_SERIAL_PORT	SD3
+#define TS_PRIMARY_UART_PORT	UARTD3
 #define TS_PRIMARY_BAUDRATE		115200
 
 #if 1
 // *******************************
 //   TunerStudio Secondary Port - J3 connector (2x2)
 // *******************************
-#define TS_SECONDARY_SERIAL_PORT	SD1
+#define TS_SECONDARY_UART_PORT		UARTD1
 #define TS_SECONDARY_BAUDRATE		115200
 #else
 // *******************************
 //   Debug serial device
+//   needs HAL_USE_SERIAL and STM32_SERIAL_USE_USART1 instead of STM32_UART_USE_USART1
 // *******************************
 #define DEBUG_SERIAL_PORT			SD1
 #define DEBUG_SERIAL_BAUDRATE		115200
 #endif
 
 // *******************************
-//   MAX31855 spi port
+//   MAX3185x chips
 // *******************************
 #define EGT_SPI_DRIVER			(&SPID3)
 
+// One line per EGT channel: SPI driver, chip select port and pin.
+// Chips may share a bus or sit on different ones.
+#define EGT_CHIPS \
+	{ EGT_SPI_DRIVER, EGT_CS0_PORT, EGT_CS0_PIN }, \
+	{ EGT_SPI_DRIVER, EGT_CS1_PORT, EGT_CS1_PIN },
+
 // Serial connection over BT module
 // enable BT module setup attempt
 #define BT_SERIAL_OVER_JDY33	TRUE
 #define BT_BROADCAST_NAME		"RusEFI WBO x2"
 
+// *******************************
+//   TunerStudio over CAN, see CanTsChannel
+// *******************************
+#define EFI_CAN_SERIAL			TRUE
+
 // *******************************
 //   Indication: per channel status LED + communication LED
 // *******************************
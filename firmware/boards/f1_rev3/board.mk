@@ -1,5 +1,7 @@
 USE_BOOTLOADER = no
 ENABLE_TS = yes
+ENABLE_EVENT_LOG = yes
+ENABLE_DIAG_STREAM = yes
 
 MCU = cortex-m3
 
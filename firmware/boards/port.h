@@ -71,6 +71,16 @@ public:
             AuxOutputMode auxOutputSource[2];
 
             SensorType sensorType;
+
+            // Bitmask of CAN formats sent in addition to rusEFI, see CanProtocolId
+            uint8_t extraCanFormats;
+
+            // Period of the CAN statistics frame in 100ms units, 0 is off
+            uint8_t canStatsPeriod;
+
+            // MAX31856 EGT conversion settings, Max31856Averaging and Max31856Notch
+            uint8_t egtAveraging;
+            uint8_t egtNotch;
         } __attribute__((packed));
 
         // pad to 256 bytes including tag
@@ -86,11 +96,20 @@ void SetConfiguration();
 uint8_t *GetConfigurationPtr();
 size_t GetConfigurationSize();
 int SaveConfiguration();
+// Write a queued burn now, call before resetting the chip
+void FlushConfiguration();
 const char *getTsSignature();
 
 void rebootNow();
 void rebootToOpenblt();
 
+// Make the bootloader stay in bootloader mode after the next reset
+void PrepareBootloaderEntry();
+// How long the bootloader took to start the app, in ms, 0 if unknown
+uint16_t GetBootTimeMs();
+// RCC_CSR bits 24-31 as the bootloader found them, 0 if unknown
+uint8_t GetResetCause();
+
 // LSU4.2, LSU4.9 or LSU_ADV
 SensorType GetSensorType();
 void SetupESRDriver(SensorType sensor);
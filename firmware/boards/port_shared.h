@@ -6,4 +6,25 @@
 
 const CANConfig& GetCanConfig();
 
+// CAN index set by the ID select pins, -1 if the pins are left floating
+int GetStrappedCanIndex();
+
+// RTC backup registers keep their value across a warm reset (not a power cycle),
+// the app and bootloader use them to pass a few words to each other
+enum class BackupRegister : uint8_t
+{
+    // Token of the last app image that passed the CRC check, see GetImageToken
+    ValidatedImage = 0,
+    // Set by the app before resetting, so the bootloader stays without waiting for a command
+    StayInBootloader = 1,
+    // Time the bootloader took from reset to starting the app, in ms
+    BootTime = 2,
+    // Why the chip last reset, RCC_CSR bits 24-31. The bootloader reads and clears the flags,
+    // so later resets are told apart.
+    ResetCause = 3,
+};
+
+uint32_t ReadBackupRegister(BackupRegister reg);
+void WriteBackupRegister(BackupRegister reg, uint32_t value);
+
 #endif // WB_PROD
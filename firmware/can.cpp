@@ -4,12 +4,18 @@
 
 #include "status.h"
 #include "can_helper.h"
+#include "can_encoder.h"
+#include "can_stats.h"
+#include "cylinder_lambda.h"
+#include "diag_stream.h"
+#include "event_log.h"
 #include "heater_control.h"
 #include "lambda_conversion.h"
 #include "sampling.h"
 #include "pump_dac.h"
 #include "port.h"
 #include "pump_control.h"
+#include "time_sync.h"
 #include "wideband_config.h"
 
 #include <rusefi/math.h>
@@ -19,21 +25,77 @@
 
 static Configuration* configuration;
 
+static void UpdateCanErrorState()
+{
+#ifdef STM32G4XX
+    uint32_t psr = CAND1.fdcan->PSR;
+    uint32_t ecr = CAND1.fdcan->ECR;
+
+    GetCanStats().OnErrorState(
+        psr & FDCAN_PSR_BO,
+        psr & FDCAN_PSR_EP,
+        (ecr & FDCAN_ECR_TEC) >> FDCAN_ECR_TEC_Pos,
+        (ecr & FDCAN_ECR_REC) >> FDCAN_ECR_REC_Pos);
+#else
+    uint32_t esr = CAND1.can->ESR;
+
+    GetCanStats().OnErrorState(
+        esr & CAN_ESR_BOFF,
+        esr & CAN_ESR_EPVF,
+        (esr & CAN_ESR_TEC) >> CAN_ESR_TEC_Pos,
+        (esr & CAN_ESR_REC) >> CAN_ESR_REC_Pos);
+#endif
+}
+
 static THD_WORKING_AREA(waCanTxThread, 512);
 void CanTxThread(void*)
 {
     chRegSetThreadName("CAN Tx");
 
+    SendBootInfo();
+
     // Current system time.
     systime_t prev = chVTGetSystemTime();
 
+    uint8_t cylinderDivider = 0;
+    uint8_t statsDivider = 0;
+    uint16_t statsTxDivider = 0;
+
     while (1)
     {
+        // Bus off recovery is automatic (ABOM), so poll often to catch it
+        UpdateCanErrorState();
+
         for (int ch = 0; ch < AFR_CHANNELS; ch++)
         {
             SendCanForChannel(ch);
         }
 
+        // Per cylinder averages change slowly, no need to send them every time
+        if (++cylinderDivider >= CYL_LAMBDA_TX_DIVIDER)
+        {
+            cylinderDivider = 0;
+
+            for (int ch = 0; ch < AFR_CHANNELS; ch++)
+            {
+                SendCylinderLambda(ch);
+            }
+        }
+
+        if (++statsDivider >= CAN_STATS_WINDOW_DIVIDER)
+        {
+            statsDivider = 0;
+            GetCanStats().UpdateWindow(CAN_STATS_WINDOW_DIVIDER * WBO_TX_PERIOD_MS / 1000.0f);
+        }
+
+        // Stats period is in units of 100ms, 0 is off
+        uint8_t statsPeriod = configuration->canStatsPeriod;
+        if (statsPeriod != 0 && ++statsTxDivider >= statsPeriod * (100 / WBO_TX_PERIOD_MS))
+        {
+            statsTxDivider = 0;
+            SendCanStats();
+        }
+
         prev = chThdSleepUntilWindowed(prev, chTimeAddX(prev, TIME_MS2I(WBO_TX_PERIOD_MS)));
     }
 }
@@ -53,7 +115,50 @@ static void SendAck()
     frame.DLC = 0;
 
     canTransmitTimeout(&CAND1, CAN_ANY_MAILBOX, &frame, TIME_INFINITE);
+    GetCanStats().OnTx(WB_ACK, true, 0, true);
+}
+
+#ifdef EVENT_LOG_ENABLED
+static void SendEventLogStatus(uint16_t first, uint8_t sent)
+{
+    CanTxTyped<wbo::EventLogStatusData> frame(WB_MSG_EVENT_LOG_STATUS(configuration->CanIndexOffset), true);
+
+    frame.get().Count = GetEventLogCount();
+    frame.get().First = first;
+    frame.get().Sent = sent;
+    frame.get().pad = 0;
+    frame.get().Boot = GetEventLogBoot();
+}
+
+static void SendEventLog(uint16_t first, uint8_t count)
+{
+    EventLogEntry entries[WB_EVENT_LOG_MAX_READ];
+
+    if (count > WB_EVENT_LOG_MAX_READ)
+    {
+        count = WB_EVENT_LOG_MAX_READ;
+    }
+
+    size_t read = ReadEventLog(first, entries, count);
+
+    for (size_t i = 0; i < read; i++)
+    {
+        const uint8_t* entry = reinterpret_cast<const uint8_t*>(&entries[i]);
+
+        for (size_t half = 0; half < 2; half++)
+        {
+            CanTxMessage frame(WB_MSG_EVENT_LOG_DATA(i * 2 + half, configuration->CanIndexOffset), 8, true);
+
+            for (size_t b = 0; b < 8; b++)
+            {
+                frame[b] = entry[half * 8 + b];
+            }
+        }
+    }
+
+    SendEventLogStatus(first, read);
 }
+#endif
 
 // Start in Unknown state. If no CAN message is ever received, we operate
 // on internal battery sense etc.
@@ -70,20 +175,23 @@ void CanRxThread(void*)
         CANRxFrame frame;
         msg_t msg = canReceiveTimeout(&CAND1, CAN_ANY_MAILBOX, &frame, TIME_INFINITE);
 
+        // Grab the arrival time before doing anything else, any latency here
+        // shows up as error in the time sync. This still includes the wakeup
+        // of this thread after the RX interrupt, the LLD doesn't timestamp frames.
+        uint32_t rxTimeUs = GetLocalTimeUs();
+
         // Ignore non-ok results...
         if (msg != MSG_OK)
         {
             continue;
         }
 
-        // Ignore std frames, only listen to ext
-        if (!CAN_EXT(frame))
-        {
-            continue;
-        }
+        // Only listen to ext frames with our header, ignore everything else
+        bool ours = CAN_EXT(frame) && WB_MSG_GET_HEADER(CAN_ID(frame)) == WB_BL_HEADER;
 
-        // Ignore not ours frames
-        if (WB_MSG_GET_HEADER(CAN_ID(frame)) != WB_BL_HEADER)
+        GetCanStats().OnRx(CAN_EXT(frame), frame.DLC, ours);
+
+        if (!ours)
         {
             continue;
         }
@@ -125,6 +233,44 @@ void CanRxThread(void*)
                 SetPumpGainAdjust(clampF(0, pumpGain, 1));
             }
         }
+        else if (frame.DLC >= 4 && CAN_ID(frame) == WB_MSG_TIME_SYNC)
+        {
+            uint32_t masterUs =
+                frame.data8[0] |
+                (frame.data8[1] << 8) |
+                (frame.data8[2] << 16) |
+                (frame.data8[3] << 24);
+
+            GetTimeSync().OnSync(masterUs, rxTimeUs);
+        }
+        else if (frame.DLC >= 2 && CAN_ID(frame) == WB_MSG_ENGINE_EVENT)
+        {
+            PostEngineEvent(frame.data8[0], frame.data8[1]);
+        }
+#ifdef DIAG_STREAM_ENABLED
+        else if (frame.DLC >= 2 && CAN_ID(frame) == WB_MSG_DIAG_STREAM)
+        {
+            uint8_t ch = frame.data8[0] - configuration->CanIndexOffset;
+            SetDiagStream(ch, frame.data8[1]);
+        }
+#endif
+#ifdef EVENT_LOG_ENABLED
+        else if (frame.DLC >= 3 && CAN_ID(frame) == WB_MSG_EVENT_LOG_READ(configuration->CanIndexOffset))
+        {
+            SendEventLog(frame.data8[0] | (frame.data8[1] << 8), frame.data8[2]);
+        }
+        else if (CAN_ID(frame) == WB_MSG_EVENT_LOG_CLEAR(configuration->CanIndexOffset))
+        {
+            ClearEventLog();
+            SendEventLogStatus(0, 0);
+        }
+#endif
+#if defined(TS_ENABLED) && defined(EFI_CAN_SERIAL)
+        else if (CAN_ID(frame) == WB_MSG_TS_RX(configuration->CanIndexOffset))
+        {
+            CanTsOnFrame(frame.data8, frame.DLC);
+        }
+#endif
         // If it's a bootloader entry request, reboot to the bootloader!
         // DLC=1 required: data[0] is 0xFF (all) or a specific controller index.
         // DLC=0 is ignored so that only the targeted controller enters bootloader
@@ -138,6 +284,8 @@ void CanRxThread(void*)
                 // Let the message get out before we reset the chip
                 chThdSleep(50);
 
+                FlushConfiguration();
+                PrepareBootloaderEntry();
                 NVIC_SystemReset();
             }
         }
@@ -169,50 +317,132 @@ void InitCan()
     canStart(&CAND1, &GetCanConfig());
     chThdCreateStatic(waCanTxThread, sizeof(waCanTxThread), NORMALPRIO, CanTxThread, nullptr);
     chThdCreateStatic(waCanRxThread, sizeof(waCanRxThread), NORMALPRIO - 4, CanRxThread, nullptr);
+
+#ifdef DIAG_STREAM_ENABLED
+    InitDiagStream();
+#endif
 }
 
-void SendRusefiFormat(uint8_t ch)
+static CanSnapshot GetCanSnapshot(uint8_t ch)
 {
-    auto baseAddress = WB_DATA_BASE_ADDR + 2 * (ch + configuration->CanIndexOffset);
-
     const auto& sampler = GetSampler(ch);
     const auto& heater = GetHeaterController(ch);
 
     auto nernstDc = sampler.GetNernstDc();
-    auto pumpDuty = GetPumpOutputDuty(ch);
     auto lambda = GetLambda(ch);
+    auto status = GetCurrentStatus(ch);
 
     // Lambda is valid if:
     // 1. Nernst voltage is near target
     // 2. Lambda is >0.6 (sensor isn't specified below that)
     bool lambdaValid = nernstDc > (NERNST_TARGET - 0.1f) && nernstDc < (NERNST_TARGET + 0.1f) && lambda > 0.6f;
 
+    CanSnapshot snapshot;
+
+    snapshot[CanSource::Lambda] = lambdaValid ? lambda : 0;
+    snapshot[CanSource::LambdaValid] = lambdaValid;
+    snapshot[CanSource::Valid] = heater.IsRunningClosedLoop() && lambdaValid;
+    snapshot[CanSource::TemperatureC] = sampler.GetSensorTemperature();
+    snapshot[CanSource::SampleTime] = static_cast<uint16_t>(GetTimeSync().ToMaster(GetLastSampleTimeUs()) / 10);
+    snapshot[CanSource::Esr] = sampler.GetSensorInternalResistance();
+    snapshot[CanSource::NernstDc] = nernstDc;
+    snapshot[CanSource::PumpDuty] = GetPumpOutputDuty(ch);
+    snapshot[CanSource::HeaterDuty] = GetHeaterDuty(ch);
+    snapshot[CanSource::Status] = static_cast<uint8_t>(status);
+    snapshot[CanSource::Fault] = wbo::isStatusError(status);
+    snapshot[CanSource::SupplyVoltage] = sampler.GetInternalHeaterVoltage();
+
+    return snapshot;
+}
+
+static void SendCanProtocol(CanProtocolId id, uint8_t ch, const CanSnapshot& snapshot)
+{
+    const auto& protocol = GetCanProtocol(id);
+
+    for (size_t i = 0; i < protocol.frameCount; i++)
     {
-        CanTxTyped<wbo::StandardData> frame(baseAddress + 0);
+        const auto& format = protocol.frames[i];
+
+        CanTxMessage frame(GetCanFrameId(format, ch + configuration->CanIndexOffset), format.dlc, format.extended);
+        EncodeCanFrame(format, snapshot, &frame[0]);
+    }
+}
+
+void SendRusefiFormat(uint8_t ch)
+{
+    SendCanProtocol(CanProtocolId::RusEfi, ch, GetCanSnapshot(ch));
+}
 
-        // The same header is imported by the ECU and checked against this data in the frame
-        frame.get().Version = RUSEFI_WIDEBAND_VERSION;
+void SendCylinderLambda(uint8_t ch)
+{
+    CylinderLambdaResult cyl;
+    GetCylinderLambda(ch).GetResult(cyl);
 
-        uint16_t lambdaInt = lambdaValid ? (lambda * 10000) : 0;
-        frame.get().Lambda = lambdaInt;
-        frame.get().TemperatureC = sampler.GetSensorTemperature();
-        bool heaterClosedLoop = heater.IsRunningClosedLoop();
-        frame.get().Valid = (heaterClosedLoop && lambdaValid) ? 0x01 : 0x00;
+    if (!cyl.IsActive())
+    {
+        return;
     }
 
+    uint8_t cylinderCount = cyl.cylinderCount;
+
+    for (uint8_t group = 0; group * 4 < cylinderCount; group++)
     {
-        CanTxTyped<wbo::DiagData> frame(baseAddress + 1);
+        CanTxTyped<wbo::CylinderLambdaData> frame(
+            WB_MSG_TELEMETRY(WB_TELEMETRY_CYL_LAMBDA + group, ch + configuration->CanIndexOffset),
+            true);
 
-        frame.get().Esr = sampler.GetSensorInternalResistance();
-        frame.get().NernstDc = nernstDc * 1000;
-        frame.get().PumpDuty = pumpDuty * 255;
-        frame.get().status = GetCurrentStatus(ch);
-        frame.get().HeaterDuty = GetHeaterDuty(ch) * 255;
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            float pumpCurrent;
+
+            if (cyl.GetAveragePumpCurrent(group * 4 + i, pumpCurrent))
+            {
+                frame.get().Lambda[i] = GetLambdaForPumpCurrent(pumpCurrent) * 10000;
+            }
+            else
+            {
+                frame.get().Lambda[i] = 0;
+            }
+        }
     }
 }
 
+void SendCanStats()
+{
+    const auto& stats = GetCanStats();
+
+    CanTxTyped<wbo::CanStatsData> frame(WB_MSG_TELEMETRY(WB_TELEMETRY_CAN_STATS, configuration->CanIndexOffset), true);
+
+    frame.get().BusLoadOwn = clampF(0, stats.busLoadOwn * 2, 255);
+    frame.get().BusLoadTotal = clampF(0, stats.busLoadTotal * 2, 255);
+    frame.get().TxTimeouts = stats.txTimeouts > UINT16_MAX ? UINT16_MAX : stats.txTimeouts;
+    frame.get().TxErrors = stats.txErrors;
+    frame.get().RxErrors = stats.rxErrors;
+    frame.get().Flags = (stats.busOff ? 0x01 : 0) | (stats.errorPassive ? 0x02 : 0);
+    frame.get().BusOffCount = stats.busOffCount;
+}
+
+void SendBootInfo()
+{
+    CanTxTyped<wbo::BootInfoData> frame(WB_MSG_TELEMETRY(WB_TELEMETRY_BOOT_INFO, configuration->CanIndexOffset), true);
+
+    frame.get().BootTimeMs = GetBootTimeMs();
+    frame.get().ResetCause = GetResetCause();
+}
+
 // Weak link so boards can override it
 __attribute__((weak)) void SendCanForChannel(uint8_t ch)
 {
-    SendRusefiFormat(ch);
+    // Gather once, encode for every enabled format
+    auto snapshot = GetCanSnapshot(ch);
+
+    SendCanProtocol(CanProtocolId::RusEfi, ch, snapshot);
+
+    for (size_t id = 1; id < static_cast<size_t>(CanProtocolId::Count); id++)
+    {
+        if (configuration->extraCanFormats & (1 << (id - 1)))
+        {
+            SendCanProtocol(static_cast<CanProtocolId>(id), ch, snapshot);
+        }
+    }
 }
@@ -5,6 +5,20 @@
 void InitCan();
 void SendCanData(float lambda, uint16_t measuredResistance);
 void SendRusefiFormat(uint8_t ch);
+// Per cylinder lambda, only sent while the ECU is sending engine events
+void SendCylinderLambda(uint8_t ch);
+
+// Send per cylinder lambda every Nth transmit period
+#define CYL_LAMBDA_TX_DIVIDER 10
+
+// Bus statistics, only sent if enabled in the configuration
+void SendCanStats();
+
+// Startup information, sent once
+void SendBootInfo();
+
+// Compute bus load and rates over this many transmit periods
+#define CAN_STATS_WINDOW_DIVIDER 100
 
 enum class HeaterAllow
 {
@@ -20,6 +34,9 @@ enum class HeaterAllow
 
 HeaterAllow GetHeaterAllowed();
 
+// TunerStudio over CAN (EFI_CAN_SERIAL), takes every WB_MSG_TS_RX frame for this controller
+void CanTsOnFrame(const uint8_t* data, uint8_t dlc);
+
 float GetRemoteBatteryVoltage();
 
 // implement this for your board if you want some non-standard behavior
@@ -0,0 +1,148 @@
+#include "can_encoder.h"
+
+#include "../for_rusefi/wideband_can.h"
+
+#include <rusefi/arrays.h>
+
+// *******************************
+//    rusEFI
+//    See wbo::StandardData and wbo::DiagData
+// *******************************
+static constexpr CanSignal rusefiStandardSignals[] = {
+    CanSignal::Constant(RUSEFI_WIDEBAND_VERSION, 0, 8),
+    {CanSource::Valid, 8, 8},
+    {CanSource::Lambda, 16, 16, 0.0001},
+    {CanSource::TemperatureC, 32, 16},
+    {CanSource::SampleTime, 48, 16},
+};
+
+static constexpr CanSignal rusefiDiagSignals[] = {
+    {CanSource::Esr, 0, 16},
+    {CanSource::NernstDc, 16, 16, 0.001},
+    {CanSource::PumpDuty, 32, 8, 1 / 255.0},
+    {CanSource::Status, 40, 8},
+    {CanSource::HeaterDuty, 48, 8, 1 / 255.0},
+};
+
+static constexpr CanFrameFormat rusefiFrames[] = {
+    {WB_DATA_BASE_ADDR + 0, 2, false, 8, rusefiStandardSignals, efi::size(rusefiStandardSignals)},
+    {WB_DATA_BASE_ADDR + 1, 2, false, 8, rusefiDiagSignals, efi::size(rusefiDiagSignals)},
+};
+
+// *******************************
+//    AEM X-series UEGO style
+//    Extended ID 0x180 + index, big endian
+// *******************************
+static constexpr CanSignal aemSignals[] = {
+    // byte 0-1: lambda, 0.0001/bit
+    {CanSource::Lambda, 7, 16, 0.0001, 0, true},
+    // byte 4: supply voltage, 0.1V/bit
+    {CanSource::SupplyVoltage, 39, 8, 0.1, 0, true},
+    // byte 6 bit 7: lambda valid
+    {CanSource::Valid, 55, 1, 1, 0, true},
+    // byte 7 bit 6: sensor fault
+    {CanSource::Fault, 62, 1, 1, 0, true},
+};
+
+static constexpr CanFrameFormat aemFrames[] = {
+    {0x180, 1, true, 8, aemSignals, efi::size(aemSignals)},
+};
+
+static constexpr CanProtocol protocols[] = {
+    {"rusEFI", rusefiFrames, efi::size(rusefiFrames)},
+    {"AEM X-series", aemFrames, efi::size(aemFrames)},
+};
+
+static_assert(efi::size(protocols) == static_cast<size_t>(CanProtocolId::Count));
+
+const CanProtocol& GetCanProtocol(CanProtocolId id)
+{
+    return protocols[static_cast<size_t>(id)];
+}
+
+uint32_t GetCanFrameId(const CanFrameFormat& format, uint8_t index)
+{
+    return format.baseId + format.idStride * index;
+}
+
+static uint32_t ToRaw(const CanSignal& signal, float value)
+{
+    float raw = (value - signal.offset) * signal.invScale;
+
+    if (raw > signal.rawMax)
+    {
+        raw = signal.rawMax;
+    }
+    else if (raw < signal.rawMin)
+    {
+        raw = signal.rawMin;
+    }
+
+    // Truncate like a plain integer conversion, negative values end up two's complement
+    return static_cast<uint32_t>(static_cast<int64_t>(raw));
+}
+
+static void PackSignal(const CanSignal& signal, uint32_t raw, uint8_t* data)
+{
+    if (signal.byteCount)
+    {
+        for (uint8_t i = 0; i < signal.byteCount; i++)
+        {
+            uint8_t shift = signal.bigEndian ? 8 * (signal.byteCount - 1 - i) : 8 * i;
+            data[signal.firstByte + i] = raw >> shift;
+        }
+
+        return;
+    }
+
+    if (!signal.bigEndian)
+    {
+        // Intel: start bit is the LSB, bits go up from there
+        for (uint8_t i = 0; i < signal.length; i++)
+        {
+            uint8_t pos = signal.startBit + i;
+
+            if (raw & (1u << i))
+            {
+                data[pos / 8] |= 1 << (pos % 8);
+            }
+        }
+    }
+    else
+    {
+        // Motorola: start bit is the MSB, bits go down within a byte, then on to the next byte
+        uint8_t pos = signal.startBit;
+
+        for (int i = signal.length - 1; i >= 0; i--)
+        {
+            if (raw & (1u << i))
+            {
+                data[pos / 8] |= 1 << (pos % 8);
+            }
+
+            if (pos % 8 == 0)
+            {
+                pos += 15;
+            }
+            else
+            {
+                pos--;
+            }
+        }
+    }
+}
+
+void EncodeCanFrame(const CanFrameFormat& format, const CanSnapshot& snapshot, uint8_t* data)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        data[i] = 0;
+    }
+
+    for (size_t i = 0; i < format.signalCount; i++)
+    {
+        const auto& signal = format.signals[i];
+
+        PackSignal(signal, ToRaw(signal, snapshot[signal.source]), data);
+    }
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Everything any CAN format might want to send about one channel,
+// gathered once per transmit period and shared by all enabled formats
+enum class CanSource : uint8_t
+{
+    // Always 0, used for constants
+    Zero,
+    // Lambda, 0 when not valid
+    Lambda,
+    // 1 when lambda is valid
+    LambdaValid,
+    // 1 when lambda is valid and the heater is in closed loop
+    Valid,
+    TemperatureC,
+    // Sample time in 10us units wrapped to 16 bits, see WB_MSG_TIME_SYNC
+    SampleTime,
+    Esr,
+    // Volts
+    NernstDc,
+    // 0-1
+    PumpDuty,
+    HeaterDuty,
+    // wbo::Status
+    Status,
+    // 1 when wbo::Status is an error
+    Fault,
+    // Volts
+    SupplyVoltage,
+
+    Count,
+};
+
+struct CanSnapshot
+{
+    float values[static_cast<size_t>(CanSource::Count)] = {};
+
+    float& operator[](CanSource s)
+    {
+        return values[static_cast<size_t>(s)];
+    }
+
+    float operator[](CanSource s) const
+    {
+        return values[static_cast<size_t>(s)];
+    }
+};
+
+/**
+ * One signal in a frame, described the same way as in a DBC file:
+ * physical = raw * scale + offset, start bit in DBC numbering (LSB for little endian, MSB for big endian).
+ * Values outside of what fits in the signal are clamped.
+ *
+ * Everything that only depends on the layout (reciprocal scale, raw range, byte placement) is
+ * worked out by the constexpr constructor, so with the tables below it costs nothing at run time.
+ * What is left per signal and frame: a multiply-add, a clamp, and one to four byte stores for
+ * signals that are whole bytes on a byte boundary (all rusEFI and AEM values), or a loop over
+ * the bits for anything else (the AEM single bit flags).
+ */
+struct CanSignal
+{
+    // Scale is taken as double so that the reciprocal of things like 0.001 comes out as exactly 1000
+    constexpr CanSignal(CanSource source, uint8_t startBit, uint8_t length, double scale = 1, float offset = 0,
+                        bool bigEndian = false, bool isSigned = false)
+        : source(source)
+        , startBit(startBit)
+        , length(length)
+        , bigEndian(bigEndian)
+        , isSigned(isSigned)
+        , firstByte(startBit / 8)
+        , byteCount(IsByteAligned(startBit, length, bigEndian) ? length / 8 : 0)
+        , invScale(1 / scale)
+        , offset(offset)
+        , rawMin(isSigned ? -static_cast<float>(1u << (length - 1)) : 0)
+        , rawMax(isSigned ? static_cast<float>((1u << (length - 1)) - 1)
+                          : (length >= 32 ? static_cast<float>(UINT32_MAX) : static_cast<float>((1u << length) - 1)))
+    {
+    }
+
+    static constexpr bool IsByteAligned(uint8_t startBit, uint8_t length, bool bigEndian)
+    {
+        // Motorola start bit is the MSB, so the top bit of its first byte
+        return length % 8 == 0 && length <= 32 && startBit % 8 == (bigEndian ? 7 : 0);
+    }
+
+    // A fixed raw value
+    static constexpr CanSignal Constant(uint32_t value, uint8_t startBit, uint8_t length)
+    {
+        return CanSignal(CanSource::Zero, startBit, length, 1, -static_cast<float>(value));
+    }
+
+    CanSource source;
+    uint8_t startBit;
+    uint8_t length;
+    bool bigEndian;
+    bool isSigned;
+
+    // Byte aligned signals are written a byte at a time, starting at firstByte: LSB first for
+    // little endian, MSB first for big endian. 0 for signals that have to go bit by bit.
+    uint8_t firstByte;
+    uint8_t byteCount;
+
+    // Store the reciprocal so encoding is a multiply
+    float invScale;
+    float offset;
+
+    // Range of the raw value
+    float rawMin;
+    float rawMax;
+};
+
+struct CanFrameFormat
+{
+    // ID of the first channel, each following channel (and CAN index offset) adds idStride
+    uint32_t baseId;
+    uint8_t idStride;
+    bool extended;
+    uint8_t dlc;
+
+    const CanSignal* signals;
+    uint8_t signalCount;
+};
+
+struct CanProtocol
+{
+    const char* name;
+    const CanFrameFormat* frames;
+    uint8_t frameCount;
+};
+
+enum class CanProtocolId : uint8_t
+{
+    // Always sent
+    RusEfi,
+
+    // Optional, enabled by bit (id - 1) of Configuration::extraCanFormats
+    AemXSeries,
+
+    Count,
+};
+
+const CanProtocol& GetCanProtocol(CanProtocolId id);
+
+void EncodeCanFrame(const CanFrameFormat& format, const CanSnapshot& snapshot, uint8_t* data);
+
+uint32_t GetCanFrameId(const CanFrameFormat& format, uint8_t index);
@@ -3,6 +3,7 @@
 #include <cstring>
 
 #include "can.h"
+#include "can_stats.h"
 
 CanTxMessage::CanTxMessage(uint32_t eid, uint8_t dlc, bool isExtended)
 {
@@ -30,7 +31,9 @@ CanTxMessage::CanTxMessage(uint32_t eid, uint8_t dlc, bool isExtended)
 CanTxMessage::~CanTxMessage()
 {
     // 100 ms timeout
-    canTransmitTimeout(&CAND1, CAN_ANY_MAILBOX, &m_frame, TIME_MS2I(100));
+    msg_t msg = canTransmitTimeout(&CAND1, CAN_ANY_MAILBOX, &m_frame, TIME_MS2I(100));
+
+    GetCanStats().OnTx(CAN_ID(m_frame), CAN_EXT(m_frame), m_frame.DLC, msg == MSG_OK);
 }
 
 uint8_t& CanTxMessage::operator[](size_t index)
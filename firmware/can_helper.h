@@ -46,8 +46,8 @@ template <typename TData> class CanTxTyped final : public CanTxMessage
     static_assert(sizeof(TData) <= sizeof(CANTxFrame::data8));
 
 public:
-    explicit CanTxTyped(uint32_t eid)
-        : CanTxMessage(eid)
+    explicit CanTxTyped(uint32_t eid, bool isExtended = false)
+        : CanTxMessage(eid, 8, isExtended)
     {
     }
 
@@ -0,0 +1,106 @@
+#include "can_stats.h"
+
+#include "../for_rusefi/wideband_can.h"
+
+static CanStats canStats;
+
+CanStats& GetCanStats()
+{
+    return canStats;
+}
+
+CanTxClass ClassifyCanTx(uint32_t id, bool extended)
+{
+    if (!extended)
+    {
+        // rusEFI data frames are the only standard IDs we send by default
+        return (id >= WB_DATA_BASE_ADDR && id < WB_DATA_BASE_ADDR + 0x20) ? CanTxClass::Data : CanTxClass::ExtraFormat;
+    }
+
+    if (WB_MSG_GET_HEADER(id) != WB_BL_HEADER)
+    {
+        return id == WB_ACK ? CanTxClass::Protocol : CanTxClass::ExtraFormat;
+    }
+
+    return WB_MSG_GET_OPCODE(id) == WB_OPCODE_TELEMETRY ? CanTxClass::Telemetry : CanTxClass::Protocol;
+}
+
+uint32_t GetCanFrameBits(bool extended, uint8_t dlc)
+{
+    // SOF, arbitration, control, data, CRC: the part subject to bit stuffing
+    uint32_t stuffed = (extended ? 54 : 34) + 8 * dlc;
+
+    // CRC delimiter, ACK, EOF, interframe space
+    uint32_t fixed = 13;
+
+    // Worst case is one stuff bit per 4, typical traffic is closer to one per 5
+    return stuffed + stuffed / 5 + fixed;
+}
+
+void CanStats::OnTx(uint32_t id, bool extended, uint8_t dlc, bool success)
+{
+    if (!success)
+    {
+        txTimeouts++;
+        return;
+    }
+
+    txFrames++;
+    m_windowTxFrames[static_cast<uint8_t>(ClassifyCanTx(id, extended))]++;
+    m_windowTxBits += GetCanFrameBits(extended, dlc);
+}
+
+void CanStats::OnRx(bool extended, uint8_t dlc, bool accepted)
+{
+    if (accepted)
+    {
+        rxAccepted++;
+    }
+    else
+    {
+        rxFiltered++;
+    }
+
+    m_windowRxBits += GetCanFrameBits(extended, dlc);
+}
+
+void CanStats::OnErrorState(bool newBusOff, bool newErrorPassive, uint8_t newTxErrors, uint8_t newRxErrors)
+{
+    if (newBusOff && !busOff && busOffCount < UINT8_MAX)
+    {
+        busOffCount++;
+    }
+
+    if (newErrorPassive && !errorPassive && errorPassiveCount < UINT8_MAX)
+    {
+        errorPassiveCount++;
+    }
+
+    busOff = newBusOff;
+    errorPassive = newErrorPassive;
+    txErrors = newTxErrors;
+    rxErrors = newRxErrors;
+}
+
+void CanStats::UpdateWindow(float elapsedSeconds)
+{
+    if (elapsedSeconds <= 0)
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(CanTxClass::Count); i++)
+    {
+        float rate = m_windowTxFrames[i] / elapsedSeconds;
+        txRate[i] = rate > UINT16_MAX ? UINT16_MAX : rate;
+        m_windowTxFrames[i] = 0;
+    }
+
+    float capacity = CAN_STATS_BITRATE * elapsedSeconds;
+
+    busLoadOwn = 100 * m_windowTxBits / capacity;
+    busLoadTotal = 100 * (m_windowTxBits + m_windowRxBits) / capacity;
+
+    m_windowTxBits = 0;
+    m_windowRxBits = 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+
+// All boards run the bus at 500kbit, see canConfig500
+#define CAN_STATS_BITRATE 500000
+
+enum class CanTxClass : uint8_t
+{
+    // rusEFI StandardData/DiagData
+    Data,
+    // Additional formats enabled in the configuration
+    ExtraFormat,
+    // WB_MSG_TELEMETRY frames: per cylinder lambda, diag stream, stats...
+    Telemetry,
+    // Acks and anything else
+    Protocol,
+
+    Count,
+};
+
+CanTxClass ClassifyCanTx(uint32_t id, bool extended);
+
+// Approximate number of bits a frame occupies on the wire, including typical bit stuffing and interframe space
+uint32_t GetCanFrameBits(bool extended, uint8_t dlc);
+
+/**
+ * Counts what the controller sends and receives, and estimates bus load.
+ *
+ * Counters are updated from several threads without locking, under heavy
+ * contention an increment may occasionally be lost. That's fine for statistics.
+ */
+class CanStats
+{
+public:
+    void OnTx(uint32_t id, bool extended, uint8_t dlc, bool success);
+    void OnRx(bool extended, uint8_t dlc, bool accepted);
+
+    // Feed the controller error state, edges into bus off and error passive are counted
+    void OnErrorState(bool busOff, bool errorPassive, uint8_t txErrors, uint8_t rxErrors);
+
+    // Close the current measurement window and compute rates and bus load over it
+    void UpdateWindow(float elapsedSeconds);
+
+    // Totals
+    uint32_t txFrames = 0;
+    uint32_t txTimeouts = 0;
+    uint32_t rxAccepted = 0;
+    uint32_t rxFiltered = 0;
+    uint8_t busOffCount = 0;
+    uint8_t errorPassiveCount = 0;
+
+    // Current error state
+    bool busOff = false;
+    bool errorPassive = false;
+    uint8_t txErrors = 0;
+    uint8_t rxErrors = 0;
+
+    // Computed over the last window
+    uint16_t txRate[static_cast<uint8_t>(CanTxClass::Count)] = {};
+    // Percent of bus capacity used by our own transmits, and by everything we saw
+    float busLoadOwn = 0;
+    float busLoadTotal = 0;
+
+private:
+    uint32_t m_windowTxFrames[static_cast<uint8_t>(CanTxClass::Count)] = {};
+    uint32_t m_windowTxBits = 0;
+    uint32_t m_windowRxBits = 0;
+};
+
+CanStats& GetCanStats();
@@ -0,0 +1,73 @@
+#include "config_burn.h"
+
+static BurnQueue burnQueue;
+
+BurnQueue& GetBurnQueue()
+{
+    return burnQueue;
+}
+
+void BurnQueue::SetStored(uint32_t contentCrc)
+{
+    m_haveStored = true;
+    m_storedCrc = contentCrc;
+}
+
+void BurnQueue::Request()
+{
+    requestCount++;
+
+    m_pending = true;
+    m_sinceRequest.reset();
+
+    // A write already in progress keeps its state, this one goes after it
+    if (m_state != BurnState::Writing)
+    {
+        m_state = BurnState::Pending;
+    }
+}
+
+bool BurnQueue::IsDue() const
+{
+    return m_pending && m_state != BurnState::Writing && m_sinceRequest.hasElapsedMs(BURN_COALESCE_MS);
+}
+
+bool BurnQueue::Begin(uint32_t contentCrc)
+{
+    m_pending = false;
+
+    if (m_haveStored && contentCrc == m_storedCrc)
+    {
+        skipCount++;
+        m_state = BurnState::Idle;
+        return false;
+    }
+
+    m_writingCrc = contentCrc;
+    m_state = BurnState::Writing;
+    return true;
+}
+
+void BurnQueue::End(bool ok)
+{
+    if (ok)
+    {
+        writeCount++;
+        SetStored(m_writingCrc);
+    }
+    else
+    {
+        errorCount++;
+        // Don't know what is in flash now, write whatever comes next
+        m_haveStored = false;
+    }
+
+    if (m_pending)
+    {
+        m_state = BurnState::Pending;
+    }
+    else
+    {
+        m_state = ok ? BurnState::Idle : BurnState::Error;
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+
+#include "timer.h"
+
+// A burn waits until the configuration has been left alone this long, so a burst of burns is one write
+#define BURN_COALESCE_MS 200
+
+enum class BurnState : uint8_t
+{
+    // Nothing to do, flash matches the last burn
+    Idle,
+    // Burn requested, waiting for things to settle
+    Pending,
+    // Flash write in progress
+    Writing,
+    // Last write failed, the next burn retries
+    Error,
+};
+
+/**
+ * Decides when a configuration burn actually writes flash. Burn requests just mark the
+ * configuration dirty and return, a low priority thread does the write later
+ * (see the board's configuration storage). Repeated requests are coalesced,
+ * and a burn that wouldn't change what's in flash is skipped.
+ *
+ * Not thread safe, the caller locks around it.
+ */
+class BurnQueue
+{
+public:
+    // Configuration was loaded from flash, content CRC of what is stored there
+    void SetStored(uint32_t contentCrc);
+
+    void Request();
+
+    // Something was requested and nothing new came in for BURN_COALESCE_MS
+    bool IsDue() const;
+    // Something was requested and not written yet, due or not. Checked before a reset,
+    // which can't wait for the coalesce time.
+    bool HasPending() const
+    {
+        return m_pending;
+    }
+
+    // About to write a snapshot with this content CRC. Returns false if flash already has it,
+    // in which case there is nothing to write.
+    bool Begin(uint32_t contentCrc);
+    void End(bool ok);
+
+    BurnState GetState() const
+    {
+        return m_state;
+    }
+
+    uint16_t requestCount = 0;
+    uint16_t writeCount = 0;
+    uint16_t skipCount = 0;
+    uint16_t errorCount = 0;
+
+private:
+    BurnState m_state = BurnState::Idle;
+    bool m_pending = false;
+    Timer m_sinceRequest;
+
+    bool m_haveStored = false;
+    uint32_t m_storedCrc = 0;
+    uint32_t m_writingCrc = 0;
+};
+
+BurnQueue& GetBurnQueue();
@@ -0,0 +1,193 @@
+#include "config_store.h"
+#include "crc_backend.h"
+
+#include <cstring>
+
+// One MFS record each. Keep in sync with the ini, and see the schema rules in config_store.h.
+static const ConfigSection sections[] =
+{
+    // CanIndexOffset, changes on its own with WB_MSG_SET_INDEX
+    { 4, 1 },
+    // auxOutBins, auxOutValues, auxOutputSource
+    { 5, 130 },
+    // sensorType, extraCanFormats, canStatsPeriod, egtAveraging, egtNotch
+    { 135, 5 },
+};
+
+static constexpr size_t sectionCount = sizeof(sections) / sizeof(sections[0]);
+
+const ConfigSection* GetConfigSections(size_t& count)
+{
+    count = sectionCount;
+    return sections;
+}
+
+// "WBCF"
+#define CONFIG_HEADER_MAGIC 0x46434257
+
+struct ConfigHeader
+{
+    uint32_t magic;
+    uint16_t schemaVersion;
+    uint16_t reserved;
+};
+
+static uint8_t* GetBytes(Configuration& cfg)
+{
+    return reinterpret_cast<uint8_t*>(&cfg);
+}
+
+static const uint8_t* GetBytes(const Configuration& cfg)
+{
+    return reinterpret_cast<const uint8_t*>(&cfg);
+}
+
+// 0 -> 1: the legacy record had no range checks, reset anything the firmware wouldn't have written
+static void MigrateFrom0(Configuration& cfg, const Configuration& defaults)
+{
+    if (static_cast<uint8_t>(cfg.sensorType) > static_cast<uint8_t>(SensorType::LSUADV))
+    {
+        cfg.sensorType = defaults.sensorType;
+    }
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (static_cast<uint8_t>(cfg.auxOutputSource[i]) > static_cast<uint8_t>(AuxOutputMode::Egt1))
+        {
+            cfg.auxOutputSource[i] = defaults.auxOutputSource[i];
+        }
+    }
+}
+
+// Schema 0 ended at sensorType
+static constexpr size_t legacyFieldsEnd = 136;
+
+// migrations[n] takes a configuration from schema n to n + 1
+using ConfigMigration = void (*)(Configuration& cfg, const Configuration& defaults);
+static const ConfigMigration migrations[] =
+{
+    MigrateFrom0,
+};
+
+static_assert(sizeof(migrations) / sizeof(migrations[0]) == CONFIG_SCHEMA_VERSION, "every schema version needs a migration from the one before");
+static_assert(sectionCount <= 8, "ConfigStore tracks up to 8 sections");
+
+static void Migrate(Configuration& cfg, const Configuration& defaults, uint16_t fromVersion)
+{
+    for (uint16_t v = fromVersion; v < CONFIG_SCHEMA_VERSION; v++)
+    {
+        migrations[v](cfg, defaults);
+    }
+}
+
+ConfigStore::ConfigStore(ConfigStorage& storage)
+    : m_storage(storage)
+{
+}
+
+ConfigLoadResult ConfigStore::Load(Configuration& cfg)
+{
+    const Configuration defaults = cfg;
+
+    ConfigHeader header;
+    size_t size = sizeof(header);
+    if (m_storage.Read(CONFIG_RECORD_HEADER, reinterpret_cast<uint8_t*>(&header), size)
+        && size == sizeof(header)
+        && header.magic == CONFIG_HEADER_MAGIC
+        && header.schemaVersion <= CONFIG_SCHEMA_VERSION)
+    {
+        for (size_t i = 0; i < sectionCount; i++)
+        {
+            const auto& section = sections[i];
+
+            // A record from before fields were appended is shorter, the rest keeps defaults.
+            // Unlike a longer one, from newer firmware, which has to be cut down.
+            uint8_t buffer[256];
+            size = sizeof(buffer);
+            if (!m_storage.Read(CONFIG_RECORD_FIRST_SECTION + i, buffer, size))
+            {
+                continue;
+            }
+
+            memcpy(GetBytes(cfg) + section.offset, buffer, size < section.size ? size : section.size);
+
+            m_sectionStored[i] = true;
+            m_sectionCrc[i] = Crc32(buffer, size);
+        }
+
+        if (header.schemaVersion == CONFIG_SCHEMA_VERSION)
+        {
+            m_headerStored = true;
+            return ConfigLoadResult::Loaded;
+        }
+
+        Migrate(cfg, defaults, header.schemaVersion);
+        return ConfigLoadResult::Migrated;
+    }
+
+    // Schema 0, the whole configuration in one record
+    Configuration legacy;
+    size = sizeof(legacy);
+    if (m_storage.Read(CONFIG_RECORD_LEGACY, GetBytes(legacy), size))
+    {
+        m_legacyStored = true;
+
+        if (size == sizeof(legacy) && legacy.IsValid())
+        {
+            // Only what schema 0 had, fields appended since were padding there and keep their defaults
+            memcpy(GetBytes(cfg), GetBytes(legacy), legacyFieldsEnd);
+            Migrate(cfg, defaults, 0);
+            return ConfigLoadResult::Migrated;
+        }
+    }
+
+    return ConfigLoadResult::Defaults;
+}
+
+int ConfigStore::Save(const Configuration& cfg)
+{
+    int written = 0;
+
+    for (size_t i = 0; i < sectionCount; i++)
+    {
+        const auto& section = sections[i];
+        const uint8_t* data = GetBytes(cfg) + section.offset;
+
+        uint32_t crc = Crc32(data, section.size);
+        if (m_sectionStored[i] && crc == m_sectionCrc[i])
+        {
+            continue;
+        }
+
+        if (!m_storage.Write(CONFIG_RECORD_FIRST_SECTION + i, data, section.size))
+        {
+            m_sectionStored[i] = false;
+            return -1;
+        }
+
+        m_sectionStored[i] = true;
+        m_sectionCrc[i] = crc;
+        written++;
+    }
+
+    // Header last, once every section it describes is in the current schema
+    if (!m_headerStored)
+    {
+        ConfigHeader header = { CONFIG_HEADER_MAGIC, CONFIG_SCHEMA_VERSION, 0 };
+        if (!m_storage.Write(CONFIG_RECORD_HEADER, reinterpret_cast<const uint8_t*>(&header), sizeof(header)))
+        {
+            return -1;
+        }
+
+        m_headerStored = true;
+        written++;
+    }
+
+    if (m_legacyStored)
+    {
+        m_storage.Erase(CONFIG_RECORD_LEGACY);
+        m_legacyStored = false;
+    }
+
+    return written;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "port.h"
+
+/**
+ * Configuration storage as one record per section, with schema versions and migrations.
+ *
+ * In RAM (and to TS) the configuration stays the single Configuration struct. In storage each
+ * section, a byte range of it, is its own record, so a small edit (say the CAN index) only
+ * rewrites that record. A header record holds the schema version the sections were written with.
+ *
+ * Schema rules:
+ *  - Fields are only ever appended, at the end of the configuration. They either extend the
+ *    last section or start a new one. A record shorter than its section just leaves the
+ *    remaining fields at their defaults, no migration needed.
+ *  - Anything else (moving, resizing or reinterpreting a field) bumps CONFIG_SCHEMA_VERSION
+ *    and adds a migration function, see config_store.cpp.
+ *
+ * Schema history:
+ *  0: single record with the whole struct and a tag, 0xDEADBE01, as the released firmware
+ *     wrote it. The fields end at sensorType (offset 136), the rest is padding and isn't read.
+ *  1: record per section
+ */
+#define CONFIG_SCHEMA_VERSION 1
+
+// Record ids. The legacy record is only read, to migrate it, then erased.
+#define CONFIG_RECORD_LEGACY 1
+#define CONFIG_RECORD_HEADER 2
+#define CONFIG_RECORD_FIRST_SECTION 3
+
+// Where records are kept: MFS on the F1 boards, a map in the tests
+class ConfigStorage
+{
+public:
+    // size: buffer size in, record size out. Returns false if there is no such record.
+    virtual bool Read(uint16_t id, uint8_t* buffer, size_t& size) = 0;
+    virtual bool Write(uint16_t id, const uint8_t* data, size_t size) = 0;
+    virtual void Erase(uint16_t id) = 0;
+};
+
+struct ConfigSection
+{
+    // Offset and size within Configuration, the same offsets as in the ini
+    uint16_t offset;
+    uint16_t size;
+};
+
+enum class ConfigLoadResult : uint8_t
+{
+    // Nothing usable stored, defaults kept
+    Defaults,
+    Loaded,
+    // Loaded from an older schema, it should be saved to store it in the current one
+    Migrated,
+};
+
+class ConfigStore
+{
+public:
+    ConfigStore(ConfigStorage& storage);
+
+    // cfg must already hold the defaults, anything not stored keeps them
+    ConfigLoadResult Load(Configuration& cfg);
+
+    // Writes the sections that changed since the last Load/Save.
+    // Returns the number of records written, or -1 on a write error.
+    int Save(const Configuration& cfg);
+
+private:
+    ConfigStorage& m_storage;
+
+    bool m_headerStored = false;
+    bool m_legacyStored = false;
+
+    // CRC of each section as stored, to tell what changed
+    bool m_sectionStored[8] = {};
+    uint32_t m_sectionCrc[8] = {};
+};
+
+const ConfigSection* GetConfigSections(size_t& count);
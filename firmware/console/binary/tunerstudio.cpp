@@ -75,7 +75,7 @@
 
 #include "indication.h"
 
-#include <rusefi/crc.h>
+#include "crc_backend.h"
 
 #ifndef EFI_BLUETOOTH_SETUP
 	#define EFI_BLUETOOTH_SETUP 0
@@ -166,7 +166,7 @@ void TunerStudio::handleCrc32Check(TsChannelBase *tsChannel, ts_response_format_
 
 	const uint8_t* start = getWorkingPageAddr() + offset;
 
-	uint32_t crc = SWAP_UINT32(crc32(start, count));
+	uint32_t crc = SWAP_UINT32(Crc32(start, count));
 	tsChannel->sendResponse(mode, (const uint8_t *) &crc, 4);
 }
 
@@ -195,6 +195,7 @@ static void sendResponseCode(ts_response_format_e mode, TsChannelBase *tsChannel
 static void handleBurnCommand(TsChannelBase* tsChannel, ts_response_format_e mode) {
 	tsState.burnCommandCounter++;
 
+	// Only queues the write, so the link stays responsive. Progress shows up in the BurnState output channel.
 	int ret = SaveConfiguration();
 	if (ret) {
 		tunerStudioError(tsChannel, "ERROR: failed to save settings");
@@ -241,13 +242,21 @@ static void handleIoTestCommand(TsChannelBase* tsChannel, ts_response_format_e m
 }
 
 static bool isKnownCommand(char command) {
+#ifdef EVENT_LOG_ENABLED
+	if (command == TS_EVENT_LOG_COMMAND) {
+		return true;
+	}
+#endif
+
 	return command == TS_HELLO_COMMAND || command == TS_READ_COMMAND || command == TS_OUTPUT_COMMAND
 			|| command == TS_BURN_COMMAND
 			|| command == TS_CHUNK_WRITE_COMMAND
 			|| command == TS_GET_SCATTERED_GET_COMMAND
 			|| command == TS_CRC_CHECK_COMMAND
 			|| command == TS_GET_FIRMWARE_VERSION
-			|| command == TS_IO_TEST_COMMAND;
+			|| command == TS_IO_TEST_COMMAND
+			|| command == TS_STREAM_COMMAND
+			|| command == TS_LAMBDA_LOG_COMMAND;
 }
 
 /**
@@ -340,8 +349,20 @@ static int tsProcessOne(TsChannelBase* tsChannel) {
 
 	tsState.totalCounter++;
 
+	auto& stream = tsChannel->stream;
+
 	uint8_t firstByte;
-	int received = tsChannel->readTimeout(&firstByte, 1, TS_COMMUNICATION_TIMEOUT);
+	// while streaming only wait for a command until the next record is due
+	sysinterval_t timeout = stream.IsActive() ? TIME_MS2I(stream.GetMsUntilDue()) : TS_COMMUNICATION_TIMEOUT;
+	int received = tsChannel->readTimeout(&firstByte, 1, timeout);
+
+	if (received != 1 && stream.IsActive()) {
+		// a quiet line is expected while streaming
+		if (stream.IsDue()) {
+			tsInstance.sendStreamRecord(tsChannel);
+		}
+		return 0;
+	}
 
 	if (received != 1) {
 //			tunerStudioError("ERROR: no command");
@@ -354,6 +375,9 @@ static int tsProcessOne(TsChannelBase* tsChannel) {
 		return -1;
 	}
 
+	// TS is talking to us again, whatever it is ends the stream
+	stream.Stop();
+
 	if (tsInstance.handlePlainCommand(tsChannel, firstByte)) {
 		return -1;
 	}
@@ -433,7 +457,7 @@ static int tsProcessOne(TsChannelBase* tsChannel) {
 
 	expectedCrc = SWAP_UINT32(expectedCrc);
 
-	uint32_t actualCrc = crc32(tsChannel->scratchBuffer, incomingPacketSize);
+	uint32_t actualCrc = Crc32(tsChannel->scratchBuffer, incomingPacketSize);
 	if (actualCrc != expectedCrc) {
 		//efiPrintf("TunerStudio: CRC %x %x %x %x", tsChannel->scratchBuffer[incomingPacketSize + 0],
 		//		tsChannel->scratchBuffer[incomingPacketSize + 1], tsChannel->scratchBuffer[incomingPacketSize + 2],
@@ -559,6 +583,44 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, size_t i
 		}
 	}
 
+	if (command == TS_STREAM_COMMAND) {
+		if (incomingPacketSize < sizeof(TunerStudioStreamPacketHeader)) {
+			sendErrorCode(tsChannel, TS_RESPONSE_UNDERRUN);
+			tunerStudioError(tsChannel, "ERROR: underrun");
+			return false;
+		}
+
+		const TunerStudioStreamPacketHeader* header = reinterpret_cast<TunerStudioStreamPacketHeader*>(data);
+		handleStreamCommand(tsChannel, header->source, header->periodMs, header->offset, header->count);
+		return true;
+	}
+
+	if (command == TS_LAMBDA_LOG_COMMAND) {
+		if (incomingPacketSize < sizeof(TunerStudioLambdaLogPacketHeader)) {
+			sendErrorCode(tsChannel, TS_RESPONSE_UNDERRUN);
+			tunerStudioError(tsChannel, "ERROR: underrun");
+			return false;
+		}
+
+		const TunerStudioLambdaLogPacketHeader* header = reinterpret_cast<TunerStudioLambdaLogPacketHeader*>(data);
+		handleLambdaLogCommand(tsChannel, header->op, header->trigger, header->channelMask, header->offset, header->count);
+		return true;
+	}
+
+#ifdef EVENT_LOG_ENABLED
+	if (command == TS_EVENT_LOG_COMMAND) {
+		if (incomingPacketSize < sizeof(TunerStudioEventLogPacketHeader)) {
+			sendErrorCode(tsChannel, TS_RESPONSE_UNDERRUN);
+			tunerStudioError(tsChannel, "ERROR: underrun");
+			return false;
+		}
+
+		const TunerStudioEventLogPacketHeader* header = reinterpret_cast<TunerStudioEventLogPacketHeader*>(data);
+		handleEventLogCommand(tsChannel, header->op, header->offset, header->count);
+		return true;
+	}
+#endif
+
 	/* check if we can extract page, offset and count */
 	if (incomingPacketSize < sizeof(TunerStudioDataPacketHeader)) {
 		sendErrorCode(tsChannel, TS_RESPONSE_UNDERRUN);
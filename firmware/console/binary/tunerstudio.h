@@ -42,6 +42,67 @@ typedef struct {
 	uint16_t count;
 } __attribute__((packed)) TunerStudioDataPacketHeader;
 
+typedef struct {
+	uint8_t cmd;
+	// OchStreamSource
+	uint8_t source;
+	// 0 stops streaming
+	uint16_t periodMs;
+	// Output channel block range, Block source only (Delta always sends the whole block)
+	uint16_t offset;
+	uint16_t count;
+} __attribute__((packed)) TunerStudioStreamPacketHeader;
+
+/* Lambda logger operations, see LambdaLogger */
+#define TS_LAMBDA_LOG_ARM 0
+#define TS_LAMBDA_LOG_TRIGGER 1
+#define TS_LAMBDA_LOG_STOP 2
+#define TS_LAMBDA_LOG_STATUS 3
+#define TS_LAMBDA_LOG_READ 4
+
+typedef struct {
+	uint8_t cmd;
+	uint8_t op;
+	// Arm: LambdaLogTrigger and channels to log
+	uint8_t trigger;
+	uint8_t channelMask;
+	// Arm: records to keep from before the trigger. Read: first record, 0 = oldest
+	uint16_t offset;
+	// Arm: lambda step trigger threshold, 0.0001 lambda. Read: record count
+	uint16_t count;
+} __attribute__((packed)) TunerStudioLambdaLogPacketHeader;
+
+typedef struct {
+	uint8_t state;		// LambdaLogState
+	uint8_t trigger;
+	uint8_t channelMask;
+	uint8_t recordSize;
+	uint16_t recordCount;
+	uint16_t triggerIndex;
+	uint32_t triggerTimeUs;
+	uint32_t lastTimeUs;
+} __attribute__((packed)) TunerStudioLambdaLogStatus;
+
+/* Event log operations, see EventLog */
+#define TS_EVENT_LOG_STATUS 0
+#define TS_EVENT_LOG_READ 1
+#define TS_EVENT_LOG_CLEAR 2
+
+typedef struct {
+	uint8_t cmd;
+	uint8_t op;
+	// Read: first entry, 0 = oldest, and entry count
+	uint16_t offset;
+	uint16_t count;
+} __attribute__((packed)) TunerStudioEventLogPacketHeader;
+
+typedef struct {
+	uint16_t count;
+	uint16_t boot;
+	uint8_t entrySize;
+	uint8_t capacity;
+} __attribute__((packed)) TunerStudioEventLogStatus;
+
 #define CONNECTIVITY_THREAD_STACK 	(512)
 #define CONNECTIVITY_THREAD_PRIO	(NORMALPRIO + 1)
 
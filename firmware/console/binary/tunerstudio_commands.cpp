@@ -8,34 +8,46 @@
 
 #include <cstring>
 
-#include <rusefi/crc.h>
-#include <rusefi/fragments.h>
+#include "crc_backend.h"
+#include "livedata.h"
+#include "och_snapshot.h"
+#include "lambda_logger.h"
+#include "event_log.h"
 
 void sendErrorCode(TsChannelBase *tsChannel, uint8_t code);
 void sendOkResponse(TsChannelBase *tsChannel, ts_response_format_e mode);
 
-FragmentList getFragments();
-
 /**
  * @brief 'Output' command sends out a snapshot of current values
  * Gauges refresh
  */
 void TunerStudio::cmdOutputChannels(TsChannelBase* tsChannel, uint16_t offset, uint16_t count) {
-	// TODO: check against total framents size
-//	if (offset + count > TS_TOTAL_OUTPUT_SIZE) {
-//		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
-//		return;
-//	}
+	if (offset + count > OCH_BLOCK_SIZE) {
+		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+		return;
+	}
 
 	tsChannel->assertPacketSize(count, false);
 	// this method is invoked too often to print any debug information
-	uint8_t * scratchBuffer = (uint8_t *)tsChannel->scratchBuffer;
-	/**
-	 * collect data from all models
-	 */
-	copyRange(scratchBuffer + 3, getFragments(), offset, count);
+	const uint8_t* packet = AcquireOutputChannels();
 
-	tsChannel->crcAndWriteBuffer(TS_RESPONSE_OK, count);
+	if (!packet) {
+		// sampling hasn't published anything yet
+		memset(tsChannel->scratchBuffer + 3, 0, count);
+		tsChannel->crcAndWriteBuffer(TS_RESPONSE_OK, count);
+		return;
+	}
+
+	if (offset == 0 && count == OCH_BLOCK_SIZE) {
+		// the usual case: whole block, header and CRC already in place
+		tsChannel->write(packet, OCH_PACKET_SIZE, true);
+		tsChannel->flush();
+	} else {
+		// frame is pinned, safe to CRC and send straight from it
+		tsChannel->writeCrcPacketLarge(TS_RESPONSE_OK, GetOchBlock(packet) + offset, count);
+	}
+
+	ReleaseOutputChannels(packet);
 }
 
 // Validate whether the specified offset and count would cause an overrun in the tune.
@@ -47,82 +59,213 @@ bool TunerStudio::validateScatterOffsetCount(size_t offset, size_t count) {
 }
 
 void TunerStudio::handleScatteredReadCommand(TsChannelBase* tsChannel) {
-#ifdef HIGH_SPEED_OPTIMIZED
-	uint8_t *buffer = (uint8_t *)tsChannel->scratchBuffer;
-	tsChannel->writeHeader(TS_RESPONSE_OK, highSpeedTotalSize);
-	for (size_t i = 0; i < highSpeedChunks; i++) {
-		chDbgAssert(NULL != highSpeedPtrs[i], "NULL pointer in scatter list");
-		// copy to temp buffer to avoid changes before transmission, couse it can affect CRC
-		memcpy(buffer, highSpeedPtrs[i], highSpeedSizes[i]);
-		tsChannel->writeBody(buffer, highSpeedSizes[i]);
-	}
-	tsChannel->writeTail();
-#else
-	size_t count = 0;
 	uint8_t *buffer = (uint8_t *)tsChannel->scratchBuffer + 3;	/* reserve 3 bytes for header */
+	size_t count;
 
-	for (size_t i = 0; i < HIGH_SPEED_COUNT; i++) {
-		int packed = highSpeedOffsets[i];
-		int type = packed >> 13;
-
-		if (type == 0)
-			continue;
-		int size = 1 << (type - 1);
-
-		int offset = packed & 0x1FFF;
-		// write each data point and CRC incrementally
-		copyRange(buffer + count, getFragments(), offset, size);
-		count += size;
+	const uint8_t* packet = AcquireOutputChannels();
+	if (packet) {
+		// all data points from the same frame
+		count = highSpeedPlan.Gather(GetOchBlock(packet), buffer);
+		ReleaseOutputChannels(packet);
+	} else {
+		// sampling hasn't published anything yet
+		count = highSpeedPlan.GetTotalSize();
+		memset(buffer, 0, count);
 	}
+
 	tsChannel->crcAndWriteBuffer(TS_RESPONSE_OK, count);
-#endif
 }
 
 void TunerStudio::handleScatterListWriteCommand(TsChannelBase* tsChannel, uint16_t offset, uint16_t count, void *content)
 {
+	if (!validateScatterOffsetCount(offset, count)) {
+		tunerStudioError(tsChannel, "ERROR: out of range");
+		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+		return;
+	}
+
 	uint8_t * addr = (uint8_t *)highSpeedOffsets + offset;
 	memcpy(addr, content, count);
 
-#ifdef HIGH_SPEED_OPTIMIZED
-	highSpeedChunks = 0;
-	highSpeedTotalSize = 0;
-	/* translate to CPU pointers */
-	for (int i = 0; i < HIGH_SPEED_COUNT; i++) {
-		int packed = highSpeedOffsets[i];
-		int type = packed >> 13;
-
-		if (type == 0)
-			continue;
-
-		int size = 1 << (type - 1);
-		int offset = packed & 0x1FFF;
-		highSpeedTotalSize += size;
-
-		uint8_t *ptr;
-
-		do {
-			size_t availSize = getRangePtr(&ptr, getFragments(), offset, size);
-
-			/* note: no need to check ptr for NULL */
-			if ((highSpeedChunks == 0) ||	/* first chunk */
-				((highSpeedChunks > 0) &&
-				 (highSpeedPtrs[highSpeedChunks - 1] + highSpeedSizes[highSpeedChunks - 1] != ptr))) /* or not contiguous chunks */ {
-				highSpeedPtrs[highSpeedChunks] = ptr;
-				highSpeedSizes[highSpeedChunks] = size;
-				highSpeedChunks++;
-			} else {
-				/* unite */
-				highSpeedSizes[highSpeedChunks - 1] += size;
-			}
-		size -= availSize;
-		offset += availSize;
-		} while (size);
+	highSpeedPlan.Compile(highSpeedOffsets, HIGH_SPEED_COUNT, OCH_BLOCK_SIZE, BLOCKING_FACTOR);
+
+	sendOkResponse(tsChannel, TS_CRC);
+}
+
+void TunerStudio::handleStreamCommand(TsChannelBase* tsChannel, uint8_t source, uint16_t periodMs, uint16_t offset, uint16_t count)
+{
+	if (periodMs == 0) {
+		tsChannel->stream.Stop();
+		sendOkResponse(tsChannel, TS_CRC);
+		return;
+	}
+
+	auto streamSource = static_cast<OchStreamSource>(source);
+	size_t sourceSize = streamSource == OchStreamSource::Scatter ? highSpeedPlan.GetTotalSize() : OCH_BLOCK_SIZE;
+
+	if (!tsChannel->stream.Start(streamSource, periodMs, offset, count, sourceSize)) {
+		tunerStudioError(tsChannel, "ERROR: bad stream request");
+		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+		return;
+	}
+
+	sendOkResponse(tsChannel, TS_CRC);
+}
+
+// Stream records are built in the scratch buffer: header, sequence number, payload, CRC
+static_assert(3 + 2 + OCH_DELTA_MAX_SIZE + 4 <= sizeof(TsChannelBase::scratchBuffer), "delta keyframe doesn't fit");
+static_assert(3 + 2 + BLOCKING_FACTOR + 4 <= sizeof(TsChannelBase::scratchBuffer), "scatter record doesn't fit");
+static_assert(3 + OCH_BLOCK_SIZE + 4 <= sizeof(TsChannelBase::scratchBuffer), "output channel fallback doesn't fit");
+
+void TunerStudio::sendStreamRecord(TsChannelBase* tsChannel)
+{
+	auto& stream = tsChannel->stream;
+
+	uint16_t sequence = stream.NextRecord();
+	uint8_t sequenceBytes[2] = { (uint8_t)sequence, (uint8_t)(sequence >> 8) };
+
+	const uint8_t* packet = AcquireOutputChannels();
+	const uint8_t* block = packet ? GetOchBlock(packet) : nullptr;
+
+	if (stream.GetSource() == OchStreamSource::Scatter) {
+		uint8_t *buffer = (uint8_t *)tsChannel->scratchBuffer + 3;	/* reserve 3 bytes for header */
+		size_t count;
+
+		if (block) {
+			count = highSpeedPlan.Gather(block, buffer + sizeof(sequenceBytes));
+		} else {
+			count = highSpeedPlan.GetTotalSize();
+			memset(buffer + sizeof(sequenceBytes), 0, count);
+		}
+
+		memcpy(buffer, sequenceBytes, sizeof(sequenceBytes));
+		tsChannel->crcAndWriteBuffer(TS_RESPONSE_STREAM_RECORD, sizeof(sequenceBytes) + count);
+	} else if (stream.GetSource() == OchStreamSource::Delta) {
+		if (block) {
+			uint8_t *buffer = (uint8_t *)tsChannel->scratchBuffer + 3;	/* reserve 3 bytes for header */
+
+			size_t count = stream.delta.Encode(block, buffer + sizeof(sequenceBytes));
+
+			memcpy(buffer, sequenceBytes, sizeof(sequenceBytes));
+			tsChannel->crcAndWriteBuffer(TS_RESPONSE_STREAM_RECORD, sizeof(sequenceBytes) + count);
+		}
+	} else if (block) {
+		// straight from the pinned frame
+		tsChannel->writeHeader(TS_RESPONSE_STREAM_RECORD, sizeof(sequenceBytes) + stream.GetCount());
+		tsChannel->writeBody(sequenceBytes, sizeof(sequenceBytes));
+		tsChannel->writeBody(block + stream.GetOffset(), stream.GetCount());
+		tsChannel->writeTail();
+		tsChannel->flush();
+	}
+
+	if (packet) {
+		ReleaseOutputChannels(packet);
+	}
+}
+
+void TunerStudio::handleLambdaLogCommand(TsChannelBase* tsChannel, uint8_t op, uint8_t trigger, uint8_t channelMask, uint16_t offset, uint16_t count)
+{
+	auto& logger = GetLambdaLogger();
+
+	switch (op) {
+	case TS_LAMBDA_LOG_ARM:
+		if (!ArmLambdaLogger(static_cast<LambdaLogTrigger>(trigger), channelMask, offset, count / 10000.0f)) {
+			tunerStudioError(tsChannel, "ERROR: bad logger request");
+			sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+			return;
+		}
+		break;
+	case TS_LAMBDA_LOG_TRIGGER:
+		TriggerLambdaLogger();
+		break;
+	case TS_LAMBDA_LOG_STOP:
+		StopLambdaLogger();
+		break;
+	case TS_LAMBDA_LOG_STATUS: {
+		TunerStudioLambdaLogStatus status;
+		status.state = static_cast<uint8_t>(logger.GetState());
+		status.trigger = static_cast<uint8_t>(logger.GetTrigger());
+		status.channelMask = logger.GetChannelMask();
+		status.recordSize = sizeof(LambdaLogRecord);
+		status.recordCount = logger.GetRecordCount();
+		status.triggerIndex = logger.GetTriggerIndex();
+		status.triggerTimeUs = logger.GetTriggerTimeUs();
+		status.lastTimeUs = logger.GetLastTimeUs();
+
+		tsChannel->sendResponse(TS_CRC, (const uint8_t *)&status, sizeof(status));
+		return;
+	}
+	case TS_LAMBDA_LOG_READ: {
+		// whole records, as many as fit a packet
+		if (count == 0 || count > BLOCKING_FACTOR / sizeof(LambdaLogRecord)) {
+			sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+			return;
+		}
+
+		// nothing while still recording, or past the end
+		LambdaLogRecord* records = reinterpret_cast<LambdaLogRecord*>(tsChannel->scratchBuffer + 3);
+		size_t read = logger.Read(offset, records, count);
+
+		if (read == 0) {
+			sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+			return;
+		}
+
+		tsChannel->crcAndWriteBuffer(TS_RESPONSE_OK, read * sizeof(LambdaLogRecord));
+		return;
+	}
+	default:
+		sendErrorCode(tsChannel, TS_RESPONSE_UNRECOGNIZED_COMMAND);
+		return;
 	}
-#endif
 
 	sendOkResponse(tsChannel, TS_CRC);
 }
 
+#ifdef EVENT_LOG_ENABLED
+void TunerStudio::handleEventLogCommand(TsChannelBase* tsChannel, uint8_t op, uint16_t offset, uint16_t count)
+{
+	switch (op) {
+	case TS_EVENT_LOG_STATUS: {
+		TunerStudioEventLogStatus status;
+		status.count = GetEventLogCount();
+		status.boot = GetEventLogBoot();
+		status.entrySize = sizeof(EventLogEntry);
+		status.capacity = EVENT_LOG_ENTRIES;
+
+		tsChannel->sendResponse(TS_CRC, (const uint8_t *)&status, sizeof(status));
+		return;
+	}
+	case TS_EVENT_LOG_READ: {
+		// whole entries, as many as fit a packet
+		if (count == 0 || count > BLOCKING_FACTOR / sizeof(EventLogEntry)) {
+			sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+			return;
+		}
+
+		EventLogEntry* entries = reinterpret_cast<EventLogEntry*>(tsChannel->scratchBuffer + 3);
+		size_t read = ReadEventLog(offset, entries, count);
+
+		if (read == 0) {
+			sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE);
+			return;
+		}
+
+		tsChannel->crcAndWriteBuffer(TS_RESPONSE_OK, read * sizeof(EventLogEntry));
+		return;
+	}
+	case TS_EVENT_LOG_CLEAR:
+		ClearEventLog();
+		break;
+	default:
+		sendErrorCode(tsChannel, TS_RESPONSE_UNRECOGNIZED_COMMAND);
+		return;
+	}
+
+	sendOkResponse(tsChannel, TS_CRC);
+}
+#endif
+
 void TunerStudio::handleScatterListReadCommand(TsChannelBase* tsChannel, uint16_t offset, uint16_t count)
 {
 	if (!validateScatterOffsetCount(offset, count)) {
@@ -146,6 +289,6 @@ void TunerStudio::handleScatterListCrc32Check(TsChannelBase *tsChannel, uint16_t
 
 	const uint8_t* start = (uint8_t *)highSpeedOffsets + offset;
 
-	uint32_t crc = SWAP_UINT32(crc32(start, count));
+	uint32_t crc = SWAP_UINT32(Crc32(start, count));
 	tsChannel->sendResponse(TS_CRC, (const uint8_t *) &crc, 4);
 }
@@ -7,9 +7,7 @@
 #include <cstdint>
 #include <cstddef>
 
-#define HIGH_SPEED_COUNT 32
-
-#define HIGH_SPEED_OPTIMIZED
+#include "scatter_plan.h"
 
 struct TsChannelBase;
 
@@ -44,16 +42,19 @@ public:
 	void handleScatterListWriteCommand(TsChannelBase* tsChannel, uint16_t offset, uint16_t count, void *content);
 	void handleScatterListReadCommand(TsChannelBase* tsChannel, uint16_t offset, uint16_t count);
 	void handleScatterListCrc32Check(TsChannelBase *tsChannel, uint16_t offset, uint16_t count);
+	// Push mode
+	void handleStreamCommand(TsChannelBase* tsChannel, uint8_t source, uint16_t periodMs, uint16_t offset, uint16_t count);
+	void sendStreamRecord(TsChannelBase* tsChannel);
+	// High rate lambda logger
+	void handleLambdaLogCommand(TsChannelBase* tsChannel, uint8_t op, uint8_t trigger, uint8_t channelMask, uint16_t offset, uint16_t count);
+	// Fault and event history
+	void handleEventLogCommand(TsChannelBase* tsChannel, uint8_t op, uint16_t offset, uint16_t count);
 
 private:
 	void sendErrorCode(TsChannelBase* tsChannel, uint8_t code);
 
 	bool validateScatterOffsetCount(size_t offset, size_t count);
 	uint16_t highSpeedOffsets[HIGH_SPEED_COUNT];
-#ifdef HIGH_SPEED_OPTIMIZED
-	uint8_t *highSpeedPtrs[HIGH_SPEED_COUNT];
-	size_t highSpeedSizes[HIGH_SPEED_COUNT];
-	size_t highSpeedChunks;
-	size_t highSpeedTotalSize;
-#endif
+	// highSpeedOffsets compiled, rebuilt whenever TS writes them
+	ScatterPlan highSpeedPlan;
 };
@@ -11,13 +11,13 @@
 #include "tunerstudio_io.h"
 #include "byteswap.h"
 
-#include <rusefi/crc.h>
+#include "crc_backend.h"
 
 size_t TsChannelBase::read(uint8_t* buffer, size_t size) {
 	return readTimeout(buffer, size, SR5_READ_TIMEOUT);
 }
 
-#define isBigPacket(size) ((size) > BLOCKING_FACTOR + 7)
+#define isBigPacket(size) ((size) > TS_SCRATCH_PAYLOAD_SIZE + 7)
 
 void TsChannelBase::copyAndWriteSmallCrcPacket(uint8_t responseCode, const uint8_t* buf, size_t size) {
 	auto scratchBuffer = this->scratchBuffer;
@@ -46,7 +46,7 @@ void TsChannelBase::crcAndWriteBuffer(uint8_t responseCode, size_t size) {
 	scratchBuffer[2] = responseCode;
 
 	// CRC is computed on the responseCode and payload but not length
-	uint32_t crc = crc32(&scratchBuffer[2], size + 1); // command part of CRC
+	uint32_t crc = Crc32(&scratchBuffer[2], size + 1); // command part of CRC
 
 	// Place the CRC at the end
 	*reinterpret_cast<uint32_t*>(&scratchBuffer[size + 3]) = SWAP_UINT32(crc);
@@ -67,7 +67,7 @@ int TsChannelBase::writeHeader(uint8_t responseCode, size_t size)
 
 	// start calculating CRC
 	// CRC is computed on the responseCode and payload but not length
-	crcAcc = crc32(&buffer[2], sizeof(buffer) - 2);
+	crcAcc = Crc32(&buffer[2], sizeof(buffer) - 2);
 	// save packet size
 	packetSize = size; 	/* + 3 bytes for head + 4 bytes of CRC */
 
@@ -77,11 +77,11 @@ int TsChannelBase::writeHeader(uint8_t responseCode, size_t size)
 	return sizeof(buffer);
 }
 
-int TsChannelBase::writeBody(uint8_t *buffer, size_t size)
+int TsChannelBase::writeBody(const uint8_t *buffer, size_t size)
 {
 	chDbgAssert(size <= packetSize, "writeBody packet size is more than provided in header");
 	// append CRC
-	crcAcc = crc32inc(buffer, crcAcc, size);
+	crcAcc = Crc32Update(crcAcc, buffer, size);
 	// adjust packet size
 	packetSize -= size;
 
@@ -114,9 +114,9 @@ void TsChannelBase::writeCrcPacketLarge(uint8_t responseCode, const uint8_t* buf
 	*(uint8_t*)(headerBuffer + 2) = responseCode;
 
 	// Command part of CRC
-	uint32_t crc = crc32((void*)(headerBuffer + 2), 1);
+	uint32_t crc = Crc32(headerBuffer + 2, 1);
 	// Data part of CRC
-	crc = crc32inc((void*)buf, crc, size);
+	crc = Crc32Update(crc, buf, size);
 	*(uint32_t*)crcBuffer = SWAP_UINT32(crc);
 
 	// Write header
@@ -11,11 +11,22 @@
 /* to get ChibiOS hal config options */
 #include "hal.h"
 
+#include "wideband_config.h"
+
 #include "tunerstudio_impl.h"
+#include "dma_rx_ring.h"
+#include "och_stream.h"
+#include "isotp.h"
+#include "spsc_fifo.h"
 
 /* TODO: find better place */
 #define BLOCKING_FACTOR 256
 
+// Largest payload built in the scratch buffer. Boards with more than four EGT channels have an
+// output channel block bigger than BLOCKING_FACTOR, and it goes out whole (stream keyframes,
+// the fallback before the first frame).
+#define TS_SCRATCH_PAYLOAD_SIZE (OCH_BLOCK_SIZE > BLOCKING_FACTOR ? OCH_BLOCK_SIZE : BLOCKING_FACTOR)
+
 #define TS_BURN_COMMAND 'B'
 #define TS_CHUNK_WRITE_COMMAND 'C'
 #define TS_COMMAND_F 'F'
@@ -29,6 +40,9 @@
 #define TS_TEST_COMMAND 't'
 #define TS_GET_SCATTERED_GET_COMMAND '9'
 #define TS_IO_TEST_COMMAND 'Z'
+#define TS_STREAM_COMMAND 'L'
+#define TS_LAMBDA_LOG_COMMAND 'l'
+#define TS_EVENT_LOG_COMMAND 'e'
 
 #define TS_RESPONSE_BURN_OK 4
 #define TS_RESPONSE_COMMAND_OK 7
@@ -38,6 +52,8 @@
 #define TS_RESPONSE_OUT_OF_RANGE 0x84
 #define TS_RESPONSE_UNDERRUN 0x80
 #define TS_RESPONSE_UNRECOGNIZED_COMMAND 0x83
+// Pushed output channel record, see OchStream
+#define TS_RESPONSE_STREAM_RECORD 0x10
 
 class TsChannelBase {
 public:
@@ -65,19 +81,24 @@ public:
 	/**
 	 * See 'blockingFactor' in rusefi.ini
 	 */
-	char scratchBuffer[BLOCKING_FACTOR + 30];
+	char scratchBuffer[TS_SCRATCH_PAYLOAD_SIZE + 30];
 	const char *name;
 
+	// Push mode output channels, running until anything arrives on this channel
+	OchStream stream;
+
 	void assertPacketSize(size_t size, bool allowLongPackets);
 	void crcAndWriteBuffer(uint8_t responseCode, size_t size);
 	void copyAndWriteSmallCrcPacket(uint8_t responseCode, const uint8_t* buf, size_t size);
 
 	int writeHeader(uint8_t responseCode, size_t size);
-	int writeBody(uint8_t *buffer, size_t size);
+	int writeBody(const uint8_t *buffer, size_t size);
 	int writeTail(void);
 
-private:
+	// No copy, buf must not change until this returns
 	void writeCrcPacketLarge(uint8_t responseCode, const uint8_t* buf, size_t size);
+
+private:
 	// CRC accumulator
 	uint32_t crcAcc;
 	// total size expected
@@ -89,7 +110,22 @@ class SerialTsChannelBase : public TsChannelBase {
 public:
 	SerialTsChannelBase(const char *name) : TsChannelBase(name) {};
 	// Open the serial port with the specified baud rate
-	virtual int start(uint32_t baud) = 0;
+	int start(uint32_t newBaud);
+	// Close and open serial ports with specified baud rate
+	// Also will do BT module setup if BT is enabled
+	int reStart() override;
+
+protected:
+	// Start the driver at this rate, BT setup goes through several before settling on the one from start()
+	virtual void open(uint32_t speed) = 0;
+
+private:
+	int bt_printf(const char *fmt, ...);
+	int bt_read_line(char *str, size_t max_len);
+	int bt_wait_ok(void);
+	int bt_disconnect(void);
+
+	uint32_t baud;
 };
 
 #if HAL_USE_SERIAL
@@ -98,21 +134,15 @@ class SerialTsChannel : public SerialTsChannelBase {
 public:
 	SerialTsChannel(SerialDriver& driver) : SerialTsChannelBase("Serial"), m_driver(&driver) { }
 
-	int start(uint32_t newBaud) override;
-	// Close and open serial ports with specified baud rate
-	// Also will do BT module setup if BT is enabled
-	int reStart() override;
 	void stop() override;
 
 	void write(const uint8_t* buffer, size_t size, bool isEndOfPacket) override;
 	size_t readTimeout(uint8_t* buffer, size_t size, int timeout) override;
 
-private:
-	int bt_read_line(char *str, size_t max_len);
-	int bt_wait_ok(void);
-	int bt_disconnect(void);
+protected:
+	void open(uint32_t speed) override;
 
-	uint32_t baud;
+private:
 	SerialDriver* const m_driver;
 };
 #endif // HAL_USE_SERIAL
@@ -123,19 +153,101 @@ class UartTsChannel : public SerialTsChannelBase {
 public:
 	UartTsChannel(UARTDriver& driver) : SerialTsChannelBase("UART"), m_driver(&driver) { }
 
-	int start(uint32_t newBaud) override;
-	int reStart() override;
 	void stop() override;
 
 	void write(const uint8_t* buffer, size_t size, bool isEndOfPacket) override;
 	size_t readTimeout(uint8_t* buffer, size_t size, int timeout) override;
 
 protected:
+	void open(uint32_t speed) override;
+
 	UARTDriver* const m_driver;
 	UARTConfig m_config;
 };
+
+// Has to hold the longest burst TS sends without a pause, a whole chunk write command
+#define TS_UART_DMA_RX_SIZE 512
+#define TS_UART_TX_STAGE_SIZE 16
+
+/**
+ * UART channel with no per byte interrupts.
+ *
+ * RX runs a DMA transfer in circular mode for as long as the channel is open, the line idle
+ * interrupt at the end of each command wakes the reader, which takes the bytes straight from
+ * the DMA buffer. TX sends each piece of a packet (header, body, CRC) as one DMA transfer,
+ * small pieces are collected and go out together.
+ */
+class UartDmaTsChannel : public UartTsChannel {
+public:
+	UartDmaTsChannel(UARTDriver& driver);
+
+	void write(const uint8_t* buffer, size_t size, bool isEndOfPacket) override;
+	void flush() override;
+	size_t readTimeout(uint8_t* buffer, size_t size, int timeout) override;
+
+protected:
+	void open(uint32_t speed) override;
+
+private:
+	static void rxIdleCallback(UARTDriver* uartp);
+	void send(const uint8_t* buffer, size_t size);
+
+	binary_semaphore_t m_rxSignal;
+	DmaRxRing m_rxRing;
+	uint8_t m_rxDma[TS_UART_DMA_RX_SIZE];
+
+	uint8_t m_txStage[TS_UART_TX_STAGE_SIZE];
+	size_t m_txStageFill = 0;
+};
 #endif // HAL_USE_UART
 
+#ifdef EFI_CAN_SERIAL
+// Outgoing bytes are collected up to this, then sent as one ISO-TP message
+#define CAN_TS_TX_BUFFER_SIZE (BLOCKING_FACTOR + 16)
+// Longest message from the host, a whole chunk write command
+#define CAN_TS_RX_MESSAGE_SIZE (BLOCKING_FACTOR + 30)
+// ISO-TP N_Bs, how long the host gets to answer a first frame
+#define CAN_TS_FLOW_CONTROL_TIMEOUT TIME_MS2I(1000)
+
+/**
+ * TS over CAN, see WB_MSG_TS_RX in wideband_can.h.
+ *
+ * The CAN Rx thread hands every frame to onFrame: data frames are reassembled right there, and
+ * whole messages go into a FIFO for the TS thread, flow control frames are queued for the sender.
+ * Sending happens on the TS thread, one message per TS packet unless it doesn't fit the buffer.
+ */
+class CanTsChannel : public TsChannelBase {
+public:
+	CanTsChannel();
+
+	void write(const uint8_t* buffer, size_t size, bool isEndOfPacket) override;
+	void flush() override;
+	size_t readTimeout(uint8_t* buffer, size_t size, int timeout) override;
+
+	// Called by the CAN Rx thread
+	void onFrame(const uint8_t* data, uint8_t dlc);
+
+	uint32_t rxOverflows = 0;
+	uint32_t txAborts = 0;
+
+private:
+	void sendFrame(const IsoTpFrame& frame);
+
+	// CAN Rx thread side
+	IsoTpReceiver m_rx;
+	uint8_t m_rxMessage[CAN_TS_RX_MESSAGE_SIZE];
+	SpscFifo<uint8_t, 512> m_rxFifo;
+	binary_semaphore_t m_rxSignal;
+
+	// TS thread side
+	IsoTpSender m_tx;
+	uint8_t m_txBuffer[CAN_TS_TX_BUFFER_SIZE];
+	size_t m_txFill = 0;
+	SpscFifo<IsoTpFrame, 4> m_flowControl;
+	binary_semaphore_t m_flowControlSignal;
+};
+#endif // EFI_CAN_SERIAL
+
 #define CRC_VALUE_SIZE 4
 // todo: double-check this
 #define CRC_WRAPPING_SIZE (CRC_VALUE_SIZE + 3)
@@ -0,0 +1,151 @@
+/**
+ * Implementation for TunerStudio over CAN, ISO-TP segmented
+ */
+
+#include <string.h>
+
+#include "tunerstudio_io.h"
+#include "hal.h"
+
+#ifdef EFI_CAN_SERIAL
+
+#include "can_helper.h"
+#include "port.h"
+
+#include "../for_rusefi/wideband_can.h"
+
+CanTsChannel::CanTsChannel()
+	: TsChannelBase("CAN")
+	, m_rx(m_rxMessage, sizeof(m_rxMessage))
+{
+	chBSemObjectInit(&m_rxSignal, true);
+	chBSemObjectInit(&m_flowControlSignal, true);
+}
+
+void CanTsChannel::sendFrame(const IsoTpFrame& frame) {
+	CanTxMessage msg(WB_MSG_TS_TX(GetConfiguration()->CanIndexOffset), frame.dlc, true);
+
+	for (size_t i = 0; i < frame.dlc; i++) {
+		msg[i] = frame.data[i];
+	}
+}
+
+void CanTsChannel::onFrame(const uint8_t* data, uint8_t dlc) {
+	if (dlc >= 1 && (data[0] & 0xF0) == ISOTP_PCI_FLOW_CONTROL) {
+		// for the sender, which lives on the TS thread
+		IsoTpFrame frame;
+		frame.dlc = dlc > sizeof(frame.data) ? sizeof(frame.data) : dlc;
+		memcpy(frame.data, data, frame.dlc);
+
+		m_flowControl.Push(frame);
+		chBSemSignal(&m_flowControlSignal);
+		return;
+	}
+
+	IsoTpFrame reply;
+	auto result = m_rx.OnFrame(data, dlc, reply);
+
+	if (reply.dlc) {
+		sendFrame(reply);
+	}
+
+	if (result == IsoTpRxResult::Complete) {
+		const uint8_t* message = m_rx.GetData();
+
+		for (size_t i = 0; i < m_rx.GetSize(); i++) {
+			if (!m_rxFifo.Push(message[i])) {
+				// TS isn't reading, whatever it sent next is garbage anyway
+				rxOverflows++;
+				break;
+			}
+		}
+
+		chBSemSignal(&m_rxSignal);
+	}
+}
+
+size_t CanTsChannel::readTimeout(uint8_t* buffer, size_t size, int timeout) {
+	size_t received = 0;
+
+	while (true) {
+		while (received < size && m_rxFifo.Pop(buffer[received])) {
+			received++;
+		}
+
+		if (received == size) {
+			return received;
+		}
+
+		// Nothing new for the whole timeout, give up with what we have
+		if (chBSemWaitTimeout(&m_rxSignal, timeout) != MSG_OK) {
+			return received;
+		}
+	}
+}
+
+void CanTsChannel::write(const uint8_t* buffer, size_t size, bool isEndOfPacket) {
+	while (size) {
+		size_t count = sizeof(m_txBuffer) - m_txFill;
+		if (count > size) {
+			count = size;
+		}
+
+		memcpy(m_txBuffer + m_txFill, buffer, count);
+		m_txFill += count;
+		buffer += count;
+		size -= count;
+
+		// Doesn't fit one message, the rest of the packet goes in the next one
+		if (m_txFill == sizeof(m_txBuffer)) {
+			flush();
+		}
+	}
+
+	if (isEndOfPacket) {
+		flush();
+	}
+}
+
+void CanTsChannel::flush() {
+	if (m_txFill == 0) {
+		return;
+	}
+
+	// Anything left over belongs to a message that is long gone
+	IsoTpFrame frame;
+	while (m_flowControl.Pop(frame)) { }
+	chBSemReset(&m_flowControlSignal, true);
+
+	if (m_tx.Start(m_txBuffer, m_txFill, frame)) {
+		sendFrame(frame);
+	}
+
+	while (!m_tx.IsDone()) {
+		if (m_tx.IsWaitingForFlowControl()) {
+			if (m_flowControl.Pop(frame)) {
+				if (!m_tx.OnFlowControl(frame.data, frame.dlc)) {
+					// host can't take it
+					txAborts++;
+				}
+			} else if (chBSemWaitTimeout(&m_flowControlSignal, CAN_TS_FLOW_CONTROL_TIMEOUT) != MSG_OK) {
+				// host went away
+				m_tx.Abort();
+				txAborts++;
+			}
+
+			continue;
+		}
+
+		m_tx.NextFrame(frame);
+		sendFrame(frame);
+
+		uint32_t separationUs = m_tx.GetSeparationTimeUs();
+		if (separationUs) {
+			chThdSleepMicroseconds(separationUs);
+		}
+	}
+
+	m_txFill = 0;
+}
+
+#endif // EFI_CAN_SERIAL
@@ -3,6 +3,7 @@
  */
 
 #include <string.h>
+#include <stdarg.h>
 
 #include "rusefi/arrays.h"
 #include "tunerstudio_io.h"
@@ -10,8 +11,6 @@
 #include "chprintf.h"
 #include "wideband_config.h"
 
-#if HAL_USE_SERIAL
-
 #ifndef BT_SERIAL_OVER_JDY33
 	#define BT_SERIAL_OVER_JDY33	FALSE
 #endif
@@ -27,7 +26,21 @@ static_assert(efi::size(baudRates) == efi::size(baudRateCodes));
 
 static const unsigned int btModuleTimeout = TIME_MS2I(100);
 
-int SerialTsChannel::bt_read_line(char *str, size_t max_len)
+int SerialTsChannelBase::bt_printf(const char *fmt, ...)
+{
+	char tmp[64];
+	va_list ap;
+
+	va_start(ap, fmt);
+	int len = chvsnprintf(tmp, sizeof(tmp), fmt, ap);
+	va_end(ap);
+
+	write((const uint8_t *)tmp, len, true);
+
+	return len;
+}
+
+int SerialTsChannelBase::bt_read_line(char *str, size_t max_len)
 {
 	size_t i = 0;
 
@@ -42,7 +55,7 @@ int SerialTsChannel::bt_read_line(char *str, size_t max_len)
 	return i;
 }
 
-int SerialTsChannel::bt_wait_ok(void)
+int SerialTsChannelBase::bt_wait_ok(void)
 {
 	/* wait for '+OK\r\n' */
 	char tmp[6];
@@ -54,9 +67,9 @@ int SerialTsChannel::bt_wait_ok(void)
 	return -1;
 }
 
-int SerialTsChannel::bt_disconnect(void)
+int SerialTsChannelBase::bt_disconnect(void)
 {
-	chprintf((BaseSequentialStream *)m_driver, "AT+DISC\r\n");
+	bt_printf("AT+DISC\r\n");
 
 	return bt_wait_ok();
 }
@@ -65,33 +78,21 @@ int SerialTsChannel::bt_disconnect(void)
 #define PORT_EXTRA_SERIAL_CR2 0
 #endif
 
-int SerialTsChannel::start(uint32_t newBaud) {
-	SerialConfig cfg = {
-		.speed = newBaud,
-		.cr1 = 0,
-		.cr2 = USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2,
-		.cr3 = 0
-	};
-
+int SerialTsChannelBase::start(uint32_t newBaud) {
 	baud = newBaud;
 
-	sdStart(m_driver, &cfg);
+	open(baud);
 
 	return 0;
 }
 
 /* this will also try to reinit BT module */
-int SerialTsChannel::reStart() {
+int SerialTsChannelBase::reStart() {
 	int ret = 0;
-	SerialConfig cfg = {
-		.speed = baud,
-		.cr1 = 0,
-		.cr2 = USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2,
-		.cr3 = 0
-	};
+	uint32_t speed = baud;
 
 	/* Stop first */
-	sdStop(m_driver);
+	stop();
 
 	if (BT_SERIAL_OVER_JDY33) {
 		/* try BT setup */
@@ -101,15 +102,15 @@ int SerialTsChannel::reStart() {
 
 		do {
 			for (baudIdx = 0; baudIdx < efi::size(baudRates) && !done; baudIdx++) {
-				cfg.speed = baudRates[baudIdx];
-				sdStart(m_driver, &cfg);
+				speed = baudRates[baudIdx];
+				open(speed);
 
-				chprintf((BaseSequentialStream *)m_driver, "AT\r\n");
+				bt_printf("AT\r\n");
 				if (bt_wait_ok() != 0) {
 					/* try to diconnect in case device already configured and in silence mode */
 					if (bt_disconnect() != 0) {
 						/* try next baud rate */
-						sdStop(m_driver);
+						stop();
 						continue;
 					}
 				}
@@ -142,7 +143,7 @@ int SerialTsChannel::reStart() {
 			done = false;
 			do {
 				/* just a curious */
-				chprintf((BaseSequentialStream *)m_driver, "AT+VERSION\r\n");
+				bt_printf("AT+VERSION\r\n");
 				len = bt_read_line(tmp, sizeof(tmp));
 				if (len < 0) {
 					/* retry */
@@ -150,41 +151,41 @@ int SerialTsChannel::reStart() {
 				}
 
 				/* Reset settings to defaults */
-				chprintf((BaseSequentialStream *)m_driver, "AT+DEFAULT\r\n");
+				bt_printf("AT+DEFAULT\r\n");
 				if (bt_wait_ok() != 0) {
 					/* retry */
 					continue;
 				}
 
 				/* SPP Broadcast name: up to 18 bytes */
-				chprintf((BaseSequentialStream *)m_driver, "AT+NAME%s\r\n", BT_BROADCAST_NAME);
+				bt_printf("AT+NAME%s\r\n", BT_BROADCAST_NAME);
 				if (bt_wait_ok() != 0) {
 					/* retry */
 					continue;
 				}
 
 				/* BLE Broadcast name: up to 18 bytes */
-				chprintf((BaseSequentialStream *)m_driver, "AT+NAMB%s\r\n", BT_BROADCAST_NAME " BLE");
+				bt_printf("AT+NAMB%s\r\n", BT_BROADCAST_NAME " BLE");
 				if (bt_wait_ok() != 0) {
 					/* retry */
 					continue;
 				}
 
 				/* SPP connection with no password */
-				chprintf((BaseSequentialStream *)m_driver, "AT+TYPE%d\r\n", 0);
+				bt_printf("AT+TYPE%d\r\n", 0);
 				if (bt_wait_ok() != 0) {
 					/* retry */
 					continue;
 				}
 
 				/* Disable serial port status output */
-				chprintf((BaseSequentialStream *)m_driver, "AT+ENLOG%d\r\n", 0);
+				bt_printf("AT+ENLOG%d\r\n", 0);
 				if (bt_wait_ok() != 0) {
 					/* retry */
 					continue;
 				}
 
-				chprintf((BaseSequentialStream *)m_driver, "AT+BAUD%d\r\n", baudRateCodes[baudIdx]);
+				bt_printf("AT+BAUD%d\r\n", baudRateCodes[baudIdx]);
 				if (bt_wait_ok() != 0) {
 					/* retry */
 					continue;
@@ -195,20 +196,20 @@ int SerialTsChannel::reStart() {
 			} while ((!done) && (--retry));
 
 			if (retry <= 0) {
-				sdStop(m_driver);
+				stop();
 				ret = -3;
 			}
 		}
 
 		if (ret == 0) {
 			/* switch to new baudrate? */
-			if (cfg.speed != baud) {
-				sdStop(m_driver);
+			if (speed != baud) {
+				stop();
 
 				if (ret == 0) {
 					/* switch baudrate */
-					cfg.speed = baud;
-					sdStart(m_driver, &cfg);
+					speed = baud;
+					open(speed);
 
 					chThdSleepMilliseconds(10);
 				}
@@ -217,26 +218,38 @@ int SerialTsChannel::reStart() {
 
 		if (ret == 0) {
 			/* now reset BT to apply new settings */
-			chprintf((BaseSequentialStream *)m_driver, "AT+RESET\r\n");
+			bt_printf("AT+RESET\r\n");
 			if (bt_wait_ok() != 0) {
-				sdStop(m_driver);
+				stop();
 				ret = -4;
 			}
 		}
 
 		if (ret < 0) {
 			/* set requested baudrate and wait for direct uart connection */
-			cfg.speed = baud;
-			sdStart(m_driver, &cfg);
+			speed = baud;
+			open(speed);
 		}
 	} else {
 		/* Direct uart connetion */
-		sdStart(m_driver, &cfg);
+		open(speed);
 	}
 
 	return ret;
 }
 
+#if HAL_USE_SERIAL
+void SerialTsChannel::open(uint32_t speed) {
+	SerialConfig cfg = {
+		.speed = speed,
+		.cr1 = 0,
+		.cr2 = USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2,
+		.cr3 = 0
+	};
+
+	sdStart(m_driver, &cfg);
+}
+
 void SerialTsChannel::stop() {
 	sdStop(m_driver);
 }
@@ -251,27 +264,19 @@ size_t SerialTsChannel::readTimeout(uint8_t* buffer, size_t size, int timeout) {
 #endif // HAL_USE_SERIAL
 
 #if (HAL_USE_UART == TRUE) && (UART_USE_WAIT == TRUE)
-int UartTsChannel::start(uint32_t newBaud) {
+void UartTsChannel::open(uint32_t speed) {
 	m_config.txend1_cb 		= NULL;
 	m_config.txend2_cb 		= NULL;
 	m_config.rxend_cb 		= NULL;
 	m_config.rxchar_cb		= NULL;
 	m_config.rxerr_cb		= NULL;
 	m_config.timeout_cb		= NULL;
-	m_config.speed 			= newBaud;
+	m_config.speed 			= speed;
 	m_config.cr1 			= 0;
-	m_config.cr2 			= 0/*USART_CR2_STOP1_BITS*/ | USART_CR2_LINEN;
+	m_config.cr2 			= USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2;
 	m_config.cr3 			= 0;
 
 	uartStart(m_driver, &m_config);
-
-	return 0;
-}
-
-int UartTsChannel::reStart() {
-	stop();
-	/* TODO: add BT setup? */
-	start(baud);
 }
 
 void UartTsChannel::stop() {
@@ -286,4 +291,105 @@ size_t UartTsChannel::readTimeout(uint8_t* buffer, size_t size, int timeout) {
 	uartReceiveTimeout(m_driver, &size, buffer, timeout);
 	return size;
 }
+
+// The UART callbacks only get the driver
+static UartDmaTsChannel* dmaChannels[2];
+
+UartDmaTsChannel::UartDmaTsChannel(UARTDriver& driver)
+	: UartTsChannel(driver)
+	, m_rxRing(m_rxDma, sizeof(m_rxDma))
+{
+	chBSemObjectInit(&m_rxSignal, true);
+
+	for (auto& slot : dmaChannels) {
+		if (!slot) {
+			slot = this;
+			break;
+		}
+	}
+}
+
+void UartDmaTsChannel::open(uint32_t speed) {
+	// Restarting, the circular receive below never ends on its own
+	uartStop(m_driver);
+
+	m_config.txend1_cb 		= NULL;
+	m_config.txend2_cb 		= NULL;
+	m_config.rxend_cb 		= NULL;
+	m_config.rxchar_cb		= NULL;
+	m_config.rxerr_cb		= NULL;
+	// Line idle, the end of a TS command
+	m_config.timeout_cb		= rxIdleCallback;
+	m_config.speed 			= speed;
+	m_config.cr1 			= 0;
+	m_config.cr2 			= USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2;
+	m_config.cr3 			= 0;
+
+	uartStart(m_driver, &m_config);
+
+	m_rxRing.Reset();
+	m_txStageFill = 0;
+
+	// Take the RX DMA over from the driver's one character idle loop. Without its
+	// interrupts enabled the driver never touches it again, the idle interrupt tells us about new data.
+	dmaStreamDisable(m_driver->dmarx);
+	dmaStreamSetMemory0(m_driver->dmarx, m_rxDma);
+	dmaStreamSetTransactionSize(m_driver->dmarx, sizeof(m_rxDma));
+	dmaStreamSetMode(m_driver->dmarx, m_driver->dmarxmode | STM32_DMA_CR_MINC | STM32_DMA_CR_CIRC);
+	dmaStreamEnable(m_driver->dmarx);
+}
+
+/*static*/ void UartDmaTsChannel::rxIdleCallback(UARTDriver* uartp) {
+	for (auto channel : dmaChannels) {
+		if (channel && channel->m_driver == uartp) {
+			osalSysLockFromISR();
+			chBSemSignalI(&channel->m_rxSignal);
+			osalSysUnlockFromISR();
+		}
+	}
+}
+
+size_t UartDmaTsChannel::readTimeout(uint8_t* buffer, size_t size, int timeout) {
+	size_t received = 0;
+
+	while (true) {
+		received += m_rxRing.Read(dmaStreamGetTransactionSize(m_driver->dmarx), buffer + received, size - received);
+
+		if (received == size) {
+			return received;
+		}
+
+		// Nothing new for the whole timeout, give up with what we have
+		if (chBSemWaitTimeout(&m_rxSignal, timeout) != MSG_OK) {
+			return received;
+		}
+	}
+}
+
+void UartDmaTsChannel::send(const uint8_t* buffer, size_t size) {
+	if (size) {
+		uartSendTimeout(m_driver, &size, buffer, BINARY_IO_TIMEOUT);
+	}
+}
+
+void UartDmaTsChannel::write(const uint8_t* buffer, size_t size, bool isEndOfPacket) {
+	if (size <= sizeof(m_txStage) - m_txStageFill) {
+		// Small piece (header, CRC), goes out together with whatever comes next
+		memcpy(m_txStage + m_txStageFill, buffer, size);
+		m_txStageFill += size;
+	} else {
+		flush();
+		// Straight from the caller's buffer, it has to stay put until this returns
+		send(buffer, size);
+	}
+
+	if (isEndOfPacket) {
+		flush();
+	}
+}
+
+void UartDmaTsChannel::flush() {
+	send(m_txStage, m_txStageFill);
+	m_txStageFill = 0;
+}
 #endif // HAL_USE_UART
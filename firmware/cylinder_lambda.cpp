@@ -0,0 +1,192 @@
+#include "cylinder_lambda.h"
+
+#include <atomic>
+
+void CylinderLambda::PostEngineEvent(uint8_t cylinder, uint8_t cylinderCount)
+{
+    if (cylinderCount == 0 || cylinderCount > CYL_LAMBDA_MAX_CYLINDERS || cylinder >= cylinderCount)
+    {
+        return;
+    }
+
+    m_pendingCylinder = cylinder;
+    m_pendingCylinderCount = cylinderCount;
+    m_eventPending = true;
+}
+
+void CylinderLambda::OnSample(float pumpCurrent)
+{
+    if (m_eventPending)
+    {
+        uint8_t cylinder = m_pendingCylinder;
+        uint8_t cylinderCount = m_pendingCylinderCount;
+        m_eventPending = false;
+
+        if (cylinderCount != m_cylinderCount || !IsActive())
+        {
+            // Engine changed or we lost sync, history no longer means anything
+            Reset();
+            m_cylinderCount = cylinderCount;
+        }
+        else
+        {
+            CloseWindow();
+        }
+
+        m_currentCylinder = cylinder;
+        m_windowOpen = true;
+        m_lastEvent.reset();
+
+        Publish();
+    }
+
+    if (!m_windowOpen)
+    {
+        return;
+    }
+
+    if (!IsActive())
+    {
+        // Events stopped, don't let this window grow forever
+        m_windowOpen = false;
+        return;
+    }
+
+    m_windowSum += pumpCurrent;
+    m_windowSamples++;
+}
+
+void CylinderLambda::CloseWindow()
+{
+    if (!m_windowOpen || m_windowSamples == 0)
+    {
+        return;
+    }
+
+    auto& h = m_history[m_currentCylinder];
+
+    h.pumpCurrent[h.head] = m_windowSum / m_windowSamples;
+    h.head = (h.head + 1) % CYL_LAMBDA_HISTORY;
+
+    if (h.count < CYL_LAMBDA_HISTORY)
+    {
+        h.count++;
+    }
+
+    m_windowSum = 0;
+    m_windowSamples = 0;
+}
+
+bool CylinderLambda::IsActive() const
+{
+    return m_cylinderCount != 0 && !m_lastEvent.hasElapsedMs(CYL_LAMBDA_TIMEOUT_MS);
+}
+
+uint8_t CylinderLambda::GetCylinderCount() const
+{
+    return m_cylinderCount;
+}
+
+uint8_t CylinderLambda::GetCurrentCylinder() const
+{
+    return m_currentCylinder;
+}
+
+bool CylinderLambda::GetAveragePumpCurrent(uint8_t cylinder, float& pumpCurrent) const
+{
+    if (cylinder >= m_cylinderCount)
+    {
+        return false;
+    }
+
+    const auto& h = m_history[cylinder];
+
+    uint8_t count = h.count;
+
+    if (count == 0)
+    {
+        return false;
+    }
+
+    float sum = 0;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        sum += h.pumpCurrent[i];
+    }
+
+    pumpCurrent = sum / count;
+    return true;
+}
+
+void CylinderLambda::Reset()
+{
+    m_cylinderCount = 0;
+    m_currentCylinder = 0;
+    m_windowOpen = false;
+    m_windowSum = 0;
+    m_windowSamples = 0;
+
+    for (auto& h : m_history)
+    {
+        h.head = 0;
+        h.count = 0;
+    }
+
+    m_lastEvent.init();
+
+    Publish();
+}
+
+void CylinderLambda::Publish()
+{
+    m_resultSequence = m_resultSequence + 1;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+
+    m_result.cylinderCount = m_cylinderCount;
+    m_result.currentCylinder = m_currentCylinder;
+    m_result.validMask = 0;
+    m_result.lastEvent = m_lastEvent;
+
+    for (uint8_t i = 0; i < CYL_LAMBDA_MAX_CYLINDERS; i++)
+    {
+        if (GetAveragePumpCurrent(i, m_result.pumpCurrent[i]))
+        {
+            m_result.validMask |= 1 << i;
+        }
+    }
+
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    m_resultSequence = m_resultSequence + 1;
+}
+
+void CylinderLambda::GetResult(CylinderLambdaResult& result) const
+{
+    uint32_t sequence;
+
+    // The sampling thread preempts readers, never the other way around, so this retries at
+    // most once or twice
+    do
+    {
+        sequence = m_resultSequence;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        result = m_result;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    } while ((sequence & 1) || sequence != m_resultSequence);
+}
+
+bool CylinderLambdaResult::IsActive() const
+{
+    return cylinderCount != 0 && !lastEvent.hasElapsedMs(CYL_LAMBDA_TIMEOUT_MS);
+}
+
+bool CylinderLambdaResult::GetAveragePumpCurrent(uint8_t cylinder, float& out) const
+{
+    if (cylinder >= cylinderCount || !(validMask & (1 << cylinder)))
+    {
+        return false;
+    }
+
+    out = pumpCurrent[cylinder];
+    return true;
+}
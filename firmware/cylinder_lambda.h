@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+
+#include "timer.h"
+
+#define CYL_LAMBDA_MAX_CYLINDERS 8
+
+// How many windows (engine cycles) are averaged for each cylinder
+#define CYL_LAMBDA_HISTORY 8
+
+// If the ECU stops sending engine events for this long, per-cylinder capture stops
+#define CYL_LAMBDA_TIMEOUT_MS 500
+
+// What other threads get to see, copied out in one piece by CylinderLambda::GetResult
+struct CylinderLambdaResult
+{
+    uint8_t cylinderCount;
+    uint8_t currentCylinder;
+    // Bit per cylinder that has an average in pumpCurrent
+    uint8_t validMask;
+    float pumpCurrent[CYL_LAMBDA_MAX_CYLINDERS];
+    Timer lastEvent;
+
+    bool IsActive() const;
+    bool GetAveragePumpCurrent(uint8_t cylinder, float& pumpCurrent) const;
+};
+
+/**
+ * Attributes pump current to individual cylinders, using TDC events sent by the ECU.
+ *
+ * Each engine event closes the window that started with the previous event: the average pump
+ * current over that window goes into the history ring of the cylinder that window belonged to.
+ * The ECU is expected to account for exhaust transport delay by choosing which cylinder index
+ * it reports, as it knows the engine speed and geometry.
+ *
+ * Pump current is kept rather than lambda so the per-sample work is only an addition,
+ * conversion to lambda happens when somebody asks for the result.
+ */
+class CylinderLambda
+{
+public:
+    // Called from the CAN thread: the window for this cylinder begins now
+    void PostEngineEvent(uint8_t cylinder, uint8_t cylinderCount);
+
+    // Called from the sampling thread with the unfiltered pump current of every sample
+    void OnSample(float pumpCurrent);
+
+    // Consistent copy of the results, safe from any thread. The getters below are for the
+    // sampling thread (and tests) only, anywhere else they can see a half updated history.
+    void GetResult(CylinderLambdaResult& result) const;
+
+    // True while engine events are arriving
+    bool IsActive() const;
+
+    uint8_t GetCylinderCount() const;
+    uint8_t GetCurrentCylinder() const;
+
+    // Average pump current of the recent windows for the cylinder,
+    // returns false if there is no data for it yet
+    bool GetAveragePumpCurrent(uint8_t cylinder, float& pumpCurrent) const;
+
+    void Reset();
+
+private:
+    void CloseWindow();
+    void Publish();
+
+    // Written by the CAN thread, consumed by the sampling thread.
+    // Engine events are much slower than samples, so a single slot is enough.
+    volatile bool m_eventPending = false;
+    volatile uint8_t m_pendingCylinder = 0;
+    volatile uint8_t m_pendingCylinderCount = 0;
+
+    uint8_t m_cylinderCount = 0;
+    uint8_t m_currentCylinder = 0;
+    bool m_windowOpen = false;
+
+    float m_windowSum = 0;
+    uint32_t m_windowSamples = 0;
+
+    struct History
+    {
+        float pumpCurrent[CYL_LAMBDA_HISTORY];
+        uint8_t head;
+        uint8_t count;
+    };
+
+    History m_history[CYL_LAMBDA_MAX_CYLINDERS] = {};
+
+    Timer m_lastEvent;
+
+    // Written by the sampling thread after every engine event, odd sequence while it is being
+    // written. Readers retry if it changed under them, the writer never waits.
+    CylinderLambdaResult m_result = {};
+    volatile uint32_t m_resultSequence = 0;
+};
+
+// Per channel instances, live alongside the samplers
+const CylinderLambda& GetCylinderLambda(int ch);
+
+// Forward an engine event from the ECU to all channels
+void PostEngineEvent(uint8_t cylinder, uint8_t cylinderCount);
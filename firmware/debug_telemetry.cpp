@@ -0,0 +1,148 @@
+#include "debug_telemetry.h"
+
+#include <cstring>
+
+#include "crc_backend.h"
+
+size_t CobsEncode(const uint8_t* in, size_t size, uint8_t* out)
+{
+    // Each block starts with the distance to the next zero, filled in once it is found
+    size_t codeIndex = 0;
+    size_t written = 1;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        if (in[i] == 0)
+        {
+            out[codeIndex] = code;
+            codeIndex = written++;
+            code = 1;
+            continue;
+        }
+
+        out[written++] = in[i];
+        code++;
+
+        // Longest block, 254 bytes with no zero after them
+        if (code == 0xFF)
+        {
+            out[codeIndex] = code;
+            codeIndex = written++;
+            code = 1;
+        }
+    }
+
+    out[codeIndex] = code;
+
+    return written;
+}
+
+size_t CobsDecode(const uint8_t* in, size_t size, uint8_t* out)
+{
+    size_t read = 0;
+    size_t written = 0;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    while (read < size)
+    {
+        uint8_t code = in[read++];
+
+        if (code == 0 || read + code - 1 > size)
+        {
+            return 0;
+        }
+
+        for (uint8_t i = 1; i < code; i++)
+        {
+            if (in[read] == 0)
+            {
+                return 0;
+            }
+
+            out[written++] = in[read++];
+        }
+
+        // Every block but a full one ends in a zero, except at the very end
+        if (code != 0xFF && read < size)
+        {
+            out[written++] = 0;
+        }
+    }
+
+    return written;
+}
+
+size_t BuildDebugTelemetryFrame(const DebugTelemetryHeader& header, const DebugTelemetryChannel* channels, uint8_t* out)
+{
+    uint8_t payload[DEBUG_TELEMETRY_MAX_PAYLOAD];
+
+    uint8_t channelCount = header.channelCount;
+    if (channelCount > DEBUG_TELEMETRY_MAX_CHANNELS)
+    {
+        channelCount = DEBUG_TELEMETRY_MAX_CHANNELS;
+    }
+
+    size_t size = 0;
+    memcpy(payload, &header, sizeof(header));
+    payload[offsetof(DebugTelemetryHeader, channelCount)] = channelCount;
+    size += sizeof(header);
+
+    memcpy(payload + size, channels, channelCount * sizeof(DebugTelemetryChannel));
+    size += channelCount * sizeof(DebugTelemetryChannel);
+
+    uint32_t crc = Crc32(payload, size);
+    memcpy(payload + size, &crc, sizeof(crc));
+    size += sizeof(crc);
+
+    size_t encoded = CobsEncode(payload, size, out);
+    out[encoded++] = 0;
+
+    return encoded;
+}
+
+bool ParseDebugTelemetryFrame(const uint8_t* frame, size_t size, DebugTelemetryHeader& header, DebugTelemetryChannel* channels)
+{
+    // Longer than any frame could be, don't even try
+    if (size >= DEBUG_TELEMETRY_MAX_FRAME)
+    {
+        return false;
+    }
+
+    uint8_t payload[DEBUG_TELEMETRY_MAX_FRAME];
+    size_t decoded = CobsDecode(frame, size, payload);
+
+    if (decoded < sizeof(header) + sizeof(uint32_t))
+    {
+        return false;
+    }
+
+    uint32_t crc;
+    decoded -= sizeof(crc);
+    memcpy(&crc, payload + decoded, sizeof(crc));
+
+    if (crc != Crc32(payload, decoded))
+    {
+        return false;
+    }
+
+    memcpy(&header, payload, sizeof(header));
+
+    if (header.version != DEBUG_TELEMETRY_VERSION || header.channelCount > DEBUG_TELEMETRY_MAX_CHANNELS)
+    {
+        return false;
+    }
+
+    if (decoded != sizeof(header) + header.channelCount * sizeof(DebugTelemetryChannel))
+    {
+        return false;
+    }
+
+    memcpy(channels, payload + sizeof(header), header.channelCount * sizeof(DebugTelemetryChannel));
+
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Binary debug telemetry for the debug UART, instead of the text lines.
+ *
+ * Each frame is a DebugTelemetryHeader, then header.channelCount DebugTelemetryChannel, then the
+ * CRC32 (crc_backend.h) of all that, little endian. The whole thing is COBS encoded and ends in a
+ * 0x00, so a receiver can start anywhere and just wait for the next zero. Decode with tools/wb_telemetry.cpp.
+ *
+ * A frame with both channels is 56 bytes on the wire: about 200 frames/s fit 115200 baud,
+ * 1 kHz takes 921600 baud.
+ */
+#define DEBUG_TELEMETRY_VERSION 1
+#define DEBUG_TELEMETRY_MAX_CHANNELS 2
+
+struct DebugTelemetryHeader
+{
+    uint8_t version;
+    // Counts up by one per frame, gaps are lost frames
+    uint8_t sequence;
+    uint32_t timeUs;            // GetLocalTimeUs
+    uint16_t supplyVoltage;     // mV, 0 if the board can't measure it
+    int8_t mcuTemp;             // deg C
+    uint8_t channelCount;
+} __attribute__((packed));
+
+struct DebugTelemetryChannel
+{
+    uint16_t lambda;            // 0.0001
+    int16_t pumpCurrent;        // uA
+    int16_t nernstDc;           // mV
+    int16_t nernstAc;           // mV
+    uint16_t esr;               // ohm
+    int16_t sensorTemp;         // deg C
+    uint16_t pumpDuty;          // 0.1%
+    uint16_t heaterDuty;        // 0.1%
+    uint16_t heaterVoltage;     // mV
+    uint8_t heaterState;        // HeaterState
+    uint8_t status;             // wbo::Status
+} __attribute__((packed));
+
+#define DEBUG_TELEMETRY_MAX_PAYLOAD (sizeof(DebugTelemetryHeader) + DEBUG_TELEMETRY_MAX_CHANNELS * sizeof(DebugTelemetryChannel) + 4)
+// COBS adds a byte per 254, plus the first one, plus the delimiter
+#define DEBUG_TELEMETRY_MAX_FRAME (DEBUG_TELEMETRY_MAX_PAYLOAD + DEBUG_TELEMETRY_MAX_PAYLOAD / 254 + 2)
+
+// COBS, without the delimiter. out needs size + size / 254 + 1.
+size_t CobsEncode(const uint8_t* in, size_t size, uint8_t* out);
+// Returns the decoded size, 0 if it isn't valid COBS (a zero inside, or a block running past the end)
+size_t CobsDecode(const uint8_t* in, size_t size, uint8_t* out);
+
+// Whole frame, delimiter included, into out (DEBUG_TELEMETRY_MAX_FRAME). Returns its size.
+size_t BuildDebugTelemetryFrame(const DebugTelemetryHeader& header, const DebugTelemetryChannel* channels, uint8_t* out);
+
+// frame without the delimiter. Returns false if it is damaged or not a frame this understands.
+bool ParseDebugTelemetryFrame(const uint8_t* frame, size_t size, DebugTelemetryHeader& header, DebugTelemetryChannel* channels);
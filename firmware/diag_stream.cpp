@@ -0,0 +1,160 @@
+#include "diag_stream.h"
+
+#include "../for_rusefi/wideband_can.h"
+
+#define DIAG_SEQ_MASK 0x1F
+
+static uint8_t MakeHeader(uint8_t type, uint8_t seq)
+{
+    return (seq << 3) | type;
+}
+
+static void Put16(uint8_t* dst, uint16_t value)
+{
+    dst[0] = value & 0xFF;
+    dst[1] = value >> 8;
+}
+
+static uint16_t Get16(const uint8_t* src)
+{
+    return src[0] | (src[1] << 8);
+}
+
+static bool FitsInt8(int32_t delta)
+{
+    return delta >= INT8_MIN && delta <= INT8_MAX;
+}
+
+size_t DiagStreamEncoder::Encode(const DiagStreamSample& sample, uint8_t divider, DiagStreamFrame* out)
+{
+    m_seq = (m_seq + 1) & DIAG_SEQ_MASK;
+
+    int32_t deltas[] = {
+        sample.nernstDc - m_last.nernstDc,
+        sample.nernstAc - m_last.nernstAc,
+        sample.pumpCurrent - m_last.pumpCurrent,
+        sample.pumpDuty - m_last.pumpDuty,
+        sample.heaterDuty - m_last.heaterDuty,
+    };
+
+    bool deltaFits = true;
+
+    for (auto d : deltas)
+    {
+        deltaFits &= FitsInt8(d);
+    }
+
+    m_last = sample;
+
+    if (deltaFits && m_sinceKeyframe < DIAG_STREAM_KEYFRAME_INTERVAL)
+    {
+        m_sinceKeyframe++;
+
+        out[0].data[0] = MakeHeader(WB_DIAG_FRAME_DELTA, m_seq);
+
+        for (size_t i = 0; i < 5; i++)
+        {
+            out[0].data[1 + i] = static_cast<int8_t>(deltas[i]);
+        }
+
+        out[0].dlc = 6;
+
+        return 1;
+    }
+
+    m_sinceKeyframe = 0;
+
+    out[0].data[0] = MakeHeader(WB_DIAG_FRAME_KEY_A, m_seq);
+    Put16(&out[0].data[1], sample.nernstDc);
+    Put16(&out[0].data[3], sample.nernstAc);
+    Put16(&out[0].data[5], sample.pumpCurrent);
+    out[0].dlc = 7;
+
+    out[1].data[0] = MakeHeader(WB_DIAG_FRAME_KEY_B, m_seq);
+    Put16(&out[1].data[1], sample.pumpDuty);
+    Put16(&out[1].data[3], sample.heaterDuty);
+    out[1].data[5] = divider;
+    out[1].dlc = 6;
+
+    return 2;
+}
+
+void DiagStreamEncoder::ForceKeyframe()
+{
+    m_sinceKeyframe = DIAG_STREAM_KEYFRAME_INTERVAL;
+}
+
+bool DiagStreamDecoder::Decode(const uint8_t* data, uint8_t dlc, DiagStreamSample& sample)
+{
+    if (dlc < 1)
+    {
+        return false;
+    }
+
+    uint8_t type = data[0] & 0x07;
+    uint8_t seq = data[0] >> 3;
+
+    switch (type)
+    {
+    case WB_DIAG_FRAME_KEY_A:
+        if (dlc < 7)
+        {
+            return false;
+        }
+
+        m_last.nernstDc = Get16(&data[1]);
+        m_last.nernstAc = Get16(&data[3]);
+        m_last.pumpCurrent = Get16(&data[5]);
+        m_haveKeyA = true;
+        m_keyASeq = seq;
+
+        return false;
+    case WB_DIAG_FRAME_KEY_B:
+        if (dlc < 6 || !m_haveKeyA || seq != m_keyASeq)
+        {
+            m_haveKeyA = false;
+            return false;
+        }
+
+        if (m_valid && seq != ((m_seq + 1) & DIAG_SEQ_MASK))
+        {
+            m_lost++;
+        }
+
+        m_last.pumpDuty = Get16(&data[1]);
+        m_last.heaterDuty = Get16(&data[3]);
+        m_divider = data[5];
+        m_haveKeyA = false;
+
+        break;
+    case WB_DIAG_FRAME_DELTA:
+        if (dlc < 6 || !m_valid)
+        {
+            return false;
+        }
+
+        if (seq != ((m_seq + 1) & DIAG_SEQ_MASK))
+        {
+            // Missed something, can't apply deltas until the next keyframe
+            m_valid = false;
+            m_lost++;
+            return false;
+        }
+
+        m_last.nernstDc += static_cast<int8_t>(data[1]);
+        m_last.nernstAc += static_cast<int8_t>(data[2]);
+        m_last.pumpCurrent += static_cast<int8_t>(data[3]);
+        m_last.pumpDuty += static_cast<int8_t>(data[4]);
+        m_last.heaterDuty += static_cast<int8_t>(data[5]);
+
+        break;
+    default:
+        return false;
+    }
+
+    m_valid = true;
+    m_seq = seq;
+    sample = m_last;
+
+    return true;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Send a keyframe at least this often, so a receiver joining late (or
+// missing a frame) picks the stream back up quickly
+#define DIAG_STREAM_KEYFRAME_INTERVAL 50
+
+// One sample of the diagnostic stream, already scaled to wire units
+struct DiagStreamSample
+{
+    int16_t nernstDc;       // mV
+    int16_t nernstAc;       // mV
+    int16_t pumpCurrent;    // uA
+    uint16_t pumpDuty;      // 0.1%
+    uint16_t heaterDuty;    // 0.1%
+
+    bool operator==(const DiagStreamSample& other) const = default;
+};
+
+struct DiagStreamFrame
+{
+    uint8_t data[8];
+    uint8_t dlc;
+};
+
+/**
+ * Encodes samples as delta frames, falling back to keyframes periodically,
+ * whenever a delta doesn't fit in 8 bits, or when asked to after a frame was dropped.
+ * See WB_TELEMETRY_DIAG_STREAM in wideband_can.h for the wire format.
+ */
+class DiagStreamEncoder
+{
+public:
+    // Returns the number of frames written to out (1 or 2), out must have room for 2
+    size_t Encode(const DiagStreamSample& sample, uint8_t divider, DiagStreamFrame* out);
+
+    // Next sample goes out as a keyframe
+    void ForceKeyframe();
+
+private:
+    DiagStreamSample m_last = {};
+    uint8_t m_seq = 0;
+    uint8_t m_sinceKeyframe = DIAG_STREAM_KEYFRAME_INTERVAL;
+};
+
+/**
+ * Receiving side, for tools and tests.
+ */
+class DiagStreamDecoder
+{
+public:
+    // Returns true when a complete sample has been decoded into sample
+    bool Decode(const uint8_t* data, uint8_t dlc, DiagStreamSample& sample);
+
+    uint8_t GetDivider() const
+    {
+        return m_divider;
+    }
+
+    uint32_t GetLostCount() const
+    {
+        return m_lost;
+    }
+
+private:
+    DiagStreamSample m_last = {};
+    bool m_valid = false;
+
+    bool m_haveKeyA = false;
+    uint8_t m_keyASeq = 0;
+
+    uint8_t m_seq = 0;
+    uint8_t m_divider = 0;
+    uint32_t m_lost = 0;
+};
+
+// Start/stop streaming a channel, divider 0 is off
+void SetDiagStream(uint8_t ch, uint8_t divider);
+// Called by the sampling thread after every sample
+void DiagStreamOnSample(uint8_t ch);
+void InitDiagStream();
@@ -0,0 +1,140 @@
+#include "ch.h"
+#include "hal.h"
+
+#include "diag_stream.h"
+#include "can_helper.h"
+#include "heater_control.h"
+#include "pump_dac.h"
+#include "sampling.h"
+#include "port.h"
+#include "spsc_fifo.h"
+
+#include "wideband_config.h"
+
+#include "../for_rusefi/wideband_can.h"
+
+struct DiagStreamChannel
+{
+    // Written by the CAN Rx thread, picked up by the sampling thread
+    volatile uint8_t requestedDivider = 0;
+
+    // Owned by the sampling thread
+    uint8_t divider = 0;
+    uint8_t count = 0;
+    float nernstDc = 0;
+    float nernstAc = 0;
+    float pumpCurrent = 0;
+    float pumpDuty = 0;
+    float heaterDuty = 0;
+    DiagStreamEncoder encoder;
+
+    // Sampling thread -> diag stream thread
+    SpscFifo<DiagStreamFrame, 64> fifo;
+};
+
+static DiagStreamChannel channels[AFR_CHANNELS];
+
+void SetDiagStream(uint8_t ch, uint8_t divider)
+{
+    if (ch < AFR_CHANNELS)
+    {
+        channels[ch].requestedDivider = divider;
+    }
+}
+
+void DiagStreamOnSample(uint8_t ch)
+{
+    auto& c = channels[ch];
+
+    if (c.divider != c.requestedDivider)
+    {
+        c.divider = c.requestedDivider;
+        c.count = 0;
+        c.nernstDc = c.nernstAc = c.pumpCurrent = c.pumpDuty = c.heaterDuty = 0;
+        c.encoder.ForceKeyframe();
+    }
+
+    if (c.divider == 0)
+    {
+        return;
+    }
+
+    const auto& sampler = GetSampler(ch);
+
+    // Average over the decimation window instead of just dropping samples
+    c.nernstDc += sampler.GetNernstDc();
+    c.nernstAc += sampler.GetNernstAc();
+    c.pumpCurrent += sampler.GetPumpNominalCurrentUnfiltered();
+    c.pumpDuty += GetPumpOutputDuty(ch);
+    c.heaterDuty += GetHeaterDuty(ch);
+
+    if (++c.count < c.divider)
+    {
+        return;
+    }
+
+    float scale = 1.0f / c.count;
+
+    DiagStreamSample sample;
+    sample.nernstDc = c.nernstDc * scale * 1000;
+    sample.nernstAc = c.nernstAc * scale * 1000;
+    sample.pumpCurrent = c.pumpCurrent * scale * 1000;
+    sample.pumpDuty = c.pumpDuty * scale * 1000;
+    sample.heaterDuty = c.heaterDuty * scale * 1000;
+
+    c.count = 0;
+    c.nernstDc = c.nernstAc = c.pumpCurrent = c.pumpDuty = c.heaterDuty = 0;
+
+    if (c.fifo.GetFree() < 2)
+    {
+        // Bus can't keep up, drop this sample and resync the receiver afterwards
+        c.encoder.ForceKeyframe();
+        return;
+    }
+
+    DiagStreamFrame frames[2];
+    size_t frameCount = c.encoder.Encode(sample, c.divider, frames);
+
+    for (size_t i = 0; i < frameCount; i++)
+    {
+        c.fifo.Push(frames[i]);
+    }
+}
+
+static THD_WORKING_AREA(waDiagStreamThread, 256);
+static void DiagStreamThread(void*)
+{
+    chRegSetThreadName("CAN Diag");
+
+    while (true)
+    {
+        bool anyEnabled = false;
+
+        for (uint8_t ch = 0; ch < AFR_CHANNELS; ch++)
+        {
+            auto& c = channels[ch];
+            anyEnabled |= c.requestedDivider != 0;
+
+            DiagStreamFrame frame;
+
+            while (c.fifo.Pop(frame))
+            {
+                auto id = WB_MSG_TELEMETRY(WB_TELEMETRY_DIAG_STREAM, ch + GetConfiguration()->CanIndexOffset);
+                CanTxMessage msg(id, frame.dlc, true);
+
+                for (size_t i = 0; i < frame.dlc; i++)
+                {
+                    msg[i] = frame.data[i];
+                }
+            }
+        }
+
+        // Poll quickly while streaming, lazily otherwise
+        chThdSleepMilliseconds(anyEnabled ? 1 : 100);
+    }
+}
+
+void InitDiagStream()
+{
+    chThdCreateStatic(waDiagStreamThread, sizeof(waDiagStreamThread), NORMALPRIO - 2, DiagStreamThread, nullptr);
+}
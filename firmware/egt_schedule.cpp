@@ -0,0 +1,29 @@
+#include "egt_schedule.h"
+
+uint32_t EgtSchedule::TimeUntilDue(uint32_t nowMs) const
+{
+    return IsDue(nowMs) ? 0 : m_nextMs - nowMs;
+}
+
+void EgtSchedule::Done(uint32_t nowMs, uint32_t periodMs, bool ok)
+{
+    if (ok)
+    {
+        m_errorStreak = 0;
+        m_nextMs = nowMs + periodMs;
+        return;
+    }
+
+    if (m_errorStreak < UINT8_MAX)
+    {
+        m_errorStreak++;
+    }
+
+    uint32_t delay = periodMs;
+    for (uint8_t i = 1; i < m_errorStreak && delay < EGT_BACKOFF_MAX_MS; i++)
+    {
+        delay *= 2;
+    }
+
+    m_nextMs = nowMs + (delay < EGT_BACKOFF_MAX_MS ? delay : EGT_BACKOFF_MAX_MS);
+}
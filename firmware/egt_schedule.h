@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+// Longest wait between retries of a chip that doesn't answer
+#define EGT_BACKOFF_MAX_MS 5000
+
+/**
+ * When to read one EGT chip next. While it answers, once per conversion period. While it
+ * doesn't, the first retry comes after the usual period (one glitch shouldn't cost more), then
+ * the wait doubles up to EGT_BACKOFF_MAX_MS, so a missing or broken chip doesn't take bus time
+ * from the working ones.
+ */
+class EgtSchedule
+{
+public:
+    bool IsDue(uint32_t nowMs) const
+    {
+        return static_cast<int32_t>(nowMs - m_nextMs) >= 0;
+    }
+
+    // 0 if due now
+    uint32_t TimeUntilDue(uint32_t nowMs) const;
+
+    // A read (or detection attempt) finished at nowMs, ok if the chip answered
+    void Done(uint32_t nowMs, uint32_t periodMs, bool ok);
+
+    uint8_t GetErrorStreak() const
+    {
+        return m_errorStreak;
+    }
+
+private:
+    uint32_t m_nextMs = 0;
+    uint8_t m_errorStreak = 0;
+};
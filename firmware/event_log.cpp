@@ -0,0 +1,242 @@
+#include "event_log.h"
+
+#include <cstring>
+
+bool SupplyMonitor::Update(float voltage, EventType& event)
+{
+    EventType next;
+
+    if (voltage < EVENT_LOG_SUPPLY_LOW)
+    {
+        next = EventType::SupplyLow;
+    }
+    else if (voltage > EVENT_LOG_SUPPLY_HIGH)
+    {
+        next = EventType::SupplyHigh;
+    }
+    else if (m_state == EventType::SupplyLow && voltage < EVENT_LOG_SUPPLY_LOW + EVENT_LOG_SUPPLY_HYSTERESIS)
+    {
+        next = EventType::SupplyLow;
+    }
+    else if (m_state == EventType::SupplyHigh && voltage > EVENT_LOG_SUPPLY_HIGH - EVENT_LOG_SUPPLY_HYSTERESIS)
+    {
+        next = EventType::SupplyHigh;
+    }
+    else
+    {
+        next = EventType::SupplyNormal;
+    }
+
+    if (next == m_state)
+    {
+        return false;
+    }
+
+    m_state = next;
+    event = next;
+    return true;
+}
+
+void EventLog::Load(ConfigStorage& storage)
+{
+    bool any = false;
+    uint16_t lastBoot = 0;
+
+    m_slot = 0;
+    m_sequence = 0;
+    m_dirty = 0;
+
+    for (uint8_t slot = 0; slot < EVENT_LOG_SLOTS; slot++)
+    {
+        m_count[slot] = 0;
+        m_slotSequence[slot] = 0;
+
+        EventLogRecord record;
+        size_t size = sizeof(record);
+
+        if (!storage.Read(EVENT_LOG_RECORD_FIRST + slot, reinterpret_cast<uint8_t*>(&record), size))
+        {
+            continue;
+        }
+
+        if (size < EVENT_LOG_RECORD_HEADER_SIZE || record.slot != slot || record.count > EVENT_LOG_SLOT_ENTRIES ||
+            size != EVENT_LOG_RECORD_HEADER_SIZE + record.count * sizeof(EventLogEntry))
+        {
+            continue;
+        }
+
+        memcpy(m_entries[slot], record.entries, record.count * sizeof(EventLogEntry));
+        m_count[slot] = record.count;
+        m_slotSequence[slot] = record.sequence;
+
+        if (!any || record.sequence > m_sequence)
+        {
+            m_slot = slot;
+            m_sequence = record.sequence;
+        }
+
+        if (!any || record.boot > lastBoot)
+        {
+            lastBoot = record.boot;
+        }
+
+        any = true;
+    }
+
+    m_boot = any ? lastBoot + 1 : 0;
+}
+
+void EventLog::MarkDirty(uint8_t slot, uint32_t nowMs)
+{
+    if (!m_dirty)
+    {
+        m_dirtySinceMs = nowMs;
+    }
+
+    m_dirty |= 1 << slot;
+}
+
+void EventLog::Add(const EventLogEntry& entry, uint32_t nowMs, bool urgent)
+{
+    // Current slot full, the oldest one gets overwritten
+    if (m_count[m_slot] == EVENT_LOG_SLOT_ENTRIES)
+    {
+        m_slot = (m_slot + 1) % EVENT_LOG_SLOTS;
+        m_count[m_slot] = 0;
+        m_slotSequence[m_slot] = ++m_sequence;
+    }
+
+    auto& stored = m_entries[m_slot][m_count[m_slot]++];
+    stored = entry;
+    stored.boot = m_boot;
+
+    MarkDirty(m_slot, nowMs);
+    m_urgent |= urgent;
+}
+
+void EventLog::Clear(uint32_t nowMs)
+{
+    for (uint8_t slot = 0; slot < EVENT_LOG_SLOTS; slot++)
+    {
+        m_count[slot] = 0;
+        MarkDirty(slot, nowMs);
+    }
+}
+
+bool EventLog::IsFlushDue(uint32_t nowMs) const
+{
+    if (!m_dirty)
+    {
+        return false;
+    }
+
+    if (m_flushed && nowMs - m_lastFlushMs < EVENT_LOG_MIN_FLUSH_INTERVAL_MS)
+    {
+        return false;
+    }
+
+    // Anything but the current slot is done changing, no point waiting
+    if (m_dirty & ~(1 << m_slot))
+    {
+        return true;
+    }
+
+    uint32_t delay = m_urgent ? EVENT_LOG_URGENT_FLUSH_DELAY_MS : EVENT_LOG_FLUSH_DELAY_MS;
+    return nowMs - m_dirtySinceMs >= delay;
+}
+
+size_t EventLog::TakeFlush(uint32_t nowMs, EventLogRecord& record)
+{
+    if (flushCount >= EVENT_LOG_BOOT_WRITE_LIMIT)
+    {
+        // Used up, what's left is lost at the next reset
+        m_flushing = false;
+        return 0;
+    }
+
+    if (!m_flushing)
+    {
+        if (!IsFlushDue(nowMs))
+        {
+            return 0;
+        }
+
+        m_flushing = true;
+        m_flushed = true;
+        m_lastFlushMs = nowMs;
+        m_urgent = false;
+    }
+
+    if (!m_dirty)
+    {
+        m_flushing = false;
+        return 0;
+    }
+
+    // Oldest first
+    uint8_t slot = m_slot;
+    for (uint8_t i = 1; i <= EVENT_LOG_SLOTS; i++)
+    {
+        slot = (m_slot + i) % EVENT_LOG_SLOTS;
+
+        if (m_dirty & (1 << slot))
+        {
+            break;
+        }
+    }
+
+    m_dirty &= ~(1 << slot);
+
+    record.sequence = m_slotSequence[slot];
+    record.slot = slot;
+    record.count = m_count[slot];
+    record.boot = m_boot;
+    memcpy(record.entries, m_entries[slot], m_count[slot] * sizeof(EventLogEntry));
+
+    flushCount++;
+
+    return EVENT_LOG_RECORD_HEADER_SIZE + m_count[slot] * sizeof(EventLogEntry);
+}
+
+void EventLog::FlushFailed(uint8_t slot)
+{
+    // Tried again after the minimum interval
+    MarkDirty(slot, m_lastFlushMs);
+    m_urgent = true;
+    m_flushing = false;
+}
+
+size_t EventLog::GetCount() const
+{
+    size_t count = 0;
+
+    for (uint8_t slot = 0; slot < EVENT_LOG_SLOTS; slot++)
+    {
+        count += m_count[slot];
+    }
+
+    return count;
+}
+
+size_t EventLog::Read(size_t index, EventLogEntry* out, size_t count) const
+{
+    size_t copied = 0;
+
+    for (uint8_t i = 1; i <= EVENT_LOG_SLOTS && copied < count; i++)
+    {
+        uint8_t slot = (m_slot + i) % EVENT_LOG_SLOTS;
+
+        for (size_t e = 0; e < m_count[slot] && copied < count; e++)
+        {
+            if (index)
+            {
+                index--;
+                continue;
+            }
+
+            out[copied++] = m_entries[slot][e];
+        }
+    }
+
+    return copied;
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "config_store.h"
+
+/**
+ * Event history: status changes, supply excursions and resets, each with a snapshot of what the
+ * channel looked like at the time. Kept in a RAM ring of slots, each slot one storage record
+ * (MFS on the F1 boards, on pages of its own so it never wears the configuration's). A slot is
+ * written when it fills, or a while after its first unwritten event, and never more often than
+ * EVENT_LOG_MIN_FLUSH_INTERVAL_MS. The rate limit alone still lets a fault flapping for hours
+ * rewrite a slot every interval, so each boot also only gets EVENT_LOG_BOOT_WRITE_LIMIT slot
+ * writes. Past that events stay in RAM, readable over TS, until the next boot.
+ */
+#define EVENT_LOG_SLOTS 4
+#define EVENT_LOG_SLOT_ENTRIES 16
+#define EVENT_LOG_ENTRIES (EVENT_LOG_SLOTS * EVENT_LOG_SLOT_ENTRIES)
+
+// Storage record ids, clear of the configuration ones from when both shared a storage
+#define EVENT_LOG_RECORD_FIRST 16
+
+// How long an event may wait in RAM, faults are written sooner
+#define EVENT_LOG_FLUSH_DELAY_MS 60000
+#define EVENT_LOG_URGENT_FLUSH_DELAY_MS 5000
+#define EVENT_LOG_MIN_FLUSH_INTERVAL_MS 10000
+#define EVENT_LOG_BOOT_WRITE_LIMIT 16
+
+// Channel of events that aren't about a channel
+#define EVENT_LOG_NO_CHANNEL 0xFF
+
+enum class EventType : uint8_t
+{
+    // from: reset cause, RCC_CSR bits 24-31
+    Boot = 0,
+    // from, to: wbo::Status
+    Status = 1,
+    // Supply voltage left the normal range, or came back
+    SupplyLow = 2,
+    SupplyHigh = 3,
+    SupplyNormal = 4,
+};
+
+struct EventLogEntry
+{
+    // Since boot
+    uint32_t timeMs;
+    // Boot counter, tells the power cycles apart
+    uint16_t boot;
+    uint8_t type;           // EventType
+    uint8_t channel;
+    uint8_t from;
+    uint8_t to;
+    uint16_t supplyVoltage; // mV
+    // Channel snapshot, zero for board events
+    int16_t sensorTemp;     // deg C
+    uint16_t esr;           // ohm
+} __attribute__((packed));
+
+static_assert(sizeof(EventLogEntry) == 16);
+
+// One slot as stored, only count entries are written
+struct EventLogRecord
+{
+    // Goes up by one every time the ring moves to the next slot, the highest one is the newest
+    uint32_t sequence;
+    uint8_t slot;
+    uint8_t count;
+    // Boot counter when written
+    uint16_t boot;
+    EventLogEntry entries[EVENT_LOG_SLOT_ENTRIES];
+} __attribute__((packed));
+
+#define EVENT_LOG_RECORD_HEADER_SIZE (sizeof(EventLogRecord) - sizeof(EventLogRecord::entries))
+
+// Supply voltage range, with some hysteresis so ripple doesn't log an event every time
+#define EVENT_LOG_SUPPLY_LOW 9.0f
+#define EVENT_LOG_SUPPLY_HIGH 16.0f
+#define EVENT_LOG_SUPPLY_HYSTERESIS 0.5f
+
+class SupplyMonitor
+{
+public:
+    // Returns true with the event to log when the voltage leaves or reenters the normal range
+    bool Update(float voltage, EventType& event);
+
+private:
+    EventType m_state = EventType::SupplyNormal;
+};
+
+/**
+ * Not thread safe, the firmware glue locks around it. Storage is only touched by Load, writes go
+ * through TakeFlush so the caller can write without holding its lock.
+ */
+class EventLog
+{
+public:
+    // Picks up where the stored records left off, and counts this as the next boot
+    void Load(ConfigStorage& storage);
+
+    // entry.boot is filled in. urgent events are written after the shorter delay.
+    void Add(const EventLogEntry& entry, uint32_t nowMs, bool urgent = false);
+    // Forget everything, stored records included (on the next flush)
+    void Clear(uint32_t nowMs);
+
+    // If a flush is due, fills record with the next slot to write and returns its size, 0 when
+    // there is nothing (more) to write or this boot's writes are used up. Call FlushFailed if
+    // writing it didn't work.
+    size_t TakeFlush(uint32_t nowMs, EventLogRecord& record);
+    void FlushFailed(uint8_t slot);
+
+    size_t GetCount() const;
+    // Copy up to count entries starting at index (0 = oldest), returns how many were copied
+    size_t Read(size_t index, EventLogEntry* out, size_t count) const;
+
+    uint16_t GetBoot() const
+    {
+        return m_boot;
+    }
+
+    // Slots waiting to be written, bit per slot
+    uint8_t GetDirty() const
+    {
+        return m_dirty;
+    }
+
+    // Slot writes this boot, see EVENT_LOG_BOOT_WRITE_LIMIT
+    uint32_t flushCount = 0;
+
+private:
+    bool IsFlushDue(uint32_t nowMs) const;
+    void MarkDirty(uint8_t slot, uint32_t nowMs);
+
+    EventLogEntry m_entries[EVENT_LOG_SLOTS][EVENT_LOG_SLOT_ENTRIES];
+    uint8_t m_count[EVENT_LOG_SLOTS] = {};
+    uint32_t m_slotSequence[EVENT_LOG_SLOTS] = {};
+
+    // Slot new entries go into
+    uint8_t m_slot = 0;
+    uint32_t m_sequence = 0;
+    uint16_t m_boot = 0;
+
+    uint8_t m_dirty = 0;
+    uint32_t m_dirtySinceMs = 0;
+    bool m_urgent = false;
+    // A flush is going on, TakeFlush hands out dirty slots until there are none left
+    bool m_flushing = false;
+    bool m_flushed = false;
+    uint32_t m_lastFlushMs = 0;
+};
+
+// Firmware's log, and the locked wrappers around it. Without storage the log is RAM only.
+void InitEventLog(ConfigStorage* storage);
+// Writes whatever is due, from the thread that owns storage
+void FlushEventLog(ConfigStorage& storage);
+void LogEvent(EventType type, uint8_t ch, uint8_t from = 0, uint8_t to = 0);
+// Called periodically, logs supply excursions
+void EventLogCheckSupply();
+size_t ReadEventLog(size_t index, EventLogEntry* out, size_t count);
+size_t GetEventLogCount();
+uint16_t GetEventLogBoot();
+void ClearEventLog();
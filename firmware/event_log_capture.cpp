@@ -0,0 +1,130 @@
+#include "ch.h"
+#include "hal.h"
+
+#include <cmath>
+
+#include <rusefi/math.h>
+
+#include "event_log.h"
+#include "wideband_config.h"
+#include "sampling.h"
+#include "status.h"
+
+static EventLog eventLog;
+static SupplyMonitor supplyMonitor;
+
+// Wraps after 49 days, the boot counter tells entries apart across power cycles
+static uint32_t NowMs()
+{
+    return chVTGetTimeStamp() / (CH_CFG_ST_FREQUENCY / 1000);
+}
+
+static float GetEventSupplyVoltage()
+{
+#ifdef BOARD_HAS_VOLTAGE_SENSE
+    return GetSupplyVoltage();
+#else
+    return GetSampler(0).GetInternalHeaterVoltage();
+#endif
+}
+
+void InitEventLog(ConfigStorage* storage)
+{
+    if (storage)
+    {
+        eventLog.Load(*storage);
+    }
+
+    // Why we're here: pin, power on, software, watchdogs, low power (RCC_CSR bits 26-31)
+    uint8_t resetCause = (RCC->CSR >> 24) & 0xFC;
+    RCC->CSR |= RCC_CSR_RMVF;
+
+    LogEvent(EventType::Boot, EVENT_LOG_NO_CHANNEL, resetCause);
+}
+
+void FlushEventLog(ConfigStorage& storage)
+{
+    static EventLogRecord record;
+
+    while (true)
+    {
+        // Copied out under the lock, the write itself can take a while
+        chSysLock();
+        size_t size = eventLog.TakeFlush(NowMs(), record);
+        chSysUnlock();
+
+        if (size == 0)
+        {
+            return;
+        }
+
+        if (!storage.Write(EVENT_LOG_RECORD_FIRST + record.slot, reinterpret_cast<uint8_t*>(&record), size))
+        {
+            chSysLock();
+            eventLog.FlushFailed(record.slot);
+            chSysUnlock();
+            return;
+        }
+    }
+}
+
+void LogEvent(EventType type, uint8_t ch, uint8_t from, uint8_t to)
+{
+    EventLogEntry entry = {};
+    entry.timeMs = NowMs();
+    entry.type = static_cast<uint8_t>(type);
+    entry.channel = ch;
+    entry.from = from;
+    entry.to = to;
+    entry.supplyVoltage = clampF(0, std::round(GetEventSupplyVoltage() * 1000), UINT16_MAX);
+
+    if (ch < AFR_CHANNELS)
+    {
+        const auto& sampler = GetSampler(ch);
+        entry.sensorTemp = clampF(INT16_MIN, std::round(sampler.GetSensorTemperature()), INT16_MAX);
+        entry.esr = clampF(0, std::round(sampler.GetSensorInternalResistance()), UINT16_MAX);
+    }
+
+    // Faults are what the log is for, don't sit on them for long
+    bool urgent = type == EventType::Status && wbo::isStatusError(static_cast<wbo::Status>(to));
+
+    chSysLock();
+    eventLog.Add(entry, entry.timeMs, urgent);
+    chSysUnlock();
+}
+
+void EventLogCheckSupply()
+{
+    EventType event;
+
+    if (supplyMonitor.Update(GetEventSupplyVoltage(), event))
+    {
+        LogEvent(event, EVENT_LOG_NO_CHANNEL);
+    }
+}
+
+size_t ReadEventLog(size_t index, EventLogEntry* out, size_t count)
+{
+    chSysLock();
+    size_t read = eventLog.Read(index, out, count);
+    chSysUnlock();
+
+    return read;
+}
+
+size_t GetEventLogCount()
+{
+    return eventLog.GetCount();
+}
+
+uint16_t GetEventLogBoot()
+{
+    return eventLog.GetBoot();
+}
+
+void ClearEventLog()
+{
+    chSysLock();
+    eventLog.Clear(NowMs());
+    chSysUnlock();
+}
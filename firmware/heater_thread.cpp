@@ -5,6 +5,7 @@
 #include "heater_control.h"
 #include "port.h"
 #include "sampling.h"
+#include "event_log.h"
 
 // 400khz / 1024 = 390hz PWM
 static Pwm heaterPwm(HEATER_PWM_DEVICE);
@@ -93,6 +94,10 @@ static void HeaterThread(void*)
             heater.Update(sampler, heaterAllowState);
         }
 
+#ifdef EVENT_LOG_ENABLED
+        EventLogCheckSupply();
+#endif
+
         // Loop at ~20hz
         chThdSleepMilliseconds(HEATER_CONTROL_PERIOD);
     }
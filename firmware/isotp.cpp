@@ -0,0 +1,234 @@
+#include "isotp.h"
+
+#include <cstring>
+
+uint32_t IsoTpSeparationTimeUs(uint8_t st)
+{
+    if (st <= 0x7F)
+    {
+        return st * 1000;
+    }
+
+    if (st >= 0xF1 && st <= 0xF9)
+    {
+        return (st - 0xF0) * 100;
+    }
+
+    // Reserved, the standard says to use the longest
+    return 127 * 1000;
+}
+
+bool IsoTpSender::Start(const uint8_t* data, size_t size, IsoTpFrame& out)
+{
+    if (size == 0 || size > ISOTP_MAX_MESSAGE_SIZE)
+    {
+        return false;
+    }
+
+    m_data = data;
+    m_size = size;
+
+    if (size <= ISOTP_SINGLE_FRAME_MAX)
+    {
+        out.data[0] = ISOTP_PCI_SINGLE | size;
+        memcpy(&out.data[1], data, size);
+        out.dlc = 1 + size;
+
+        m_offset = size;
+        return true;
+    }
+
+    out.data[0] = ISOTP_PCI_FIRST | (size >> 8);
+    out.data[1] = size & 0xFF;
+    memcpy(&out.data[2], data, ISOTP_FIRST_FRAME_DATA);
+    out.dlc = 8;
+
+    m_offset = ISOTP_FIRST_FRAME_DATA;
+    m_sequence = 1;
+    m_waitFlowControl = true;
+
+    return true;
+}
+
+bool IsoTpSender::NextFrame(IsoTpFrame& out)
+{
+    if (IsDone() || m_waitFlowControl)
+    {
+        return false;
+    }
+
+    size_t count = m_size - m_offset;
+    if (count > ISOTP_CONSECUTIVE_FRAME_DATA)
+    {
+        count = ISOTP_CONSECUTIVE_FRAME_DATA;
+    }
+
+    out.data[0] = ISOTP_PCI_CONSECUTIVE | m_sequence;
+    memcpy(&out.data[1], m_data + m_offset, count);
+    out.dlc = 1 + count;
+
+    m_offset += count;
+    m_sequence = (m_sequence + 1) & 0x0F;
+
+    if (m_blockSize != 0 && --m_blockLeft == 0)
+    {
+        m_waitFlowControl = true;
+    }
+
+    return true;
+}
+
+bool IsoTpSender::OnFlowControl(const uint8_t* data, uint8_t dlc)
+{
+    if (!IsWaitingForFlowControl() || dlc < 3 || (data[0] & 0xF0) != ISOTP_PCI_FLOW_CONTROL)
+    {
+        // Not for us, or not now
+        return true;
+    }
+
+    switch (static_cast<IsoTpFlowStatus>(data[0] & 0x0F))
+    {
+    case IsoTpFlowStatus::ContinueToSend:
+        m_blockSize = data[1];
+        m_blockLeft = m_blockSize;
+        m_separationUs = IsoTpSeparationTimeUs(data[2]);
+        m_waitFlowControl = false;
+        return true;
+    case IsoTpFlowStatus::Wait:
+        // Still waiting, the caller starts its timeout over
+        return true;
+    default:
+        Abort();
+        return false;
+    }
+}
+
+IsoTpReceiver::IsoTpReceiver(uint8_t* buffer, size_t size, uint8_t blockSize, uint8_t stMin)
+    : m_buffer(buffer)
+    , m_capacity(size)
+    , m_blockSize(blockSize)
+    , m_stMin(stMin)
+{
+}
+
+void IsoTpReceiver::MakeFlowControl(IsoTpFlowStatus status, IsoTpFrame& reply) const
+{
+    reply.data[0] = ISOTP_PCI_FLOW_CONTROL | static_cast<uint8_t>(status);
+    reply.data[1] = m_blockSize;
+    reply.data[2] = m_stMin;
+    reply.dlc = 3;
+}
+
+IsoTpRxResult IsoTpReceiver::OnFrame(const uint8_t* data, uint8_t dlc, IsoTpFrame& reply)
+{
+    reply.dlc = 0;
+
+    if (dlc < 1)
+    {
+        return IsoTpRxResult::Ignored;
+    }
+
+    switch (data[0] & 0xF0)
+    {
+    case ISOTP_PCI_SINGLE:
+    {
+        size_t size = data[0] & 0x0F;
+
+        if (m_receiving)
+        {
+            // A new message ends the one in progress
+            m_receiving = false;
+            errorCount++;
+        }
+
+        if (size == 0 || size > ISOTP_SINGLE_FRAME_MAX || dlc < 1 + size || size > m_capacity)
+        {
+            errorCount++;
+            return IsoTpRxResult::Error;
+        }
+
+        memcpy(m_buffer, &data[1], size);
+        m_size = size;
+
+        return IsoTpRxResult::Complete;
+    }
+    case ISOTP_PCI_FIRST:
+    {
+        if (m_receiving)
+        {
+            errorCount++;
+        }
+
+        m_receiving = false;
+
+        size_t size = ((data[0] & 0x0F) << 8) | data[1];
+
+        if (dlc < 8 || size <= ISOTP_SINGLE_FRAME_MAX)
+        {
+            errorCount++;
+            return IsoTpRxResult::Error;
+        }
+
+        if (size > m_capacity)
+        {
+            // Tell the sender not to bother
+            errorCount++;
+            MakeFlowControl(IsoTpFlowStatus::Overflow, reply);
+            return IsoTpRxResult::Error;
+        }
+
+        memcpy(m_buffer, &data[2], ISOTP_FIRST_FRAME_DATA);
+        m_size = size;
+        m_offset = ISOTP_FIRST_FRAME_DATA;
+        m_sequence = 1;
+        m_blockLeft = m_blockSize;
+        m_receiving = true;
+
+        MakeFlowControl(IsoTpFlowStatus::ContinueToSend, reply);
+        return IsoTpRxResult::SendFlowControl;
+    }
+    case ISOTP_PCI_CONSECUTIVE:
+    {
+        if (!m_receiving)
+        {
+            return IsoTpRxResult::Ignored;
+        }
+
+        size_t count = m_size - m_offset;
+        if (count > ISOTP_CONSECUTIVE_FRAME_DATA)
+        {
+            count = ISOTP_CONSECUTIVE_FRAME_DATA;
+        }
+
+        if ((data[0] & 0x0F) != m_sequence || dlc < 1 + count)
+        {
+            // Lost a frame, the rest of the message is no use
+            m_receiving = false;
+            errorCount++;
+            return IsoTpRxResult::Error;
+        }
+
+        memcpy(m_buffer + m_offset, &data[1], count);
+        m_offset += count;
+        m_sequence = (m_sequence + 1) & 0x0F;
+
+        if (m_offset == m_size)
+        {
+            m_receiving = false;
+            return IsoTpRxResult::Complete;
+        }
+
+        if (m_blockSize != 0 && --m_blockLeft == 0)
+        {
+            m_blockLeft = m_blockSize;
+            MakeFlowControl(IsoTpFlowStatus::ContinueToSend, reply);
+            return IsoTpRxResult::SendFlowControl;
+        }
+
+        return IsoTpRxResult::Pending;
+    }
+    default:
+        // Flow control is for the sender
+        return IsoTpRxResult::Ignored;
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * ISO 15765-2 (ISO-TP) segmentation for classic CAN, normal addressing:
+ *   single      0x0L, L data bytes (1-7)
+ *   first       0x1L LL, 12 bit message length, 6 data bytes
+ *   consecutive 0x2N, N sequence number (first one after the first frame is 1), up to 7 data bytes
+ *   flow control 0x3S BS ST: S = continue/wait/overflow, BS consecutive frames before the next flow
+ *               control (0 = no more), ST minimum time between consecutive frames
+ * Frames are not padded, the length tells where the data ends.
+ *
+ * Neither side touches CAN, they take and produce frames so they can be tested on the host.
+ */
+#define ISOTP_MAX_MESSAGE_SIZE 4095
+#define ISOTP_SINGLE_FRAME_MAX 7
+#define ISOTP_FIRST_FRAME_DATA 6
+#define ISOTP_CONSECUTIVE_FRAME_DATA 7
+
+#define ISOTP_PCI_SINGLE 0x00
+#define ISOTP_PCI_FIRST 0x10
+#define ISOTP_PCI_CONSECUTIVE 0x20
+#define ISOTP_PCI_FLOW_CONTROL 0x30
+
+enum class IsoTpFlowStatus : uint8_t
+{
+    ContinueToSend = 0,
+    Wait = 1,
+    Overflow = 2,
+};
+
+struct IsoTpFrame
+{
+    uint8_t data[8];
+    uint8_t dlc;
+};
+
+// ST byte of a flow control frame to microseconds: 0-127 ms, 0xF1-0xF9 100-900 us, anything else 127 ms
+uint32_t IsoTpSeparationTimeUs(uint8_t st);
+
+class IsoTpSender
+{
+public:
+    // Start sending a message, data must stay put until the sender is done. The first (or only)
+    // frame goes in out. Returns false if the message is too long.
+    bool Start(const uint8_t* data, size_t size, IsoTpFrame& out);
+
+    // Next consecutive frame, false when done or when it has to wait for flow control
+    bool NextFrame(IsoTpFrame& out);
+
+    // Returns false if the receiver gave up on the message (overflow, or garbage)
+    bool OnFlowControl(const uint8_t* data, uint8_t dlc);
+
+    bool IsDone() const
+    {
+        return m_offset >= m_size;
+    }
+
+    bool IsWaitingForFlowControl() const
+    {
+        return !IsDone() && m_waitFlowControl;
+    }
+
+    // Separation time the receiver asked for
+    uint32_t GetSeparationTimeUs() const
+    {
+        return m_separationUs;
+    }
+
+    void Abort()
+    {
+        m_offset = m_size;
+    }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_offset = 0;
+
+    uint8_t m_sequence = 0;
+    bool m_waitFlowControl = false;
+    // Consecutive frames left in this block, 0 = unlimited
+    uint8_t m_blockSize = 0;
+    uint8_t m_blockLeft = 0;
+    uint32_t m_separationUs = 0;
+};
+
+enum class IsoTpRxResult : uint8_t
+{
+    // Not a data frame, or not one we expected
+    Ignored,
+    // Part of a message, nothing to do
+    Pending,
+    // Part of a message, send the flow control frame in reply
+    SendFlowControl,
+    // A whole message is in the buffer
+    Complete,
+    // Message dropped (sequence error, too long), reply holds a flow control frame if one should be sent
+    Error,
+};
+
+class IsoTpReceiver
+{
+public:
+    // Messages are reassembled into buffer. Asks the sender for blockSize frames between flow controls
+    // (0 = all of them) and stMin between frames.
+    IsoTpReceiver(uint8_t* buffer, size_t size, uint8_t blockSize = 0, uint8_t stMin = 0);
+
+    // reply.dlc is non zero when a flow control frame has to be sent
+    IsoTpRxResult OnFrame(const uint8_t* data, uint8_t dlc, IsoTpFrame& reply);
+
+    const uint8_t* GetData() const
+    {
+        return m_buffer;
+    }
+
+    size_t GetSize() const
+    {
+        return m_size;
+    }
+
+    uint32_t errorCount = 0;
+
+private:
+    void MakeFlowControl(IsoTpFlowStatus status, IsoTpFrame& reply) const;
+
+    uint8_t* const m_buffer;
+    const size_t m_capacity;
+    const uint8_t m_blockSize;
+    const uint8_t m_stMin;
+
+    bool m_receiving = false;
+    size_t m_size = 0;
+    size_t m_offset = 0;
+    uint8_t m_sequence = 0;
+    uint8_t m_blockLeft = 0;
+};
@@ -83,10 +83,13 @@ static float GetPhi(float pumpCurrent)
     return 1;
 }
 
-float GetLambda(int ch)
+float GetLambdaForPumpCurrent(float pumpCurrent)
 {
-    float pumpCurrent = GetSampler(ch).GetPumpNominalCurrent();
-
     // Lambda is reciprocal of phi
     return 1 / GetPhi(pumpCurrent);
 }
+
+float GetLambda(int ch)
+{
+    return GetLambdaForPumpCurrent(GetSampler(ch).GetPumpNominalCurrent());
+}
@@ -1,3 +1,6 @@
 #pragma once
 
 float GetLambda(int ch);
+
+// Convert any pump current (mA) to lambda for the configured sensor type
+float GetLambdaForPumpCurrent(float pumpCurrent);
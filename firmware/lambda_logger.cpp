@@ -0,0 +1,208 @@
+#include "lambda_logger.h"
+
+#include <cmath>
+#include <cstring>
+
+#include <rusefi/math.h>
+
+#include "../for_rusefi/wideband_can.h"
+
+bool LambdaLogger::Arm(LambdaLogTrigger trigger, uint8_t channelMask, uint16_t preTrigger, float stepThreshold)
+{
+    if (channelMask == 0 || (channelMask >> LAMBDA_LOG_MAX_CHANNELS) != 0)
+    {
+        return false;
+    }
+
+    // Has to leave room for at least the trigger record
+    if (preTrigger >= LAMBDA_LOG_RECORDS)
+    {
+        return false;
+    }
+
+    switch (trigger)
+    {
+    case LambdaLogTrigger::Manual:
+    case LambdaLogTrigger::Fault:
+        break;
+    case LambdaLogTrigger::LambdaStep:
+        if (stepThreshold <= 0)
+        {
+            return false;
+        }
+        break;
+    default:
+        return false;
+    }
+
+    m_trigger = trigger;
+    m_channelMask = channelMask;
+    m_preTrigger = preTrigger;
+    m_stepThreshold = stepThreshold;
+
+    m_head = 0;
+    m_count = 0;
+    m_postTrigger = 0;
+    m_seen = 0;
+    m_triggerRequested = false;
+    m_triggerTimeUs = 0;
+    m_lastTimeUs = 0;
+
+    m_state = LambdaLogState::Armed;
+
+    return true;
+}
+
+void LambdaLogger::Trigger()
+{
+    m_triggerRequested = true;
+}
+
+void LambdaLogger::Stop()
+{
+    if (m_state == LambdaLogState::Armed || m_state == LambdaLogState::Triggered)
+    {
+        m_state = LambdaLogState::Idle;
+    }
+}
+
+bool LambdaLogger::CheckTrigger(uint8_t ch, const LambdaLogSample& sample)
+{
+    uint8_t bit = 1 << ch;
+    bool first = !(m_seen & bit);
+    m_seen |= bit;
+
+    switch (m_trigger)
+    {
+    case LambdaLogTrigger::LambdaStep:
+    {
+        // Lambda means nothing until the loop is closed, start over once it is
+        if (sample.status != static_cast<uint8_t>(wbo::Status::RunningClosedLoop))
+        {
+            m_seen &= ~bit;
+            return false;
+        }
+
+        if (first)
+        {
+            m_baseline[ch] = sample.lambda;
+            return false;
+        }
+
+        float step = sample.lambda - m_baseline[ch];
+        m_baseline[ch] += LAMBDA_LOG_BASELINE_ALPHA * step;
+
+        return std::abs(step) > m_stepThreshold;
+    }
+    case LambdaLogTrigger::Fault:
+    {
+        auto status = static_cast<wbo::Status>(sample.status);
+        // Only a new fault, not one that was already there when armed
+        bool newFault = !first && isStatusError(status) && !isStatusError(static_cast<wbo::Status>(m_lastStatus[ch]));
+        m_lastStatus[ch] = sample.status;
+
+        return newFault;
+    }
+    default:
+        return false;
+    }
+}
+
+void LambdaLogger::OnSample(uint8_t ch, const LambdaLogSample& sample, uint32_t timeUs)
+{
+    if (m_state != LambdaLogState::Armed && m_state != LambdaLogState::Triggered)
+    {
+        return;
+    }
+
+    if (ch >= LAMBDA_LOG_MAX_CHANNELS || !(m_channelMask & (1 << ch)))
+    {
+        return;
+    }
+
+    if (m_state == LambdaLogState::Armed)
+    {
+        // Evaluate the trigger even when a manual one is pending, so its state stays current
+        bool triggered = CheckTrigger(ch, sample);
+
+        if (triggered || m_triggerRequested)
+        {
+            m_state = LambdaLogState::Triggered;
+            m_triggerTimeUs = timeUs;
+
+            // Only keep the history asked for, the rest of the buffer is for after the trigger
+            if (m_count > m_preTrigger)
+            {
+                m_count = m_preTrigger;
+            }
+        }
+    }
+
+    auto& record = m_records[m_head];
+    record.lambda = clampF(0, std::round(sample.lambda * 10000), UINT16_MAX);
+    record.pumpCurrent = clampF(INT16_MIN, std::round(sample.pumpCurrent * 1000), INT16_MAX);
+    record.nernstDc = clampF(INT16_MIN, std::round(sample.nernstDc * 10000), INT16_MAX);
+    record.heaterDuty = clampF(0, std::round(sample.heaterDuty * 200), UINT8_MAX);
+    record.channelStatus = (ch << 4) | (sample.status & 0x0F);
+
+    m_head = (m_head + 1) % LAMBDA_LOG_RECORDS;
+    m_lastTimeUs = timeUs;
+
+    if (m_count < LAMBDA_LOG_RECORDS)
+    {
+        m_count++;
+    }
+
+    if (m_state == LambdaLogState::Triggered)
+    {
+        m_postTrigger++;
+
+        // Never wraps onto the kept history, the trim above left exactly enough room
+        if (m_count == LAMBDA_LOG_RECORDS)
+        {
+            m_state = LambdaLogState::Done;
+        }
+    }
+}
+
+size_t LambdaLogger::GetTriggerIndex() const
+{
+    if (m_postTrigger == 0)
+    {
+        return m_count;
+    }
+
+    return m_count - m_postTrigger;
+}
+
+size_t LambdaLogger::Read(size_t index, LambdaLogRecord* out, size_t count) const
+{
+    if (m_state == LambdaLogState::Armed || m_state == LambdaLogState::Triggered)
+    {
+        return 0;
+    }
+
+    if (index >= m_count)
+    {
+        return 0;
+    }
+
+    if (count > m_count - index)
+    {
+        count = m_count - index;
+    }
+
+    size_t start = (m_head + LAMBDA_LOG_RECORDS - m_count + index) % LAMBDA_LOG_RECORDS;
+
+    // At most two pieces, up to the end of the ring and from its start
+    size_t first = LAMBDA_LOG_RECORDS - start;
+    if (first > count)
+    {
+        first = count;
+    }
+
+    memcpy(out, &m_records[start], first * sizeof(LambdaLogRecord));
+    memcpy(out + first, &m_records[0], (count - first) * sizeof(LambdaLogRecord));
+
+    return count;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// 4 KB, about half a second of both channels at the sampling rate
+#define LAMBDA_LOG_RECORDS 512
+// Channels that can be logged, each keeps its own trigger state
+#define LAMBDA_LOG_MAX_CHANNELS 4
+
+// Filter for the lambda step trigger baseline, about 100 samples
+#define LAMBDA_LOG_BASELINE_ALPHA 0.01f
+
+// One channel, one sample, fixed point
+struct LambdaLogRecord
+{
+    uint16_t lambda;        // 0.0001
+    int16_t pumpCurrent;    // uA
+    int16_t nernstDc;       // 0.1 mV
+    uint8_t heaterDuty;     // 0.5%
+    uint8_t channelStatus;  // channel << 4 | wbo::Status
+} __attribute__((packed));
+
+static_assert(sizeof(LambdaLogRecord) == 8);
+
+// One channel, one sample, in sensor units
+struct LambdaLogSample
+{
+    float lambda;
+    float pumpCurrent;      // mA
+    float nernstDc;         // V
+    float heaterDuty;       // 0-1
+    uint8_t status;         // wbo::Status
+};
+
+enum class LambdaLogTrigger : uint8_t
+{
+    // Waits for Trigger()
+    Manual = 0,
+    // Lambda moves more than the threshold away from its recent average
+    LambdaStep = 1,
+    // Any channel goes into a fault
+    Fault = 2,
+};
+
+enum class LambdaLogState : uint8_t
+{
+    // Nothing being recorded, whatever was captured before can be read
+    Idle = 0,
+    // Recording history from before the trigger, waiting for it
+    Armed = 1,
+    // Recording the rest of the buffer
+    Triggered = 2,
+    // Buffer full, ready to be read
+    Done = 3,
+};
+
+/**
+ * High rate lambda logger, like a tooth logger: records every sample into a RAM ring while armed,
+ * keeps going for the rest of the buffer once triggered, then holds still until it is read out.
+ * That captures transients far faster than any output channel poll or stream over a slow link.
+ *
+ * Samples only come from the sampling thread. Arm/Trigger/Stop come from a TS thread, the caller locks.
+ * Read only returns anything while not recording, so the readout doesn't race the sampling thread.
+ */
+class LambdaLogger
+{
+public:
+    // preTrigger records of history are kept from before the trigger, the rest of the buffer
+    // is after it. stepThreshold is for LambdaStep, in lambda. Returns false for a bad request.
+    bool Arm(LambdaLogTrigger trigger, uint8_t channelMask, uint16_t preTrigger, float stepThreshold);
+    // Trigger on the next sample, whatever the trigger condition
+    void Trigger();
+    // Stop recording, keeps what was recorded so far
+    void Stop();
+
+    void OnSample(uint8_t ch, const LambdaLogSample& sample, uint32_t timeUs);
+
+    LambdaLogState GetState() const
+    {
+        return m_state;
+    }
+
+    LambdaLogTrigger GetTrigger() const
+    {
+        return m_trigger;
+    }
+
+    uint8_t GetChannelMask() const
+    {
+        return m_channelMask;
+    }
+
+    size_t GetRecordCount() const
+    {
+        return m_count;
+    }
+
+    // Index (0 = oldest) of the first record after the trigger, equal to the record count if it didn't trigger
+    size_t GetTriggerIndex() const;
+
+    uint32_t GetTriggerTimeUs() const
+    {
+        return m_triggerTimeUs;
+    }
+
+    uint32_t GetLastTimeUs() const
+    {
+        return m_lastTimeUs;
+    }
+
+    // Copy up to count records starting at index (0 = oldest), returns how many were copied
+    size_t Read(size_t index, LambdaLogRecord* out, size_t count) const;
+
+private:
+    bool CheckTrigger(uint8_t ch, const LambdaLogSample& sample);
+
+    LambdaLogRecord m_records[LAMBDA_LOG_RECORDS];
+    // Next record written here
+    size_t m_head = 0;
+    size_t m_count = 0;
+    size_t m_postTrigger = 0;
+    size_t m_preTrigger = 0;
+
+    LambdaLogState m_state = LambdaLogState::Idle;
+    LambdaLogTrigger m_trigger = LambdaLogTrigger::Manual;
+    uint8_t m_channelMask = 0;
+    float m_stepThreshold = 0;
+    volatile bool m_triggerRequested = false;
+
+    // Per channel trigger state, valid once the channel has been seen since arming
+    uint8_t m_seen = 0;
+    float m_baseline[LAMBDA_LOG_MAX_CHANNELS];
+    uint8_t m_lastStatus[LAMBDA_LOG_MAX_CHANNELS];
+
+    uint32_t m_triggerTimeUs = 0;
+    uint32_t m_lastTimeUs = 0;
+};
+
+// Firmware's logger, and the locked wrappers TS uses
+LambdaLogger& GetLambdaLogger();
+bool ArmLambdaLogger(LambdaLogTrigger trigger, uint8_t channelMask, uint16_t preTrigger, float stepThreshold);
+void TriggerLambdaLogger();
+void StopLambdaLogger();
+// Called by the sampling thread after every sample
+void LambdaLoggerOnSample(uint8_t ch);
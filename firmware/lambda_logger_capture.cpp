@@ -0,0 +1,60 @@
+#include "ch.h"
+
+#include "lambda_logger.h"
+#include "lambda_conversion.h"
+#include "heater_control.h"
+#include "sampling.h"
+#include "status.h"
+
+static LambdaLogger logger;
+
+LambdaLogger& GetLambdaLogger()
+{
+    return logger;
+}
+
+bool ArmLambdaLogger(LambdaLogTrigger trigger, uint8_t channelMask, uint16_t preTrigger, float stepThreshold)
+{
+    // The sampling thread runs at a higher priority, don't let it see a half armed logger
+    chSysLock();
+    bool result = logger.Arm(trigger, channelMask, preTrigger, stepThreshold);
+    chSysUnlock();
+
+    return result;
+}
+
+void TriggerLambdaLogger()
+{
+    logger.Trigger();
+}
+
+void StopLambdaLogger()
+{
+    chSysLock();
+    logger.Stop();
+    chSysUnlock();
+}
+
+void LambdaLoggerOnSample(uint8_t ch)
+{
+    // Cheap way out for the usual case
+    auto state = logger.GetState();
+    if (state != LambdaLogState::Armed && state != LambdaLogState::Triggered)
+    {
+        return;
+    }
+
+    const auto& sampler = GetSampler(ch);
+
+    // Unfiltered, the point is to see the transients
+    float pumpCurrent = sampler.GetPumpNominalCurrentUnfiltered();
+
+    LambdaLogSample sample;
+    sample.lambda = GetLambdaForPumpCurrent(pumpCurrent);
+    sample.pumpCurrent = pumpCurrent;
+    sample.nernstDc = sampler.GetNernstDc();
+    sample.heaterDuty = GetHeaterDuty(ch);
+    sample.status = static_cast<uint8_t>(GetCurrentStatus(ch));
+
+    logger.OnSample(ch, sample, GetLastSampleTimeUs());
+}
@@ -1,16 +1,25 @@
 #include "wideband_config.h"
 #include "livedata.h"
 
+#include "can_stats.h"
+#include "config_burn.h"
+#include "cylinder_lambda.h"
 #include "lambda_conversion.h"
 #include "sampling.h"
 #include "pump_dac.h"
 #include "heater_control.h"
 #include "max3185x.h"
 #include "status.h"
+#include "och_snapshot.h"
+#include "timer.h"
+
+#include "ch.h"
 
-#include <rusefi/arrays.h>
 #include <rusefi/fragments.h>
 
+#include <array>
+#include <utility>
+
 static livedata_common_s livedata_common;
 static livedata_afr_s livedata_afr[AFR_CHANNELS];
 
@@ -37,6 +46,12 @@ void SamplingUpdateLiveData()
     }
 
     livedata_common.vbatt = GetSampler(0).GetInternalHeaterVoltage();
+
+    const auto& burn = GetBurnQueue();
+    livedata_common.burnState = static_cast<uint8_t>(burn.GetState());
+    livedata_common.burnWrites = burn.writeCount;
+    livedata_common.burnSkipped = burn.skipCount;
+    livedata_common.burnErrors = burn.errorCount;
 }
 
 template <> const livedata_common_s* getLiveData(size_t)
@@ -54,15 +69,151 @@ template <> const struct livedata_afr_s* getLiveData(size_t ch)
     return nullptr;
 }
 
-static const FragmentEntry fragments[] = {
-    decl_frag<livedata_common_s>{},
-    decl_frag<livedata_afr_s, 0>{},
-    decl_frag<livedata_afr_s, 1>{},
-    decl_frag<livedata_egt_s, 0>{},
-    decl_frag<livedata_egt_s, 1>{},
-};
+static livedata_cyl_s livedata_cyl[AFR_CHANNELS];
+
+// Per cylinder data changes slowly, build it when TS asks for it instead of every sample
+template <> const struct livedata_cyl_s* getLiveData(size_t ch)
+{
+    if (ch >= AFR_CHANNELS)
+    {
+        return nullptr;
+    }
+
+    livedata_cyl_s* data = &livedata_cyl[ch];
+    CylinderLambdaResult cyl;
+    GetCylinderLambda(ch).GetResult(cyl);
+
+    data->cylinderCount = cyl.cylinderCount;
+    data->currentCylinder = cyl.currentCylinder;
+    data->active = cyl.IsActive();
+
+    for (size_t i = 0; i < CYL_LAMBDA_MAX_CYLINDERS; i++)
+    {
+        float pumpCurrent;
+
+        if (cyl.GetAveragePumpCurrent(i, pumpCurrent))
+        {
+            data->lambda[i] = GetLambdaForPumpCurrent(pumpCurrent) * 10000;
+        }
+        else
+        {
+            data->lambda[i] = 0;
+        }
+    }
+
+    return data;
+}
+
+static livedata_can_s livedata_can;
+
+template <> const struct livedata_can_s* getLiveData(size_t)
+{
+    const auto& stats = GetCanStats();
+    livedata_can_s* data = &livedata_can;
+
+    data->txFrames = stats.txFrames;
+    data->rxAccepted = stats.rxAccepted;
+    data->rxFiltered = stats.rxFiltered;
+    data->txRateData = stats.txRate[static_cast<uint8_t>(CanTxClass::Data)];
+    data->txRateExtraFormat = stats.txRate[static_cast<uint8_t>(CanTxClass::ExtraFormat)];
+    data->txRateTelemetry = stats.txRate[static_cast<uint8_t>(CanTxClass::Telemetry)];
+    data->txRateProtocol = stats.txRate[static_cast<uint8_t>(CanTxClass::Protocol)];
+    data->txTimeouts = stats.txTimeouts > UINT16_MAX ? UINT16_MAX : stats.txTimeouts;
+    data->busOffCount = stats.busOffCount;
+    data->errorPassiveCount = stats.errorPassiveCount;
+    data->txErrors = stats.txErrors;
+    data->rxErrors = stats.rxErrors;
+    data->flags = (stats.busOff ? 0x01 : 0) | (stats.errorPassive ? 0x02 : 0);
+    data->busLoadOwn = stats.busLoadOwn * 10;
+    data->busLoadTotal = stats.busLoadTotal * 10;
+
+    return data;
+}
+
+// Two EGT fragments are always there, any more go at the end so the layout of the rest doesn't move
+#define OCH_EXTRA_EGT_CHANNELS (EGT_CHANNELS > 2 ? EGT_CHANNELS - 2 : 0)
+
+static_assert(sizeof(livedata_common_s) + 2 * sizeof(livedata_afr_s) + 2 * sizeof(livedata_egt_s) +
+              2 * sizeof(livedata_cyl_s) + sizeof(livedata_can_s) +
+              OCH_EXTRA_EGT_CHANNELS * sizeof(livedata_egt_s) <= OCH_BLOCK_SIZE,
+              "Output channels don't fit OCH_BLOCK_SIZE");
+
+template <size_t... TExtraEgt>
+static std::array<FragmentEntry, 8 + sizeof...(TExtraEgt)> makeFragments(std::index_sequence<TExtraEgt...>)
+{
+    return {{
+        decl_frag<livedata_common_s>{},
+        decl_frag<livedata_afr_s, 0>{},
+        decl_frag<livedata_afr_s, 1>{},
+        decl_frag<livedata_egt_s, 0>{},
+        decl_frag<livedata_egt_s, 1>{},
+        decl_frag<livedata_cyl_s, 0>{},
+        decl_frag<livedata_cyl_s, 1>{},
+        decl_frag<livedata_can_s>{},
+        decl_frag<livedata_egt_s, 2 + TExtraEgt>{}...,
+    }};
+}
+
+static const auto fragments = makeFragments(std::make_index_sequence<OCH_EXTRA_EGT_CHANNELS>{});
 
 FragmentList getFragments()
 {
-    return {fragments, efi::size(fragments)};
+    return {fragments.data(), fragments.size()};
+}
+
+static OchSnapshot och;
+static Timer ochPublishTimer;
+
+void SamplingPublishOutputChannels()
+{
+    if (!ochPublishTimer.hasElapsedMs(OCH_PUBLISH_PERIOD_MS))
+    {
+        return;
+    }
+
+    // Nobody reading, don't spend the sampling thread's time on frames
+    chSysLock();
+    uint8_t* block = och.IsWanted() ? och.BeginWrite() : nullptr;
+    chSysUnlock();
+
+    if (!block)
+    {
+        return;
+    }
+
+    ochPublishTimer.reset();
+
+    copyRange(block, getFragments(), 0, OCH_BLOCK_SIZE);
+    och.Seal();
+
+    chSysLock();
+    och.Publish();
+    chSysUnlock();
+}
+
+const uint8_t* AcquireOutputChannels()
+{
+    chSysLock();
+    bool idle = !och.IsWanted();
+    och.Want();
+    chSysUnlock();
+
+    if (idle)
+    {
+        // The last frame is from before frames stopped, give sampling time to build a fresh one
+        chThdSleepMilliseconds(2 * OCH_PUBLISH_PERIOD_MS);
+    }
+
+    chSysLock();
+    auto packet = och.Acquire();
+    chSysUnlock();
+
+    return packet;
+}
+
+void ReleaseOutputChannels(const uint8_t* packet)
+{
+    chSysLock();
+    och.Release(packet);
+    chSysUnlock();
 }
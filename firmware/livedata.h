@@ -5,6 +5,7 @@
 #include <rusefi/fragments.h>
 
 #include "wideband_config.h"
+#include "cylinder_lambda.h"
 
 /* +0 offset */
 struct livedata_common_s
@@ -14,6 +15,12 @@ struct livedata_common_s
         struct
         {
             float vbatt;
+            // Background configuration burn, see BurnQueue
+            uint8_t burnState;
+            uint8_t padding;
+            uint16_t burnWrites;
+            uint16_t burnSkipped;
+            uint16_t burnErrors;
         };
         uint8_t pad0[32];
     };
@@ -44,5 +51,65 @@ struct livedata_afr_s
     };
 };
 
+/* +128 offset, one per AFR channel */
+struct livedata_cyl_s
+{
+    union
+    {
+        struct
+        {
+            // 0.0001 lambda per bit, 0 if no data for that cylinder
+            uint16_t lambda[CYL_LAMBDA_MAX_CYLINDERS];
+            uint8_t cylinderCount;
+            uint8_t currentCylinder;
+            uint8_t active;
+        } __attribute__((packed));
+        uint8_t pad[32];
+    };
+};
+
+/* +192 offset */
+struct livedata_can_s
+{
+    union
+    {
+        struct
+        {
+            uint32_t txFrames;
+            uint32_t rxAccepted;
+            uint32_t rxFiltered;
+            // frames per second, see CanTxClass
+            uint16_t txRateData;
+            uint16_t txRateExtraFormat;
+            uint16_t txRateTelemetry;
+            uint16_t txRateProtocol;
+            uint16_t txTimeouts;
+            uint8_t busOffCount;
+            uint8_t errorPassiveCount;
+            uint8_t txErrors;
+            uint8_t rxErrors;
+            uint8_t flags; // bit 0: bus off, bit 1: error passive
+            uint8_t padding;
+            // 0.1%
+            uint16_t busLoadOwn;
+            uint16_t busLoadTotal;
+        } __attribute__((packed));
+        uint8_t pad[32];
+    };
+};
+
 /* update functions */
 void SamplingUpdateLiveData();
+
+// TS polls at well under this rate, no point building frames faster
+#define OCH_PUBLISH_PERIOD_MS 5
+
+// Build a complete output channel frame for TS from the live data, see OchSnapshot.
+// Only while something is reading them.
+void SamplingPublishOutputChannels();
+
+// Latest output channel frame as a ready to send TS packet, nullptr if there isn't one yet.
+// The frame doesn't change until it is released. The first call after frames stopped waits a
+// little for a fresh one.
+const uint8_t* AcquireOutputChannels();
+void ReleaseOutputChannels(const uint8_t* packet);
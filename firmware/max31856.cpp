@@ -0,0 +1,49 @@
+#include "max31856.h"
+
+// CR0
+#define MAX31856_CR0_AUTO (1 << 7)
+#define MAX31856_CR0_OCFAULT_1 (2 << 4)
+#define MAX31856_CR0_50HZ (1 << 0)
+
+// CR1
+#define MAX31856_CR1_TYPE_K 3
+
+uint8_t Max31856Cr0Stopped(Max31856Notch notch)
+{
+    return notch == Max31856Notch::Hz50 ? MAX31856_CR0_50HZ : 0;
+}
+
+uint8_t Max31856Cr0Auto(Max31856Notch notch)
+{
+    return MAX31856_CR0_AUTO | MAX31856_CR0_OCFAULT_1 | Max31856Cr0Stopped(notch);
+}
+
+static uint8_t AveragingBits(Max31856Averaging averaging)
+{
+    uint8_t bits = static_cast<uint8_t>(averaging);
+
+    return bits > static_cast<uint8_t>(Max31856Averaging::Samples16) ? static_cast<uint8_t>(Max31856Averaging::Samples16) : bits;
+}
+
+uint8_t Max31856Cr1(Max31856Averaging averaging)
+{
+    return (AveragingBits(averaging) << 4) | MAX31856_CR1_TYPE_K;
+}
+
+uint8_t Max31856SampleCount(Max31856Averaging averaging)
+{
+    return 1 << AveragingBits(averaging);
+}
+
+uint32_t Max31856ConversionPeriodMs(Max31856Averaging averaging, Max31856Notch notch)
+{
+    uint32_t extra = Max31856SampleCount(averaging) - 1;
+
+    if (notch == Max31856Notch::Hz50)
+    {
+        return 110 + extra * 40;
+    }
+
+    // 33.3 ms each, rounded up
+    return 90 + (extra * 100 + 2) / 3;
+}
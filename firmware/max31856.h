@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+// MAX31856 conversion settings, as configured (Configuration::egtAveraging / egtNotch)
+enum class Max31856Averaging : uint8_t
+{
+    Samples1 = 0,
+    Samples2 = 1,
+    Samples4 = 2,
+    Samples8 = 3,
+    Samples16 = 4,
+};
+
+enum class Max31856Notch : uint8_t
+{
+    Hz60 = 0,
+    Hz50 = 1,
+};
+
+#define MAX31856_REG_CR0 0x00
+#define MAX31856_REG_CR1 0x01
+#define MAX31856_WRITE 0x80
+
+// CR0 with the conversions stopped, the notch filter may only change like this
+uint8_t Max31856Cr0Stopped(Max31856Notch notch);
+// CR0 for automatic conversion mode, open circuit detection on
+uint8_t Max31856Cr0Auto(Max31856Notch notch);
+// CR1 for a K type thermocouple. Out of range averaging falls back to 16 samples.
+uint8_t Max31856Cr1(Max31856Averaging averaging);
+
+uint8_t Max31856SampleCount(Max31856Averaging averaging);
+
+/**
+ * Worst case time between two results in automatic conversion mode, per the datasheet: one
+ * conversion (90 ms at 60 Hz, 110 ms at 50 Hz), plus a line cycle pair for every extra sample.
+ * Reading any faster only returns the same result again.
+ */
+uint32_t Max31856ConversionPeriodMs(Max31856Averaging averaging, Max31856Notch notch);
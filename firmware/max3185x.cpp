@@ -1,81 +1,205 @@
 #include <math.h>
+#include <string.h>
 
 #include "io_pins.h"
 #include "wideband_config.h"
 #include "bit.h"
 #include "livedata.h"
+#include "port.h"
+#include "max31856.h"
 
 #include "max3185x.h"
 
 #if (EGT_CHANNELS > 0)
 
-static const SPIConfig spi_config[EGT_CHANNELS] = {{.circular = false,
-                                                    .slave = false,
-                                                    .data_cb = nullptr,
-                                                    .error_cb = nullptr,
-                                                    .ssport = EGT_CS0_PORT,
-                                                    .sspad = EGT_CS0_PIN,
-                                                    .cr1 =
-                                                        /* SPI_CR1_LSBFIRST | */
-                                                    ((3 << SPI_CR1_BR_Pos) & SPI_CR1_BR) | /* div = 16 */
-                                                    /* SPI_CR1_CPOL | */                   // = 0
-                                                    SPI_CR1_CPHA |                         // = 1
-                                                    0,
-                                                    .cr2 = 0},
-                                                   {.circular = false,
-                                                    .slave = false,
-                                                    .data_cb = nullptr,
-                                                    .error_cb = nullptr,
-                                                    .ssport = EGT_CS1_PORT,
-                                                    .sspad = EGT_CS1_PIN,
-                                                    .cr1 =
-                                                        /* SPI_CR1_LSBFIRST | */
-                                                    ((3 << SPI_CR1_BR_Pos) & SPI_CR1_BR) | /* div = 16 */
-                                                    /* SPI_CR1_CPOL | */                   // = 0
-                                                    SPI_CR1_CPHA |                         // = 1
-                                                    0,
-                                                    .cr2 = 0}};
-
-static Max3185x instances[EGT_CHANNELS] = {Max3185x(&spi_config[0]), Max3185x(&spi_config[1])};
+struct EgtChip
+{
+    SPIDriver* driver;
+    ioportid_t csPort;
+    iopadid_t csPad;
+};
+
+static const EgtChip chips[] = {EGT_CHIPS};
+
+static_assert(sizeof(chips) / sizeof(chips[0]) == EGT_CHANNELS, "EGT_CHIPS needs one entry per EGT channel");
+
+static void egtSpiDone(SPIDriver* spip);
+static void egtSpiError(SPIDriver* spip);
+
+/* Started once per bus and left running. Chip selects are driven by hand, so ssport/sspad are
+ * unused and all chips share this config. */
+static const SPIConfig spi_config = {.circular = false,
+                                     .slave = false,
+                                     .data_cb = egtSpiDone,
+                                     .error_cb = egtSpiError,
+                                     .ssport = nullptr,
+                                     .sspad = 0,
+                                     .cr1 =
+                                         /* SPI_CR1_LSBFIRST | */
+                                     ((3 << SPI_CR1_BR_Pos) & SPI_CR1_BR) | /* div = 16 */
+                                     /* SPI_CR1_CPOL | */                   // = 0
+                                     SPI_CR1_CPHA |                         // = 1
+                                     0,
+                                     .cr2 = 0};
+
+static_assert(EGT_CHANNELS <= SPI_QUEUE_SIZE);
+
+// Chips on the same driver take turns, different buses run at the same time
+struct EgtSpiBus
+{
+    SPIDriver* driver;
+    SpiQueue queue;
+    // Signalled when the queue runs dry
+    binary_semaphore_t idle;
+};
+
+static EgtSpiBus buses[EGT_CHANNELS];
+static size_t busCount = 0;
+
+static Max3185x instances[EGT_CHANNELS];
 
 static Max3185xThread EgtThread(instances);
 
-int Max3185x::spi_txrx(const uint8_t tx[], uint8_t rx[], size_t n)
+// Locked
+static void egtSpiBegin(EgtSpiBus& bus, const SpiTransaction* t)
 {
-    /* Acquire ownership of the bus. */
-    spiAcquireBus(EGT_SPI_DRIVER);
-    /* Setup transfer parameters. */
-    spiStart(EGT_SPI_DRIVER, spi);
-    /* Slave Select assertion. */
-    spiSelect(EGT_SPI_DRIVER);
-    spiExchange(EGT_SPI_DRIVER, n, tx, rx);
-    /* Slave Select de-assertion. */
-    spiUnselect(EGT_SPI_DRIVER);
-    /* Bus deinit */
-    spiStop(EGT_SPI_DRIVER);
-    /* Ownership release. */
-    spiReleaseBus(EGT_SPI_DRIVER);
-
-    /* no errors for now */
-    return 0;
+    palClearPad(chips[t->device].csPort, chips[t->device].csPad);
+    spiStartExchangeI(bus.driver, t->size, t->tx, t->rx);
 }
 
-int Max3185x::spi_rx32(uint32_t* data)
+static void egtSpiEnd(SPIDriver* spip, bool ok)
 {
-    int ret;
-    /* dummy */
-    uint8_t tx[4] = {0};
-    uint8_t rx[4];
+    chSysLockFromISR();
 
-    ret = spi_txrx(tx, rx, 4);
-    if (ret)
+    for (size_t i = 0; i < busCount; i++)
+    {
+        EgtSpiBus& bus = buses[i];
+
+        if (bus.driver != spip)
+        {
+            continue;
+        }
+
+        const SpiTransaction* t = bus.queue.GetRunning();
+        if (t)
+        {
+            palSetPad(chips[t->device].csPort, chips[t->device].csPad);
+        }
+
+        /* The driver only goes back to ready once this callback returns, mark it ready here so
+         * the next chip starts right away instead of waking the thread in between. */
+        spip->state = SPI_READY;
+
+        const SpiTransaction* next = bus.queue.Complete(ok);
+        if (next)
+        {
+            egtSpiBegin(bus, next);
+        }
+        else
+        {
+            chBSemSignalI(&bus.idle);
+        }
+
+        break;
+    }
+
+    chSysUnlockFromISR();
+}
+
+static void egtSpiDone(SPIDriver* spip)
+{
+    egtSpiEnd(spip, true);
+}
+
+static void egtSpiError(SPIDriver* spip)
+{
+    egtSpiEnd(spip, false);
+}
+
+// Queue only, egtSpiKick starts it
+static void egtSpiQueue(EgtSpiBus& bus, const SpiTransaction& t)
+{
+    chSysLock();
+    bus.queue.Push(t);
+    chSysUnlock();
+}
+
+// Starts on what has been queued, everything queued up front so the bus can't go idle halfway
+static void egtSpiKick(EgtSpiBus& bus)
+{
+    chBSemReset(&bus.idle, true);
+
+    chSysLock();
+    const SpiTransaction* first = bus.queue.StartNext();
+    if (first)
+    {
+        egtSpiBegin(bus, first);
+    }
+    else if (bus.queue.IsIdle())
+    {
+        chBSemSignalI(&bus.idle);
+    }
+    chSysUnlock();
+}
+
+// Waits for the bus to run dry
+static bool egtSpiWait(EgtSpiBus& bus)
+{
+    if (chBSemWaitTimeout(&bus.idle, TIME_MS2I(EGT_SPI_TIMEOUT_MS)) == MSG_OK)
+    {
+        return true;
+    }
+
+    /* Lost a completion: stop the DMA and drop what is left. The driver is still active then,
+     * unless the completion turned up just now, and spiStop only takes a ready driver. */
+    chSysLock();
+    if (bus.driver->state == SPI_ACTIVE)
+    {
+        spiAbortI(bus.driver);
+    }
+    bus.queue.Reset();
+    chSysUnlock();
+
+    for (size_t i = 0; i < EGT_CHANNELS; i++)
     {
-        return ret;
+        if (chips[i].driver == bus.driver)
+        {
+            palSetPad(chips[i].csPort, chips[i].csPad);
+        }
     }
-    if (data)
+
+    // Ready now, restart the peripheral in case it is the one stuck
+    spiStop(bus.driver);
+    spiStart(bus.driver, &spi_config);
+
+    return false;
+}
+
+static void onExchangeDone(void* context, bool ok)
+{
+    *reinterpret_cast<bool*>(context) = ok;
+}
+
+int Max3185x::spi_txrx(const uint8_t tx[], uint8_t rx[], size_t n)
+{
+    bool ok = false;
+
+    SpiTransaction t;
+    t.device = index;
+    t.size = n;
+    t.tx = tx;
+    t.rx = rx;
+    t.done = onExchangeDone;
+    t.context = &ok;
+
+    egtSpiQueue(buses[bus], t);
+    egtSpiKick(buses[bus]);
+
+    if (!egtSpiWait(buses[bus]) || !ok)
     {
-        *data = (rx[0] << 24) | (rx[1] << 16) | (rx[2] << 8) | (rx[3] << 0);
+        return -1;
     }
+
     return 0;
 }
 
@@ -88,16 +212,19 @@ Max3185xType Max3185x::detect()
     uint8_t rx[4];
     uint8_t tx[4];
 
+    auto cfg = GetConfiguration();
+    auto averaging = static_cast<Max31856Averaging>(cfg->egtAveraging);
+    auto notch = static_cast<Max31856Notch>(cfg->egtNotch);
+
     /* try to apply settings to max31956 and then read back settings */
-    // Wr, register 0x00
-    tx[0] = 0x00 | BIT(7);
-    // CR0: 50Hz mode
+    tx[0] = MAX31856_REG_CR0 | MAX31856_WRITE;
+    // CR0: conversions off
     // Change the notch frequency only while in the "Normally Off" mode - not in the Automatic
-    tx[1] = BIT(0);
-    // CR1: 4 samples average, K type
+    tx[1] = Max31856Cr0Stopped(notch);
+    // CR1: averaging, K type
     // The Thermocouple Voltage Conversion Averaging Mode settings should not be changed while
     // conversions are taking place.
-    tx[2] = (2 << 4) | (3 << 0);
+    tx[2] = Max31856Cr1(averaging);
 
     // Stop any conversion
     ret = spi_txrx(tx, rx, 2);
@@ -114,18 +241,19 @@ Max3185xType Max3185x::detect()
     }
 
     // Start Automatic Conversion mode
-    // CR0: Automatic Conversion mode, OCFAULT = 2, 50Hz mode
-    tx[1] = BIT(7) | BIT(0) | (2 << 4);
-    // CR1: 4 samples average, K type
-    tx[2] = (2 << 4) | (3 << 0);
+    // CR0: Automatic Conversion mode, OCFAULT = 2, notch
+    tx[1] = Max31856Cr0Auto(notch);
     ret = spi_txrx(tx, rx, 3);
     if (ret)
     {
         return UNKNOWN_TYPE;
     }
 
+    cr0 = tx[1];
+    cr1 = tx[2];
+
     /* Now readback settings */
-    tx[0] = 0x00;
+    tx[0] = MAX31856_REG_CR0;
     ret = spi_txrx(tx, rx, 4);
     if ((rx[1] == tx[1]) && (rx[2] == tx[2]))
     {
@@ -151,18 +279,16 @@ Max3185xType Max3185x::detect()
     return UNKNOWN_TYPE;
 }
 
-Max3185xState Max3185x::readPacket31855()
+Max3185xState Max3185x::decode31855()
 {
-    uint32_t data;
-
 #define MAX33855_FAULT_BIT BIT(16)
 #define MAX33855_OPEN_BIT BIT(0)
 #define MAX33855_GND_BIT BIT(1)
 #define MAX33855_VCC_BIT BIT(2)
 
-    int ret = spi_rx32(&data);
+    uint32_t data = (rxBuf[0] << 24) | (rxBuf[1] << 16) | (rxBuf[2] << 8) | (rxBuf[3] << 0);
 
-    if ((ret) || ((data & MAX31855_RESERVED_BITS) != 0) || (data == 0x0) || (data == 0xffffffff))
+    if ((!readOk) || ((data & MAX31855_RESERVED_BITS) != 0) || (data == 0x0) || (data == 0xffffffff))
     {
         return MAX3185X_NO_REPLY;
     }
@@ -199,15 +325,11 @@ Max3185xState Max3185x::readPacket31855()
     return MAX3185X_OK;
 }
 
-Max3185xState Max3185x::readPacket31856()
+Max3185xState Max3185x::decode31856()
 {
-    uint8_t rx[1 + 6];
-    /* read one dummy byte, Cold-Junction temperature MSB, LSB, Linearized TC temperature 3 bytes and Fault Status */
-    const uint8_t tx[1 + 6] = {0x0a};
-
-    int ret = spi_txrx(tx, rx, sizeof(rx));
+    const uint8_t* rx = rxBuf;
 
-    if (ret)
+    if (!readOk)
     {
         return MAX3185X_NO_REPLY;
     }
@@ -256,24 +378,72 @@ Max3185xState Max3185x::readPacket31856()
     return MAX3185X_OK;
 }
 
-Max3185xState Max3185x::readPacket()
+bool Max3185x::detectIfNeeded()
 {
+    if (type == MAX31856_TYPE)
+    {
+        auto cfg = GetConfiguration();
+
+        // Settings changed, write them again (conversions have to be stopped for that)
+        if (cr0 != Max31856Cr0Auto(static_cast<Max31856Notch>(cfg->egtNotch)) ||
+            cr1 != Max31856Cr1(static_cast<Max31856Averaging>(cfg->egtAveraging)))
+        {
+            type = UNKNOWN_TYPE;
+        }
+    }
+
     if (type == UNKNOWN_TYPE)
     {
         type = detect();
         if (type == UNKNOWN_TYPE)
         {
             livedata.state = MAX3185X_NO_REPLY;
+            livedata.commErrors++;
+            coldJunctionTemperature = NAN;
+            livedata.coldJunctionTemperature = 0;
+            temperature = NAN;
+            livedata.temperature = 0;
+            return false;
         }
     }
 
+    return true;
+}
+
+void Max3185x::prepareRead(SpiTransaction& t)
+{
+    if (type == MAX31855_TYPE)
+    {
+        /* 32 bits of dummy */
+        memset(txBuf, 0, 4);
+        t.size = 4;
+    }
+    else
+    {
+        /* read one dummy byte, Cold-Junction temperature MSB, LSB, Linearized TC temperature 3 bytes and Fault Status */
+        memset(txBuf, 0, 1 + 6);
+        txBuf[0] = 0x0a;
+        t.size = 1 + 6;
+    }
+
+    readOk = false;
+
+    t.device = index;
+    t.tx = txBuf;
+    t.rx = rxBuf;
+    t.done = onExchangeDone;
+    t.context = &readOk;
+}
+
+Max3185xState Max3185x::finishRead()
+{
     if (type == MAX31855_TYPE)
     {
-        livedata.state = readPacket31855();
+        livedata.state = decode31855();
     }
     else if (type == MAX31856_TYPE)
     {
-        livedata.state = readPacket31856();
+        livedata.state = decode31856();
     }
 
     if (livedata.state == MAX3185X_OK)
@@ -297,26 +467,136 @@ Max3185xState Max3185x::readPacket()
         type = UNKNOWN_TYPE;
     }
 
-    return MAX3185X_OK;
+    return (Max3185xState)livedata.state;
+}
+
+uint32_t Max3185x::readPeriodMs() const
+{
+    if (type == MAX31856_TYPE)
+    {
+        auto cfg = GetConfiguration();
+        return Max31856ConversionPeriodMs(static_cast<Max31856Averaging>(cfg->egtAveraging),
+                                          static_cast<Max31856Notch>(cfg->egtNotch));
+    }
+
+    return EGT_POLL_PERIOD_MS;
+}
+
+static uint32_t NowMs()
+{
+    return chVTGetTimeStamp() / (CH_CFG_ST_FREQUENCY / 1000);
 }
 
 void Max3185xThread::ThreadTask()
 {
+    for (size_t i = 0; i < busCount; i++)
+    {
+        spiStart(buses[i].driver, &spi_config);
+    }
 
     while (true)
     {
+        Max3185x* due[EGT_CHANNELS];
+        size_t count = 0;
+        uint32_t now = NowMs();
+
+        /* Detection first: it uses blocking exchanges, which would also start anything already
+         * queued on the bus. A chip that doesn't answer backs off. */
+        for (int ch = 0; ch < EGT_CHANNELS; ch++)
+        {
+            Max3185x& chip = max3185x[ch];
+
+            if (!chip.schedule.IsDue(now))
+            {
+                continue;
+            }
+
+            if (chip.detectIfNeeded())
+            {
+                due[count++] = &chip;
+            }
+            else
+            {
+                chip.schedule.Done(now, chip.readPeriodMs(), false);
+            }
+        }
+
+        // Then every due chip's read, back to back on its bus, all buses at once
+        bool busy[EGT_CHANNELS] = {};
+
+        for (size_t i = 0; i < count; i++)
+        {
+            SpiTransaction t;
+            due[i]->prepareRead(t);
+            egtSpiQueue(buses[due[i]->getBus()], t);
+            busy[due[i]->getBus()] = true;
+        }
+
+        for (size_t i = 0; i < busCount; i++)
+        {
+            if (busy[i])
+            {
+                egtSpiKick(buses[i]);
+            }
+        }
+
+        for (size_t i = 0; i < busCount; i++)
+        {
+            if (busy[i])
+            {
+                egtSpiWait(buses[i]);
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            bool answered = due[i]->finishRead() != MAX3185X_NO_REPLY;
+            due[i]->schedule.Done(now, due[i]->readPeriodMs(), answered);
+        }
+
+        // Until the next chip is due
+        now = NowMs();
+        uint32_t sleep = EGT_POLL_PERIOD_MS;
+
         for (int ch = 0; ch < EGT_CHANNELS; ch++)
         {
-            Max3185x& current = max3185x[ch];
-            current.readPacket();
+            uint32_t wait = max3185x[ch].schedule.TimeUntilDue(now);
+
+            if (wait < sleep)
+            {
+                sleep = wait;
+            }
         }
 
-        chThdSleepMilliseconds(500);
+        if (sleep)
+        {
+            chThdSleepMilliseconds(sleep);
+        }
     }
 }
 
 void StartEgt()
 {
+    // A bus per distinct SPI driver
+    for (size_t ch = 0; ch < EGT_CHANNELS; ch++)
+    {
+        size_t bus = 0;
+
+        while (bus < busCount && buses[bus].driver != chips[ch].driver)
+        {
+            bus++;
+        }
+
+        if (bus == busCount)
+        {
+            buses[bus].driver = chips[ch].driver;
+            chBSemObjectInit(&buses[bus].idle, true);
+            busCount++;
+        }
+
+        instances[ch].setChip(ch, bus);
+    }
+
     EgtThread.Start();
 }
 
@@ -4,6 +4,8 @@
 
 #include "wideband_config.h"
 #include "thread_controller.h"
+#include "spi_queue.h"
+#include "egt_schedule.h"
 
 typedef enum
 {
@@ -21,7 +23,7 @@ typedef enum
     MAX3185X_NO_REPLY = 4,
 } Max3185xState;
 
-/* livedata: +96/112 offset, size = 16 */
+/* livedata: +96/112 offset, size = 16. Channels 2 and up follow the CAN fragment, +224 onward */
 struct livedata_egt_s
 {
     union
@@ -46,23 +48,61 @@ const struct livedata_egt_s* getEgtLiveDataStructAddr(const int ch);
 #define MAX3185X_THREAD_STACK (512)
 #define MAX3185X_THREAD_PRIO (NORMALPRIO + 1)
 
+// MAX31855 read period, about one conversion. MAX31856 are read at their own conversion period.
+#define EGT_POLL_PERIOD_MS 100
+// A batch of reads is a few tens of us per chip, this only catches a lost completion
+#define EGT_SPI_TIMEOUT_MS 10
+
+// Largest read, MAX31856 register dump
+#define MAX3185X_PACKET_SIZE 7
+
 class Max3185x
 {
 public:
-    Max3185x(const SPIConfig* spi) { this->spi = spi; }
+    // Which EGT_CHIPS entry this is, and the index of its bus
+    void setChip(uint8_t index, uint8_t bus)
+    {
+        this->index = index;
+        this->bus = bus;
+    }
+
+    uint8_t getBus() const
+    {
+        return bus;
+    }
+
     livedata_egt_s livedata;
     /* do we need float temperatures? */
     float coldJunctionTemperature;
     float temperature;
     Max3185xType type = UNKNOWN_TYPE;
-    Max3185xState readPacket();
+
+    // Detects the chip (again) if needed, with blocking exchanges: call before anything is queued
+    // on its bus. Returns false if there is no chip to read.
+    bool detectIfNeeded();
+    // Fills t with the read for this period
+    void prepareRead(SpiTransaction& t);
+    // Decodes what the read got back
+    Max3185xState finishRead();
+    // How often a new result is ready, which is when it gets read
+    uint32_t readPeriodMs() const;
+
+    EgtSchedule schedule;
 
 private:
-    const SPIConfig* spi;
+    uint8_t index = 0;
+    uint8_t bus = 0;
+    // DMA buffers, live as long as the chip
+    uint8_t txBuf[MAX3185X_PACKET_SIZE] = {};
+    uint8_t rxBuf[MAX3185X_PACKET_SIZE];
+    bool readOk = false;
+    // MAX31856 settings written by detect(), compared against the configuration
+    uint8_t cr0 = 0;
+    uint8_t cr1 = 0;
+
     Max3185xType detect();
-    Max3185xState readPacket31855();
-    Max3185xState readPacket31856();
-    int spi_rx32(uint32_t* data);
+    Max3185xState decode31855();
+    Max3185xState decode31856();
     int spi_txrx(const uint8_t tx[], uint8_t rx[], size_t n);
 };
 
@@ -0,0 +1,125 @@
+#include "och_delta.h"
+
+#include <cstring>
+
+void OchDeltaEncoder::Reset()
+{
+    m_haveReference = false;
+}
+
+size_t OchDeltaEncoder::Encode(const uint8_t* block, uint8_t* out)
+{
+    uint8_t* bitmap = out + 1;
+    size_t changed = 0;
+
+    if (m_haveReference && m_sinceKeyframe < OCH_DELTA_KEYFRAME_INTERVAL)
+    {
+        memset(bitmap, 0, OCH_DELTA_BITMAP_SIZE);
+
+        for (size_t word = 0; word < OCH_DELTA_WORDS; word++)
+        {
+            if (memcmp(block + word * 4, m_reference + word * 4, 4) != 0)
+            {
+                bitmap[word / 8] |= 1 << (word % 8);
+                changed++;
+            }
+        }
+    }
+    else
+    {
+        // Anything bigger than a keyframe
+        changed = OCH_DELTA_WORDS;
+    }
+
+    size_t size;
+
+    if (1 + OCH_DELTA_BITMAP_SIZE + changed * 4 < OCH_DELTA_MAX_SIZE)
+    {
+        out[0] = 0;
+        uint8_t* values = bitmap + OCH_DELTA_BITMAP_SIZE;
+
+        for (size_t word = 0; word < OCH_DELTA_WORDS; word++)
+        {
+            if (bitmap[word / 8] & (1 << (word % 8)))
+            {
+                memcpy(values, block + word * 4, 4);
+                values += 4;
+            }
+        }
+
+        size = values - out;
+        m_sinceKeyframe++;
+        deltaCount++;
+    }
+    else
+    {
+        out[0] = OCH_DELTA_KEYFRAME;
+        memcpy(out + 1, block, OCH_BLOCK_SIZE);
+
+        size = OCH_DELTA_MAX_SIZE;
+        m_sinceKeyframe = 0;
+        keyframeCount++;
+    }
+
+    memcpy(m_reference, block, OCH_BLOCK_SIZE);
+    m_haveReference = true;
+
+    return size;
+}
+
+void OchDeltaDecoder::Reset()
+{
+    m_haveBlock = false;
+}
+
+bool OchDeltaDecoder::Decode(const uint8_t* in, size_t size)
+{
+    if (size < 1)
+    {
+        return false;
+    }
+
+    if (in[0] & OCH_DELTA_KEYFRAME)
+    {
+        if (size != OCH_DELTA_MAX_SIZE)
+        {
+            return false;
+        }
+
+        memcpy(m_block, in + 1, OCH_BLOCK_SIZE);
+        m_haveBlock = true;
+        return true;
+    }
+
+    if (!m_haveBlock || size < 1 + OCH_DELTA_BITMAP_SIZE)
+    {
+        return false;
+    }
+
+    const uint8_t* bitmap = in + 1;
+
+    // Check the size before touching the block
+    size_t changed = 0;
+    for (size_t i = 0; i < OCH_DELTA_BITMAP_SIZE; i++)
+    {
+        changed += __builtin_popcount(bitmap[i]);
+    }
+
+    if (size != 1 + OCH_DELTA_BITMAP_SIZE + changed * 4)
+    {
+        return false;
+    }
+
+    const uint8_t* values = bitmap + OCH_DELTA_BITMAP_SIZE;
+
+    for (size_t word = 0; word < OCH_DELTA_WORDS; word++)
+    {
+        if (bitmap[word / 8] & (1 << (word % 8)))
+        {
+            memcpy(m_block + word * 4, values, 4);
+            values += 4;
+        }
+    }
+
+    return true;
+}
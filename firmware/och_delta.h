@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "och_snapshot.h"
+
+/**
+ * Delta compressed output channel blocks, for slow links.
+ *
+ * Most of the block stays the same from one record to the next, so instead of the whole block
+ * only the 4 byte words that changed are sent:
+ *   keyframe: flags (OCH_DELTA_KEYFRAME), then the whole block
+ *   delta:    flags (0), a bitmap of changed words (bit n of byte n / 8 = word n), then those words in order
+ * A delta applies to the block the previous record left the decoder with. A keyframe goes out
+ * every OCH_DELTA_KEYFRAME_INTERVAL records, so a client that lost a record (sequence number gap)
+ * drops deltas until the next keyframe and carries on from there.
+ */
+#define OCH_DELTA_WORDS (OCH_BLOCK_SIZE / 4)
+#define OCH_DELTA_BITMAP_SIZE (OCH_DELTA_WORDS / 8)
+#define OCH_DELTA_KEYFRAME_INTERVAL 50
+
+#define OCH_DELTA_KEYFRAME 0x01
+
+// A delta is never sent when a keyframe would be smaller
+#define OCH_DELTA_MAX_SIZE (1 + OCH_BLOCK_SIZE)
+
+class OchDeltaEncoder
+{
+public:
+    // Next record is a keyframe
+    void Reset();
+
+    // Encode block into out, which holds at least OCH_DELTA_MAX_SIZE. Returns the encoded size.
+    size_t Encode(const uint8_t* block, uint8_t* out);
+
+    uint32_t keyframeCount = 0;
+    uint32_t deltaCount = 0;
+
+private:
+    alignas(4) uint8_t m_reference[OCH_BLOCK_SIZE];
+    bool m_haveReference = false;
+    uint16_t m_sinceKeyframe = 0;
+};
+
+class OchDeltaDecoder
+{
+public:
+    // Forget the current block, only a keyframe can follow
+    void Reset();
+
+    // Returns false for a malformed record, or a delta with no keyframe before it. The block is left alone then.
+    bool Decode(const uint8_t* in, size_t size);
+
+    bool HasBlock() const
+    {
+        return m_haveBlock;
+    }
+
+    const uint8_t* GetBlock() const
+    {
+        return m_block;
+    }
+
+private:
+    alignas(4) uint8_t m_block[OCH_BLOCK_SIZE];
+    bool m_haveBlock = false;
+};
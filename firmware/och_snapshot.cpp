@@ -0,0 +1,71 @@
+#include "och_snapshot.h"
+
+#include "crc_backend.h"
+
+uint8_t* OchSnapshot::BeginWrite()
+{
+    Buffer& back = m_buffers[m_back];
+
+    if (back.readers)
+    {
+        skipCount++;
+        return nullptr;
+    }
+
+    return back.packet + OCH_PACKET_HEADER_SIZE;
+}
+
+void OchSnapshot::Seal()
+{
+    uint8_t* packet = m_buffers[m_back].packet;
+
+    // Size (big endian) counts the response code too
+    packet[0] = (OCH_BLOCK_SIZE + 1) >> 8;
+    packet[1] = (OCH_BLOCK_SIZE + 1) & 0xFF;
+    // TS_RESPONSE_OK
+    packet[2] = 0;
+
+    // CRC covers the response code and the data, big endian
+    uint32_t crc = Crc32(packet + 2, OCH_BLOCK_SIZE + 1);
+    uint8_t* tail = packet + OCH_PACKET_HEADER_SIZE + OCH_BLOCK_SIZE;
+    tail[0] = crc >> 24;
+    tail[1] = crc >> 16;
+    tail[2] = crc >> 8;
+    tail[3] = crc;
+}
+
+void OchSnapshot::Publish()
+{
+    m_back ^= 1;
+    m_havePublished = true;
+    publishCount++;
+
+    if (m_wantedFrames)
+    {
+        m_wantedFrames--;
+    }
+}
+
+const uint8_t* OchSnapshot::Acquire()
+{
+    if (!m_havePublished)
+    {
+        return nullptr;
+    }
+
+    // The front buffer is whichever one isn't the back
+    Buffer& front = m_buffers[m_back ^ 1];
+    front.readers++;
+    return front.packet;
+}
+
+void OchSnapshot::Release(const uint8_t* packet)
+{
+    for (auto& buffer : m_buffers)
+    {
+        if (buffer.packet == packet && buffer.readers)
+        {
+            buffer.readers--;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "wideband_config.h"
+
+// Size of the output channel block, ochBlockSize in the ini. The fixed fragments take 224 bytes,
+// boards with more than four EGT channels need more for the extra ones (see livedata.cpp).
+#define OCH_BLOCK_SIZE (EGT_CHANNELS > 4 ? (224 + 16 * (EGT_CHANNELS - 2) + 31) / 32 * 32 : 256)
+
+// TS response framing around the block: 2 byte size and response code before, CRC32 after
+#define OCH_PACKET_HEADER_SIZE 3
+#define OCH_PACKET_SIZE (OCH_PACKET_HEADER_SIZE + OCH_BLOCK_SIZE + 4)
+
+// Frames keep being built for this many publishes after a reader last asked, about a second at
+// OCH_PUBLISH_PERIOD_MS. Polling TS keeps getting fresh frames, with nobody polling it stops.
+#define OCH_WANTED_FRAMES 200
+
+/**
+ * Output channel frames for TunerStudio, double buffered.
+ *
+ * The producer fills the back buffer with a complete frame and publishes it, readers pin the
+ * published buffer and send it as is: the TS response header and CRC are already in place.
+ * A pinned buffer is never written. If the producer's next buffer is still pinned by a slow
+ * reader, that frame is skipped and readers keep getting the last complete one.
+ *
+ * Not thread safe, the caller locks around BeginWrite(), Publish(), Acquire() and Release().
+ * Between BeginWrite() and Publish() the back buffer belongs to the producer alone, so
+ * filling it and Seal() run unlocked.
+ *
+ * Building a frame isn't free, the producer only does it while IsWanted().
+ */
+class OchSnapshot
+{
+public:
+    // Output channel block to fill, nullptr if the back buffer is pinned (skip this frame)
+    uint8_t* BeginWrite();
+    // Build the TS header and CRC around the back buffer
+    void Seal();
+    // Make the back buffer the one readers get
+    void Publish();
+
+    // Whole TS packet for the latest frame, pinned until Release(). nullptr if nothing was published yet.
+    const uint8_t* Acquire();
+    void Release(const uint8_t* packet);
+
+    // A reader is about to Acquire(), keep frames coming for OCH_WANTED_FRAMES more publishes
+    void Want()
+    {
+        m_wantedFrames = OCH_WANTED_FRAMES;
+    }
+
+    bool IsWanted() const
+    {
+        return m_wantedFrames != 0;
+    }
+
+    uint32_t publishCount = 0;
+    // Frames dropped because a reader was still sending the back buffer
+    uint32_t skipCount = 0;
+
+private:
+    struct Buffer
+    {
+        alignas(4) uint8_t packet[OCH_PACKET_SIZE];
+        uint8_t readers;
+    };
+
+    Buffer m_buffers[2] = {};
+    uint8_t m_back = 0;
+    bool m_havePublished = false;
+    uint8_t m_wantedFrames = 0;
+};
+
+// Offset of the output channel block within a packet from OchSnapshot::Acquire()
+inline const uint8_t* GetOchBlock(const uint8_t* packet)
+{
+    return packet + OCH_PACKET_HEADER_SIZE;
+}
@@ -0,0 +1,85 @@
+#include "och_stream.h"
+
+bool OchStream::Start(OchStreamSource source, uint16_t periodMs, uint16_t offset, uint16_t count, size_t sourceSize)
+{
+    if (periodMs < OCH_STREAM_MIN_PERIOD_MS || periodMs > OCH_STREAM_MAX_PERIOD_MS)
+    {
+        return false;
+    }
+
+    switch (source)
+    {
+    case OchStreamSource::Block:
+        if (count == 0 || offset + count > sourceSize)
+        {
+            return false;
+        }
+        break;
+    case OchStreamSource::Scatter:
+        // The whole scatter read, no range
+        if (sourceSize == 0)
+        {
+            return false;
+        }
+        offset = 0;
+        count = sourceSize;
+        break;
+    case OchStreamSource::Delta:
+        // Deltas are of the whole block
+        offset = 0;
+        count = sourceSize;
+        delta.Reset();
+        break;
+    default:
+        return false;
+    }
+
+    m_active = true;
+    m_source = source;
+    m_periodMs = periodMs;
+    m_offset = offset;
+    m_count = count;
+    m_sequence = 0;
+
+    // First record goes out right away
+    m_sinceRecord.init();
+
+    return true;
+}
+
+void OchStream::Stop()
+{
+    m_active = false;
+}
+
+bool OchStream::IsDue() const
+{
+    return m_active && m_sinceRecord.hasElapsedMs(m_periodMs);
+}
+
+uint32_t OchStream::GetMsUntilDue() const
+{
+    if (IsDue())
+    {
+        return 0;
+    }
+
+    float elapsedMs = m_sinceRecord.getElapsedUs() / 1000;
+
+    // Round up, waking early only means waiting again
+    return static_cast<uint32_t>(m_periodMs - elapsedMs) + 1;
+}
+
+uint16_t OchStream::NextRecord()
+{
+    // Not counting the first record, there is nothing to be late for
+    if (m_sequence > 0 && m_sinceRecord.hasElapsedMs(2 * m_periodMs))
+    {
+        lateCount++;
+    }
+
+    recordCount++;
+    m_sinceRecord.reset();
+
+    return m_sequence++;
+}
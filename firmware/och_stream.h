@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "timer.h"
+#include "och_delta.h"
+
+// Output channel frames aren't built any faster than OCH_PUBLISH_PERIOD_MS
+#define OCH_STREAM_MIN_PERIOD_MS 5
+#define OCH_STREAM_MAX_PERIOD_MS 10000
+
+enum class OchStreamSource : uint8_t
+{
+    // A range of the output channel block, like the 'O' command
+    Block = 0,
+    // The compiled scatter list, like the '9' command
+    Scatter = 1,
+    // The whole block, delta compressed (see och_delta.h)
+    Delta = 2,
+};
+
+/**
+ * Push mode output channels for one TS channel.
+ *
+ * Instead of a command round trip per record, the client asks once and the controller keeps
+ * sending records at the requested period until the client sends anything at all.
+ * On a high latency link (BT) that is the difference between a few and a few dozen records a second.
+ *
+ * This only keeps the schedule, the TS thread does the sending.
+ */
+class OchStream
+{
+public:
+    // Returns false (and changes nothing) if the request doesn't make sense. sourceSize is the
+    // size of the block, or of one scatter read.
+    bool Start(OchStreamSource source, uint16_t periodMs, uint16_t offset, uint16_t count, size_t sourceSize);
+    void Stop();
+
+    bool IsActive() const
+    {
+        return m_active;
+    }
+
+    bool IsDue() const;
+    // How long the TS thread can wait for a command before the next record is due
+    uint32_t GetMsUntilDue() const;
+
+    // About to send a record, returns its sequence number
+    uint16_t NextRecord();
+
+    OchStreamSource GetSource() const
+    {
+        return m_source;
+    }
+
+    uint16_t GetOffset() const
+    {
+        return m_offset;
+    }
+
+    uint16_t GetCount() const
+    {
+        return m_count;
+    }
+
+    // Reset on every start, so a stream always opens with a keyframe
+    OchDeltaEncoder delta;
+
+    uint32_t recordCount = 0;
+    // Records sent more than a period late, the link can't keep up with the rate
+    uint32_t lateCount = 0;
+
+private:
+    bool m_active = false;
+    OchStreamSource m_source = OchStreamSource::Block;
+    uint16_t m_periodMs = 0;
+    uint16_t m_offset = 0;
+    uint16_t m_count = 0;
+    uint16_t m_sequence = 0;
+
+    Timer m_sinceRecord;
+};
@@ -35,13 +35,19 @@ float Sampler::GetNernstAc() const
     return nernstAc;
 }
 
+// Gain is 10x, then a 61.9 ohm resistor
+// Effective resistance with the gain is 619 ohms
+// 1000 is to convert to milliamperes
+static constexpr float pumpCurrentRatio = -1000 / (PUMP_CURRENT_SENSE_GAIN * LSU_SENSE_R);
+
 float Sampler::GetPumpNominalCurrent() const
 {
-    // Gain is 10x, then a 61.9 ohm resistor
-    // Effective resistance with the gain is 619 ohms
-    // 1000 is to convert to milliamperes
-    constexpr float ratio = -1000 / (PUMP_CURRENT_SENSE_GAIN * LSU_SENSE_R);
-    return pumpCurrentSenseVoltage * ratio;
+    return pumpCurrentSenseVoltage * pumpCurrentRatio;
+}
+
+float Sampler::GetPumpNominalCurrentUnfiltered() const
+{
+    return pumpCurrentSenseVoltageUnfiltered * pumpCurrentRatio;
 }
 
 float Sampler::GetInternalHeaterVoltage() const
@@ -111,9 +117,11 @@ void Sampler::ApplySample(AnalogChannelResult& result, float virtualGroundVoltag
 
     nernstAc = (1 - ESR_SENSE_ALPHA) * nernstAc + ESR_SENSE_ALPHA * nernstAcLocal;
 
+    pumpCurrentSenseVoltageUnfiltered = result.PumpCurrentVoltage - virtualGroundVoltageInt;
+
     // Exponential moving average (aka first order lpf)
     pumpCurrentSenseVoltage = (1 - PUMP_FILTER_ALPHA) * pumpCurrentSenseVoltage +
-                              PUMP_FILTER_ALPHA * (result.PumpCurrentVoltage - virtualGroundVoltageInt);
+                              PUMP_FILTER_ALPHA * pumpCurrentSenseVoltageUnfiltered;
 
 #ifdef BOARD_HAS_VOLTAGE_SENSE
     internalHeaterVoltage = result.HeaterSupplyVoltage;
@@ -9,6 +9,7 @@ struct ISampler
     virtual float GetNernstDc() const = 0;
     virtual float GetNernstAc() const = 0;
     virtual float GetPumpNominalCurrent() const = 0;
+    virtual float GetPumpNominalCurrentUnfiltered() const = 0;
     virtual float GetInternalHeaterVoltage() const = 0;
     virtual float GetSensorTemperature() const = 0;
     virtual float GetSensorInternalResistance() const = 0;
@@ -25,6 +26,7 @@ public:
     float GetNernstDc() const override;
     float GetNernstAc() const override;
     float GetPumpNominalCurrent() const override;
+    float GetPumpNominalCurrentUnfiltered() const override;
     float GetInternalHeaterVoltage() const override;
     float GetSensorTemperature() const override;
     float GetSensorInternalResistance() const override;
@@ -36,6 +38,7 @@ private:
     float nernstAc = 0;
     float nernstDc = 0;
     float pumpCurrentSenseVoltage = 0;
+    float pumpCurrentSenseVoltageUnfiltered = 0;
 
 #ifdef BOARD_HAS_VOLTAGE_SENSE
     float internalHeaterVoltage = 0;
@@ -53,4 +56,7 @@ float GetSupplyVoltage();
 
 float GetMcuTemperature();
 
+// Local time (see GetLocalTimeUs) that the most recent sample was taken
+uint32_t GetLastSampleTimeUs();
+
 void StartSampling();
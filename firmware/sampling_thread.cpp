@@ -5,15 +5,33 @@
 #include "livedata.h"
 
 #include "sampling.h"
+#include "cylinder_lambda.h"
+#include "diag_stream.h"
+#include "lambda_logger.h"
 #include "port.h"
+#include "time_sync.h"
 
 static Sampler samplers[AFR_CHANNELS];
+static CylinderLambda cylinderLambda[AFR_CHANNELS];
 
 const ISampler& GetSampler(int ch)
 {
     return samplers[ch];
 }
 
+const CylinderLambda& GetCylinderLambda(int ch)
+{
+    return cylinderLambda[ch];
+}
+
+void PostEngineEvent(uint8_t cylinder, uint8_t cylinderCount)
+{
+    for (int ch = 0; ch < AFR_CHANNELS; ch++)
+    {
+        cylinderLambda[ch].PostEngineEvent(cylinder, cylinderCount);
+    }
+}
+
 static THD_WORKING_AREA(waSamplingThread, 256);
 
 #ifdef BOARD_HAS_VOLTAGE_SENSE
@@ -31,6 +49,12 @@ float GetMcuTemperature()
     return mcuTemp;
 }
 
+static uint32_t lastSampleTimeUs = 0;
+uint32_t GetLastSampleTimeUs()
+{
+    return lastSampleTimeUs;
+}
+
 static void SamplingThread(void*)
 {
     chRegSetThreadName("Sampling");
@@ -45,6 +69,7 @@ static void SamplingThread(void*)
     while (true)
     {
         auto result = AnalogSampleFinish();
+        lastSampleTimeUs = GetLocalTimeUs();
 
         // Toggle the pin after sampling so that any switching noise occurs while we're doing our math instead of when
         // sampling
@@ -60,11 +85,19 @@ static void SamplingThread(void*)
         for (int ch = 0; ch < AFR_CHANNELS; ch++)
         {
             samplers[ch].ApplySample(result.ch[ch], result.VirtualGroundVoltageInt);
+            cylinderLambda[ch].OnSample(samplers[ch].GetPumpNominalCurrentUnfiltered());
+#if defined(DIAG_STREAM_ENABLED)
+            DiagStreamOnSample(ch);
+#endif
+#if defined(TS_ENABLED)
+            LambdaLoggerOnSample(ch);
+#endif
         }
 
 #if defined(TS_ENABLED)
         /* tunerstudio */
         SamplingUpdateLiveData();
+        SamplingPublishOutputChannels();
 #endif
     }
 }
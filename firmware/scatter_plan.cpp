@@ -0,0 +1,81 @@
+#include "scatter_plan.h"
+
+#include <cstring>
+
+// Run offset for bytes outside the output channel block
+#define SCATTER_ZERO_RUN 0xFFFF
+
+void ScatterPlan::Compile(const uint16_t* entries, size_t count, size_t blockSize, size_t maxSize)
+{
+    m_runCount = 0;
+    m_totalSize = 0;
+
+    if (count > HIGH_SPEED_COUNT)
+    {
+        count = HIGH_SPEED_COUNT;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint16_t packed = entries[i];
+        uint8_t type = packed >> 13;
+
+        if (type == 0)
+        {
+            continue;
+        }
+
+        uint16_t size = 1 << (type - 1);
+        uint16_t offset = packed & 0x1FFF;
+
+        if (m_totalSize + size > maxSize)
+        {
+            break;
+        }
+
+        m_totalSize += size;
+
+        if (offset + size > blockSize)
+        {
+            offset = SCATTER_ZERO_RUN;
+        }
+
+        // Carries on where the last one ended, same copy
+        if (m_runCount > 0)
+        {
+            ScatterRun& last = m_runs[m_runCount - 1];
+
+            bool bothZero = last.offset == SCATTER_ZERO_RUN && offset == SCATTER_ZERO_RUN;
+            bool adjacent = last.offset != SCATTER_ZERO_RUN && last.offset + last.size == offset;
+
+            if (bothZero || adjacent)
+            {
+                last.size += size;
+                continue;
+            }
+        }
+
+        m_runs[m_runCount++] = {offset, size};
+    }
+}
+
+size_t ScatterPlan::Gather(const uint8_t* block, uint8_t* out) const
+{
+    for (size_t i = 0; i < m_runCount; i++)
+    {
+        const ScatterRun& run = m_runs[i];
+
+        if (run.offset == SCATTER_ZERO_RUN)
+        {
+            memset(out, 0, run.size);
+        }
+        else
+        {
+            memcpy(out, block + run.offset, run.size);
+        }
+
+        out += run.size;
+    }
+
+    return m_totalSize;
+}
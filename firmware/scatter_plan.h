@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Entries in the TS scatter list, highSpeedOffsets in the ini
+#define HIGH_SPEED_COUNT 64
+
+struct ScatterRun
+{
+    uint16_t offset;
+    uint16_t size;
+};
+
+/**
+ * TunerStudio's scatter read list ('9' command), compiled.
+ *
+ * TS sends the output channels it wants as packed entries: bits 13-15 are log2(size) + 1
+ * (0 = unused entry), bits 0-12 the offset in the output channel block. Decoding that on
+ * every poll is wasted work, the list only changes when TS writes it. So it is turned into
+ * runs of contiguous bytes once, with adjacent entries merged, and a read is then one copy per run.
+ */
+class ScatterPlan
+{
+public:
+    // Entries reaching past blockSize read as zero. Entries that would take the response past maxSize are dropped.
+    void Compile(const uint16_t* entries, size_t count, size_t blockSize, size_t maxSize);
+
+    // Copy the selected bytes of the output channel block to out, returns GetTotalSize()
+    size_t Gather(const uint8_t* block, uint8_t* out) const;
+
+    size_t GetTotalSize() const
+    {
+        return m_totalSize;
+    }
+
+    size_t GetRunCount() const
+    {
+        return m_runCount;
+    }
+
+private:
+    ScatterRun m_runs[HIGH_SPEED_COUNT];
+    size_t m_runCount = 0;
+    size_t m_totalSize = 0;
+};
@@ -0,0 +1,152 @@
+#include "bl_block.h"
+
+#include <cstring>
+
+void BlockReceiver::Begin(uint16_t blockIndex)
+{
+    m_active = true;
+    m_blockIndex = blockIndex;
+
+    for (size_t i = 0; i < BL_BLOCK_STATUS_COUNT; i++)
+    {
+        m_received[i] = 0;
+    }
+
+    // Erased flash value, so a short last block programs cleanly
+    memset(m_buffer, 0xFF, sizeof(m_buffer));
+}
+
+bool BlockReceiver::OnData(uint8_t seq, const uint8_t* data, uint8_t dlc)
+{
+    if (!m_active || seq >= BL_BLOCK_FRAMES || dlc != BL_BLOCK_FRAME_SIZE)
+    {
+        return false;
+    }
+
+    // A retransmit of a frame we already have simply overwrites it with the same data
+    memcpy(&m_buffer[seq * BL_BLOCK_FRAME_SIZE], data, BL_BLOCK_FRAME_SIZE);
+    m_received[seq / BL_BLOCK_FRAMES_PER_STATUS] |= 1ull << (seq % BL_BLOCK_FRAMES_PER_STATUS);
+
+    return true;
+}
+
+uint64_t BlockReceiver::GetMissing(uint8_t statusIndex, uint8_t frameCount) const
+{
+    if (statusIndex >= BL_BLOCK_STATUS_COUNT)
+    {
+        return 0;
+    }
+
+    int first = statusIndex * BL_BLOCK_FRAMES_PER_STATUS;
+    int count = frameCount - first;
+
+    if (count <= 0)
+    {
+        return 0;
+    }
+
+    uint64_t expected = count >= BL_BLOCK_FRAMES_PER_STATUS ? ~0ull : (1ull << count) - 1;
+
+    return expected & ~m_received[statusIndex];
+}
+
+bool BlockReceiver::IsComplete(uint8_t frameCount) const
+{
+    if (frameCount > BL_BLOCK_FRAMES)
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < BL_BLOCK_STATUS_COUNT; i++)
+    {
+        if (GetMissing(i, frameCount))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+BlockEndResult BlockReceiver::OnEnd(uint16_t blockIndex, uint8_t frameCount)
+{
+    if (frameCount == 0 || frameCount > BL_BLOCK_FRAMES)
+    {
+        return BlockEndResult::Invalid;
+    }
+
+    if (!m_active && static_cast<int32_t>(blockIndex) == m_lastFinished)
+    {
+        return BlockEndResult::AlreadyDone;
+    }
+
+    if (!m_active || blockIndex != m_blockIndex)
+    {
+        // We never saw this block's BEGIN, start it now and ask for everything
+        Begin(blockIndex);
+        return BlockEndResult::Missing;
+    }
+
+    return IsComplete(frameCount) ? BlockEndResult::Program : BlockEndResult::Missing;
+}
+
+void BlockReceiver::Finish()
+{
+    m_active = false;
+    m_lastFinished = m_blockIndex;
+}
+
+void BlockReceiver::Reset()
+{
+    m_active = false;
+    m_lastFinished = -1;
+}
+
+bool IsBlockInArea(uint16_t blockIndex, uint8_t frameCount, uint32_t areaSize)
+{
+    uint32_t offset = blockIndex * BL_BLOCK_SIZE;
+    uint32_t size = frameCount * BL_BLOCK_FRAME_SIZE;
+
+    return offset + size <= areaSize;
+}
+
+void MulticastBlockTracker::Begin(uint32_t nodeMask)
+{
+    m_pending = nodeMask;
+
+    for (size_t i = 0; i < BL_BLOCK_STATUS_COUNT; i++)
+    {
+        m_resend[i] = 0;
+    }
+}
+
+void MulticastBlockTracker::OnAck(uint8_t node)
+{
+    if (node < 32)
+    {
+        m_pending &= ~(1u << node);
+    }
+}
+
+void MulticastBlockTracker::OnStatus(uint8_t node, uint8_t group, uint64_t missing)
+{
+    // A node we aren't waiting for has nothing to say about this block
+    if (node >= 32 || !(m_pending & (1u << node)) || group >= BL_BLOCK_STATUS_COUNT)
+    {
+        return;
+    }
+
+    m_resend[group] |= missing;
+}
+
+uint64_t MulticastBlockTracker::TakeResend(uint8_t group)
+{
+    if (group >= BL_BLOCK_STATUS_COUNT)
+    {
+        return 0;
+    }
+
+    uint64_t resend = m_resend[group];
+    m_resend[group] = 0;
+    return resend;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// One block is one flash page on the F0, see WB_OPCODE_BLOCK
+#define BL_BLOCK_SIZE 1024
+#define BL_BLOCK_FRAME_SIZE 8
+#define BL_BLOCK_FRAMES (BL_BLOCK_SIZE / BL_BLOCK_FRAME_SIZE)
+// Missing frame bitmaps are sent 64 frames per status message
+#define BL_BLOCK_FRAMES_PER_STATUS 64
+#define BL_BLOCK_STATUS_COUNT (BL_BLOCK_FRAMES / BL_BLOCK_FRAMES_PER_STATUS)
+
+enum class BlockEndResult : uint8_t
+{
+    // All frames are here, program the buffer then call Finish()
+    Program,
+    // The block was already programmed, the host didn't get our ack
+    AlreadyDone,
+    // Some frames are missing, report them with GetMissing()
+    Missing,
+    // Bad frame count
+    Invalid,
+};
+
+/**
+ * Collects the frames of one block into a RAM page buffer, in any order,
+ * and keeps track of which ones are still missing.
+ */
+class BlockReceiver
+{
+public:
+    // Start a new block, discarding whatever was collected so far
+    void Begin(uint16_t blockIndex);
+
+    // Returns false if the frame doesn't belong in a block (no block started, bad sequence number or length)
+    bool OnData(uint8_t seq, const uint8_t* data, uint8_t dlc);
+
+    // True once all of the first frameCount frames have arrived
+    bool IsComplete(uint8_t frameCount) const;
+
+    // Bit n set = frame (statusIndex * 64 + n) of the first frameCount frames is missing
+    uint64_t GetMissing(uint8_t statusIndex, uint8_t frameCount) const;
+
+    bool IsActive() const
+    {
+        return m_active;
+    }
+
+    // Handle the END of a block
+    BlockEndResult OnEnd(uint16_t blockIndex, uint8_t frameCount);
+
+    // The current block has been programmed
+    void Finish();
+
+    // Forget everything, for example after the flash is erased
+    void Reset();
+
+    uint16_t GetBlockIndex() const
+    {
+        return m_blockIndex;
+    }
+
+    const uint8_t* GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+private:
+    bool m_active = false;
+    uint16_t m_blockIndex = 0;
+    int32_t m_lastFinished = -1;
+    uint64_t m_received[BL_BLOCK_STATUS_COUNT] = {};
+
+    // Aligned so the buffer can be handed to the flash halfword by halfword
+    alignas(4) uint8_t m_buffer[BL_BLOCK_SIZE];
+};
+
+// Whether frameCount frames of block blockIndex fit in an area of areaSize bytes, the bootloader
+// NAKs an uncompressed block that doesn't
+bool IsBlockInArea(uint16_t blockIndex, uint8_t frameCount, uint32_t areaSize);
+
+/**
+ * Host side of a multicast block transfer (see WB_BL_MULTICAST): tracks which controllers
+ * still have to ack the current block, and which frames at least one of them is missing.
+ * Controllers are identified by CAN index, up to 32 of them.
+ */
+class MulticastBlockTracker
+{
+public:
+    // Start a block that all nodes in nodeMask (bit n = CAN index n) have to ack
+    void Begin(uint32_t nodeMask);
+
+    void OnAck(uint8_t node);
+    void OnStatus(uint8_t node, uint8_t group, uint64_t missing);
+
+    bool IsDone() const
+    {
+        return m_pending == 0;
+    }
+
+    // Nodes that haven't acked yet
+    uint32_t GetPending() const
+    {
+        return m_pending;
+    }
+
+    // Frames to resend before the next END, the union of what every node reported missing.
+    // Clears the request.
+    uint64_t TakeResend(uint8_t group);
+
+private:
+    uint32_t m_pending = 0;
+    uint64_t m_resend[BL_BLOCK_STATUS_COUNT] = {};
+};
@@ -0,0 +1,141 @@
+#include "crc_backend.h"
+
+#if WB_PROD
+#include "hal.h"
+#endif
+
+#if defined(STM32F0XX) || defined(STM32F1XX)
+#define HAS_CRC_UNIT 1
+#else
+#define HAS_CRC_UNIT 0
+#endif
+
+// Half a byte at a time: the bulk of the work goes to the CRC unit anyway,
+// so a 64 byte table is a better deal than 1k of flash in the bootloader
+static const uint32_t crcNibbleTable[16] =
+{
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+uint32_t SoftwareCrc32Update(uint32_t crc, const uint8_t* data, size_t size)
+{
+    crc = ~crc;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        crc ^= data[i];
+        crc = crcNibbleTable[crc & 0xF] ^ (crc >> 4);
+        crc = crcNibbleTable[crc & 0xF] ^ (crc >> 4);
+    }
+
+    return ~crc;
+}
+
+uint32_t GetCrcUnitLoadWord(uint32_t state)
+{
+    // A step forward shifts right, and XORs the polynomial in if the bit shifted out was set.
+    // The polynomial has its top bit set, so the top bit tells which way each step went.
+    for (int i = 0; i < 32; i++)
+    {
+        if (state & 0x80000000)
+        {
+            state = ((state ^ CRC32_POLY_REFLECTED) << 1) | 1;
+        }
+        else
+        {
+            state <<= 1;
+        }
+    }
+
+    // This is state ^ word from all ones
+    return state ^ 0xFFFFFFFF;
+}
+
+#if HAS_CRC_UNIT
+
+#ifdef STM32F0XX
+// F0 can reverse the bits itself
+struct CrcUnit
+{
+    void Reset()
+    {
+        CRC->INIT = 0xFFFFFFFF;
+        CRC->CR = CRC_CR_REV_IN | CRC_CR_REV_OUT | CRC_CR_RESET;
+    }
+
+    void Write(uint32_t w)
+    {
+        CRC->DR = w;
+    }
+
+    uint32_t Read()
+    {
+        return CRC->DR;
+    }
+};
+#else
+// F1 has a fixed configuration, reverse in software (one instruction on the M3)
+struct CrcUnit
+{
+    void Reset()
+    {
+        CRC->CR = CRC_CR_RESET;
+    }
+
+    void Write(uint32_t w)
+    {
+        CRC->DR = __RBIT(w);
+    }
+
+    uint32_t Read()
+    {
+        return __RBIT(CRC->DR);
+    }
+};
+#endif
+
+// Below this the software version wins, loading the unit costs about as much as 16 bytes
+#define CRC_UNIT_MIN_SIZE 32
+
+// The unit is shared between threads, each chunk runs locked and reloads the state.
+// 256 bytes is a few microseconds with interrupts off.
+#define CRC_UNIT_CHUNK_SIZE 256
+
+uint32_t Crc32Update(uint32_t crc, const void* data, size_t size)
+{
+    auto p = static_cast<const uint8_t*>(data);
+
+    if (size >= CRC_UNIT_MIN_SIZE)
+    {
+        rccEnableAHB(RCC_AHBENR_CRCEN, true);
+
+        CrcUnit unit;
+        while (size >= 4)
+        {
+            size_t chunk = size < CRC_UNIT_CHUNK_SIZE ? size : CRC_UNIT_CHUNK_SIZE;
+            size_t words = chunk / 4;
+
+            chSysLock();
+            crc = UnitCrc32Update(unit, crc, p, words);
+            chSysUnlock();
+
+            p += words * 4;
+            size -= words * 4;
+        }
+    }
+
+    // Whatever doesn't make a whole word
+    return SoftwareCrc32Update(crc, p, size);
+}
+
+#else // no CRC unit
+
+uint32_t Crc32Update(uint32_t crc, const void* data, size_t size)
+{
+    return SoftwareCrc32Update(crc, static_cast<const uint8_t*>(data), size);
+}
+
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * CRC32, the same one as crc32()/crc32inc() from libfirmware (zlib's), using the
+ * CRC unit where the chip has one, and a table driven software version otherwise.
+ *
+ * The STM32 CRC unit takes 32 bit words, MSB first, and on F1 can't be told where to start.
+ * So the words are bit reversed on the way in and out, and a CRC is continued by first
+ * writing the one word that takes the unit from its reset value to the state we want.
+ */
+
+// Continue a CRC from a previous result, crc = 0 starts a new one
+uint32_t Crc32Update(uint32_t crc, const void* data, size_t size);
+
+inline uint32_t Crc32(const void* data, size_t size)
+{
+    return Crc32Update(0, data, size);
+}
+
+// The software version, always available
+uint32_t SoftwareCrc32Update(uint32_t crc, const uint8_t* data, size_t size);
+
+#define CRC32_POLY_REFLECTED 0xEDB88320
+
+// The word that, written to a freshly reset CRC unit, leaves it in (reflected) state `state`.
+// Found by running the CRC backwards 32 bits from the state we want.
+uint32_t GetCrcUnitLoadWord(uint32_t state);
+
+/**
+ * The part that drives the CRC unit, on whole words. TUnit provides:
+ *   void Reset()            unit back to all ones
+ *   void Write(uint32_t w)  feed a word as it is in memory, in the (reflected) bit order crc32 uses
+ *   uint32_t Read()         current state, reflected
+ * On the chip that's the peripheral, the host tests use a model of it.
+ */
+template <typename TUnit>
+uint32_t UnitCrc32Update(TUnit& unit, uint32_t crc, const uint8_t* data, size_t words)
+{
+    unit.Reset();
+
+    // crc32 keeps its state inverted between calls
+    uint32_t state = ~crc;
+    if (state != 0xFFFFFFFF)
+    {
+        unit.Write(GetCrcUnitLoadWord(state));
+    }
+
+    for (size_t i = 0; i < words; i++)
+    {
+        // The data may not be aligned, this compiles to a plain load where that is allowed
+        uint32_t w = data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+        unit.Write(w);
+        data += 4;
+    }
+
+    return ~unit.Read();
+}
@@ -59,17 +59,11 @@ void Flash::ErasePage(uint8_t pageIdx)
 
 static void flashWriteData(flashaddr_t address, const flashdata_t data)
 {
-    /* Enter flash programming mode */
-    FLASH->CR |= FLASH_CR_PG;
-
     /* Write the data */
     *(flashdata_t*)address = data;
 
     /* Wait for completion */
     flashWaitWhileBusy();
-
-    /* Exit flash programming mode */
-    FLASH->CR &= ~FLASH_CR_PG;
 }
 
 void Flash::Write(flashaddr_t address, const uint8_t* buffer, size_t size)
@@ -80,6 +74,9 @@ void Flash::Write(flashaddr_t address, const uint8_t* buffer, size_t size)
     /* Wait for any busy flags */
     flashWaitWhileBusy();
 
+    /* Enter flash programming mode once for the whole buffer */
+    FLASH->CR |= FLASH_CR_PG;
+
     // Copy data directly from buffer's data to flash
     while (size >= sizeof(flashdata_t))
     {
@@ -89,6 +86,9 @@ void Flash::Write(flashaddr_t address, const uint8_t* buffer, size_t size)
         size -= sizeof(flashdata_t);
     }
 
+    /* Exit flash programming mode */
+    FLASH->CR &= ~FLASH_CR_PG;
+
     /* Lock flash again */
     flashLock();
 }
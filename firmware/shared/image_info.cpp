@@ -0,0 +1,53 @@
+#include "image_info.h"
+
+#include <cstring>
+
+static const ImageInfo* GetImageInfo(const uint8_t* app, size_t areaSize)
+{
+    auto info = reinterpret_cast<const ImageInfo*>(app + GetImageInfoOffset(areaSize));
+
+    if (info->magic != IMAGE_INFO_MAGIC || info->size == 0 || info->size > GetImageInfoOffset(areaSize))
+    {
+        return nullptr;
+    }
+
+    return info;
+}
+
+// The last word of the area, stored byte swapped (see build_wideband.sh)
+static uint32_t GetAreaCrc(const uint8_t* app, size_t areaSize)
+{
+    uint32_t stored;
+    memcpy(&stored, app + areaSize - sizeof(stored), sizeof(stored));
+
+    return __builtin_bswap32(stored);
+}
+
+bool IsImageValid(const uint8_t* app, size_t areaSize, CrcFunction crc)
+{
+    if (auto info = GetImageInfo(app, areaSize))
+    {
+        return crc(app, info->size) == info->crc;
+    }
+
+    return crc(app, areaSize - sizeof(uint32_t)) == GetAreaCrc(app, areaSize);
+}
+
+uint32_t GetImageToken(const uint8_t* app, size_t areaSize)
+{
+    // Mix in the reset vector too, so an erased area never matches
+    uint32_t resetVector;
+    memcpy(&resetVector, app + 4, sizeof(resetVector));
+
+    uint32_t crc;
+    if (auto info = GetImageInfo(app, areaSize))
+    {
+        crc = info->crc;
+    }
+    else
+    {
+        crc = GetAreaCrc(app, areaSize);
+    }
+
+    return crc ^ resetVector ^ IMAGE_INFO_MAGIC;
+}
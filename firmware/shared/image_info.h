@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// "WBIH"
+#define IMAGE_INFO_MAGIC 0x48494257
+
+/**
+ * Written by the build (tools/wb_image) at the end of the app area, just before the
+ * CRC word that covers the whole area. Older bootloaders only know about that last word,
+ * so it stays, this just lets newer ones check less flash.
+ * It can't go at the start of the app, that's where the vector table lives.
+ */
+struct ImageInfo
+{
+    uint32_t magic;
+    // Bytes of actual image from the start of the app area, a multiple of 4
+    uint32_t size;
+    // CRC32 of those bytes
+    uint32_t crc;
+    // Build identifier, the git commit hash
+    uint32_t version;
+};
+
+static_assert(sizeof(ImageInfo) == 16);
+
+inline size_t GetImageInfoOffset(size_t areaSize)
+{
+    return areaSize - sizeof(uint32_t) - sizeof(ImageInfo);
+}
+
+using CrcFunction = uint32_t (*)(const uint8_t* data, size_t size);
+
+// Check the app image in flash, with the image info if there is one, or the whole area CRC if not
+bool IsImageValid(const uint8_t* app, size_t areaSize, CrcFunction crc);
+
+/**
+ * A value identifying the image in flash, cheap to compute (no CRC), to remember that
+ * this image has already been validated. Any new image or erase changes it.
+ */
+uint32_t GetImageToken(const uint8_t* app, size_t areaSize);
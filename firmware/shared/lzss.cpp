@@ -0,0 +1,246 @@
+#include "lzss.h"
+#include "crc_backend.h"
+
+#include <cstring>
+
+void LzssDecoder::Reset()
+{
+    m_flags = 0;
+    m_tokensLeft = 0;
+    m_haveMatchLow = false;
+}
+
+bool LzssDecoder::Feed(const uint8_t* data, size_t size, LzssSink& sink, size_t outputLimit)
+{
+    size_t pos = 0;
+
+    while (pos < size && sink.GetWritten() < outputLimit)
+    {
+        if (m_tokensLeft == 0)
+        {
+            m_flags = data[pos++];
+            m_tokensLeft = 8;
+            continue;
+        }
+
+        if (m_flags & 1)
+        {
+            sink.Put(data[pos++]);
+        }
+        else
+        {
+            if (!m_haveMatchLow)
+            {
+                m_matchLow = data[pos++];
+                m_haveMatchLow = true;
+                continue;
+            }
+
+            uint16_t token = m_matchLow | (data[pos++] << 8);
+            m_haveMatchLow = false;
+
+            size_t distance = (token & 0x3FF) + 1;
+            size_t length = (token >> 10) + LZSS_MIN_MATCH;
+
+            if (distance > sink.GetWritten())
+            {
+                return false;
+            }
+
+            // Byte by byte, so overlapping matches (runs) work
+            for (size_t i = 0; i < length && sink.GetWritten() < outputLimit; i++)
+            {
+                sink.Put(sink.Peek(distance));
+            }
+        }
+
+        m_flags >>= 1;
+        m_tokensLeft--;
+    }
+
+    return true;
+}
+
+size_t LzssCompress(const uint8_t* in, size_t size, uint8_t* out, size_t outCapacity)
+{
+    size_t outPos = 0;
+    size_t flagPos = 0;
+    uint8_t tokenCount = 8;
+
+    size_t pos = 0;
+    while (pos < size)
+    {
+        if (tokenCount == 8)
+        {
+            if (outPos >= outCapacity)
+            {
+                return 0;
+            }
+
+            flagPos = outPos++;
+            out[flagPos] = 0;
+            tokenCount = 0;
+        }
+
+        // Greedy longest match, this only runs on the host so brute force is fine
+        size_t bestLength = 0;
+        size_t bestDistance = 0;
+        size_t maxLength = size - pos < LZSS_MAX_MATCH ? size - pos : LZSS_MAX_MATCH;
+
+        for (size_t distance = 1; distance <= LZSS_WINDOW_SIZE && distance <= pos; distance++)
+        {
+            size_t length = 0;
+            while (length < maxLength && in[pos + length] == in[pos + length - distance])
+            {
+                length++;
+            }
+
+            if (length > bestLength)
+            {
+                bestLength = length;
+                bestDistance = distance;
+
+                if (length == maxLength)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (bestLength >= LZSS_MIN_MATCH)
+        {
+            if (outPos + 2 > outCapacity)
+            {
+                return 0;
+            }
+
+            uint16_t token = (bestDistance - 1) | ((bestLength - LZSS_MIN_MATCH) << 10);
+            out[outPos++] = token & 0xFF;
+            out[outPos++] = token >> 8;
+            pos += bestLength;
+        }
+        else
+        {
+            if (outPos + 1 > outCapacity)
+            {
+                return 0;
+            }
+
+            out[flagPos] |= 1 << tokenCount;
+            out[outPos++] = in[pos++];
+        }
+
+        tokenCount++;
+    }
+
+    return outPos;
+}
+
+void CompressedImageWriter::Begin(ImageFlash& flash, uint32_t maxSize)
+{
+    m_flash = &flash;
+    m_maxSize = maxSize;
+    m_state = ImageWriteResult::NeedMore;
+    m_headerBytes = 0;
+    m_pageStart = 0;
+    m_pageFill = 0;
+    m_decoder.Reset();
+}
+
+ImageWriteResult CompressedImageWriter::Feed(const uint8_t* data, size_t size)
+{
+    if (m_state != ImageWriteResult::NeedMore)
+    {
+        return m_state;
+    }
+
+    // Collect the header first
+    while (m_headerBytes < sizeof(m_header) && size > 0)
+    {
+        reinterpret_cast<uint8_t*>(&m_header)[m_headerBytes++] = *data++;
+        size--;
+
+        if (m_headerBytes == sizeof(m_header))
+        {
+            if (m_header.magic != LZSS_IMAGE_MAGIC || m_header.rawSize == 0 || m_header.rawSize > m_maxSize)
+            {
+                return m_state = ImageWriteResult::Error;
+            }
+        }
+    }
+
+    if (size == 0)
+    {
+        return m_state;
+    }
+
+    // Anything past the end of the image is padding up to the end of the last CAN frame, ignore it
+    if (!m_decoder.Feed(data, size, *this, m_header.rawSize))
+    {
+        return m_state = ImageWriteResult::Error;
+    }
+
+    if (GetWritten() < m_header.rawSize)
+    {
+        return m_state;
+    }
+
+    FlushPage();
+
+    if (Crc32(m_flash->GetBase(), m_header.rawSize) != m_header.rawCrc)
+    {
+        return m_state = ImageWriteResult::Error;
+    }
+
+    return m_state = ImageWriteResult::Done;
+}
+
+void CompressedImageWriter::Put(uint8_t b)
+{
+    m_page[m_pageFill++] = b;
+
+    if (m_pageFill == LZSS_PAGE_SIZE)
+    {
+        FlushPage();
+    }
+}
+
+uint8_t CompressedImageWriter::Peek(size_t distance) const
+{
+    uint32_t pos = GetWritten() - distance;
+
+    if (pos >= m_pageStart)
+    {
+        return m_page[pos - m_pageStart];
+    }
+
+    // Already in flash
+    return m_flash->GetBase()[pos];
+}
+
+size_t CompressedImageWriter::GetWritten() const
+{
+    return m_pageStart + m_pageFill;
+}
+
+void CompressedImageWriter::FlushPage()
+{
+    if (m_pageFill == 0)
+    {
+        return;
+    }
+
+    // The flash is programmed in halfwords, pad an odd tail with the erased value
+    if (m_pageFill % 2)
+    {
+        m_page[m_pageFill] = 0xFF;
+        m_flash->Write(m_pageStart, m_page, m_pageFill + 1);
+    }
+    else
+    {
+        m_flash->Write(m_pageStart, m_page, m_pageFill);
+    }
+
+    m_pageStart += m_pageFill;
+    m_pageFill = 0;
+}
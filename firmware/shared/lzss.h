@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * LZSS compression for firmware images.
+ *
+ * The stream is a sequence of groups: one flag byte, then 8 tokens, LSB of the flag byte first.
+ * Flag bit 1: the token is one literal byte.
+ * Flag bit 0: the token is a match, 2 bytes little endian: bits 0-9 distance - 1, bits 10-15 length - 3.
+ * The last group may be short, the decoder knows when to stop from the image header.
+ *
+ * The decoder has no window of its own, it reads back what it already wrote.
+ */
+#define LZSS_WINDOW_SIZE 1024
+#define LZSS_MIN_MATCH 3
+#define LZSS_MAX_MATCH (LZSS_MIN_MATCH + 63)
+
+// "WBLZ"
+#define LZSS_IMAGE_MAGIC 0x5A4C4257
+
+struct CompressedImageHeader
+{
+    uint32_t magic;
+    // Size and CRC32 of the image once decompressed
+    uint32_t rawSize;
+    uint32_t rawCrc;
+    // Size of the compressed data following this header
+    uint32_t compressedSize;
+};
+
+static_assert(sizeof(CompressedImageHeader) == 16);
+
+// Where the decoder output goes
+class LzssSink
+{
+public:
+    virtual void Put(uint8_t b) = 0;
+    // Byte written `distance` bytes ago, 1 = the most recent one
+    virtual uint8_t Peek(size_t distance) const = 0;
+    virtual size_t GetWritten() const = 0;
+};
+
+class LzssDecoder
+{
+public:
+    void Reset();
+
+    // Decode until the input runs out or the sink holds outputLimit bytes.
+    // Returns false on a corrupt stream (a match reaching back before the start of the output).
+    bool Feed(const uint8_t* data, size_t size, LzssSink& sink, size_t outputLimit);
+
+private:
+    uint8_t m_flags = 0;
+    uint8_t m_tokensLeft = 0;
+
+    // A match token is split across two Feed() calls
+    bool m_haveMatchLow = false;
+    uint8_t m_matchLow = 0;
+};
+
+// Host side: compress `size` bytes, returns the compressed size or 0 if it doesn't fit in outCapacity
+size_t LzssCompress(const uint8_t* in, size_t size, uint8_t* out, size_t outCapacity);
+
+// What a compressed image writer needs from flash: sequential page writes, and reading back what was written
+class ImageFlash
+{
+public:
+    virtual void Write(uint32_t offset, const uint8_t* data, size_t size) = 0;
+    virtual const uint8_t* GetBase() const = 0;
+};
+
+enum class ImageWriteResult : uint8_t
+{
+    NeedMore,
+    // Whole image written and CRC checked
+    Done,
+    Error,
+};
+
+#define LZSS_PAGE_SIZE 1024
+
+/**
+ * Takes a compressed image (header + LZSS stream) in chunks of any size,
+ * and writes it out to flash a page at a time.
+ */
+class CompressedImageWriter : private LzssSink
+{
+public:
+    void Begin(ImageFlash& flash, uint32_t maxSize);
+    ImageWriteResult Feed(const uint8_t* data, size_t size);
+
+private:
+    void Put(uint8_t b) override;
+    uint8_t Peek(size_t distance) const override;
+    size_t GetWritten() const override;
+
+    void FlushPage();
+
+    ImageFlash* m_flash = nullptr;
+    uint32_t m_maxSize = 0;
+    ImageWriteResult m_state = ImageWriteResult::Error;
+
+    CompressedImageHeader m_header;
+    size_t m_headerBytes = 0;
+
+    LzssDecoder m_decoder;
+
+    // Output not yet written to flash starts at m_pageStart
+    uint32_t m_pageStart = 0;
+    uint32_t m_pageFill = 0;
+    alignas(4) uint8_t m_page[LZSS_PAGE_SIZE];
+};
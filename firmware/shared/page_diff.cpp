@@ -0,0 +1,36 @@
+#include "page_diff.h"
+#include "crc_backend.h"
+
+#include <cstring>
+
+uint32_t GetPageCrc(const uint8_t* page)
+{
+    return Crc32(page, APP_PAGE_SIZE);
+}
+
+uint32_t GetChangedPages(const uint8_t* image, size_t imageSize, const uint32_t* deviceCrcs, size_t pageCount)
+{
+    uint32_t changed = 0;
+
+    for (size_t i = 0; i < pageCount && i < 32; i++)
+    {
+        size_t offset = i * APP_PAGE_SIZE;
+
+        // Pad a short (or missing) page out to what the flash would hold
+        uint8_t page[APP_PAGE_SIZE];
+        memset(page, 0xFF, sizeof(page));
+
+        if (offset < imageSize)
+        {
+            size_t size = imageSize - offset < APP_PAGE_SIZE ? imageSize - offset : APP_PAGE_SIZE;
+            memcpy(page, image + offset, size);
+        }
+
+        if (GetPageCrc(page) != deviceCrcs[i])
+        {
+            changed |= 1u << i;
+        }
+    }
+
+    return changed;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// App flash on the F0 is 25 pages of 1k, see EraseAppPages()
+#define APP_PAGE_SIZE 1024
+#define APP_PAGE_COUNT 25
+
+uint32_t GetPageCrc(const uint8_t* page);
+
+/**
+ * Host side of delta updates: compare a new image against the page CRCs reported
+ * by the bootloader (WB_BL_PAGE_CRC_QUERY). Bit n of the result is set if page n has to be
+ * erased and rewritten. Past the end of the image, pages are expected to be erased (0xFF).
+ */
+uint32_t GetChangedPages(const uint8_t* image, size_t imageSize, const uint32_t* deviceCrcs, size_t pageCount);
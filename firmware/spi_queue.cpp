@@ -0,0 +1,62 @@
+#include "spi_queue.h"
+
+bool SpiQueue::Push(const SpiTransaction& transaction)
+{
+    if (m_count == SPI_QUEUE_SIZE)
+    {
+        return false;
+    }
+
+    m_queue[(m_tail + m_count) % SPI_QUEUE_SIZE] = transaction;
+    m_count++;
+
+    return true;
+}
+
+const SpiTransaction* SpiQueue::StartNext()
+{
+    if (m_running || m_count == 0)
+    {
+        return nullptr;
+    }
+
+    m_running = true;
+    return &m_queue[m_tail];
+}
+
+const SpiTransaction* SpiQueue::Complete(bool ok)
+{
+    if (!m_running)
+    {
+        return nullptr;
+    }
+
+    // Off the queue before the callback, it may queue more
+    SpiTransaction done = m_queue[m_tail];
+    m_tail = (m_tail + 1) % SPI_QUEUE_SIZE;
+    m_count--;
+    m_running = false;
+
+    if (ok)
+    {
+        completeCount++;
+    }
+    else
+    {
+        errorCount++;
+    }
+
+    if (done.done)
+    {
+        done.done(done.context, ok);
+    }
+
+    return StartNext();
+}
+
+void SpiQueue::Reset()
+{
+    m_tail = 0;
+    m_count = 0;
+    m_running = false;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#define SPI_QUEUE_SIZE 8
+
+struct SpiTransaction
+{
+    // Chip select, index into the bus's devices
+    uint8_t device;
+    uint8_t size;
+    const uint8_t* tx;
+    uint8_t* rx;
+
+    // Called once it is done, from the completion interrupt on the firmware so keep it short
+    void (*done)(void* context, bool ok);
+    void* context;
+};
+
+/**
+ * Transactions waiting for a shared SPI bus, run back to back in the order they were queued.
+ * Only keeps the order and the callbacks, the firmware glue does the actual DMA exchanges:
+ *   Push, then StartNext to kick an idle bus
+ *   Complete from the completion interrupt, which hands out the next one to start right away
+ * Not thread safe, the glue locks around it.
+ */
+class SpiQueue
+{
+public:
+    // Returns false if the queue is full
+    bool Push(const SpiTransaction& transaction);
+
+    // Transaction to start now, nullptr if one is running already or there is nothing queued
+    const SpiTransaction* StartNext();
+
+    // The running transaction is done: calls its callback, then returns the next one (already
+    // running) or nullptr if the bus goes idle
+    const SpiTransaction* Complete(bool ok);
+
+    const SpiTransaction* GetRunning() const
+    {
+        return m_running ? &m_queue[m_tail] : nullptr;
+    }
+
+    bool IsIdle() const
+    {
+        return !m_running && m_count == 0;
+    }
+
+    // Drop everything, without callbacks (the bus got reset)
+    void Reset();
+
+    uint32_t completeCount = 0;
+    uint32_t errorCount = 0;
+
+private:
+    SpiTransaction m_queue[SPI_QUEUE_SIZE];
+    // Oldest, the running one while m_running
+    size_t m_tail = 0;
+    size_t m_count = 0;
+    bool m_running = false;
+};
@@ -1,5 +1,6 @@
 #include "wideband_config.h"
 #include "status.h"
+#include "event_log.h"
 
 using namespace wbo;
 
@@ -7,6 +8,13 @@ static Status currentStatus[AFR_CHANNELS];
 
 void SetStatus(int ch, Status fault)
 {
+#ifdef EVENT_LOG_ENABLED
+    if (fault != currentStatus[ch])
+    {
+        LogEvent(EventType::Status, ch, static_cast<uint8_t>(currentStatus[ch]), static_cast<uint8_t>(fault));
+    }
+#endif
+
     currentStatus[ch] = fault;
 }
 
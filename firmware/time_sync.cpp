@@ -0,0 +1,121 @@
+#include "time_sync.h"
+
+#include <cmath>
+
+static TimeSync timeSync;
+
+TimeSync& GetTimeSync()
+{
+    return timeSync;
+}
+
+void TimeSync::OnSync(uint32_t masterUs, uint32_t localUs)
+{
+    int32_t error = (int32_t)(masterUs - ToMaster(localUs));
+
+    if (!m_synced || error > TIME_SYNC_STEP_THRESHOLD_US || error < -TIME_SYNC_STEP_THRESHOLD_US)
+    {
+        // Too far off to slew, jump straight to the master's time
+        m_anchorLocal = localUs;
+        m_anchorMaster = masterUs;
+        m_synced = true;
+        return;
+    }
+
+    int32_t elapsed = (int32_t)(localUs - m_anchorLocal);
+
+    if (elapsed < TIME_SYNC_MIN_INTERVAL_US)
+    {
+        return;
+    }
+
+    // Whatever error is left over after the last phase correction is the
+    // result of the clocks running at different rates
+    m_drift += TIME_SYNC_DRIFT_GAIN * error / elapsed;
+
+    if (m_drift > TIME_SYNC_MAX_DRIFT)
+    {
+        m_drift = TIME_SYNC_MAX_DRIFT;
+    }
+    else if (m_drift < -TIME_SYNC_MAX_DRIFT)
+    {
+        m_drift = -TIME_SYNC_MAX_DRIFT;
+    }
+
+    // Move the anchor to now, correcting part of the phase error
+    m_anchorMaster = masterUs - (int32_t)lroundf((1 - TIME_SYNC_PHASE_GAIN) * error);
+    m_anchorLocal = localUs;
+}
+
+uint32_t TimeSync::ToMaster(uint32_t localUs) const
+{
+    if (!m_synced)
+    {
+        return localUs;
+    }
+
+    int32_t elapsed = (int32_t)(localUs - m_anchorLocal);
+
+    return m_anchorMaster + elapsed + (int32_t)lroundf(elapsed * m_drift);
+}
+
+bool TimeSync::IsSynced() const
+{
+    return m_synced;
+}
+
+float TimeSync::GetDriftPpm() const
+{
+    return m_drift * 1e6f;
+}
+
+void TimeSync::Reset()
+{
+    m_synced = false;
+    m_anchorLocal = 0;
+    m_anchorMaster = 0;
+    m_drift = 0;
+}
+
+#ifdef MOCK_TIMER
+
+static uint32_t mockLocalTimeUs = 0;
+
+uint32_t GetLocalTimeUs()
+{
+    return mockLocalTimeUs;
+}
+
+#else
+#include "ch.h"
+
+uint32_t GetLocalTimeUs()
+{
+#if PORT_SUPPORTS_RT
+    // The system tick is too coarse to align samples between controllers, so
+    // accumulate the core cycle counter instead. This has to be called more
+    // often than the counter wraps, which the sampling thread takes care of.
+    static uint32_t lastCycles = 0;
+    static uint32_t cycleRemainder = 0;
+    static uint32_t timeUs = 0;
+
+    constexpr uint32_t cyclesPerUs = STM32_SYSCLK / 1000000;
+
+    chSysLock();
+    uint32_t cycles = chSysGetRealtimeCounterX();
+    cycleRemainder += cycles - lastCycles;
+    lastCycles = cycles;
+
+    timeUs += cycleRemainder / cyclesPerUs;
+    cycleRemainder %= cyclesPerUs;
+
+    uint32_t result = timeUs;
+    chSysUnlock();
+
+    return result;
+#else
+    return chVTGetTimeStamp() * (1000000 / CH_CFG_ST_FREQUENCY);
+#endif
+}
+
+#endif // MOCK_TIMER
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+// If a sync message disagrees with our prediction by more than this, step
+// the clock instead of slewing it (first sync, master reboot, lost messages...)
+#define TIME_SYNC_STEP_THRESHOLD_US 5000
+
+// Fraction of the phase error corrected on each sync message
+#define TIME_SYNC_PHASE_GAIN (0.5f)
+// Fraction of the observed rate error applied to the drift estimate on each sync message
+#define TIME_SYNC_DRIFT_GAIN (0.2f)
+
+// Syncs closer together than this carry mostly jitter, not rate error, and are ignored
+#define TIME_SYNC_MIN_INTERVAL_US 10000
+// Drift can't be more than two crystals' worth of tolerance
+#define TIME_SYNC_MAX_DRIFT (500e-6f)
+
+/**
+ * Disciplines the local free-running clock to a master clock broadcast over CAN.
+ *
+ * The master periodically sends its time, and we note our own time when the message
+ * arrives. From those pairs we track both the offset and the rate error (drift) between
+ * the two clocks, so that any local timestamp can be converted to the master timebase.
+ *
+ * All times are in microseconds and are allowed to wrap around.
+ */
+class TimeSync
+{
+public:
+    // Feed a sync message: master time it carried, and local time it arrived
+    void OnSync(uint32_t masterUs, uint32_t localUs);
+
+    // Convert a local timestamp to the master timebase.
+    // Until the first sync message arrives, local time is returned unchanged.
+    uint32_t ToMaster(uint32_t localUs) const;
+
+    bool IsSynced() const;
+    float GetDriftPpm() const;
+
+    void Reset();
+
+private:
+    bool m_synced = false;
+
+    // Last sync point: local time and our estimate of master time at that instant
+    uint32_t m_anchorLocal = 0;
+    uint32_t m_anchorMaster = 0;
+
+    // Master time elapsed per local time elapsed, minus 1
+    float m_drift = 0;
+};
+
+TimeSync& GetTimeSync();
+
+// Free-running local time in microseconds
+uint32_t GetLocalTimeUs();
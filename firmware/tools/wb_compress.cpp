@@ -0,0 +1,60 @@
+// Host tool: wraps a wideband image in a CompressedImageHeader and LZSS compresses it,
+// for embedding in rusEFI and sending over CAN with compressed WB_OPCODE_BLOCK transfers.
+//
+// Usage: wb_compress <image.bin> <image.lz>
+
+#include "lzss.h"
+
+#include <cstdio>
+#include <vector>
+#include <rusefi/crc.h>
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <image.bin> <image.lz>\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (!in)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<uint8_t> raw;
+    int c;
+    while ((c = fgetc(in)) != EOF)
+    {
+        raw.push_back(c);
+    }
+    fclose(in);
+
+    // Incompressible data grows by one flag byte per 8 bytes
+    std::vector<uint8_t> compressed(raw.size() + raw.size() / 8 + 1);
+    size_t compressedSize = LzssCompress(raw.data(), raw.size(), compressed.data(), compressed.size());
+
+    CompressedImageHeader header;
+    header.magic = LZSS_IMAGE_MAGIC;
+    header.rawSize = raw.size();
+    header.rawCrc = crc32(raw.data(), raw.size());
+    header.compressedSize = compressedSize;
+
+    FILE* out = fopen(argv[2], "wb");
+    if (!out)
+    {
+        perror(argv[2]);
+        return 1;
+    }
+
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(compressed.data(), 1, compressedSize, out);
+    fclose(out);
+
+    printf("%s: %zu -> %zu bytes (%.0f%%)\n", argv[2], raw.size(), sizeof(header) + compressedSize,
+           100.0 * (sizeof(header) + compressedSize) / raw.size());
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+// Host tool: pads an app binary out to the full app area, and adds the image info
+// and the whole area CRC at the end, see shared/image_info.h for the layout.
+//
+// Usage: wb_image <app.bin> <version, hex> <image.bin>
+
+#include "image_info.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <rusefi/crc.h>
+
+// 32k (flash) - 6k (bootloader) - 1k (config)
+#define APP_AREA_SIZE (25 * 1024)
+
+int main(int argc, char** argv)
+{
+    if (argc != 4)
+    {
+        fprintf(stderr, "Usage: %s <app.bin> <version> <image.bin>\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+    if (!in)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<uint8_t> area;
+    int c;
+    while ((c = fgetc(in)) != EOF)
+    {
+        area.push_back(c);
+    }
+    fclose(in);
+
+    // Whole words, so the bootloader can CRC it a word at a time
+    size_t size = (area.size() + 3) & ~3;
+
+    if (size > GetImageInfoOffset(APP_AREA_SIZE))
+    {
+        fprintf(stderr, "%s: %zu bytes doesn't fit, max %zu\n", argv[1], area.size(), GetImageInfoOffset(APP_AREA_SIZE));
+        return 1;
+    }
+
+    area.resize(APP_AREA_SIZE, 0xFF);
+
+    ImageInfo info;
+    info.magic = IMAGE_INFO_MAGIC;
+    info.size = size;
+    info.crc = crc32(area.data(), size);
+    info.version = strtoul(argv[2], nullptr, 16);
+    memcpy(&area[GetImageInfoOffset(APP_AREA_SIZE)], &info, sizeof(info));
+
+    // Old bootloaders check this one, byte swapped as the crc32 utility used to print it
+    uint32_t areaCrc = __builtin_bswap32(crc32(area.data(), APP_AREA_SIZE - sizeof(uint32_t)));
+    memcpy(&area[APP_AREA_SIZE - sizeof(uint32_t)], &areaCrc, sizeof(areaCrc));
+
+    FILE* out = fopen(argv[3], "wb");
+    if (!out)
+    {
+        perror(argv[3]);
+        return 1;
+    }
+
+    fwrite(area.data(), 1, area.size(), out);
+    fclose(out);
+
+    printf("%s: %zu byte image, version %08x\n", argv[3], size, (unsigned)info.version);
+
+    return 0;
+}
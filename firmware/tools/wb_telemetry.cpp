@@ -0,0 +1,104 @@
+// Host tool: decodes binary debug UART telemetry (debug_telemetry.h) to CSV, one line per channel per frame.
+// Damaged frames are skipped, and sequence gaps are counted as lost frames, both reported at the end.
+//
+// Usage: wb_telemetry [capture.bin] > telemetry.csv
+//   reads stdin without a file, so it can sit behind a serial capture: cat /dev/ttyUSB0 | wb_telemetry
+// Build (from firmware/):
+//   g++ -O2 -std=c++17 -I. -Ishared -Ilibfirmware/util/include -o wb_telemetry
+//       tools/wb_telemetry.cpp debug_telemetry.cpp shared/crc_backend.cpp libfirmware/util/src/crc.cpp
+
+#include "debug_telemetry.h"
+
+#include <cstdio>
+#include <vector>
+
+static void PrintFrame(const DebugTelemetryHeader& header, const DebugTelemetryChannel* channels)
+{
+    for (size_t ch = 0; ch < header.channelCount; ch++)
+    {
+        const auto& c = channels[ch];
+
+        printf("%u,%u,%.3f,%d,%zu,%.4f,%d,%d,%d,%u,%d,%.1f,%.1f,%.3f,%u,%u\n",
+            header.timeUs, header.sequence, header.supplyVoltage / 1000.0, header.mcuTemp, ch,
+            c.lambda / 10000.0, c.pumpCurrent, c.nernstDc, c.nernstAc, c.esr, c.sensorTemp,
+            c.pumpDuty / 10.0, c.heaterDuty / 10.0, c.heaterVoltage / 1000.0, c.heaterState, c.status);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: %s [capture.bin]\n", argv[0]);
+        return 1;
+    }
+
+    FILE* in = argc == 2 ? fopen(argv[1], "rb") : stdin;
+    if (!in)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    printf("time_us,sequence,supply_v,mcu_temp_c,channel,lambda,pump_ua,nernst_dc_mv,nernst_ac_mv,esr_ohm,"
+        "sensor_temp_c,pump_duty_pct,heater_duty_pct,heater_v,heater_state,status\n");
+
+    std::vector<uint8_t> frame;
+    size_t good = 0;
+    size_t damaged = 0;
+    size_t lost = 0;
+    bool first = true;
+    uint8_t lastSequence = 0;
+
+    int c;
+    while ((c = fgetc(in)) != EOF)
+    {
+        if (c != 0)
+        {
+            // Anything this long is text mode output or noise, wait for the next delimiter
+            if (frame.size() < DEBUG_TELEMETRY_MAX_FRAME)
+            {
+                frame.push_back(c);
+            }
+
+            continue;
+        }
+
+        if (frame.empty())
+        {
+            continue;
+        }
+
+        DebugTelemetryHeader header;
+        DebugTelemetryChannel channels[DEBUG_TELEMETRY_MAX_CHANNELS];
+
+        if (ParseDebugTelemetryFrame(frame.data(), frame.size(), header, channels))
+        {
+            if (!first)
+            {
+                lost += static_cast<uint8_t>(header.sequence - lastSequence - 1);
+            }
+
+            first = false;
+            lastSequence = header.sequence;
+            good++;
+
+            PrintFrame(header, channels);
+        }
+        else
+        {
+            damaged++;
+        }
+
+        frame.clear();
+    }
+
+    if (in != stdin)
+    {
+        fclose(in);
+    }
+
+    fprintf(stderr, "%zu frames, %zu damaged, %zu lost\n", good, damaged, lost);
+
+    return 0;
+}
@@ -2,6 +2,10 @@
 #include "hal.h"
 #include "chprintf.h"
 
+#include <cmath>
+
+#include <rusefi/math.h>
+
 #include "lambda_conversion.h"
 #include "sampling.h"
 #include "heater_control.h"
@@ -9,6 +13,9 @@
 #include "status.h"
 #include "uart.h"
 #include "pump_dac.h"
+#include "debug_telemetry.h"
+#include "time_sync.h"
+#include "port.h"
 
 #include "tunerstudio.h"
 #include "tunerstudio_io.h"
@@ -20,84 +27,157 @@
 
 #ifdef DEBUG_SERIAL_PORT
 
+// A board defining DEBUG_TELEMETRY_PERIOD_MS gets binary telemetry frames at that period
+// instead of the text lines
+#ifdef DEBUG_TELEMETRY_PERIOD_MS
+
+// Binary telemetry gets its own rate, 115200 only fits about 200 frames/s
+#ifndef DEBUG_TELEMETRY_BAUDRATE
+#define DEBUG_TELEMETRY_BAUDRATE 921600
+#endif
+
 SerialConfig cfg = {
-    .speed = DEBUG_SERIAL_BAUDRATE, .cr1 = 0, .cr2 = USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2, .cr3 = 0};
+    .speed = DEBUG_TELEMETRY_BAUDRATE, .cr1 = 0, .cr2 = USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2, .cr3 = 0};
 
-static char printBuffer[200];
+static uint8_t telemetryFrame[DEBUG_TELEMETRY_MAX_FRAME];
 
-static THD_WORKING_AREA(waUartThread, 512);
-static void UartThread(void*)
+static void SendTelemetry(uint8_t sequence)
 {
-    chRegSetThreadName("UART debug");
+    DebugTelemetryHeader header;
+    DebugTelemetryChannel channels[DEBUG_TELEMETRY_MAX_CHANNELS];
 
-    sdStart(&SD1, &cfg);
+    header.version = DEBUG_TELEMETRY_VERSION;
+    header.sequence = sequence;
+    header.timeUs = GetLocalTimeUs();
+#ifdef BOARD_HAS_VOLTAGE_SENSE
+    header.supplyVoltage = clampF(0, std::round(GetSupplyVoltage() * 1000), UINT16_MAX);
+    header.mcuTemp = clampF(INT8_MIN, std::round(GetMcuTemperature()), INT8_MAX);
+#else
+    header.supplyVoltage = 0;
+    header.mcuTemp = 0;
+#endif
+    header.channelCount = AFR_CHANNELS < DEBUG_TELEMETRY_MAX_CHANNELS ? AFR_CHANNELS : DEBUG_TELEMETRY_MAX_CHANNELS;
 
-    while (true)
+    for (int ch = 0; ch < header.channelCount; ch++)
     {
-        int ch;
+        const auto& sampler = GetSampler(ch);
+        auto& out = channels[ch];
+
+        out.lambda = clampF(0, std::round(GetLambda(ch) * 10000), UINT16_MAX);
+        out.pumpCurrent = clampF(INT16_MIN, std::round(sampler.GetPumpNominalCurrent() * 1000), INT16_MAX);
+        out.nernstDc = clampF(INT16_MIN, std::round(sampler.GetNernstDc() * 1000), INT16_MAX);
+        out.nernstAc = clampF(INT16_MIN, std::round(sampler.GetNernstAc() * 1000), INT16_MAX);
+        out.esr = clampF(0, std::round(sampler.GetSensorInternalResistance()), UINT16_MAX);
+        out.sensorTemp = clampF(INT16_MIN, std::round(sampler.GetSensorTemperature()), INT16_MAX);
+        out.pumpDuty = clampF(0, std::round(GetPumpOutputDuty(ch) * 1000), UINT16_MAX);
+        out.heaterDuty = clampF(0, std::round(GetHeaterDuty(ch) * 1000), UINT16_MAX);
+        out.heaterVoltage = clampF(0, std::round(sampler.GetInternalHeaterVoltage() * 1000), UINT16_MAX);
+        out.heaterState = static_cast<uint8_t>(GetHeaterState(ch));
+        out.status = static_cast<uint8_t>(GetCurrentStatus(ch));
+    }
+
+    size_t size = BuildDebugTelemetryFrame(header, channels, telemetryFrame);
+    chnWrite(&DEBUG_SERIAL_PORT, telemetryFrame, size);
+}
+
+#else
+
+SerialConfig cfg = {
+    .speed = DEBUG_SERIAL_BAUDRATE, .cr1 = 0, .cr2 = USART_CR2_STOP1_BITS | PORT_EXTRA_SERIAL_CR2, .cr3 = 0};
+
+static char printBuffer[200];
+
+static void SendText()
+{
+    int ch;
 
 #ifdef BOARD_HAS_VOLTAGE_SENSE
-        {
-            float vbatt = GetSupplyVoltage();
-
-            int vbattIntPart = vbatt;
-            int vbattTenths = (vbatt - vbattIntPart) * 10;
-
-            int tempC = GetMcuTemperature();
-
-            size_t writeCount = chsnprintf(printBuffer,
-                                           sizeof(printBuffer),
-                                           "Board: VBatt %d.%01d Temp %d deg C\r\n",
-                                           vbattIntPart,
-                                           vbattTenths,
-                                           tempC);
-            chnWrite(&SD1, (const uint8_t*)printBuffer, writeCount);
-        }
+    {
+        float vbatt = GetSupplyVoltage();
+
+        int vbattIntPart = vbatt;
+        int vbattTenths = (vbatt - vbattIntPart) * 10;
+
+        int tempC = GetMcuTemperature();
+
+        size_t writeCount = chsnprintf(printBuffer,
+                                       sizeof(printBuffer),
+                                       "Board: VBatt %d.%01d Temp %d deg C\r\n",
+                                       vbattIntPart,
+                                       vbattTenths,
+                                       tempC);
+        chnWrite(&DEBUG_SERIAL_PORT, (const uint8_t*)printBuffer, writeCount);
+    }
 #endif
 
-        for (ch = 0; ch < AFR_CHANNELS; ch++)
-        {
-            float lambda = GetLambda(ch);
-            int lambdaIntPart = lambda;
-            int lambdaThousandths = (lambda - lambdaIntPart) * 1000;
-            int heaterVoltageMv = GetSampler(ch).GetInternalHeaterVoltage() * 1000;
-            int heaterDuty = GetHeaterDuty(ch) * 100;
-            int pumpDuty = GetPumpOutputDuty(ch) * 100;
-
-            size_t writeCount = chsnprintf(printBuffer,
-                                           sizeof(printBuffer),
-                                           "[AFR%d]: %d.%03d DC: %4d mV AC: %4d mV ESR: %5d T: %4d C Ipump: %6d uA "
-                                           "PumpDac: %3d Vheater: %5d heater: %s (%d)\tfault: %s\r\n",
-                                           ch,
-                                           lambdaIntPart,
-                                           lambdaThousandths,
-                                           (int)(GetSampler(ch).GetNernstDc() * 1000.0),
-                                           (int)(GetSampler(ch).GetNernstAc() * 1000.0),
-                                           (int)GetSampler(ch).GetSensorInternalResistance(),
-                                           (int)GetSampler(ch).GetSensorTemperature(),
-                                           (int)(GetSampler(ch).GetPumpNominalCurrent() * 1000),
-                                           pumpDuty,
-                                           heaterVoltageMv,
-                                           describeHeaterState(GetHeaterState(ch)),
-                                           heaterDuty,
-                                           describeStatus(GetCurrentStatus(ch)));
-            chnWrite(&SD1, (const uint8_t*)printBuffer, writeCount);
-        }
+    for (ch = 0; ch < AFR_CHANNELS; ch++)
+    {
+        float lambda = GetLambda(ch);
+        int lambdaIntPart = lambda;
+        int lambdaThousandths = (lambda - lambdaIntPart) * 1000;
+        int heaterVoltageMv = GetSampler(ch).GetInternalHeaterVoltage() * 1000;
+        int heaterDuty = GetHeaterDuty(ch) * 100;
+        int pumpDuty = GetPumpOutputDuty(ch) * 100;
+
+        size_t writeCount = chsnprintf(printBuffer,
+                                       sizeof(printBuffer),
+                                       "[AFR%d]: %d.%03d DC: %4d mV AC: %4d mV ESR: %5d T: %4d C Ipump: %6d uA "
+                                       "PumpDac: %3d Vheater: %5d heater: %s (%d)\tfault: %s\r\n",
+                                       ch,
+                                       lambdaIntPart,
+                                       lambdaThousandths,
+                                       (int)(GetSampler(ch).GetNernstDc() * 1000.0),
+                                       (int)(GetSampler(ch).GetNernstAc() * 1000.0),
+                                       (int)GetSampler(ch).GetSensorInternalResistance(),
+                                       (int)GetSampler(ch).GetSensorTemperature(),
+                                       (int)(GetSampler(ch).GetPumpNominalCurrent() * 1000),
+                                       pumpDuty,
+                                       heaterVoltageMv,
+                                       describeHeaterState(GetHeaterState(ch)),
+                                       heaterDuty,
+                                       describeStatus(GetCurrentStatus(ch)));
+        chnWrite(&DEBUG_SERIAL_PORT, (const uint8_t*)printBuffer, writeCount);
+    }
 
 #if (EGT_CHANNELS > 0)
-        for (ch = 0; ch < EGT_CHANNELS; ch++)
-        {
-            size_t writeCount = chsnprintf(printBuffer,
-                                           sizeof(printBuffer),
-                                           "EGT[%d]: %d C (int %d C)\r\n",
-                                           (int)getEgtDrivers()[ch].temperature,
-                                           (int)getEgtDrivers()[ch].coldJunctionTemperature);
-            chnWrite(&SD1, (const uint8_t*)printBuffer, writeCount);
-        }
+    for (ch = 0; ch < EGT_CHANNELS; ch++)
+    {
+        size_t writeCount = chsnprintf(printBuffer,
+                                       sizeof(printBuffer),
+                                       "EGT[%d]: %d C (int %d C)\r\n",
+                                       ch,
+                                       (int)getEgtDrivers()[ch].temperature,
+                                       (int)getEgtDrivers()[ch].coldJunctionTemperature);
+        chnWrite(&DEBUG_SERIAL_PORT, (const uint8_t*)printBuffer, writeCount);
+    }
 #endif /* EGT_CHANNELS > 0 */
+}
+
+#endif /* DEBUG_TELEMETRY_PERIOD_MS */
+
+static THD_WORKING_AREA(waUartThread, 512);
+static void UartThread(void*)
+{
+    chRegSetThreadName("UART debug");
+
+    sdStart(&DEBUG_SERIAL_PORT, &cfg);
 
+#ifdef DEBUG_TELEMETRY_PERIOD_MS
+    uint8_t sequence = 0;
+    systime_t prev = chVTGetSystemTime();
+
+    while (true)
+    {
+        SendTelemetry(sequence++);
+        prev = chThdSleepUntilWindowed(prev, chTimeAddX(prev, TIME_MS2I(DEBUG_TELEMETRY_PERIOD_MS)));
+    }
+#else
+    while (true)
+    {
+        SendText();
         chThdSleepMilliseconds(100);
     }
+#endif
 }
 
 #endif /* DEBUG_SERIAL_PORT */
@@ -105,7 +185,7 @@ static void UartThread(void*)
 #ifdef TS_ENABLED
 
 #ifdef TS_PRIMARY_UART_PORT
-static UartTsChannel primaryChannel(TS_PRIMARY_UART_PORT);
+static UartDmaTsChannel primaryChannel(TS_PRIMARY_UART_PORT);
 #endif
 
 #ifdef TS_PRIMARY_SERIAL_PORT
@@ -129,8 +209,12 @@ struct PrimaryChannelThread : public TunerstudioThread
 
 static PrimaryChannelThread primaryChannelThread;
 
-#ifdef TS_SECONDARY_SERIAL_PORT
+#if defined(TS_SECONDARY_SERIAL_PORT) || defined(TS_SECONDARY_UART_PORT)
+#ifdef TS_SECONDARY_UART_PORT
+static UartDmaTsChannel secondaryChannel(TS_SECONDARY_UART_PORT);
+#else
 static SerialTsChannel secondaryChannel(TS_SECONDARY_SERIAL_PORT);
+#endif
 
 struct SecondaryChannelThread : public TunerstudioThread
 {
@@ -149,7 +233,33 @@ struct SecondaryChannelThread : public TunerstudioThread
 
 static SecondaryChannelThread secondaryChannelThread;
 
-#endif /* TS_SECONDARY_SERIAL_PORT */
+#endif /* TS_SECONDARY_SERIAL_PORT || TS_SECONDARY_UART_PORT */
+
+#ifdef EFI_CAN_SERIAL
+static CanTsChannel canChannel;
+
+void CanTsOnFrame(const uint8_t* data, uint8_t dlc)
+{
+    canChannel.onFrame(data, dlc);
+}
+
+struct CanChannelThread : public TunerstudioThread
+{
+    CanChannelThread()
+        : TunerstudioThread("CAN TS Channel")
+    {
+    }
+
+    TsChannelBase* setupChannel()
+    {
+        // CAN itself is started by InitCan
+        return &canChannel;
+    }
+};
+
+static CanChannelThread canChannelThread;
+
+#endif /* EFI_CAN_SERIAL */
 #endif /* TS_ENABLED */
 
 void InitUart()
@@ -159,8 +269,11 @@ void InitUart()
 #endif
 #ifdef TS_ENABLED
     primaryChannelThread.Start();
-#ifdef TS_SECONDARY_SERIAL_PORT
+#if defined(TS_SECONDARY_SERIAL_PORT) || defined(TS_SECONDARY_UART_PORT)
     secondaryChannelThread.Start();
 #endif
+#ifdef EFI_CAN_SERIAL
+    canChannelThread.Start();
+#endif
 #endif
 }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Reader side of a DMA channel receiving into a buffer in circular mode.
+ *
+ * The DMA only tells how many transfers are left before it wraps around, so what's new is
+ * everything from where the last Read() stopped up to size - remaining, wrapping if needed.
+ * Nothing tells the reader when the DMA laps it, so the buffer has to hold everything
+ * that can arrive between two reads.
+ */
+class DmaRxRing
+{
+public:
+    DmaRxRing(const uint8_t* buffer, size_t size)
+        : m_buffer(buffer)
+        , m_size(size)
+    {
+    }
+
+    // DMA restarted from the beginning of the buffer
+    void Reset()
+    {
+        m_pos = 0;
+    }
+
+    // Bytes waiting, remaining is the DMA counter
+    size_t GetAvailable(size_t remaining) const
+    {
+        return (GetHead(remaining) + m_size - m_pos) % m_size;
+    }
+
+    // Copy up to maxSize waiting bytes to out, returns how many
+    size_t Read(size_t remaining, uint8_t* out, size_t maxSize)
+    {
+        size_t count = GetAvailable(remaining);
+        if (count > maxSize)
+        {
+            count = maxSize;
+        }
+
+        // Up to the end of the buffer, then from the start
+        size_t first = m_size - m_pos < count ? m_size - m_pos : count;
+        memcpy(out, m_buffer + m_pos, first);
+        memcpy(out + first, m_buffer, count - first);
+
+        m_pos = (m_pos + count) % m_size;
+
+        return count;
+    }
+
+private:
+    size_t GetHead(size_t remaining) const
+    {
+        // The counter reloads to m_size when the DMA wraps
+        return remaining == 0 ? 0 : m_size - remaining;
+    }
+
+    const uint8_t* const m_buffer;
+    const size_t m_size;
+    size_t m_pos = 0;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Lock free FIFO for exactly one producer thread and one consumer thread.
+ *
+ * Lets a high priority thread (sampling) hand data to a low priority one (CAN, UART...)
+ * without ever blocking or entering a critical section.
+ */
+template <typename T, size_t TSize> class SpscFifo
+{
+    static_assert(TSize > 0 && (TSize & (TSize - 1)) == 0, "size must be a power of 2");
+
+public:
+    // Producer side
+    bool Push(const T& item)
+    {
+        size_t write = m_write.load(std::memory_order_relaxed);
+        size_t read = m_read.load(std::memory_order_acquire);
+
+        if (write - read >= TSize)
+        {
+            return false;
+        }
+
+        m_buffer[write & (TSize - 1)] = item;
+        m_write.store(write + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Producer side, for when several items have to go in together
+    size_t GetFree() const
+    {
+        return TSize - GetCount();
+    }
+
+    // Consumer side
+    bool Pop(T& item)
+    {
+        size_t read = m_read.load(std::memory_order_relaxed);
+        size_t write = m_write.load(std::memory_order_acquire);
+
+        if (read == write)
+        {
+            return false;
+        }
+
+        item = m_buffer[read & (TSize - 1)];
+        m_read.store(read + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    size_t GetCount() const
+    {
+        return m_write.load(std::memory_order_acquire) - m_read.load(std::memory_order_acquire);
+    }
+
+private:
+    T m_buffer[TSize];
+
+    std::atomic<size_t> m_write{0};
+    std::atomic<size_t> m_read{0};
+};
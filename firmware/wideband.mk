@@ -2,4 +2,22 @@ WIDEBANDSRC = \
 	$(FIRMWARE_DIR)/pid.cpp \
 	$(FIRMWARE_DIR)/sampling.cpp \
 	$(FIRMWARE_DIR)/heater_control.cpp \
+	$(FIRMWARE_DIR)/time_sync.cpp \
+	$(FIRMWARE_DIR)/cylinder_lambda.cpp \
+	$(FIRMWARE_DIR)/diag_stream.cpp \
+	$(FIRMWARE_DIR)/can_encoder.cpp \
+	$(FIRMWARE_DIR)/can_stats.cpp \
+	$(FIRMWARE_DIR)/config_burn.cpp \
+	$(FIRMWARE_DIR)/config_store.cpp \
+	$(FIRMWARE_DIR)/och_snapshot.cpp \
+	$(FIRMWARE_DIR)/scatter_plan.cpp \
+	$(FIRMWARE_DIR)/och_stream.cpp \
+	$(FIRMWARE_DIR)/och_delta.cpp \
+	$(FIRMWARE_DIR)/lambda_logger.cpp \
+	$(FIRMWARE_DIR)/isotp.cpp \
+	$(FIRMWARE_DIR)/debug_telemetry.cpp \
+	$(FIRMWARE_DIR)/event_log.cpp \
+	$(FIRMWARE_DIR)/spi_queue.cpp \
+	$(FIRMWARE_DIR)/max31856.cpp \
+	$(FIRMWARE_DIR)/egt_schedule.cpp \
 	$(FIRMWARE_DIR)/util/timer.cpp \
@@ -13,6 +13,15 @@
 #define WB_OPCODE_REBOOT 3
 #define WB_OPCODE_SET_INDEX 4
 #define WB_OPCODE_ECU_STATUS 5
+#define WB_OPCODE_TIME_SYNC 6
+#define WB_OPCODE_ENGINE_EVENT 7
+#define WB_OPCODE_TELEMETRY 8
+#define WB_OPCODE_DIAG_STREAM 9
+#define WB_OPCODE_BLOCK 10
+#define WB_OPCODE_PAGE 11
+#define WB_OPCODE_NODE 12
+#define WB_OPCODE_TS 13
+#define WB_OPCODE_EVENT_LOG 14
 
 #define WB_BL_BASE (WB_BL_HEADER << 4)
 #define WB_BL_CMD(opcode, extra) (((WB_BL_BASE | (opcode)) << 16) | (extra))
@@ -35,6 +44,117 @@
 #define WB_MSG_SET_INDEX WB_BL_CMD(WB_OPCODE_SET_INDEX, 0)
 // 0xEF5'0000
 #define WB_MSG_ECU_STATUS WB_BL_CMD(WB_OPCODE_ECU_STATUS, 0)
+// 0xEF6'0000
+// Broadcast by the ECU (or any single master), data0-3 = master time in microseconds, little endian
+#define WB_MSG_TIME_SYNC WB_BL_CMD(WB_OPCODE_TIME_SYNC, 0)
+// 0xEF7'0000
+// Sent by the ECU at each cylinder's TDC, data0 = cylinder index (0 based, in whatever order the ECU likes),
+// data1 = number of cylinders. The ECU should offset the index to account for exhaust transport delay.
+#define WB_MSG_ENGINE_EVENT WB_BL_CMD(WB_OPCODE_ENGINE_EVENT, 0)
+// 0xEF8'TTII
+// Optional data sent by the controller, TT = telemetry type, II = channel index (including CAN index offset)
+#define WB_MSG_TELEMETRY(type, index) WB_BL_CMD(WB_OPCODE_TELEMETRY, ((type) << 8) | (index))
+#define WB_MSG_TELEMETRY_GET_TYPE(id) (((id) >> 8) & 0xFF)
+
+// Per cylinder lambda, 4 cylinders per message: type 0x00 is cylinders 0-3, 0x01 is 4-7
+#define WB_TELEMETRY_CYL_LAMBDA 0x00
+// High rate diagnostic stream, see below
+#define WB_TELEMETRY_DIAG_STREAM 0x10
+// Bus statistics, index is the CAN index offset of the controller, see CanStatsData
+#define WB_TELEMETRY_CAN_STATS 0x20
+// Sent once at startup, index is the CAN index offset of the controller, see BootInfoData
+#define WB_TELEMETRY_BOOT_INFO 0x30
+
+// 0xEF9'0000
+// Diagnostic stream control, data0 = channel index (including CAN index offset),
+// data1 = send every Nth sample (averaged), 0 turns the stream off
+#define WB_MSG_DIAG_STREAM WB_BL_CMD(WB_OPCODE_DIAG_STREAM, 0)
+
+// Diagnostic stream frames. data0 is a header: bits 0-2 frame type, bits 3-7 sample sequence number.
+// All multi byte fields are little endian.
+// A keyframe is a KEY_A + KEY_B pair carrying the same sequence number and absolute values:
+//   KEY_A: data1-2 nernst DC (int16 mV), data3-4 nernst AC (int16 mV), data5-6 pump current (int16 uA)
+//   KEY_B: data1-2 pump DAC duty (uint16 0.1%), data3-4 heater duty (uint16 0.1%), data5 sample divider
+// A DELTA frame carries the next sample as int8 differences to the previous one, in the same units and order.
+// A receiver that misses a sequence number must wait for the next keyframe.
+#define WB_DIAG_FRAME_DELTA 0
+#define WB_DIAG_FRAME_KEY_A 1
+#define WB_DIAG_FRAME_KEY_B 2
+
+// 0xEFA'xxxx
+// Windowed flash transfer, an alternative to WB_BL_DATA_BASE that only needs one round trip per block.
+// A block is one 1k flash page, block N is written at app flash offset N * 1024. The app must be erased first.
+//   BEGIN  0xEFA'8NNN: start block NNN, no reply
+//          0xEFA'9NNN: same, but the blocks carry a compressed image (see shared/lzss.h) instead of raw flash.
+//                      Block NNN is then the Nth 1k of the compressed stream, and blocks must be sent in order.
+//                      The last block is acked once the image is decompressed to flash and its CRC checks out.
+//                      END for these blocks is 0xEFA'DNNN.
+//   DATA   0xEFA'00SS: frame SS (0-127) of the current block, DLC 8, no reply, any order
+//   END    0xEFA'CNNN: end of block NNN, data0 = number of frames in the block (last block may be short)
+//                      Reply is an ack once the block is programmed, or a STATUS for each
+//                      64 frame group that is missing frames. Resend those, then END again.
+//                      If BEGIN was lost, END starts the block and everything is reported missing.
+//   STATUS 0xEFA'4IIG: sent by the bootloader with CAN index II, data0-7 = little endian bitmap of missing frames G * 64 + bit
+#define WB_BL_BLOCK_BEGIN(block) WB_BL_CMD(WB_OPCODE_BLOCK, 0x8000 | (block))
+#define WB_BL_BLOCK_BEGIN_COMPRESSED(block) WB_BL_CMD(WB_OPCODE_BLOCK, 0x9000 | (block))
+#define WB_BL_BLOCK_IS_COMPRESSED(id) ((id) & 0x1000)
+#define WB_BL_BLOCK_DATA(seq) WB_BL_CMD(WB_OPCODE_BLOCK, (seq))
+#define WB_BL_BLOCK_END(block) WB_BL_CMD(WB_OPCODE_BLOCK, 0xC000 | (block))
+#define WB_BL_BLOCK_END_COMPRESSED(block) WB_BL_CMD(WB_OPCODE_BLOCK, 0xD000 | (block))
+#define WB_BL_BLOCK_STATUS(group, index) WB_BL_CMD(WB_OPCODE_BLOCK, 0x4000 | ((index) << 4) | (group))
+#define WB_BL_BLOCK_STATUS_GET_GROUP(id) ((id) & 0xF)
+#define WB_BL_BLOCK_STATUS_GET_INDEX(id) (((id) >> 4) & 0xFF)
+#define WB_BL_BLOCK_GET_TYPE(id) ((id) & 0xC000)
+#define WB_BL_BLOCK_GET_ARG(id) ((id) & 0x0FFF)
+
+// 0xEFB'xxxx
+// Per page operations for delta updates: query which app pages differ from the new image,
+// then erase and rewrite (with WB_OPCODE_BLOCK) only those, instead of WB_BL_ERASE of the whole app.
+//   QUERY  0xEFB'0000: data0 = first page, data1 = page count. One REPLY per page, no ack.
+//   REPLY  0xEFB'8xxx: sent by the bootloader, bits 0-4 page, bits 5-12 CAN index,
+//                      data0-3 = little endian CRC32 of the 1k page
+//   ERASE  0xEFB'40PP: erase page PP, data0-1 = WB_ERASE_TAG little endian. Acked once erased.
+#define WB_BL_PAGE_CRC_QUERY WB_BL_CMD(WB_OPCODE_PAGE, 0)
+#define WB_BL_PAGE_CRC_REPLY(page, index) WB_BL_CMD(WB_OPCODE_PAGE, 0x8000 | ((index) << 5) | (page))
+#define WB_BL_PAGE_CRC_REPLY_GET_PAGE(id) ((id) & 0x1F)
+#define WB_BL_PAGE_CRC_REPLY_GET_INDEX(id) (((id) >> 5) & 0xFF)
+#define WB_BL_PAGE_ERASE(page) WB_BL_CMD(WB_OPCODE_PAGE, 0x4000 | (page))
+#define WB_BL_PAGE_GET_TYPE(id) ((id) & 0xC000)
+#define WB_BL_PAGE_GET_PAGE(id) ((id) & 0xFF)
+
+// 0xEFC'xxxx
+// Multicast updates: all controllers in the bootloader take the same BLOCK/PAGE stream, and every
+// reply carries the CAN index of the controller that sent it, so the host can tell them apart.
+//   MULTICAST 0xEFC'0000: data0 = 1 to use NODE_ACK instead of WB_ACK, 0 to go back. Replied with an ack.
+//   NODE_ACK  0xEFC'80II: ack from the bootloader with CAN index II
+// The host sends each block once to everybody. Nodes report missing frames with their own STATUS,
+// the host resends the union of what is missing and repeats END until every node has acked.
+// A node that already programmed the block simply acks END again.
+#define WB_BL_MULTICAST WB_BL_CMD(WB_OPCODE_NODE, 0)
+#define WB_BL_NODE_ACK(index) WB_BL_CMD(WB_OPCODE_NODE, 0x8000 | (index))
+#define WB_BL_NODE_ACK_GET_INDEX(id) ((id) & 0xFF)
+
+// 0xEFD'xxxx
+// TunerStudio over CAN: the same byte stream as on the serial ports, cut into ISO 15765-2 (ISO-TP) messages.
+// Single, first, consecutive and flow control frames as usual, normal addressing, no padding needed.
+//   RX 0xEFD'00II: to the controller with CAN index II
+//   TX 0xEFD'80II: from the controller with CAN index II
+// A TS packet may span several messages (and a message several packets), treat the payload as a stream.
+#define WB_MSG_TS_RX(index) WB_BL_CMD(WB_OPCODE_TS, (index))
+#define WB_MSG_TS_TX(index) WB_BL_CMD(WB_OPCODE_TS, 0x8000 | (index))
+
+// 0xEFE'xxxx
+// Fault and event history, oldest entry first. Entries are 16 bytes, see EventLogEntry in firmware/event_log.h.
+//   READ   0xEFE'00II: to the controller with CAN index II, data0-1 = first entry (little endian),
+//                      data2 = entry count (1-8). Replied with DATA frames, then STATUS.
+//   DATA   0xEFE'8SII: from controller II, frame S (0-15) of the reply: first (S even) or second half of entry S / 2
+//   STATUS 0xEFE'40II: from controller II, see EventLogStatusData
+//   CLEAR  0xEFE'C0II: forget the history of controller II, replied with STATUS
+#define WB_MSG_EVENT_LOG_READ(index) WB_BL_CMD(WB_OPCODE_EVENT_LOG, (index))
+#define WB_MSG_EVENT_LOG_DATA(frame, index) WB_BL_CMD(WB_OPCODE_EVENT_LOG, 0x8000 | ((frame) << 8) | (index))
+#define WB_MSG_EVENT_LOG_STATUS(index) WB_BL_CMD(WB_OPCODE_EVENT_LOG, 0x4000 | (index))
+#define WB_MSG_EVENT_LOG_CLEAR(index) WB_BL_CMD(WB_OPCODE_EVENT_LOG, 0xC000 | (index))
+#define WB_EVENT_LOG_MAX_READ 8
 
 #define WB_DATA_BASE_ADDR 0x190
 
@@ -71,7 +191,10 @@ struct StandardData
     uint16_t Lambda;
     uint16_t TemperatureC;
 
-    uint16_t pad;
+    // Time the lambda sample was taken, in units of 10us, wraps around.
+    // Once WB_MSG_TIME_SYNC has been received this is in the master's timebase,
+    // so samples from several controllers can be lined up against each other.
+    uint16_t SampleTime;
 };
 
 struct DiagData
@@ -85,6 +208,49 @@ struct DiagData
     uint8_t pad;
 };
 
+struct CylinderLambdaData
+{
+    // 0.0001 lambda per bit, 0 if there is no data for that cylinder
+    uint16_t Lambda[4];
+};
+
+struct CanStatsData
+{
+    // 0.5% per bit, bus capacity used by this controller and by everything it sees
+    uint8_t BusLoadOwn;
+    uint8_t BusLoadTotal;
+
+    uint16_t TxTimeouts;
+
+    // Transmit and receive error counters of the CAN controller
+    uint8_t TxErrors;
+    uint8_t RxErrors;
+
+    // bit 0: bus off, bit 1: error passive
+    uint8_t Flags;
+    uint8_t BusOffCount;
+};
+
+struct BootInfoData
+{
+    // Time the bootloader took from reset to starting the app, 0 if not known
+    uint16_t BootTimeMs;
+    // RCC_CSR bits 24-31 of the last reset, 0 if not known. Power on (0x08 on F0) is a cold boot.
+    uint8_t ResetCause;
+};
+
+struct EventLogStatusData
+{
+    // Entries in the log
+    uint16_t Count;
+    // First entry of the reply, and how many were sent
+    uint16_t First;
+    uint8_t Sent;
+    uint8_t pad;
+    // Counts up every boot, for matching EventLogEntry::boot
+    uint16_t Boot;
+};
+
 static inline const char* describeStatus(Status status)
 {
     switch (status)
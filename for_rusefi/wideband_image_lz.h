@@ -0,0 +1,1492 @@
+static const unsigned char build_wideband_image_lz_bin[] = {
+  0x57, 0x42, 0x4c, 0x5a, 0x00, 0x64, 0x00, 0x00, 0x05, 0x1e, 0x6f, 0x3a,
+  0xb9, 0x45, 0x00, 0x00, 0xff, 0x00, 0x05, 0x00, 0x20, 0xa1, 0x19, 0x00,
+  0x08, 0xdf, 0xb1, 0x4a, 0x00, 0x08, 0xf9, 0x07, 0x00, 0x1d, 0x1a, 0x57,
+  0x00, 0x08, 0xf8, 0x07, 0x00, 0x0b, 0x07, 0x00, 0xa3, 0x07, 0x00, 0xfe,
+  0x03, 0xfc, 0x00, 0x08, 0x21, 0x47, 0x00, 0x08, 0xe1, 0x5f, 0x41, 0x00,
+  0x08, 0x81, 0x42, 0x0b, 0x00, 0x43, 0x07, 0x00, 0xaf, 0x49, 0x00, 0x08,
+  0x11, 0x6f, 0x00, 0xb1, 0x17, 0x00, 0x21, 0xec, 0x07, 0x00, 0x53, 0xc4,
+  0x61, 0x44, 0x07, 0x0c, 0xd1, 0x52, 0x00, 0xfb, 0x08, 0x00, 0x00, 0x20,
+  0x72, 0xb6, 0x24, 0x48, 0x80, 0xef, 0xf3, 0x08, 0x88, 0x23, 0x05, 0x00,
+  0x09, 0x88, 0x02, 0xff, 0x20, 0x80, 0xf3, 0x14, 0x88, 0xbf, 0xf3, 0x6f,
+  0xff, 0x8f, 0x02, 0xf0, 0x2a, 0xfc, 0x03, 0xf0, 0xe8, 0xff, 0xf8, 0x1e,
+  0x48, 0x1f, 0x49, 0x1b, 0x4a, 0x91, 0xff, 0x42, 0x02, 0xda, 0x08, 0x60,
+  0x04, 0x31, 0xfa, 0xef, 0xe7, 0x1c, 0x49, 0x19, 0x0d, 0x20, 0x1a, 0x49,
+  0x1a, 0xff, 0x4a, 0x1b, 0x4b, 0x9a, 0x42, 0x04, 0xda, 0x08, 0xfb, 0x68,
+  0x10, 0x11, 0x00, 0x04, 0x32, 0xf8, 0xe7, 0x00, 0xef, 0x20, 0x17, 0x49,
+  0x18, 0x23, 0x20, 0x02, 0xf0, 0x1d, 0xff, 0xfc, 0x02, 0xf0, 0x0b, 0xfc,
+  0x14, 0x4c, 0x14, 0xff, 0x4d, 0xac, 0x42, 0x03, 0xda, 0x21, 0x68, 0x88,
+  0xff, 0x47, 0x04, 0x34, 0xf9, 0xe7, 0x03, 0xf0, 0x61, 0xef, 0xf9, 0x11,
+  0x4c, 0x11, 0x13, 0x28, 0x0f, 0x49, 0x08, 0xf9, 0x47, 0x94, 0x00, 0x63,
+  0x01, 0x00, 0x09, 0x00, 0x20, 0x55, 0x66, 0x00, 0x00, 0x00, 0x01, 0x0b,
+  0x00, 0x0f, 0x00, 0xa4, 0x68, 0xb7, 0x00, 0xea, 0x13, 0x00, 0x14, 0x03,
+  0x00, 0x18, 0x03, 0x00, 0xd8, 0x17, 0x00, 0xbf, 0x20, 0xc0, 0x18, 0x00,
+  0x08, 0xc4, 0x03, 0x20, 0x61, 0xfe, 0x33, 0x01, 0x96, 0xe7, 0x00, 0xf0,
+  0x00, 0xf8, 0xfe, 0xff, 0xe7, 0xf0, 0xb5, 0x44, 0x46, 0x4d, 0x46, 0x56,
+  0xff, 0x46, 0x5f, 0x46, 0xf0, 0xb4, 0x6b, 0x46, 0xcb, 0xff, 0x60, 0xc3,
+  0x68, 0x9d, 0x46, 0xf0, 0xbc, 0xa0, 0xff, 0x46, 0xa9, 0x46, 0xb2, 0x46,
+  0xbb, 0x46, 0xf0, 0xff, 0xbd, 0x01, 0xf0, 0x92, 0xfe, 0x62, 0xb6, 0x28,
+  0xff, 0x1c, 0xa0, 0x47, 0x00, 0x20, 0x02, 0xf0, 0x94, 0xff, 0xfb, 0xfe,
+  0xe7, 0x01, 0xf0, 0xa1, 0xfe, 0x02, 0xff, 0xf0, 0x57, 0xfb, 0x01, 0xf0,
+  0x85, 0xfe, 0x02, 0xff, 0x4a, 0x02, 0x4b, 0x13, 0x60, 0xfe, 0xe7, 0xc0,
+  0xdf, 0x46, 0x04, 0xed, 0x00, 0xe0, 0x91, 0x00, 0x80, 0x1e, 0xff, 0xf0,
+  0x04, 0x0f, 0x0c, 0xbf, 0xef, 0xf3, 0x08, 0xff, 0x80, 0xef, 0xf3, 0x09,
+  0x80, 0x03, 0xf0, 0x3b, 0xf5, 0xbc, 0x11, 0x34, 0x4a, 0x11, 0x38, 0x49,
+  0xbc, 0x00, 0xbf, 0xff, 0x00, 0x22, 0x43, 0x08, 0x8b, 0x42, 0x74, 0xd3,
+  0xff, 0x03, 0x09, 0x8b, 0x42, 0x5f, 0xd3, 0x03, 0x0a, 0xff, 0x8b, 0x42,
+  0x44, 0xd3, 0x03, 0x0b, 0x8b, 0x42, 0xff, 0x28, 0xd3, 0x03, 0x0c, 0x8b,
+  0x42, 0x0d, 0xd3, 0xbf, 0xff, 0x22, 0x09, 0x02, 0x12, 0xba, 0x0b, 0x04,
+  0x02, 0x7f, 0xd3, 0x12, 0x12, 0x09, 0x02, 0x65, 0xd0, 0x1d, 0x04, 0x7f,
+  0x19, 0xd3, 0x00, 0xe0, 0x09, 0x0a, 0xc3, 0x09, 0x00, 0xff, 0x01, 0xd3,
+  0xcb, 0x03, 0xc0, 0x1a, 0x52, 0x41, 0x55, 0x83, 0x0b, 0x08, 0x8b, 0x0b,
+  0x08, 0x43, 0x0b, 0x08, 0x4b, 0x0b, 0x08, 0x2e, 0x2d, 0x04, 0x01, 0xd3,
+  0x0b, 0x0b, 0x08, 0xc3, 0x5d, 0x00, 0x2f, 0x00, 0xa9, 0x02, 0x2f, 0x08,
+  0x0b, 0x08, 0x8b, 0x0b, 0x08, 0x43, 0x0b, 0x08, 0x4b, 0x70, 0x0b, 0x08,
+  0x81, 0x04, 0x2f, 0x00, 0x0b, 0x08, 0xcd, 0xd2, 0xc3, 0x95, 0x00, 0x52,
+  0x31, 0x00, 0x01, 0x31, 0x08, 0x0b, 0x08, 0x8b, 0x0b, 0x08, 0x43, 0x0b,
+  0x08, 0x21, 0x4b, 0x0b, 0x08, 0xb9, 0x04, 0x31, 0x00, 0x0b, 0x08, 0xc3,
+  0xcb, 0x00, 0x2f, 0x00, 0x09, 0x00, 0x2f, 0x08, 0x0b, 0x08, 0x8b, 0x0b,
+  0x08, 0xe3, 0x04, 0x2f, 0x00, 0x0b, 0x08, 0xff, 0x41, 0x1a, 0x00, 0xd2,
+  0x01, 0x46, 0x52, 0x41, 0xff, 0x10, 0x46, 0x70, 0x47, 0xff, 0xe7, 0x01,
+  0xb5, 0xfe, 0xbf, 0x01, 0xf0, 0x06, 0xf8, 0x02, 0xbd, 0xc0, 0x46, 0xff,
+  0x00, 0x29, 0xf7, 0xd0, 0x76, 0xe7, 0x70, 0x47, 0xff, 0x70, 0x47, 0xc0,
+  0x46, 0x84, 0x46, 0x08, 0x00, 0xff, 0x61, 0x46, 0xff, 0xe7, 0x1f, 0xb5,
+  0x04, 0xf0, 0xff, 0x0f, 0xf8, 0x00, 0x28, 0x01, 0xd4, 0x00, 0x21, 0xff,
+  0xc8, 0x42, 0x1f, 0xbd, 0x10, 0xb5, 0x03, 0xf0, 0x7f, 0x9b, 0xff, 0x40,
+  0x42, 0x01, 0x30, 0x10, 0x0b, 0x00, 0xf7, 0x04, 0xf0, 0x01, 0x1b, 0x04,
+  0xdb, 0x00, 0x20, 0x10, 0xdb, 0xbd, 0x01, 0x03, 0x00, 0xc0, 0x46, 0x1f,
+  0x04, 0xf7, 0xff, 0xaa, 0x13, 0x00, 0xdd, 0x13, 0x2c, 0xa7, 0x13, 0x04,
+  0xdc, 0x13, 0x2c, 0x9d, 0xfa, 0x13, 0x04, 0xda, 0x13, 0x1c, 0x1c, 0x21,
+  0x01, 0x23, 0x1b, 0xfb, 0x04, 0x98, 0xa9, 0x00, 0x00, 0x0c, 0x10, 0x39,
+  0x1b, 0x7d, 0x0a, 0x09, 0x08, 0x0a, 0x08, 0x39, 0x1b, 0x09, 0x09, 0x08,
+  0xff, 0x09, 0x04, 0x39, 0x02, 0xa2, 0x10, 0x5c, 0x40, 0x7d, 0x18, 0x9f,
+  0x04, 0x04, 0x03, 0x02, 0x02, 0x01, 0x00, 0x00, 0xfc, 0x2b, 0x27, 0x2f,
+  0x0f, 0x03, 0x22, 0x02, 0x4b, 0x58, 0x65, 0xef, 0x02, 0x4b, 0x1a, 0x70,
+  0x1f, 0x06, 0x20, 0x16, 0x00, 0xf3, 0x20, 0x38, 0x8b, 0x02, 0x1f, 0x14,
+  0x30, 0xbf, 0xfd, 0xe7, 0xfe, 0x2f, 0x24, 0x0f, 0x4a, 0x70, 0xb5, 0x94,
+  0x46, 0x03, 0xff, 0x22, 0xff, 0x25, 0xc0, 0x26, 0x02, 0x40, 0xd2, 0xff,
+  0x00, 0x95, 0x40, 0x89, 0x01, 0x91, 0x40, 0x83, 0xff, 0x08, 0x9b, 0x00,
+  0x63, 0x44, 0xb6, 0x00, 0x9c, 0xff, 0x59, 0x1f, 0x22, 0xac, 0x43, 0x0c,
+  0x43, 0x9c, 0xff, 0x51, 0x01, 0x23, 0x02, 0x40, 0x93, 0x40, 0xc0, 0xff,
+  0x22, 0x40, 0x09, 0x80, 0x00, 0x60, 0x44, 0x52, 0xbf, 0x00, 0x83, 0x50,
+  0x03, 0x60, 0x70, 0x33, 0x05, 0xe1, 0xfc, 0x7f, 0x0a, 0x00, 0x18, 0x70,
+  0xb5, 0x04, 0x68, 0x45, 0x7b, 0xff, 0x23, 0x68, 0x0e, 0x21, 0xeb, 0x40,
+  0x19, 0x40, 0xff, 0x43, 0x68, 0x82, 0x7b, 0x1b, 0x68, 0x19, 0x42, 0xff,
+  0x0b, 0xd0, 0x0b, 0x00, 0xab, 0x40, 0x01, 0x32, 0xff, 0x63, 0x60, 0x04,
+  0x4b, 0xd2, 0x00, 0xd4, 0x58, 0xff, 0x00, 0x2c, 0x02, 0xd0, 0x9b, 0x18,
+  0x58, 0x68, 0xeb, 0xa0, 0x47, 0x43, 0x04, 0x40, 0x9f, 0x20, 0xc2, 0x69,
+  0x70, 0xff, 0xb5, 0x14, 0x69, 0xd3, 0x68, 0x05, 0x00, 0x1c, 0xff, 0x40,
+  0xff, 0x23, 0x23, 0x40, 0xdb, 0x43, 0x13, 0xff, 0x61, 0xa3, 0x07, 0x04,
+  0xd5, 0x43, 0x68, 0x1b, 0xff, 0x69, 0x00, 0x2b, 0x00, 0xd0, 0x98, 0x47,
+  0x63, 0xbf, 0x07, 0x05, 0xd5, 0x6b, 0x68, 0x9b, 0x0d, 0x00, 0x01, 0xbf,
+  0xd0, 0x28, 0x00, 0x98, 0x47, 0x23, 0x0f, 0x08, 0x1b, 0x4d, 0x6a, 0x0f,
+  0x14, 0xe3, 0x06, 0x1f, 0x08, 0x0f, 0x18, 0xe4, 0x2f, 0x0c, 0xed, 0x68,
+  0x0f, 0x14, 0x70, 0xbd, 0xaf, 0x24, 0xf0, 0xb5, 0xd6, 0xff, 0x46, 0x4f,
+  0x46, 0x46, 0x46, 0x04, 0x00, 0xc0, 0xff, 0xb5, 0x08, 0x1c, 0x11, 0x1c,
+  0x04, 0xf0, 0xaa, 0xff, 0xf8, 0x81, 0x46, 0x65, 0x68, 0x27, 0x68, 0x28,
+  0xff, 0x1c, 0x79, 0x68, 0x03, 0xf0, 0x55, 0xff, 0x49, 0xbf, 0x46, 0x03,
+  0xf0, 0x52, 0xff, 0xe1, 0x0b, 0x00, 0xe5, 0xff, 0xfb, 0xa1, 0x68, 0x06,
+  0x1c, 0x48, 0x46, 0x04, 0xff, 0xf0, 0x98, 0xf8, 0x29, 0x1c, 0x03, 0xf0,
+  0x7d, 0xff, 0xfd, 0x4b, 0x46, 0xa3, 0x60, 0x80, 0x23, 0x1b, 0xff, 0x06,
+  0x9c, 0x46, 0xfd, 0x68, 0x80, 0x46, 0xac, 0xff, 0x44, 0x29, 0x1c, 0x30,
+  0x1c, 0xe2, 0x46, 0xff, 0xff, 0xf7, 0xfc, 0xfe, 0x00, 0x28, 0x00, 0xd1,
+  0x2e, 0xbf, 0x1c, 0x50, 0x46, 0x31, 0x1c, 0x55, 0x0f, 0x00, 0x08, 0xfe,
+  0xe9, 0x01, 0x00, 0xd1, 0x35, 0x1c, 0xe5, 0x60, 0x39, 0xfb, 0x68, 0x48,
+  0x4f, 0x00, 0x2a, 0xff, 0xb9, 0x68, 0x04, 0xfb, 0x1c, 0x40, 0x09, 0x00,
+  0x25, 0xff, 0x01, 0x1c, 0x20, 0xf6, 0x4b, 0x00, 0xb7, 0xfb, 0x51, 0x04,
+  0xb4, 0xfb, 0xe0, 0xbc, 0x7f, 0xba, 0x46, 0xb1, 0x46, 0xa8, 0x46, 0xf0,
+  0x5b, 0x05, 0x6e, 0x00, 0x04, 0x69, 0x70, 0x47, 0xaf, 0x24, 0xc0, 0x68,
+  0x0f, 0x2c, 0xff, 0x10, 0xb5, 0x02, 0x49, 0x40, 0x69, 0x03, 0xf0, 0xff,
+  0x01, 0xff, 0x10, 0xbd, 0xff, 0xc8, 0xce, 0xbf, 0xff, 0x03, 0x68, 0x0c,
+  0x4a, 0x5b, 0x68, 0x10, 0xb5, 0xff, 0x93, 0x42, 0x0f, 0xd1, 0xc1, 0x68,
+  0x0a, 0x48, 0xfe, 0x6b, 0x00, 0xfd, 0xfe, 0x21, 0x89, 0x05, 0x04, 0xf0,
+  0xdf, 0x3e, 0xf8, 0x01, 0x1c, 0x07, 0x0f, 0x00, 0x22, 0xfd, 0xff, 0x06,
+  0x49, 0x04, 0xf0, 0x37, 0xf8, 0x10, 0xbd, 0xdf, 0x98, 0x47, 0x01, 0x1c,
+  0xed, 0x23, 0x02, 0xe1, 0x1d, 0xff, 0x00, 0x08, 0x33, 0x33, 0x53, 0x40,
+  0x00, 0xe0, 0xed, 0xab, 0x73, 0x00, 0x20, 0x41, 0x5f, 0x24, 0xf8, 0xb5,
+  0xce, 0xff, 0x46, 0x47, 0x46, 0x03, 0x68, 0x44, 0x49, 0x5a, 0xff, 0x69,
+  0x80, 0xb5, 0x8a, 0x42, 0x1e, 0xd1, 0x5b, 0xbf, 0x68, 0x42, 0x4a, 0x93,
+  0x42, 0x5c, 0x5d, 0x00, 0x41, 0x56, 0x4d, 0x00, 0xfb, 0xfc, 0x5d, 0x0c,
+  0x0f, 0x5d, 0x00, 0x3e, 0x0f, 0x00, 0xf7, 0xf3, 0xfc, 0x3e, 0x5d, 0x00,
+  0x08, 0xf8, 0x04, 0x1c, 0x7f, 0x3d, 0x49, 0x20, 0x1c, 0xff, 0xf7, 0x81,
+  0x09, 0x01, 0xff, 0x0c, 0xd0, 0x00, 0x20, 0xc0, 0xbc, 0xb9, 0x46, 0xff,
+  0xb0, 0x46, 0xf8, 0xbd, 0x90, 0x47, 0x04, 0x1c, 0xf5, 0x36, 0x19, 0x08,
+  0x74, 0x19, 0x00, 0xf2, 0xd1, 0x34, 0x4b, 0x5f, 0x9c, 0x42, 0x39, 0xd0,
+  0x34, 0x11, 0x08, 0x61, 0x11, 0x00, 0xd7, 0x33, 0xd1, 0x32, 0x0b, 0x08,
+  0x6f, 0x0b, 0x00, 0x2f, 0xd1, 0xff, 0x30, 0x4b, 0x00, 0x26, 0x99, 0x46,
+  0x08, 0x23, 0xff, 0x4b, 0x44, 0x98, 0x46, 0x2e, 0x4f, 0x03, 0xe0, 0xff,
+  0x43, 0x46, 0x80, 0xcb, 0x2e, 0x00, 0x98, 0x46, 0xd5, 0x39, 0x33, 0x01,
+  0x75, 0x25, 0x00, 0x3e, 0x25, 0x00, 0x1e, 0xd1, 0xdf, 0x0f, 0x2d, 0xf2,
+  0xd1, 0x24, 0x35, 0x00, 0x03, 0xf0, 0xff, 0xcc, 0xff, 0x25, 0x49, 0x03,
+  0xf0, 0x7b, 0xfe, 0xff, 0x00, 0x25, 0x24, 0x4e, 0x04, 0x1c, 0xfe, 0x20,
+  0xff, 0x21, 0x1c, 0x80, 0x05, 0x03, 0xf0, 0xc1, 0xff, 0xed, 0x31, 0x1b,
+  0x00, 0x70, 0xfe, 0x61, 0x05, 0x03, 0xfb, 0xb9, 0xfd, 0xe7, 0xf7, 0x04,
+  0xa0, 0xe7, 0x1d, 0x48, 0xb4, 0xe7, 0xff, 0x1b, 0x48, 0xb2, 0xe7, 0x4b,
+  0x46, 0xb6, 0x00, 0xff, 0x9b, 0x59, 0x20, 0x1c, 0x99, 0x46, 0x19, 0x4b,
+  0xff, 0x49, 0x46, 0x98, 0x46, 0xf6, 0x58, 0x03, 0xf0, 0x5d, 0xa8, 0xf5,
+  0x01, 0x04, 0x1c, 0x38, 0x2f, 0x00, 0xa3, 0x9f, 0x11, 0xff, 0x87, 0xfc,
+  0x43, 0x46, 0xad, 0x00, 0xe9, 0x58, 0x7d, 0x04, 0x0b, 0x00, 0x4b, 0xfe,
+  0x05, 0x1c, 0xd0, 0x37, 0x01, 0xef, 0x01, 0x1e, 0x00, 0x08, 0x3b, 0x39,
+  0x40, 0x9c, 0x45, 0xfe, 0xa5, 0x01, 0x7f, 0x00, 0x00, 0xa0, 0x42, 0x00,
+  0xa0, 0xff, 0x8c, 0x45, 0xd8, 0x63, 0x00, 0x08, 0x00, 0x00, 0xff, 0xc8,
+  0x42, 0x53, 0x04, 0x69, 0xb9, 0x00, 0x00, 0xff, 0xfa, 0x43, 0x00, 0xc0,
+  0x80, 0x44, 0x98, 0x64, 0xfc, 0x13, 0x04, 0xcf, 0x11, 0x69, 0x02, 0x38,
+  0x43, 0x42, 0x58, 0xb7, 0x41, 0xc0, 0xb2, 0xd7, 0x0d, 0x40, 0x6a, 0xdf,
+  0x2d, 0x80, 0xfc, 0xff, 0x35, 0x0f, 0x30, 0x1e, 0x49, 0x70, 0xb5, 0x8b,
+  0x69, 0xff, 0x0a, 0x69, 0x18, 0x68, 0xd5, 0x68, 0x18, 0x60, 0xff, 0x10,
+  0x78, 0x0e, 0x6a, 0x00, 0x28, 0x27, 0xd1, 0xff, 0x01, 0x30, 0xcc, 0x68,
+  0x05, 0x43, 0xc8, 0x69, 0xff, 0x89, 0x68, 0x40, 0x68, 0xc1, 0x60, 0x51,
+  0x88, 0xff, 0x4c, 0x43, 0x91, 0x69, 0x44, 0x60, 0x06, 0x60, 0xff, 0xdd,
+  0x60, 0x99, 0x62, 0x51, 0x69, 0x59, 0x61, 0xff, 0x91, 0x68, 0x00, 0x29,
+  0x05, 0xd0, 0x19, 0x68, 0xff, 0x12, 0x69, 0x19, 0x60, 0x90, 0x21, 0x59,
+  0x60, 0xff, 0x1a, 0x62, 0x01, 0x21, 0x9a, 0x68, 0x0a, 0x43, 0xff, 0x9a,
+  0x60, 0x1a, 0x68, 0x11, 0x42, 0xfc, 0xd0, 0xbd, 0x02, 0x0b, 0x00, 0x04,
+  0x21, 0x02, 0x60, 0x13, 0x0c, 0x70, 0xf7, 0xbd, 0x03, 0x20, 0x4f, 0x04,
+  0x01, 0x2c, 0x02, 0xd9, 0xff, 0x24, 0x20, 0x06, 0x43, 0xd2, 0xe7, 0x1d,
+  0x30, 0xff, 0x06, 0x43, 0xcf, 0xe7, 0x18, 0x09, 0x00, 0x20, 0xff, 0x10,
+  0xb5, 0x0f, 0x24, 0x4a, 0x68, 0x13, 0x68, 0xff, 0xa3, 0x43, 0x13, 0x60,
+  0x0e, 0x23, 0x0a, 0x68, 0xff, 0x49, 0x7b, 0x8b, 0x40, 0x53, 0x60, 0x83,
+  0x68, 0xff, 0x5b, 0x07, 0x09, 0xd5, 0x10, 0x22, 0x83, 0x68, 0xff, 0x13,
+  0x43, 0x83, 0x60, 0x11, 0x00, 0x83, 0x68, 0xff, 0x19, 0x40, 0x1a, 0x42,
+  0xfa, 0xd1, 0x41, 0x60, 0xfd, 0x02, 0x13, 0x10, 0x01, 0x3a, 0x83, 0x68,
+  0x1a, 0x42, 0xe7, 0xfc, 0xd1, 0x10, 0xe7, 0x16, 0x00, 0x10, 0x0c, 0x4b,
+  0x10, 0xff, 0xb5, 0x9a, 0x6d, 0x00, 0x2a, 0x08, 0xd1, 0xd9, 0xfd, 0x6d,
+  0xa3, 0x00, 0xdd, 0xda, 0x65, 0x1a, 0x68, 0x9a, 0xff, 0x42, 0x04, 0xd1,
+  0x62, 0xb6, 0x10, 0xbd, 0x06, 0xff, 0x48, 0xff, 0xf7, 0x8f, 0xfd, 0xdb,
+  0x68, 0x99, 0xff, 0x68, 0x93, 0x68, 0x99, 0x42, 0xf5, 0xd2, 0x03, 0xfe,
+  0x0f, 0x00, 0x87, 0xfd, 0xc0, 0x46, 0x20, 0x16, 0x00, 0xfb, 0x20, 0x4c,
+  0x67, 0x01, 0xa4, 0x66, 0x00, 0x08, 0x05, 0xfe, 0x3f, 0x10, 0x03, 0xdb,
+  0xdb, 0x6d, 0x00, 0x2b, 0x00, 0x6f, 0xdd, 0x10, 0xbd, 0x02, 0x25, 0x00,
+  0x74, 0xfd, 0x23, 0x04, 0xfd, 0x54, 0x23, 0x00, 0x70, 0xb5, 0x04, 0x29,
+  0x00, 0xd2, 0xff, 0x04, 0x21, 0x80, 0x23, 0xdb, 0x05, 0xda, 0x68, 0xff,
+  0x44, 0x18, 0x92, 0x07, 0x05, 0xd5, 0x5c, 0x63, 0xff, 0x5a, 0x6a, 0x10,
+  0x1a, 0x81, 0x42, 0x03, 0xd9, 0xb7, 0x70, 0xbd, 0x0c, 0x2d, 0x00, 0x5d,
+  0xfd, 0xfb, 0x00, 0x24, 0xff, 0xd8, 0x68, 0x01, 0x31, 0x8d, 0x18, 0x04,
+  0x42, 0xff, 0xf5, 0xd0, 0x5d, 0x63, 0x58, 0x6a, 0x82, 0x1a, 0xff, 0x8a,
+  0x42, 0x07, 0xd2, 0x04, 0x29, 0xed, 0xd9, 0xff, 0x01, 0x21, 0x04, 0x4a,
+  0xd3, 0x6a, 0x0b, 0x43, 0x7f, 0xd3, 0x62, 0xe7, 0xe7, 0x02, 0x00, 0xeb,
+  0x07, 0x02, 0xcf, 0xb8, 0x65, 0x00, 0x08, 0x5f, 0x04, 0x8f, 0x0f, 0x72,
+  0xb6, 0xf7, 0x1f, 0x4a, 0x93, 0x7b, 0x00, 0x38, 0xdd, 0xd0, 0x6d, 0xff,
+  0x00, 0x28, 0x35, 0xd1, 0x01, 0x23, 0xd3, 0x65, 0xff, 0x0b, 0x7e, 0x04,
+  0x2b, 0x20, 0xd0, 0x19, 0xd8, 0xff, 0x00, 0x2b, 0x14, 0xd0, 0x03, 0x2b,
+  0x1f, 0xd1, 0xff, 0xcb, 0x69, 0x18, 0x60, 0x01, 0x23, 0x5b, 0x42, 0xff,
+  0xcb, 0x61, 0x00, 0x23, 0x8c, 0x68, 0x0b, 0x76, 0xff, 0x0b, 0x69, 0x1b,
+  0x68, 0x98, 0x68, 0xa0, 0x42, 0xff, 0xfb, 0xd2, 0x58, 0x68, 0x0b, 0x60,
+  0x48, 0x60, 0x9f, 0x01, 0x60, 0x59, 0x60, 0x00, 0x37, 0x00, 0xf5, 0x04,
+  0x05, 0xff, 0x2b, 0x0b, 0xd1, 0xc8, 0x69, 0x83, 0x68, 0x01, 0xff, 0x33,
+  0x83, 0x60, 0x48, 0x68, 0x0b, 0x68, 0x03, 0xfb, 0x60, 0x58, 0x3b, 0x10,
+  0xe0, 0xe7, 0x01, 0x20, 0x40, 0x7f, 0x42, 0xc8, 0x61, 0x0f, 0x2b, 0xdb,
+  0xd1, 0x0b, 0x05, 0x5b, 0x01, 0xfd, 0x05, 0x04, 0xfe, 0xfc, 0x8b, 0x04,
+  0x70, 0x0b, 0x01, 0xfd, 0x5c, 0xef, 0x00, 0x03, 0x68, 0x10, 0xb5, 0x00,
+  0x2b, 0xff, 0x18, 0xd0, 0x1a, 0x7e, 0x03, 0x2a, 0x19, 0xd1, 0xff, 0x00,
+  0x24, 0x0d, 0x4a, 0x04, 0x60, 0xd9, 0x61, 0xdd, 0x91, 0x5b, 0x01, 0x0f,
+  0xdb, 0xd2, 0x27, 0x01, 0x0c, 0xdd, 0xff, 0x1a, 0x69, 0x98, 0x68, 0x1c,
+  0x76, 0x12, 0x68, 0x77, 0x91, 0x68, 0x81, 0x7f, 0x00, 0x51, 0x68, 0x1a,
+  0x7b, 0x00, 0xbf, 0x0b, 0x60, 0x53, 0x60, 0x10, 0xbd, 0x4d, 0x04, 0xd7,
+  0x25, 0xfc, 0x05, 0x04, 0xd4, 0x53, 0x08, 0x3f, 0x05, 0x3c, 0x57, 0x00,
+  0xaf, 0x25, 0xfe, 0x4f, 0x01, 0x00, 0x0b, 0x07, 0x11, 0xd4, 0x05, 0x69,
+  0xff, 0x00, 0x2d, 0x0d, 0xd0, 0x8b, 0x07, 0x35, 0xd5, 0xff, 0x2b, 0x78,
+  0x00, 0x2b, 0x3e, 0xd0, 0x6b, 0x68, 0xff, 0x00, 0x2b, 0x05, 0xd0, 0x04,
+  0x22, 0x02, 0x70, 0xff, 0x98, 0x47, 0x23, 0x78, 0x04, 0x2b, 0x5b, 0xd0,
+  0xff, 0x70, 0xbd, 0xc1, 0x69, 0x80, 0x69, 0xff, 0xf7, 0xdf, 0xe6, 0xfe,
+  0x23, 0x69, 0x9b, 0x1d, 0x00, 0x27, 0xd0, 0x7f, 0x05, 0x22, 0x01, 0x21,
+  0x20, 0x00, 0x22, 0x21, 0x08, 0xff, 0x05, 0x2b, 0x1f, 0xd0, 0x72, 0xb6,
+  0x29, 0x4d, 0xfd, 0xab, 0x39, 0x01, 0x42, 0xdd, 0xee, 0x6d, 0x00, 0x2e,
+  0xff, 0x3f, 0xd1, 0x20, 0x00, 0x01, 0x21, 0x01, 0x23, 0xff, 0x14, 0x30,
+  0x49, 0x42, 0xeb, 0x65, 0xff, 0xf7, 0xbb, 0x9a, 0xff, 0x1b, 0x04, 0x31,
+  0xdd, 0xeb, 0x05, 0x00, 0x2e, 0xfb, 0xdd, 0xee, 0x1b, 0x01, 0xd5, 0xe7,
+  0x49, 0x07, 0xd3, 0xfd, 0xd5, 0x69, 0x04, 0xd0, 0xd0, 0x98, 0x47, 0xce,
+  0xe7, 0xff, 0x02, 0x23, 0x23, 0x70, 0x00, 0x23, 0x23, 0x61, 0x5b, 0xda,
+  0xe7, 0x69, 0x0c, 0xb1, 0xfe, 0x1b, 0x04, 0x21, 0x85, 0x00, 0xae, 0x65,
+  0x14, 0x04, 0x2b, 0x1a, 0x65, 0x00, 0x0f, 0x65, 0x08, 0x0f, 0xfa, 0x65,
+  0x08, 0x0c, 0x65, 0x04, 0x23, 0x00, 0x21, 0x14, 0x30, 0xba, 0x63, 0x04,
+  0x68, 0x63, 0x08, 0xcd, 0xdc, 0x08, 0xf3, 0x00, 0x5a, 0xfb, 0xfc, 0x07,
+  0x05, 0x00, 0x57, 0xfc, 0x01, 0x3b, 0x23, 0x4b, 0x70, 0xa0, 0x5b, 0x18,
+  0xdf, 0xef, 0x01, 0x0b, 0x05, 0x64, 0x0b, 0x01, 0xfa, 0x5f, 0x05, 0xf8,
+  0xef, 0x01, 0x20, 0x4b, 0x9a, 0x6d, 0xd9, 0xff, 0x6d, 0x0a, 0x43, 0x2c,
+  0xd1, 0x01, 0x22, 0xda, 0xff, 0x65, 0x80, 0x22, 0x00, 0x27, 0xd2, 0x05,
+  0x52, 0xff, 0x6a, 0x1c, 0x6a, 0x5d, 0x6a, 0x16, 0x1b, 0xa4, 0xff, 0x19,
+  0x7d, 0x41, 0x1e, 0x6a, 0x5f, 0x6a, 0xaf, 0xbf, 0x42, 0x22, 0xd8, 0x1f,
+  0xd0, 0x00, 0x1f, 0x00, 0x1a, 0xff, 0x68, 0x1c, 0x62, 0x5d, 0x62, 0x9a,
+  0x42, 0x1d, 0xfe, 0xd3, 0x02, 0x82, 0x69, 0xc3, 0x69, 0xa4, 0x1a, 0x9d,
+  0xff, 0x41, 0x00, 0x2d, 0x0c, 0xdc, 0x09, 0xd0, 0x20, 0x7f, 0x00, 0x03,
+  0xf0, 0x7d, 0xff, 0x0e, 0x49, 0x23, 0x01, 0xff, 0xfb, 0x00, 0x28, 0x03,
+  0xd1, 0x00, 0x20, 0xf8, 0xff, 0xbd, 0xa3, 0x1c, 0xf3, 0xd9, 0x0a, 0x48,
+  0xfa, 0xfb, 0xe7, 0x0a, 0x8b, 0x00, 0x11, 0xfc, 0xa6, 0x42, 0xdd, 0xdb,
+  0xd9, 0x09, 0x09, 0x00, 0x0c, 0xfc, 0x05, 0x17, 0xdc, 0xd2, 0xfa, 0x15,
+  0x07, 0x04, 0x9f, 0x09, 0x00, 0x50, 0x43, 0x47, 0x00, 0x4f, 0x00, 0x50,
+  0x41, 0x6c, 0x9b, 0x04, 0x93, 0x02, 0x74, 0x9f, 0x10, 0x75, 0x17, 0x9f,
+  0x10, 0x1a, 0x9f, 0x68, 0x10, 0xd8, 0x0d, 0x9f, 0x28, 0xfd, 0x0b, 0x9f,
+  0x00, 0x04, 0x60, 0x45, 0x60, 0xf8, 0xbd, 0x7e, 0x0d, 0x05, 0xd3, 0xfb,
+  0xa6, 0x42, 0xef, 0xd9, 0x11, 0x05, 0xbb, 0xce, 0xfb, 0x7b, 0x14, 0xee,
+  0xd2, 0x04, 0x0f, 0x00, 0xc6, 0xf1, 0xfb, 0x7b, 0x04, 0x73, 0x24, 0x1f,
+  0x26, 0xf0, 0xb5, 0xc6, 0x46, 0x57, 0x88, 0x46, 0x00, 0x85, 0x00, 0x24,
+  0x85, 0x10, 0x33, 0x85, 0x68, 0xd7, 0x29, 0xd8, 0x26, 0x85, 0x28, 0x24,
+  0x85, 0x00, 0x02, 0x68, 0xbb, 0x43, 0x68, 0x25, 0x0d, 0x13, 0xdc, 0x10,
+  0x25, 0x09, 0xea, 0xff, 0xfe, 0x11, 0x49, 0x04, 0x1c, 0x40, 0x46, 0x03,
+  0xff, 0xf0, 0x85, 0xfb, 0x01, 0x1c, 0x20, 0x1c, 0xff, 0xff, 0xf7, 0x4d,
+  0xfb, 0x43, 0x1e, 0x98, 0x41, 0x80, 0xef, 0xbc, 0xb8, 0x46, 0xf0, 0x33,
+  0x01, 0xec, 0xd9, 0x01, 0xd7, 0x20, 0xf8, 0xe7, 0x29, 0x05, 0x77, 0xb7,
+  0x00, 0xd6, 0xd9, 0xba, 0xc1, 0x04, 0x72, 0xb7, 0x18, 0xd5, 0xd2, 0x05,
+  0x0f, 0x00, 0x6a, 0x1e, 0xb7, 0x08, 0x00, 0x40, 0x1c, 0x46, 0xbb, 0x24,
+  0xaf, 0xfc, 0xaf, 0x44, 0xb5, 0x92, 0xaf, 0x18, 0x2d, 0xaf, 0x10, 0xf5,
+  0xfa, 0xaf, 0x4c, 0x1f, 0xea, 0xaf, 0x18, 0x1a, 0xaf, 0x30, 0x12, 0xaf,
+  0x08, 0x0a, 0xd7, 0x23, 0xfd, 0x3c, 0xaf, 0x34, 0x0c, 0x00, 0xfe, 0x21,
+  0x06, 0x00, 0x7f, 0x00, 0xb5, 0x89, 0x05, 0x10, 0x1c, 0x15, 0x5b, 0x00,
+  0xff, 0xbd, 0xfa, 0x00, 0x28, 0x01, 0xd1, 0xfe, 0x25, 0x5f, 0xad, 0x05,
+  0x00, 0x21, 0x28, 0x0f, 0x00, 0xc9, 0x0f, 0x00, 0xff, 0x00, 0xd1, 0x00,
+  0x25, 0xa3, 0x1c, 0x9b, 0x00, 0xff, 0xf3, 0x18, 0x5d, 0x60, 0x33, 0x68,
+  0x30, 0x89, 0xff, 0xe2, 0xb2, 0x00, 0x2b, 0x26, 0xd0, 0x19, 0x7c, 0xff,
+  0x91, 0x42, 0x23, 0xd9, 0x72, 0xb6, 0x18, 0x4e, 0x7f, 0xb7, 0x6d, 0xf2,
+  0x6d, 0x17, 0x43, 0x20, 0xeb, 0x00, 0xff, 0x19, 0x78, 0xf2, 0x65, 0x02,
+  0x29, 0x18, 0xd1, 0xff, 0xa2, 0x40, 0xd9, 0x68, 0x0c, 0x34, 0x0a, 0x43,
+  0x7f, 0xda, 0x60, 0xdb, 0x69, 0xa4, 0x00, 0x98, 0xbb, 0x00, 0xff, 0xdd,
+  0xfd, 0x29, 0x1c, 0x03, 0xf0, 0xcc, 0xfa, 0xff, 0x02, 0xf0, 0x48, 0xff,
+  0x33, 0x68, 0x44, 0x44, 0x7f, 0x60, 0x60, 0xf7, 0x65, 0xb3, 0x42, 0x09,
+  0xf1, 0x00, 0xec, 0xc7, 0x0c, 0x1d, 0x06, 0xbf, 0xfa, 0x05, 0x04, 0xbc,
+  0xfa, 0xf2, 0xff, 0x68, 0x9b, 0x68, 0x92, 0x68, 0x9a, 0x42, 0xf0, 0xf6,
+  0x23, 0x0a, 0xb4, 0xfa, 0xbb, 0x04, 0xb0, 0x66, 0x00, 0x08, 0xf6, 0xbb,
+  0x04, 0x28, 0x67, 0x23, 0x1e, 0x60, 0x23, 0x10, 0xb5, 0xdf, 0x0a, 0x1c,
+  0xc1, 0x5c, 0x01, 0x25, 0x00, 0x99, 0xff, 0xe7, 0x10, 0xbd, 0x00, 0x93,
+  0x05, 0x3f, 0x2a, 0x4f, 0x46, 0x46, 0xff, 0x46, 0xd6, 0x46, 0xc0, 0xb5,
+  0x0f, 0x68, 0x16, 0xff, 0x00, 0x7b, 0x69, 0x9f, 0x4a, 0x04, 0x00, 0x0d,
+  0xff, 0x00, 0x93, 0x42, 0x00, 0xd0, 0x87, 0xe0, 0x7b, 0xf7, 0x68, 0x9d,
+  0x4a, 0x09, 0x04, 0xf7, 0xe0, 0xc9, 0x68, 0xff, 0x9b, 0x48, 0x03, 0xf0,
+  0xb5, 0xf8, 0xfe, 0x21, 0x5f, 0x89, 0x05, 0x03, 0xf0, 0xc9, 0x63, 0x01,
+  0x98, 0x0f, 0x00, 0xff, 0xad, 0xf8, 0x98, 0x49, 0x03, 0xf0, 0xc2, 0xfb,
+  0xff, 0x80, 0x46, 0x28, 0x00, 0x3b, 0x69, 0x98, 0x47, 0xff, 0x81, 0x46,
+  0x00, 0x2e, 0x62, 0xd1, 0x2b, 0x68, 0xff, 0x28, 0x00, 0xdb, 0x68, 0x98,
+  0x47, 0x92, 0x49, 0xd7, 0xe7, 0x69, 0x05, 0x1d, 0x01, 0x1c, 0x1d, 0x01,
+  0x66, 0xd1, 0x6b, 0x8f, 0x49, 0x29, 0x05, 0x2a, 0x0b, 0x00, 0x3a, 0xd1,
+  0x14, 0x02, 0xff, 0x30, 0xff, 0xf7, 0x62, 0xfe, 0x28, 0x22, 0x80, 0xff,
+  0x26, 0xa1, 0x5c, 0x00, 0x22, 0x89, 0x4b, 0xe2, 0xbf, 0x61, 0x5a, 0x54,
+  0xf6, 0x05, 0x88, 0x23, 0x08, 0x04, 0xee, 0x23, 0x00, 0x1e, 0xd1, 0xfe,
+  0x59, 0x01, 0x89, 0x05, 0xff, 0xfb, 0xf7, 0x1b, 0x0d, 0x00, 0x18, 0xd1,
+  0x00, 0x26, 0x82, 0xfa, 0x1b, 0x08, 0x14, 0x69, 0x05, 0xd0, 0x00, 0x26,
+  0x23, 0x68, 0xff, 0x7f, 0x4d, 0x5b, 0x69, 0xab, 0x42, 0x31, 0xd1, 0x7f,
+  0x60, 0x23, 0x7e, 0x48, 0xe1, 0x5c, 0x32, 0x5b, 0x04, 0xff, 0xff, 0xe0,
+  0xbc, 0xba, 0x46, 0xb1, 0x46, 0xa8, 0xbe, 0x29, 0x01, 0x7a, 0x4d, 0x29,
+  0x1c, 0x30, 0x4b, 0x01, 0x5c, 0xfb, 0xf8, 0x01, 0x05, 0x00, 0x23, 0xfa,
+  0x06, 0x1c, 0xde, 0xbf, 0xe7, 0x20, 0x00, 0x75, 0x49, 0x38, 0x77, 0x00,
+  0xbe, 0xff, 0xfe, 0x00, 0x28, 0xbd, 0xd0, 0x63, 0x6a, 0x73, 0xef, 0x49,
+  0x18, 0x1c, 0x9a, 0x75, 0x01, 0x62, 0xfb, 0x06, 0xff, 0x1c, 0x01, 0x2f,
+  0x66, 0xd0, 0x02, 0x2f, 0x18, 0xef, 0xd0, 0x00, 0x2f, 0x4e, 0x5d, 0x00,
+  0xe7, 0x61, 0xb9, 0xff, 0xe7, 0x6c, 0x4b, 0xe7, 0x69, 0x1d, 0x68, 0x01,
+  0xef, 0x2e, 0xea, 0xd0, 0xa7, 0x39, 0x00, 0x31, 0x1c, 0x98, 0xff, 0x47,
+  0xcf, 0xe7, 0x08, 0x00, 0x98, 0x47, 0x2f, 0xcf, 0x68, 0x80, 0x46, 0x87,
+  0x11, 0x00, 0x49, 0x04, 0x01, 0xfe, 0xff, 0x99, 0xe7, 0x63, 0x49, 0x50,
+  0x46, 0x02, 0xf0, 0xff, 0x88, 0xfe, 0x01, 0x1c, 0x48, 0x46, 0x26, 0x00,
+  0xff, 0xff, 0xf7, 0xaf, 0xf9, 0x58, 0x36, 0x00, 0x28, 0x77, 0x75, 0xd1,
+  0x5d, 0x17, 0x00, 0x03, 0xf0, 0x34, 0x29, 0x01, 0xbf, 0x48, 0x46, 0xff,
+  0xf7, 0xb8, 0xf9, 0x03, 0x05, 0x30, 0xbf, 0x00, 0x55, 0x49, 0xff, 0xf7,
+  0x7e, 0x7f, 0x00, 0x69, 0xae, 0x03, 0x01, 0x52, 0x49, 0x50, 0x43, 0x00,
+  0x77, 0x0d, 0x00, 0x7a, 0xff, 0xd1, 0x02, 0x23, 0xe3, 0x61, 0x42, 0x46,
+  0x21, 0xff, 0x6a, 0x20, 0x1d, 0xff, 0xf7, 0x66, 0xfa, 0x01, 0xeb, 0x1c,
+  0x4f, 0x5d, 0x01, 0x16, 0x97, 0x00, 0x48, 0x49, 0x30, 0xfa, 0xd9, 0x00,
+  0x85, 0x3d, 0x00, 0x00, 0xd0, 0x6f, 0xe7, 0x44, 0x5f, 0x4e, 0x6d, 0xe7,
+  0xe0, 0x6a, 0x7f, 0x01, 0xfc, 0xe3, 0x02, 0xfa, 0x43, 0x09, 0x00, 0x3d,
+  0x00, 0x2d, 0xd1, 0x48, 0x46, 0x31, 0xba, 0x25, 0x00, 0x7c, 0x25, 0x00,
+  0x27, 0xd1, 0x80, 0xbd, 0x00, 0xf6, 0xd7, 0x05, 0x59, 0xe7, 0x77, 0x0c,
+  0x72, 0x13, 0x00, 0x3c, 0xd1, 0x5f, 0x20, 0x6b, 0x03, 0xf0, 0xaf, 0x33,
+  0x08, 0x48, 0x33, 0x00, 0xff, 0xe6, 0xfd, 0x00, 0x28, 0x39, 0xd1, 0xe7,
+  0x61, 0xd7, 0x66, 0x69, 0x30, 0x5d, 0x08, 0x4c, 0x23, 0x00, 0xca, 0xd0,
+  0xff, 0x30, 0x1c, 0x33, 0x49, 0x02, 0xf0, 0x24, 0xfe, 0x1f, 0x06, 0x1c,
+  0x60, 0x61, 0xc3, 0xe9, 0x10, 0x3b, 0x01, 0xe9, 0x00, 0xff, 0x20, 0x4b,
+  0x48, 0x30, 0x63, 0x61, 0xff, 0xf7, 0xff, 0x8a, 0xfd, 0x28, 0x22, 0x1f,
+  0x4b, 0xa1, 0x5c, 0x7f, 0x27, 0x3a, 0x5a, 0x54, 0xe2, 0x61, 0xdf, 0x19,
+  0x00, 0xbe, 0xbf, 0x04, 0x7f, 0xfd, 0x93, 0xe7, 0x30, 0xf7, 0x00, 0x7b,
+  0xff, 0xfd, 0x85, 0xe7, 0x28, 0x22, 0x04, 0x21, 0x16, 0xff, 0x4b, 0xa2,
+  0x5c, 0x00, 0x26, 0x99, 0x54, 0x03, 0xaa, 0xd1, 0x00, 0x16, 0x11, 0x00,
+  0x12, 0x31, 0x00, 0x26, 0x31, 0x08, 0x8e, 0x7a, 0x0d, 0x00, 0x0f, 0x0d,
+  0x00, 0x25, 0x3a, 0x00, 0x26, 0x0f, 0x04, 0xdd, 0x07, 0x0f, 0x00, 0x05,
+  0x21, 0x0a, 0x2f, 0x20, 0xfe, 0xe6, 0xff, 0xc0, 0x46, 0x01, 0x1e, 0x00,
+  0x08, 0xe1, 0x1d, 0xff, 0x00, 0x08, 0x33, 0x33, 0x53, 0x40, 0x00, 0xe0,
+  0xff, 0xab, 0x46, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0xff, 0xe0, 0x40,
+  0x00, 0x00, 0x18, 0x41, 0x6c, 0x0b, 0x7a, 0xbb, 0x06, 0x40, 0x0b, 0x00,
+  0xb8, 0x41, 0xb1, 0x26, 0xe3, 0x02, 0x7e, 0xcb, 0x0a, 0x40, 0x41, 0x00,
+  0x24, 0xf4, 0x48, 0xc9, 0x02, 0xb7, 0x41, 0x20, 0x14, 0x0f, 0x04, 0xc8,
+  0x42, 0x0b, 0x00, 0x40, 0xef, 0x0a, 0xd7, 0xa3, 0x3c, 0xdf, 0x06, 0xf8,
+  0xb5, 0x03, 0xff, 0x68, 0x98, 0x42, 0x2b, 0xd0, 0x16, 0x4a, 0x00, 0xff,
+  0x26, 0x94, 0x6d, 0xd7, 0x6d, 0x1a, 0x68, 0xe4, 0xff, 0x0f, 0x02, 0x60,
+  0x50, 0x60, 0x19, 0x7e, 0x04, 0xff, 0x29, 0x1a, 0xd1, 0xde, 0x61, 0x00,
+  0x2c, 0x1a, 0xff, 0xd1, 0x00, 0x2f, 0x18, 0xdd, 0x9d, 0x68, 0x19, 0xff,
+  0x69, 0xac, 0x46, 0x1c, 0x76, 0x09, 0x68, 0x8d, 0xff, 0x68, 0x65, 0x45,
+  0xfb, 0xd2, 0x4d, 0x68, 0x19, 0xff, 0x60, 0x5d, 0x60, 0x2b, 0x60, 0x4b,
+  0x60, 0x82, 0x7f, 0x42, 0x0c, 0xd0, 0x13, 0x00, 0x1a, 0x68, 0x35, 0x14,
+  0xdb, 0xe4, 0xd0, 0x71, 0x07, 0xfb, 0xf8, 0x05, 0x04, 0xf8, 0xf8, 0xef,
+  0xf8, 0xbd, 0xc0, 0x46, 0x7b, 0x07, 0x84, 0x65, 0x00, 0xfb, 0x08, 0x54,
+  0x7b, 0x03, 0xf8, 0xb5, 0x1d, 0x4c, 0x23, 0xff, 0x00, 0x10, 0x33, 0xe1,
+  0x61, 0x43, 0x60, 0x23, 0xff, 0x69, 0x82, 0x60, 0x03, 0x60, 0x58, 0x60,
+  0x20, 0xff, 0x61, 0x04, 0x2a, 0x00, 0xd2, 0x04, 0x22, 0x02, 0xff, 0x20,
+  0x80, 0x23, 0x06, 0x00, 0xdb, 0x05, 0xdd, 0xff, 0x68, 0x8f, 0x18, 0x2e,
+  0x40, 0x28, 0x42, 0x07, 0xff, 0xd1, 0x5f, 0x63, 0x1e, 0x61, 0xd8, 0x60,
+  0x58, 0xff, 0x6a, 0x45, 0x1a, 0xaa, 0x42, 0x03, 0xd9, 0xf8, 0xdb, 0xbd,
+  0x0f, 0x53, 0x00, 0xce, 0xf8, 0x29, 0x00, 0x26, 0xdd, 0xff, 0x68, 0x01,
+  0x32, 0x51, 0x18, 0x2e, 0x42, 0x0b, 0xff, 0xd0, 0x59, 0x63, 0x5d, 0x6a,
+  0x29, 0x1a, 0x91, 0xff, 0x42, 0x09, 0xd2, 0x04, 0x2a, 0xed, 0xd9, 0x01,
+  0xff, 0x22, 0xe3, 0x6a, 0x13, 0x43, 0xe3, 0x62, 0xe8, 0xbb, 0xe7, 0x05,
+  0x2b, 0x00, 0xb8, 0xf8, 0x01, 0x1a, 0x02, 0xe8, 0x95, 0xe7, 0x83, 0x0c,
+  0x1c, 0xff, 0x03, 0xb8, 0x87, 0x00, 0xdf, 0x27, 0x04, 0xff, 0x4b, 0x10,
+  0xb5, 0x9b, 0x68, 0x00, 0x2b, 0x00, 0xef, 0xd1, 0x10, 0xbd, 0x02, 0x31,
+  0x00, 0x9f, 0xf8, 0xc0, 0xbf, 0x46, 0x00, 0x24, 0x01, 0x40, 0x98, 0x27,
+  0x10, 0x12, 0xfe, 0x1f, 0x00, 0x9a, 0x6d, 0x00, 0x2a, 0x17, 0xdb, 0xdb,
+  0xdf, 0x6d, 0x00, 0x2b, 0x14, 0xdd, 0x6d, 0x03, 0xd0, 0x03, 0xff, 0x7e,
+  0x00, 0x2b, 0x12, 0xd0, 0x0f, 0x2b, 0x10, 0xff, 0xd0, 0x00, 0x23, 0x81,
+  0x68, 0x03, 0x76, 0x03, 0xff, 0x69, 0x1b, 0x68, 0x9a, 0x68, 0x8a, 0x42,
+  0xfb, 0xff, 0xd2, 0x5a, 0x68, 0x03, 0x60, 0x42, 0x60, 0x10, 0x56, 0xd3,
+  0x00, 0x10, 0xbd, 0x7f, 0x04, 0x78, 0x05, 0x09, 0x75, 0x05, 0x08, 0x53,
+  0x72, 0xf8, 0x83, 0x04, 0x03, 0x05, 0x70, 0x87, 0x00, 0x84, 0x03, 0x00,
+  0xfe, 0x5f, 0x04, 0x10, 0xb5, 0x72, 0xb6, 0x19, 0x4c, 0xa3, 0xfe, 0x5b,
+  0x00, 0x0c, 0xdd, 0xe1, 0x6d, 0x00, 0x29, 0x09, 0xff, 0xd1, 0x01, 0x20,
+  0x16, 0x4b, 0xe0, 0x65, 0x9a, 0xff, 0x68, 0x00, 0x2a, 0x06, 0xdd, 0x00,
+  0x23, 0xe3, 0xbf, 0x65, 0x62, 0xb6, 0x10, 0xbd, 0x13, 0x3f, 0x00, 0x52,
+  0xff, 0xf8, 0x00, 0x2a, 0x04, 0xdb, 0x1a, 0x68, 0x9a, 0xff, 0x42, 0x12,
+  0xd1, 0x90, 0x60, 0xf1, 0xe7, 0x18, 0xfe, 0xb7, 0x01, 0x0d, 0xd0, 0x01,
+  0x32, 0x9a, 0x60, 0x02, 0xbf, 0x68, 0x53, 0x60, 0x1a, 0x60, 0xc1, 0x83,
+  0x02, 0xa8, 0xdd, 0xff, 0x49, 0x04, 0x05, 0xdc, 0x08, 0x2f, 0x00, 0x3a,
+  0xf8, 0xdd, 0x07, 0x05, 0x00, 0x37, 0xf8, 0xe3, 0x11, 0x00, 0xda, 0xdc,
+  0x7d, 0xf5, 0x03, 0x11, 0x68, 0x12, 0x00, 0x20, 0x5c, 0x83, 0x00, 0xd5,
+  0x64, 0x03, 0x00, 0x4c, 0x83, 0x00, 0x16, 0xdf, 0x10, 0x1f, 0xd1, 0xfd,
+  0xda, 0x05, 0x00, 0x1c, 0xdd, 0x5a, 0x68, 0x94, 0x68, 0xff, 0x01, 0x2c,
+  0x1e, 0xd1, 0xd9, 0x68, 0x91, 0x42, 0xff, 0x18, 0xd0, 0x0a, 0x69, 0x9a,
+  0x42, 0x15, 0xd1, 0xff, 0x08, 0x76, 0x10, 0x68, 0x03, 0x68, 0x5a, 0x60,
+  0xff, 0x13, 0x60, 0x04, 0x76, 0xd0, 0x60, 0xef, 0xf3, 0xff, 0x09, 0x83,
+  0x4a, 0x69, 0x24, 0x3b, 0x9a, 0x42, 0xff, 0x02, 0xd8, 0xfe, 0xf7, 0xdb,
+  0xfe, 0x10, 0xbd, 0xed, 0x06, 0x67, 0x00, 0x03, 0xf8, 0x05, 0x04, 0x00,
+  0xf8, 0x05, 0xdf, 0x48, 0xfe, 0xf7, 0xfd, 0xff, 0x05, 0x04, 0xfa, 0xff,
+  0xaa, 0x6f, 0x04, 0x88, 0x67, 0x00, 0x80, 0x03, 0x00, 0x2c, 0x6b, 0x00,
+  0x48, 0xfe, 0x53, 0x01, 0xf0, 0xb5, 0x47, 0x46, 0xce, 0x46, 0x80, 0xff,
+  0xb5, 0x4a, 0x4d, 0x07, 0x00, 0xab, 0x6d, 0x87, 0xbf, 0xb0, 0x00, 0x2b,
+  0x62, 0xd1, 0xea, 0x79, 0x00, 0x5f, 0xff, 0xdd, 0xea, 0x68, 0x91, 0x46,
+  0x4a, 0x1c, 0x4f, 0xff, 0xd0, 0x00, 0x29, 0x56, 0xd0, 0xe8, 0x46, 0x48,
+  0xff, 0x46, 0x42, 0x46, 0x10, 0x61, 0x40, 0x46, 0x43, 0xff, 0x61, 0x80,
+  0x23, 0x40, 0x4a, 0xdb, 0x05, 0xc2, 0xfe, 0x05, 0x02, 0x2b, 0x00, 0x2c,
+  0x69, 0x10, 0x33, 0x9c, 0xff, 0x42, 0x6b, 0xd0, 0xeb, 0x69, 0xc3, 0x1a,
+  0xce, 0xff, 0x18, 0xb3, 0x42, 0x00, 0xd9, 0x0e, 0x00, 0xa3, 0xdf, 0x68,
+  0xb3, 0x42, 0x08, 0xd9, 0x1f, 0x01, 0xfa, 0xa3, 0xff, 0x68, 0x04, 0xe0,
+  0x44, 0x45, 0x3d, 0xd0, 0x24, 0xff, 0x68, 0xf6, 0x1a, 0xa3, 0x68, 0x9e,
+  0x42, 0xf8, 0xfb, 0xd8, 0x43, 0x45, 0x00, 0x9e, 0x60, 0x63, 0x68, 0x00,
+  0xfd, 0x94, 0x21, 0x05, 0xa3, 0x68, 0x62, 0x60, 0x9b, 0x1b, 0xff, 0xa3,
+  0x60, 0x01, 0x23, 0x5b, 0x42, 0xab, 0x61, 0xdd, 0x38, 0x95, 0x03, 0x80,
+  0xff, 0xab, 0x1d, 0x01, 0x40, 0xdb, 0xfd, 0xeb, 0x05, 0x00, 0x3d, 0xdd,
+  0x00, 0x9b, 0x00, 0x2b, 0xff, 0x11, 0xd0, 0x2a, 0x69, 0x42, 0x45, 0x1e,
+  0xd0, 0xff, 0x42, 0x46, 0x41, 0x46, 0x52, 0x68, 0x89, 0x68, 0xff, 0x13,
+  0x60, 0x5a, 0x60, 0x9a, 0x68, 0x52, 0x18, 0xfd, 0x9a, 0x35, 0x10, 0x01,
+  0xe0, 0xff, 0xf7, 0x65, 0xff, 0xff, 0x4b, 0x46, 0xd8, 0x69, 0x07, 0xb0,
+  0xc0, 0xbc, 0x7f, 0xb9, 0x46, 0xb0, 0x46, 0xf0, 0xbd, 0x19, 0xed, 0x00,
+  0xbb, 0x83, 0xff, 0x05, 0x04, 0x80, 0xff, 0x18, 0x05, 0x00, 0x7d, 0xff,
+  0xff, 0x2a, 0x00, 0x00, 0x21, 0x40, 0x46, 0x10, 0xaf, 0x32, 0x2b, 0x61,
+  0x01, 0x3f, 0x00, 0x93, 0x49, 0x01, 0x81, 0xfc, 0x21, 0x02, 0x45, 0x04,
+  0x80, 0x23, 0xdb, 0x05, 0x58, 0x6a, 0xff, 0xeb, 0x69, 0xc1, 0x1a, 0x8a,
+  0x42, 0xdb, 0xd9, 0xff, 0x19, 0x1a, 0x89, 0x18, 0xff, 0xf7, 0xf5, 0xf9,
+  0xf7, 0xd6, 0xe7, 0x0b, 0x37, 0x00, 0x61, 0xff, 0x0a, 0x00, 0xff, 0x01,
+  0x00, 0x40, 0x46, 0xff, 0xf7, 0x6c, 0xfe, 0xbb, 0xaf, 0xe7, 0x29, 0x04,
+  0xd9, 0x60, 0xc9, 0xb7, 0x11, 0x81, 0x11, 0x21, 0x3b, 0x03, 0x43, 0x01,
+  0x4b, 0x05, 0xc4, 0x07, 0x00, 0x47, 0x06, 0x3f, 0x06, 0xf5, 0x01, 0x41,
+  0x0a, 0x12, 0x41, 0x02, 0xe2, 0x6d, 0x13, 0x43, 0xff, 0x10, 0xd1, 0x01,
+  0x23, 0x08, 0x20, 0xe3, 0x65, 0x77, 0xff, 0xf7, 0x4b, 0x09, 0x0a, 0x0b,
+  0xd1, 0xe2, 0x5b, 0x01, 0x7f, 0x08, 0xdd, 0xe3, 0x65, 0x23, 0x68, 0xa3,
+  0x4f, 0x03, 0xba, 0x4b, 0x06, 0x08, 0x69, 0x00, 0x2c, 0xff, 0x07, 0x05,
+  0x00, 0x29, 0xbf, 0xff, 0xe2, 0x68, 0x9b, 0x68, 0x92, 0x51, 0x02, 0xf2,
+  0x5b, 0xd2, 0x04, 0x0f, 0x00, 0x21, 0xff, 0x6b, 0x0c, 0x6c, 0x1b, 0x06,
+  0xfa, 0x03, 0x00, 0x10, 0x67, 0x00, 0xf0, 0xb5, 0x57, 0x46, 0x4e, 0xff,
+  0x46, 0xde, 0x46, 0x45, 0x46, 0xe0, 0xb5, 0x01, 0xff, 0x26, 0x07, 0x22,
+  0x8e, 0x40, 0x93, 0x46, 0x08, 0xff, 0x32, 0x92, 0x46, 0x83, 0xb0, 0x0c,
+  0x3a, 0x01, 0xff, 0x91, 0x04, 0x00, 0x35, 0x00, 0x00, 0x23, 0x02, 0xff,
+  0x21, 0x01, 0x27, 0x91, 0x46, 0x07, 0xe0, 0x40, 0xff, 0x46, 0x22, 0x6a,
+  0x82, 0x43, 0x22, 0x62, 0x6d, 0xff, 0x08, 0x27, 0xd0, 0x89, 0x00, 0x01,
+  0x33, 0x2f, 0xff, 0x42, 0xf9, 0xd0, 0x5a, 0x46, 0x50, 0x46, 0x1a, 0xff,
+  0x40, 0x92, 0x00, 0x90, 0x40, 0x80, 0x46, 0x38, 0xff, 0x00, 0x98, 0x40,
+  0x62, 0x68, 0x82, 0x43, 0x62, 0xff, 0x60, 0xa2, 0x68, 0x58, 0x00, 0x94,
+  0x46, 0x4a, 0xff, 0x46, 0x82, 0x40, 0x10, 0x00, 0x62, 0x46, 0x82, 0xef,
+  0x43, 0xa2, 0x60, 0xe2, 0x17, 0x00, 0x0a, 0x43, 0xe2, 0xfb, 0x60, 0x22,
+  0x07, 0x00, 0x22, 0x60, 0x07, 0x2b, 0xd8, 0x7f, 0xd9, 0x40, 0x46, 0x62,
+  0x6a, 0x6d, 0x08, 0x2d, 0x00, 0xff, 0x62, 0x00, 0x2d, 0xd7, 0xd1, 0x0a,
+  0x20, 0xff, 0xff, 0xf7, 0x89, 0xff, 0x01, 0x9a, 0x23, 0x69, 0x01, 0xff,
+  0x21, 0xd3, 0x40, 0x01, 0x22, 0x1a, 0x40, 0x07, 0xff, 0x23, 0x9b, 0x46,
+  0x08, 0x33, 0x9a, 0x46, 0x0c, 0xff, 0x3b, 0x90, 0x46, 0x99, 0x46, 0x01,
+  0x22, 0x07, 0xff, 0xe0, 0x60, 0x46, 0x23, 0x6a, 0x83, 0x43, 0x23, 0xff,
+  0x62, 0x76, 0x08, 0x24, 0xd0, 0x92, 0x00, 0x01, 0xfb, 0x35, 0x31, 0x7f,
+  0x00, 0x5b, 0x46, 0x57, 0x46, 0x2b, 0xfb, 0x40, 0x9b, 0x2c, 0x01, 0x9f,
+  0x40, 0xa8, 0x40, 0xbc, 0xff, 0x46, 0x4f, 0x46, 0x63, 0x68, 0x83, 0x43,
+  0x68, 0xef, 0x00, 0x87, 0x40, 0x63, 0x0f, 0x02, 0xbb, 0x43, 0xa3, 0xfb,
+  0x60, 0xe3, 0x05, 0x00, 0x13, 0x43, 0xe3, 0x60, 0x23, 0xfe, 0x07, 0x00,
+  0x23, 0x60, 0x07, 0x2d, 0xdb, 0xd9, 0x60, 0xff, 0x46, 0x63, 0x6a, 0x76,
+  0x08, 0x83, 0x43, 0x63, 0xef, 0x62, 0x00, 0x2e, 0xda, 0x79, 0x08, 0x4c,
+  0xff, 0x01, 0xff, 0x9b, 0x22, 0x69, 0x01, 0x20, 0xda, 0x40, 0x01, 0xff,
+  0x23, 0x13, 0x40, 0x98, 0x45, 0x01, 0xd1, 0x43, 0xff, 0x46, 0x58, 0x00,
+  0x03, 0xb0, 0xf0, 0xbc, 0xbb, 0xbf, 0x46, 0xb2, 0x46, 0xa9, 0x46, 0xa0,
+  0x05, 0x02, 0xc0, 0xfd, 0x46, 0x8f, 0x05, 0x1b, 0x49, 0x1c, 0x4b, 0x0a,
+  0x68, 0xff, 0x70, 0xb5, 0x1b, 0x4d, 0x9a, 0x42, 0x04, 0xd1, 0xff, 0x80,
+  0x22, 0x28, 0x00, 0x52, 0x00, 0x02, 0xf0, 0xdf, 0x9e, 0xfa, 0x01, 0x21,
+  0x18, 0x1f, 0x03, 0x58, 0xff, 0xff, 0x04, 0x00, 0x90, 0x20, 0x08, 0x21,
+  0xc0, 0x05, 0xfe, 0xaf, 0x02, 0xff, 0x63, 0x00, 0x1b, 0x19, 0x18, 0x18,
+  0xff, 0x08, 0x28, 0x05, 0xd8, 0x12, 0x4b, 0x80, 0x00, 0xff, 0x1b, 0x58,
+  0x9f, 0x46, 0x02, 0x23, 0x2b, 0x71, 0xdf, 0x28, 0x00, 0x70, 0xbd, 0x07,
+  0x07, 0x00, 0xfa, 0xe7, 0xdd, 0x00, 0x05, 0x00, 0xf7, 0xe7, 0x03, 0x05,
+  0x00, 0xf4, 0xe7, 0xdd, 0x04, 0x05, 0x00, 0xf1, 0xe7, 0x01, 0x05, 0x00,
+  0xee, 0xe7, 0xdd, 0x05, 0x05, 0x00, 0xeb, 0xe7, 0x06, 0x05, 0x00, 0xe8,
+  0xe7, 0xff, 0x00, 0x7c, 0x00, 0x08, 0x01, 0xbe, 0xad, 0xde, 0xff, 0x34,
+  0x14, 0x00, 0x20, 0x00, 0x04, 0x00, 0x48, 0xf9, 0x98, 0x17, 0x12, 0x00,
+  0x14, 0xf8, 0xb5, 0xce, 0x46, 0x47, 0xbf, 0x46, 0x81, 0x46, 0x0e, 0x00,
+  0x80, 0x27, 0x02, 0x3c, 0xaf, 0x4d, 0xab, 0x6d, 0xea, 0x27, 0x02, 0x65,
+  0x27, 0x02, 0x3a, 0xff, 0x4c, 0xeb, 0x65, 0x23, 0x78, 0x1a, 0x1f, 0x01,
+  0xff, 0x2a, 0x61, 0xd8, 0xe0, 0x22, 0x27, 0x00, 0x52, 0xff, 0x05, 0x90,
+  0x46, 0x08, 0x37, 0x00, 0xe0, 0x23, 0xff, 0x78, 0x05, 0x2b, 0x04, 0xd0,
+  0x41, 0x46, 0xe3, 0xff, 0x6b, 0x9a, 0x68, 0x0a, 0x42, 0x1a, 0xd1, 0xeb,
+  0x6f, 0x68, 0xe2, 0x68, 0x1f, 0xc5, 0x02, 0x31, 0x00, 0xff, 0x03, 0xff,
+  0x20, 0xe3, 0x60, 0xff, 0xf7, 0x1d, 0xfe, 0x00, 0xd7, 0x28, 0xeb, 0xd0,
+  0x39, 0x07, 0x34, 0xbb, 0x0b, 0x31, 0xdd, 0x7f, 0xeb, 0x65, 0x2b, 0x68,
+  0xab, 0x42, 0x40, 0x5f, 0x02, 0xfe, 0x13, 0x0f, 0xf8, 0xbd, 0x4a, 0x46,
+  0x98, 0x68, 0x16, 0xff, 0x78, 0x80, 0x01, 0x80, 0x0f, 0xb2, 0x06, 0x24,
+  0xff, 0xd4, 0x4a, 0x46, 0xf4, 0x06, 0x92, 0x88, 0xe4, 0xff, 0x0f, 0x52,
+  0x05, 0x61, 0x00, 0x11, 0x43, 0x00, 0xff, 0x01, 0x1b, 0x18, 0xc2, 0x20,
+  0x32, 0x07, 0x12, 0xff, 0x0f, 0x40, 0x00, 0x1a, 0x50, 0x4a, 0x46, 0x90,
+  0xff, 0x68, 0x1a, 0x00, 0x89, 0x32, 0xff, 0x32, 0x10, 0xaf, 0x60, 0x4a,
+  0x46, 0xd0, 0x0b, 0x00, 0x8d, 0x0b, 0x08, 0x01, 0xff, 0x22, 0x0a, 0x43,
+  0xc0, 0x21, 0x49, 0x00, 0x5a, 0xdd, 0x50, 0x69, 0x04, 0xca, 0xd0, 0x0f,
+  0xa1, 0x02, 0xd0, 0xfd, 0xff, 0x4a, 0x46, 0x51, 0x68, 0xf2, 0x06, 0xd2,
+  0x0f, 0xf7, 0x52, 0x00, 0xc9, 0x49, 0x00, 0x04, 0x22, 0x11, 0x43, 0xb7,
+  0xd7, 0xe7, 0x09, 0x19, 0x00, 0xc3, 0xfd, 0x05, 0x04, 0xc0, 0xbb, 0xfd,
+  0xea, 0xd1, 0x12, 0xb9, 0xd2, 0x06, 0x0f, 0x00, 0xb8, 0x3d, 0xfd, 0xcf,
+  0x06, 0x3c, 0x09, 0x00, 0x20, 0xcf, 0x06, 0xd7, 0x06, 0x9f, 0xc4, 0x65,
+  0x00, 0x08, 0xec, 0xd7, 0x02, 0x20, 0x19, 0xb5, 0xff, 0x85, 0xb0, 0x01,
+  0x9b, 0x0a, 0x4a, 0x5b, 0x0f, 0xff, 0x5b, 0x07, 0x13, 0x43, 0x01, 0x93,
+  0x6b, 0x46, 0xff, 0x3f, 0x22, 0x1b, 0x78, 0x01, 0x21, 0x93, 0x43, 0xff,
+  0x20, 0x22, 0x13, 0x43, 0x6a, 0x46, 0x68, 0x46, 0xff, 0x13, 0x70, 0x49,
+  0x42, 0xff, 0xf7, 0x5b, 0xff, 0x77, 0x05, 0xb0, 0x00, 0xe3, 0x01, 0x73,
+  0x75, 0x72, 0x5e, 0x25, 0xfe, 0x5f, 0x01, 0x47, 0x46, 0xce, 0x46, 0x41,
+  0x4b, 0x41, 0xff, 0x4d, 0x98, 0x46, 0x2b, 0x68, 0x80, 0xb5, 0x5b, 0xff,
+  0x68, 0x40, 0x4f, 0x40, 0x4e, 0x41, 0x4c, 0xbb, 0xff, 0x42, 0x55, 0xd1,
+  0xeb, 0x69, 0x02, 0x2b, 0x13, 0xff, 0xd0, 0x33, 0x68, 0x30, 0x00, 0x1b,
+  0x69, 0x98, 0xff, 0x47, 0x2b, 0x68, 0x3c, 0x4a, 0x1b, 0x69, 0x81, 0xff,
+  0x46, 0x93, 0x42, 0x5e, 0xd1, 0x68, 0x6a, 0x3a, 0xff, 0x49, 0x02, 0xf0,
+  0xb5, 0xfe, 0x01, 0x1c, 0x48, 0xff, 0x46, 0xfe, 0xf7, 0x39, 0xfd, 0x00,
+  0x28, 0x4a, 0xfe, 0x27, 0x00, 0x36, 0x4a, 0x1b, 0x68, 0x93, 0x42, 0x41,
+  0xbf, 0xd1, 0x32, 0x69, 0x35, 0x49, 0x35, 0xbd, 0x00, 0xf1, 0xff, 0xfd,
+  0x81, 0x46, 0x34, 0x4b, 0x35, 0x49, 0x18, 0xff, 0x68, 0x02, 0xf0, 0x51,
+  0xfd, 0x49, 0x46, 0x02, 0xff, 0xf0, 0x4e, 0xfd, 0x03, 0xf0, 0x3a, 0xf8,
+  0x03, 0x6f, 0xf0, 0x58, 0xf8, 0x30, 0x3f, 0x00, 0x47, 0xfd, 0x05, 0x04,
+  0xf7, 0xda, 0xf9, 0x2f, 0x05, 0x00, 0x41, 0xfd, 0x00, 0x21, 0xff, 0x02,
+  0x1c, 0x40, 0x46, 0xff, 0xf7, 0x36, 0xfa, 0x5f, 0x72, 0xb6, 0xa3, 0x6d,
+  0xe2, 0xe5, 0x01, 0x19, 0xe5, 0x01, 0xff, 0x14, 0x21, 0x08, 0x20, 0xe3,
+  0x65, 0xff, 0xf7, 0x77, 0x43, 0xfd, 0xa3, 0x45, 0x01, 0x1e, 0xd1, 0xe2,
+  0xaf, 0x01, 0xff, 0x1b, 0xdd, 0xe3, 0x65, 0x23, 0x68, 0xa3, 0x42, 0xfd,
+  0x1d, 0xaf, 0x01, 0x2b, 0x68, 0x5b, 0x68, 0xbb, 0x42, 0xff, 0xa9, 0xd0,
+  0x28, 0x00, 0x98, 0x47, 0x00, 0x28, 0xdf, 0xbc, 0xd1, 0xa7, 0xe7, 0x1d,
+  0x79, 0x00, 0x1c, 0xfd, 0xfd, 0x30, 0x0f, 0x00, 0x02, 0x1c, 0xba, 0xe7,
+  0xfc, 0x22, 0xdf, 0x00, 0x21, 0x40, 0x46, 0x92, 0xaf, 0x02, 0x0a, 0xfa,
+  0xb7, 0xd2, 0xe7, 0x17, 0x1b, 0x00, 0x0e, 0xfd, 0x2b, 0x04, 0x9e, 0xbb,
+  0xe7, 0xe2, 0x69, 0x11, 0xdc, 0xd2, 0x12, 0x15, 0x00, 0x03, 0xff, 0xfd,
+  0xc0, 0x46, 0x34, 0x15, 0x00, 0x20, 0x70, 0xff, 0x17, 0x00, 0x20, 0xb1,
+  0x1f, 0x00, 0x08, 0x50, 0xf4, 0x0b, 0x00, 0x7b, 0x05, 0xc1, 0x0b, 0x00,
+  0x00, 0x00, 0x48, 0x43, 0xff, 0xd1, 0x1d, 0x00, 0x08, 0x66, 0x66, 0xe6,
+  0x3e, 0xf9, 0x24, 0xa7, 0x06, 0x8f, 0x01, 0x00, 0x00, 0x7a, 0x44, 0xa2,
+  0xff, 0x61, 0xa8, 0xb9, 0x33, 0x33, 0xd3, 0x3f, 0xca, 0x27, 0x26, 0x9b,
+  0x3e, 0x9b, 0x05, 0xa3, 0x05, 0x10, 0x9b, 0x25, 0x00, 0x00, 0xff, 0xf0,
+  0xb5, 0xc6, 0x46, 0x22, 0x48, 0x00, 0xb5, 0xff, 0xff, 0xf7, 0x8a, 0xfd,
+  0x21, 0x4d, 0x22, 0x4b, 0xff, 0x28, 0x00, 0x6b, 0x62, 0x21, 0x4b, 0x40,
+  0x30, 0xff, 0x2b, 0x62, 0xff, 0xf7, 0xd1, 0xf8, 0x28, 0x00, 0x5f, 0x48,
+  0x30, 0xff, 0xf7, 0xcd, 0x07, 0x00, 0x38, 0x07, 0x00, 0xff, 0xc9, 0xf8,
+  0x01, 0x23, 0x98, 0x46, 0x1b, 0x4f, 0xff, 0x1b, 0x4e, 0x1c, 0x4c, 0x31,
+  0x00, 0x28, 0x00, 0xdf, 0x3a, 0x68, 0xff, 0xf7, 0x1f, 0x0d, 0x19, 0x12,
+  0xd1, 0xff, 0xfa, 0x21, 0x43, 0x46, 0x08, 0x20, 0x49, 0x00, 0x56, 0x0f,
+  0x05, 0xbb, 0xfc, 0x0f, 0x05, 0x0b, 0x0f, 0x09, 0x08, 0x0f, 0x11, 0xdd,
+  0x07, 0x0f, 0x01, 0xe2, 0xe7, 0x0e, 0xcd, 0x00, 0x9c, 0xfc, 0xed, 0x0d,
+  0x05, 0x00, 0x99, 0xfc, 0xe3, 0x14, 0xf2, 0xd2, 0x0a, 0xfe, 0x0f, 0x00,
+  0x91, 0xfc, 0xc0, 0x46, 0x10, 0x27, 0x00, 0xfd, 0x00, 0xe3, 0x04, 0x00,
+  0x00, 0x43, 0x44, 0x00, 0x00, 0xc7, 0x96, 0x43, 0xbc, 0xcb, 0x00, 0xeb,
+  0x14, 0xc3, 0x44, 0xf0, 0xb5, 0xff, 0x4e, 0x46, 0x45, 0x46, 0xde, 0x46,
+  0x57, 0x46, 0xff, 0x00, 0x23, 0xe0, 0xb5, 0x89, 0xb0, 0x98, 0x46, 0x7f,
+  0x99, 0x46, 0x00, 0x93, 0x72, 0xb6, 0xce, 0x89, 0x03, 0xff, 0x00, 0x2b,
+  0x00, 0xd0, 0x21, 0xe1, 0xcd, 0x4c, 0xdf, 0x26, 0x00, 0x10, 0x36, 0xeb,
+  0x0d, 0x08, 0x1a, 0xe1, 0xfb, 0x01, 0x33, 0x95, 0x07, 0x04, 0x3b, 0x01,
+  0x2b, 0x00, 0x7f, 0xd9, 0x19, 0xe1, 0x03, 0x23, 0x9a, 0x46, 0x8f, 0x07,
+  0xdf, 0x00, 0xd1, 0xea, 0xe0, 0x51, 0x91, 0x03, 0xda, 0x68, 0xff, 0x11,
+  0x42, 0x00, 0xd1, 0xe0, 0xe0, 0x03, 0x20, 0xf7, 0xda, 0x68, 0x02, 0x09,
+  0x00, 0x0b, 0xe1, 0xd8, 0x22, 0xff, 0xda, 0x21, 0xdc, 0x27, 0x52, 0x00,
+  0x49, 0x00, 0xff, 0x9a, 0x58, 0x59, 0x58, 0x7f, 0x00, 0x01, 0x91, 0x7f,
+  0xd9, 0x59, 0x02, 0xaf, 0x39, 0x61, 0xde, 0x39, 0x03, 0xff, 0x59, 0x58,
+  0x20, 0x21, 0xd9, 0x60, 0xd9, 0x68, 0xff, 0x01, 0x42, 0x03, 0xd1, 0x02,
+  0x20, 0x59, 0x69, 0xff, 0x08, 0x43, 0x58, 0x61, 0x01, 0x21, 0x53, 0x08,
+  0x7f, 0x0b, 0x40, 0x99, 0x46, 0x0f, 0x20, 0x93, 0x07, 0x00, 0xff, 0x98,
+  0x46, 0x3b, 0x79, 0x1f, 0x31, 0x83, 0x43, 0xff, 0x48, 0x46, 0x00, 0x01,
+  0x82, 0x46, 0x00, 0x98, 0xff, 0x03, 0x43, 0x10, 0x20, 0x83, 0x43, 0x50,
+  0x46, 0xff, 0x03, 0x43, 0x40, 0x46, 0xdb, 0xb2, 0x40, 0x01, 0x7f, 0x8b,
+  0x43, 0x03, 0x43, 0x3b, 0x71, 0x0b, 0x69, 0x00, 0xbf, 0xf7, 0xe0, 0xbb,
+  0x68, 0xd2, 0x08, 0x25, 0x0f, 0xbb, 0xff, 0x60, 0x0f, 0x23, 0x01, 0x9a,
+  0x1a, 0x40, 0x00, 0xdd, 0x92, 0xc3, 0x0c, 0xe6, 0xe0, 0xea, 0x45, 0x01,
+  0x00, 0xdc, 0xff, 0xe2, 0xe0, 0xeb, 0x65, 0x2b, 0x68, 0xab, 0x42, 0xff,
+  0x00, 0xd0, 0x25, 0xe1, 0x62, 0xb6, 0x0f, 0x22, 0xff, 0x02, 0xaf, 0x3b,
+  0x79, 0x00, 0x98, 0x93, 0x43, 0xff, 0x4a, 0x46, 0x11, 0x01, 0x10, 0x22,
+  0x03, 0x43, 0xff, 0x93, 0x43, 0x0b, 0x43, 0x42, 0x46, 0x20, 0x21, 0xf5,
+  0x52, 0x57, 0x00, 0x13, 0x57, 0x10, 0x9c, 0xe0, 0xba, 0x68, 0xff, 0xd2,
+  0x00, 0xd1, 0x08, 0xd2, 0x0d, 0xef, 0x2a, 0xff, 0x00, 0xd0, 0x95, 0xe0,
+  0x01, 0x28, 0x03, 0xd9, 0xf7, 0x89, 0x4a, 0x91, 0x19, 0x00, 0xcd, 0xe0,
+  0x0f, 0x22, 0xfb, 0x13, 0x40, 0x07, 0x01, 0xd0, 0x8a, 0xe0, 0xef, 0x23,
+  0xf7, 0x1b, 0x05, 0x99, 0x13, 0x00, 0x2b, 0xe1, 0x83, 0x4b, 0xfe, 0x07,
+  0x00, 0xd0, 0x81, 0xe0, 0xff, 0xf7, 0x4a, 0xfd, 0xff, 0x81, 0x4b, 0x18,
+  0x60, 0x3b, 0x7c, 0x03, 0x71, 0xff, 0x80, 0x4b, 0x1a, 0x69, 0x12, 0x06,
+  0x03, 0xd5, 0xef, 0x7f, 0x4a, 0x5a, 0x60, 0x03, 0x04, 0x01, 0x21, 0x7c,
+  0xff, 0x4b, 0xda, 0x68, 0x0a, 0x42, 0xfc, 0xd1, 0x02, 0xff, 0x22, 0x19,
+  0x69, 0x0a, 0x43, 0x1a, 0x61, 0xf8, 0xbf, 0x22, 0xd2, 0x01, 0x5a, 0x61,
+  0x40, 0x0d, 0x10, 0xc0, 0xef, 0x46, 0x01, 0x21, 0x73, 0x21, 0x14, 0x21,
+  0x1a, 0x69, 0xbd, 0x8a, 0x13, 0x00, 0x1a, 0x69, 0x7e, 0x31, 0x1b, 0x04,
+  0x1a, 0x3f, 0x69, 0x0a, 0x42, 0x03, 0xd0, 0x6d, 0x45, 0x00, 0x03, 0x04,
+  0xff, 0x01, 0x22, 0x69, 0x49, 0xcb, 0x68, 0x18, 0x00, 0xff, 0x10, 0x40,
+  0x13, 0x42, 0xfa, 0xd1, 0x69, 0x4b, 0xff, 0xab, 0x46, 0x9a, 0x46, 0x69,
+  0x4b, 0x80, 0x27, 0xff, 0x1d, 0x00, 0x23, 0x00, 0x01, 0x21, 0x54, 0x46,
+  0xfd, 0xdc, 0x0f, 0x00, 0x61, 0x4a, 0x7f, 0x00, 0x23, 0x5a, 0xff, 0x9b,
+  0x46, 0x13, 0x69, 0x0b, 0x43, 0x13, 0x61, 0x7f, 0x5b, 0x46, 0x2b, 0x52,
+  0xd3, 0x68, 0x0b, 0x59, 0x00, 0xef, 0x13, 0x69, 0x02, 0x30, 0xe7, 0x00,
+  0x61, 0xb8, 0x42, 0xff, 0xef, 0xd1, 0x80, 0x23, 0x11, 0x69, 0x65, 0x46,
+  0xfa, 0x1f, 0x04, 0x54, 0xa1, 0x03, 0xc5, 0xfd, 0x21, 0xe0, 0x1a, 0xfd,
+  0x69, 0xc9, 0x01, 0xd0, 0x1a, 0xe7, 0xef, 0x68, 0x63, 0xff, 0x69, 0x3e,
+  0x60, 0x7b, 0x60, 0x1f, 0x60, 0xab, 0x7f, 0x6d, 0x67, 0x61, 0x00, 0x2b,
+  0x1c, 0xd1, 0x09, 0x06, 0xff, 0x19, 0xdd, 0x04, 0x20, 0xff, 0xf7, 0x31,
+  0xfb, 0xbb, 0xfb, 0x69, 0x5f, 0x01, 0xd1, 0xfd, 0xe6, 0x67, 0x05, 0x33,
+  0xad, 0xd1, 0x65, 0x05, 0x30, 0xdd, 0x63, 0x0d, 0x36, 0xab, 0x02, 0x72,
+  0xbd, 0xb6, 0x7f, 0x09, 0xd1, 0xe0, 0xe6, 0x45, 0x9d, 0x02, 0x42, 0xeb,
+  0xfb, 0x44, 0x05, 0x00, 0x3f, 0x05, 0x08, 0x3c, 0xfb, 0x1a, 0xfd, 0x69,
+  0x1f, 0x06, 0x2e, 0xe7, 0xe0, 0x22, 0xe2, 0x21, 0xf5, 0xe4, 0x1f, 0x42,
+  0xe6, 0x1f, 0x12, 0x19, 0x61, 0x19, 0x69, 0xdd, 0x01, 0x89, 0x00, 0xf2,
+  0xe6, 0x10, 0x21, 0x12, 0xed, 0xe6, 0xfd, 0x34, 0x41, 0x00, 0x1b, 0xfb,
+  0x3b, 0x89, 0x52, 0x0d, 0xef, 0xdb, 0x0a, 0xdb, 0x02, 0xa9, 0x01, 0x81,
+  0x06, 0xe7, 0xdd, 0xea, 0x09, 0x13, 0xc3, 0xd2, 0x2e, 0x1d, 0x00, 0x0c,
+  0xfb, 0xff, 0x38, 0x7c, 0x02, 0xf0, 0x15, 0xfe, 0x2c, 0x4b, 0xff, 0x2c,
+  0x49, 0x9b, 0x46, 0x82, 0x46, 0x02, 0xf0, 0xff, 0x01, 0xfb, 0x5b, 0x46,
+  0x2a, 0x49, 0x18, 0x60, 0xff, 0x50, 0x46, 0xfe, 0xf7, 0xb3, 0xfa, 0x02,
+  0x23, 0xff, 0x00, 0x28, 0x03, 0xd1, 0x01, 0x21, 0x7a, 0x7c, 0xff, 0x0a,
+  0x40, 0x9b, 0x1a, 0x25, 0x4a, 0x13, 0x60, 0xff, 0x00, 0x9b, 0x02, 0x2b,
+  0xa6, 0xd0, 0x24, 0x4b, 0xf7, 0xb8, 0x7c, 0x9a, 0x2d, 0x00, 0xf8, 0xfd,
+  0x22, 0x49, 0xff, 0x02, 0xf0, 0xe7, 0xfa, 0xfe, 0x21, 0x89, 0x05, 0xff,
+  0x07, 0x1c, 0xfe, 0xf7, 0xa4, 0xfa, 0x00, 0x28, 0xff, 0x01, 0xd1, 0xfe,
+  0x27, 0xbf, 0x05, 0x00, 0x21, 0xf5, 0x38, 0x0f, 0x00, 0xb0, 0x0f, 0x00,
+  0x00, 0xd1, 0x00, 0x27, 0xdf, 0x53, 0x46, 0x1f, 0x60, 0x8b, 0x7b, 0x18,
+  0x00, 0xd3, 0xbf, 0xd3, 0xe6, 0xbf, 0xe7, 0xc0, 0x46, 0x6b, 0x07, 0x3c,
+  0xfe, 0x77, 0x03, 0x00, 0x00, 0xf5, 0x0e, 0x00, 0x00, 0xf4, 0xf7, 0x0e,
+  0x68, 0x0b, 0x0b, 0x00, 0x20, 0x02, 0x40, 0x23, 0xff, 0x01, 0x67, 0x45,
+  0xab, 0x89, 0xef, 0xcd, 0x34, 0x5d, 0x14, 0x0f, 0x00, 0x7c, 0x00, 0x08,
+  0x8f, 0x07, 0x80, 0x03, 0x00, 0xab, 0x34, 0x65, 0x97, 0x0f, 0xec, 0x97,
+  0x03, 0x20, 0x1b, 0x00, 0xcd, 0x7f, 0xcc, 0xcc, 0x3d, 0x00, 0x00, 0x8c,
+  0x42, 0xbb, 0x07, 0xfd, 0x00, 0x03, 0x00, 0x0a, 0xd7, 0x23, 0x3c, 0x3f,
+  0x7c, 0xff, 0xff, 0x2f, 0x05, 0xd0, 0xff, 0xf7, 0x1f, 0xfc, 0xf7, 0x03,
+  0x79, 0xbb, 0x0f, 0x01, 0x50, 0xe7, 0xff, 0xf7, 0xf7, 0xf1, 0xfc, 0x32,
+  0x85, 0x01, 0x4e, 0xfb, 0xbf, 0xf3, 0xff, 0x4f, 0x8f, 0x03, 0x4b, 0x04,
+  0x4a, 0xda, 0x60, 0xee, 0x09, 0x04, 0xc0, 0x46, 0xfd, 0x83, 0x00, 0x00,
+  0xed, 0x00, 0xff, 0xe0, 0x04, 0x00, 0xfa, 0x05, 0x06, 0x4b, 0x10, 0xfb,
+  0xb5, 0x9a, 0x97, 0x01, 0x04, 0xd1, 0xd9, 0x6d, 0x00, 0xff, 0x29, 0x01,
+  0xdd, 0xda, 0x65, 0x10, 0xbd, 0x02, 0xa6, 0x21, 0x01, 0x7b, 0xfa, 0xa7,
+  0x0c, 0x77, 0x04, 0x00, 0x00, 0x20, 0x05, 0xfe, 0x2f, 0x08, 0xd9, 0x6d,
+  0x0a, 0x43, 0x02, 0xd1, 0x01, 0xcd, 0x22, 0x2d, 0x14, 0x64, 0xfa, 0x2b,
+  0x04, 0xaf, 0x04, 0xf0, 0xb5, 0xff, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46,
+  0x45, 0x46, 0xff, 0xe0, 0xb5, 0x8f, 0xb0, 0x72, 0xb6, 0xff, 0xf7, 0xff,
+  0xe6, 0xff, 0x80, 0x23, 0xdb, 0x05, 0x5b, 0x6a, 0x6f, 0xb5, 0x4d, 0x01,
+  0x93, 0x6f, 0x0f, 0x36, 0xe1, 0x6f, 0x0f, 0xeb, 0x32, 0xe1, 0x6f, 0x17,
+  0x51, 0x6f, 0x03, 0xae, 0x4b, 0xae, 0xbf, 0x4e, 0x03, 0x93, 0xae, 0x4b,
+  0x04, 0x03, 0x00, 0x9b, 0xaf, 0x46, 0xae, 0x4b, 0x05, 0x07, 0x00, 0x9a,
+  0x07, 0x00, 0x06, 0xea, 0x07, 0x00, 0x07, 0x03, 0x00, 0x08, 0x03, 0x00,
+  0x09, 0x93, 0x03, 0xff, 0x9b, 0x37, 0x68, 0x1b, 0x68, 0x04, 0x9a, 0x1c,
+  0xff, 0x79, 0x3b, 0x68, 0xc8, 0x34, 0x64, 0x00, 0x93, 0xfe, 0x3d, 0x00,
+  0x16, 0xe1, 0x33, 0x69, 0x99, 0x46, 0x5b, 0xff, 0x46, 0xdb, 0x68, 0x05,
+  0x9a, 0x02, 0x93, 0xbb, 0xfd, 0x68, 0x13, 0x04, 0x07, 0xe1, 0xa4, 0x49,
+  0x70, 0x69, 0xfe, 0xe3, 0x01, 0xfa, 0x80, 0x46, 0x40, 0x46, 0xa2, 0x49,
+  0xff, 0xfe, 0xf7, 0xdc, 0xf9, 0x00, 0x28, 0x1b, 0xd1, 0xd7, 0x40, 0x46,
+  0xa0, 0x0b, 0x00, 0xc2, 0x0b, 0x00, 0x00, 0xd0, 0x5f, 0x05, 0xe1, 0x00,
+  0x21, 0x40, 0xef, 0x01, 0xbb, 0x0d, 0x08, 0xdf, 0x02, 0xe1, 0x9a, 0x49,
+  0x40, 0xdb, 0x01, 0xfc, 0xf9, 0xff, 0x99, 0x49, 0x01, 0xf0, 0x8f, 0xfe,
+  0x01, 0x1c, 0xff, 0xfe, 0x20, 0x80, 0x05, 0x02, 0xf0, 0x2a, 0xf8, 0xef,
+  0x80, 0x46, 0x02, 0xe0, 0xc3, 0x04, 0x98, 0x46, 0x48, 0xeb, 0x46, 0x93,
+  0x3d, 0x00, 0xb7, 0x2f, 0x00, 0x06, 0xd0, 0x48, 0xeb, 0x46, 0x91, 0x0b,
+  0x00, 0x9d, 0x3b, 0x08, 0xac, 0xe0, 0x00, 0xff, 0x23, 0x0a, 0x93, 0x0a,
+  0xab, 0x9b, 0x88, 0x0a, 0xfd, 0xaa, 0x73, 0x06, 0x23, 0x43, 0x93, 0x80,
+  0x08, 0x23, 0xff, 0x00, 0x21, 0x13, 0x70, 0x0c, 0xa8, 0x08, 0x22, 0xef,
+  0x01, 0xf0, 0xaa, 0xfd, 0x70, 0x03, 0x20, 0x98, 0x46, 0xff, 0xa0, 0x23,
+  0x0a, 0xaa, 0x13, 0x72, 0x50, 0x81, 0xff, 0x3b, 0x69, 0x30, 0x00, 0x98,
+  0x47, 0x01, 0xf0, 0xff, 0x44, 0xfe, 0x0a, 0xab, 0x98, 0x81, 0x53, 0x46,
+  0xdf, 0x1b, 0x68, 0x06, 0x9a, 0x5b, 0xb7, 0x08, 0x80, 0xe0, 0x5f, 0x53,
+  0x46, 0xdb, 0x69, 0x02, 0x15, 0x03, 0x80, 0x53, 0x00, 0xff, 0xfa, 0x21,
+  0x0a, 0xaa, 0x53, 0x72, 0x10, 0x00, 0xff, 0x89, 0x00, 0xff, 0xf7, 0x7a,
+  0xfb, 0x00, 0x22, 0xff, 0x0a, 0xab, 0x0a, 0x92, 0x9b, 0x88, 0x01, 0x34,
+  0xbe, 0x63, 0x04, 0x1c, 0x43, 0x0a, 0xab, 0x9c, 0x65, 0x00, 0x0a, 0xff,
+  0xa9, 0x0b, 0x70, 0x33, 0x68, 0xca, 0x73, 0x5b, 0xf7, 0x69, 0x07, 0x9a,
+  0x41, 0x04, 0x94, 0xe0, 0xf1, 0x68, 0xbf, 0x6c, 0x48, 0x01, 0xf0, 0xce,
+  0xff, 0x9d, 0x06, 0x02, 0xbf, 0xf0, 0xe2, 0xfa, 0x01, 0x1c, 0x69, 0x0f,
+  0x00, 0xc6, 0xfb, 0xff, 0x68, 0xb3, 0x02, 0xdb, 0xfa, 0x01, 0xf0, 0x09,
+  0xbe, 0x75, 0x00, 0x18, 0x81, 0x66, 0x49, 0x48, 0xed, 0x00, 0x85, 0xef,
+  0xf9, 0x01, 0xf0, 0x01, 0x0f, 0x00, 0x58, 0x81, 0x63, 0xbf, 0x49, 0x02,
+  0x98, 0x02, 0xf0, 0x7d, 0x0f, 0x00, 0xf9, 0xfd, 0xfd, 0x1f, 0x00, 0x73,
+  0x08, 0x9b, 0x0a, 0xaa, 0x1b, 0xff, 0x78, 0x5d, 0x49, 0x53, 0x73, 0x52,
+  0x46, 0x60, 0xff, 0x23, 0xd3, 0x5c, 0x09, 0x9a, 0x02, 0x33, 0x94, 0xff,
+  0x46, 0x9b, 0x00, 0x63, 0x44, 0x58, 0x68, 0x02, 0xdb, 0xf0, 0x69, 0x27,
+  0x00, 0xe5, 0xfd, 0x9f, 0x00, 0xab, 0x98, 0xef, 0x73, 0x89, 0x00, 0x18,
+  0x9f, 0x00, 0x2a, 0xfb, 0x01, 0xf7, 0x9c, 0x64, 0x34, 0xd3, 0x07, 0xea,
+  0x6d, 0x13, 0x43, 0xbf, 0x54, 0xd1, 0x01, 0x23, 0xeb, 0x65, 0xf9, 0x0d,
+  0x01, 0xff, 0x9a, 0x9a, 0x1a, 0x63, 0x2a, 0x0b, 0xd8, 0xe1, 0xbf, 0x1a,
+  0x9c, 0x42, 0x51, 0xd0, 0x08, 0x93, 0x02, 0x5c, 0xdd, 0xf9, 0x09, 0x06,
+  0x32, 0xd1, 0xeb, 0x05, 0x00, 0x2f, 0xdd, 0xf9, 0x00, 0x29, 0x00, 0x07,
+  0x06, 0x46, 0xd1, 0x62, 0xb6, 0x01, 0x7f, 0x94, 0x0d, 0xe7, 0x50, 0x46,
+  0x98, 0x47, 0x3f, 0x07, 0xff, 0x7e, 0xe7, 0x43, 0x46, 0x7d, 0xe7, 0x40,
+  0x46, 0x6d, 0x3d, 0x67, 0x01, 0xfd, 0xf8, 0x11, 0x04, 0x4b, 0xe7, 0x67,
+  0x6d, 0x5f, 0xf6, 0xfc, 0x40, 0x46, 0x33, 0xe5, 0x00, 0x1a, 0x9d, 0x00,
+  0xff, 0x96, 0xfd, 0x01, 0x23, 0x80, 0xb2, 0x98, 0x46, 0xb7, 0x44, 0xe7,
+  0x2f, 0xa1, 0x02, 0x13, 0xf9, 0x71, 0x05, 0x37, 0xdf, 0x68, 0x80, 0x46,
+  0xf7, 0xe6, 0x09, 0x0c, 0x81, 0x46, 0xdd, 0xe5, 0x09, 0x08, 0x76, 0xe7,
+  0x28, 0x1f, 0x00, 0x03, 0xf9, 0xf7, 0xfc, 0x23, 0x9b, 0xe1, 0x01, 0x0d,
+  0xe7, 0x26, 0x49, 0xb7, 0xfb, 0xe6, 0x26, 0x11, 0x00, 0xfa, 0xf8, 0xb7,
+  0x17, 0xb3, 0xeb, 0xd2, 0x23, 0x0f, 0x00, 0xf2, 0x0f, 0x18, 0x00, 0xd3,
+  0xa7, 0x9b, 0xe6, 0x1f, 0x11, 0x00, 0xe9, 0xf8, 0x23, 0x0f, 0xbf, 0x07,
+  0x50, 0x9f, 0x15, 0x00, 0x20, 0xd1, 0x1d, 0xab, 0x03, 0x07, 0x00, 0xf1,
+  0xfe, 0x07, 0x00, 0x70, 0x17, 0x00, 0x20, 0xb1, 0x1f, 0x00, 0xc7, 0x08,
+  0x01, 0x1e, 0xc7, 0x03, 0xdf, 0x07, 0x27, 0x00, 0xff, 0xc8, 0xff, 0xce,
+  0xbf, 0x7b, 0x14, 0x8e, 0x3f, 0x00, 0x00, 0xff, 0x60, 0xc0, 0x8a, 0x76,
+  0xe5, 0xbe, 0xfc, 0xde, 0xff, 0x7e, 0x3f, 0x33, 0x33, 0xb3, 0x3e, 0xcd,
+  0xcc, 0xfd, 0x0c, 0x07, 0x00, 0x53, 0x40, 0x00, 0xe0, 0xab, 0x46, 0xff,
+  0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x7a, 0x44, 0xff, 0x00, 0x00, 0x7f,
+  0x43, 0x9a, 0x99, 0x19, 0x3f, 0xcf, 0x00, 0x40, 0x1c, 0x46, 0x83, 0x07,
+  0x5b, 0x07, 0x11, 0xe4, 0x7f, 0x90, 0xbe, 0xd4, 0x66, 0x00, 0x08, 0x10,
+  0x03, 0x00, 0xf9, 0x74, 0x97, 0x13, 0x6f, 0x27, 0x0a, 0x20, 0x83, 0xb0,
+  0xff, 0xf7, 0xf7, 0x56, 0xf9, 0x75, 0x07, 0x2b, 0xfe, 0xfe, 0xf7, 0xff,
+  0x19, 0xfb, 0x80, 0x4b, 0x00, 0x93, 0x1b, 0x78, 0xfe, 0x4d, 0x02, 0xd0,
+  0xdb, 0xe0, 0x00, 0x9a, 0x7d, 0x4b, 0xff, 0x93, 0x60, 0x98, 0x46, 0x18,
+  0x23, 0xd3, 0x60, 0xff, 0x7c, 0x4b, 0x13, 0x61, 0x99, 0x46, 0x03, 0x23,
+  0xff, 0x13, 0x70, 0xfe, 0xf7, 0x7e, 0xfa, 0xfe, 0xf7, 0x7f, 0xe4, 0xfa,
+  0x72, 0xb6, 0x78, 0x4e, 0xb3, 0x9d, 0x0b, 0xf7, 0xa9, 0xe0, 0xf3, 0x07,
+  0x08, 0xa5, 0xe0, 0x01, 0x23, 0xff, 0x74, 0x4a, 0xf3, 0x65, 0x93, 0x68,
+  0x11, 0x68, 0xde, 0x0f, 0x00, 0xda, 0xa0, 0xe0, 0x91, 0x5d, 0x02, 0xbd,
+  0xe0, 0xff, 0x01, 0x3b, 0x8b, 0x60, 0x01, 0x33, 0x00, 0xd1, 0xeb, 0x9c,
+  0xe0, 0x2f, 0x0c, 0xab, 0xa7, 0x02, 0xf3, 0x65, 0x33, 0xfb, 0x68, 0xb3,
+  0x1d, 0x00, 0xb9, 0xe0, 0x62, 0xb6, 0x41, 0xff, 0x46, 0x43, 0x46, 0x00,
+  0x27, 0x90, 0x31, 0x1a, 0xff, 0x88, 0x06, 0x33, 0xbf, 0x18, 0x99, 0x42,
+  0xfa, 0xff, 0xd1, 0x41, 0x46, 0x00, 0x24, 0x62, 0x4b, 0x92, 0x7a, 0x11,
+  0x08, 0xa4, 0x11, 0x14, 0x25, 0x5f, 0x4b, 0x94, 0x11, 0x08, 0xfd, 0xad,
+  0x11, 0x08, 0x80, 0x23, 0x5c, 0x4a, 0x51, 0x69, 0xff, 0x4b, 0x40, 0x53,
+  0x61, 0x72, 0xb6, 0xb3, 0x6d, 0xfd, 0xf2, 0x41, 0x02, 0x65, 0xd1, 0x01,
+  0x33, 0xf3, 0x65, 0xdb, 0x00, 0x9b, 0xbf, 0x0c, 0x95, 0xe0, 0x55, 0x00,
+  0x9a, 0x93, 0xbd, 0x60, 0xbd, 0x04, 0x4b, 0x46, 0x13, 0x61, 0xbb, 0x0c,
+  0x20, 0xfd, 0xfa, 0x7b, 0x14, 0x74, 0xd1, 0x38, 0x00, 0x02, 0xf0, 0xf7,
+  0x7e, 0xfb, 0x4b, 0xfd, 0x01, 0x1b, 0xf8, 0x62, 0xb6, 0xff, 0x4a, 0x4f,
+  0x01, 0x90, 0xb9, 0x68, 0x01, 0xf0, 0xf7, 0xab, 0xfc, 0xfc, 0x05, 0x0b,
+  0x11, 0xf8, 0x7b, 0x68, 0xff, 0x83, 0x46, 0x19, 0x1c, 0x9a, 0x46, 0x01,
+  0xf0, 0xfd, 0xa1, 0x13, 0x10, 0x07, 0xf8, 0x51, 0x46, 0x38, 0x61, 0xfd,
+  0x58, 0x05, 0x03, 0x50, 0xf9, 0x40, 0x00, 0x3f, 0x49, 0xff, 0x40, 0x08,
+  0x01, 0xf0, 0xfd, 0xff, 0x3e, 0x49, 0xf7, 0x83, 0x46, 0xf8, 0x39, 0x00,
+  0xf8, 0xff, 0x01, 0x1c, 0x7d, 0x58, 0x2d, 0x00, 0x8a, 0xfc, 0xf8, 0x60,
+  0x20, 0x5b, 0x00, 0xdf, 0x50, 0xfb, 0x04, 0x1c, 0x28, 0x07, 0x00, 0x4c,
+  0xfb, 0xff, 0x01, 0x1c, 0x20, 0x1c, 0x02, 0xf0, 0x36, 0xf9, 0xfb, 0x34,
+  0x49, 0x03, 0x03, 0xff, 0x34, 0x49, 0x04, 0x1c, 0xdf, 0x78, 0x69, 0x01,
+  0xf0, 0xe0, 0x2f, 0x00, 0x20, 0x1c, 0xff, 0x01, 0xf0, 0x72, 0xfc, 0x53,
+  0x46, 0xbb, 0x60, 0x3f, 0x01, 0x9b, 0x78, 0x61, 0x7b, 0x60, 0xcb, 0x04,
+  0x23, 0x01, 0xff, 0xd1, 0x55, 0xe7, 0x2b, 0x48, 0xfd, 0xf7, 0xd1, 0xff,
+  0xff, 0x91, 0x42, 0x1d, 0xd0, 0x01, 0x3b, 0x93, 0xff, 0x60, 0xf3, 0x68,
+  0x51, 0x68, 0x1a, 0x60, 0x59, 0xff, 0x60, 0xda, 0x61, 0x0b, 0x60, 0x01,
+  0x21, 0x53, 0x3f, 0x60, 0x05, 0x20, 0x49, 0x42, 0xfe, 0x1f, 0x00, 0x2d,
+  0x04, 0x7b, 0x03, 0xd1, 0x7f, 0x09, 0xdd, 0x53, 0xe7, 0x1f, 0x33, 0x00,
+  0x77, 0xb7, 0xff, 0x05, 0x3f, 0x00, 0x20, 0xe7, 0x1d, 0x0b, 0x00, 0xbb,
+  0xb1, 0xff, 0x05, 0x04, 0xae, 0xff, 0xf2, 0x87, 0x12, 0x85, 0xeb, 0xd2,
+  0x1a, 0x0f, 0x00, 0xa6, 0x0f, 0x18, 0x00, 0xd3, 0x3f, 0xeb, 0xe7, 0x16,
+  0x11, 0x00, 0x9d, 0x33, 0x08, 0x66, 0xe7, 0xe4, 0xff, 0xe7, 0xc0, 0x46,
+  0x18, 0x09, 0x00, 0x20, 0x70, 0xde, 0x93, 0x02, 0xd8, 0x64, 0x00, 0x08,
+  0xab, 0x0a, 0x12, 0x00, 0xeb, 0x20, 0x72, 0x0f, 0x00, 0x74, 0x03, 0x00,
+  0x00, 0x04, 0x00, 0xdf, 0x48, 0xbe, 0xa4, 0x50, 0x37, 0xbb, 0x06, 0x6f,
+  0x12, 0xff, 0x03, 0x3b, 0xee, 0x7c, 0x7f, 0x3f, 0x9c, 0x44, 0x3f, 0x34,
+  0x35, 0x48, 0xe1, 0x7a, 0x3f, 0x6f, 0x06, 0x77, 0x06, 0xd5, 0x5c, 0x6b,
+  0x02, 0x90, 0x03, 0x00, 0xa4, 0x03, 0x00, 0x1c, 0x67, 0x7f, 0x00, 0x08,
+  0xf8, 0xb5, 0x05, 0x00, 0x0c, 0xcc, 0x02, 0xfb, 0x1f, 0x00, 0x65, 0x06,
+  0xf8, 0xfc, 0x20, 0x00, 0x20, 0xff, 0x38, 0x28, 0x18, 0x01, 0x00, 0x00,
+  0x23, 0x24, 0xff, 0x39, 0x45, 0x61, 0xc1, 0x60, 0x4b, 0x61, 0x32, 0xff,
+  0x4b, 0x32, 0x4c, 0x0b, 0x62, 0x02, 0x23, 0x0f, 0xff, 0x61, 0x03, 0x83,
+  0xa3, 0x6d, 0x86, 0x60, 0x04, 0xbf, 0x61, 0x00, 0x2b, 0x33, 0xd1, 0xe3,
+  0xd3, 0x00, 0x30, 0xff, 0xdd, 0xe1, 0x68, 0x23, 0x68, 0x8a, 0x68, 0xa3,
+  0xff, 0x42, 0x37, 0xd1, 0x00, 0x23, 0xc3, 0x61, 0x96, 0xff, 0x42, 0x39,
+  0xd9, 0x0d, 0x7e, 0x00, 0x2d, 0x2a, 0xff, 0xd0, 0x0f, 0x2d, 0x28, 0xd0,
+  0x0b, 0x76, 0x0b, 0xff, 0x69, 0x1b, 0x68, 0x9d, 0x68, 0xaa, 0x42, 0xfb,
+  0xff, 0xd3, 0x5a, 0x68, 0x0b, 0x60, 0x4a, 0x60, 0x11, 0xfe, 0x21, 0x01,
+  0x01, 0x23, 0xe0, 0x60, 0x03, 0x76, 0xef, 0xff, 0xf3, 0x09, 0x83, 0x4a,
+  0x69, 0x24, 0x3b, 0x9a, 0xff, 0x42, 0x11, 0xd8, 0xfd, 0xf7, 0x01, 0xfe,
+  0xa3, 0xfa, 0x4d, 0x00, 0x12, 0x53, 0x08, 0x0f, 0xdd, 0x00, 0x23, 0xe3,
+  0xfb, 0x65, 0x23, 0x53, 0x00, 0x1f, 0xd1, 0x62, 0xb6, 0xf8, 0xdb, 0xbd,
+  0x14, 0xff, 0x00, 0x1d, 0xff, 0x05, 0x04, 0x1a, 0xff, 0x75, 0x13, 0x05,
+  0x00, 0x17, 0x05, 0x08, 0x14, 0xff, 0x9b, 0x1f, 0x01, 0xf7, 0xc4, 0xd2,
+  0x11, 0x0b, 0x00, 0x0e, 0xff, 0x03, 0x76, 0xff, 0x23, 0x00, 0x1b, 0x68,
+  0x9a, 0x68, 0x96, 0x42, 0xff, 0xfb, 0xd9, 0x5a, 0x68, 0x03, 0x60, 0x42,
+  0x60, 0x7f, 0x10, 0x60, 0x58, 0x60, 0xda, 0xe7, 0xe2, 0x47, 0x11, 0xf7,
+  0xda, 0xd2, 0x08, 0x27, 0x00, 0xfa, 0xfe, 0xc9, 0x19, 0x6a, 0x33, 0x0d,
+  0x80, 0x07, 0x01, 0x88, 0x03, 0x00, 0x70, 0x65, 0x13, 0x0d, 0xf1, 0xf0,
+  0x07, 0x00, 0x83, 0x07, 0x7f, 0x07, 0xf8, 0xb5, 0xce, 0x46, 0xff, 0x47,
+  0x46, 0x04, 0x00, 0x0e, 0x00, 0x80, 0xb5, 0xbf, 0x00, 0x28, 0x00, 0xd1,
+  0xc9, 0xe0, 0x17, 0x05, 0x6c, 0xff, 0xfc, 0x22, 0x78, 0x53, 0x1e, 0x01,
+  0x2b, 0x00, 0xfb, 0xd9, 0xc1, 0x1d, 0x03, 0x77, 0x68, 0x66, 0x60, 0xa7,
+  0xff, 0x60, 0xe3, 0x60, 0x01, 0x2a, 0x00, 0xd1, 0x92, 0xff, 0xe0, 0xe5,
+  0x69, 0x2b, 0x60, 0x6b, 0x63, 0xab, 0xff, 0x63, 0xeb, 0x63, 0x2b, 0x64,
+  0x6b, 0x62, 0x63, 0xff, 0x69, 0x98, 0x46, 0x33, 0x68, 0x40, 0x46, 0x19,
+  0xff, 0x00, 0x99, 0x46, 0xfd, 0xf7, 0xd8, 0xfd, 0x80, 0xbf, 0x22, 0x43,
+  0x1e, 0x52, 0x02, 0x93, 0xcb, 0x01, 0xaf, 0xff, 0xe0, 0x4a, 0x46, 0x50,
+  0x43, 0x80, 0x45, 0x00, 0xff, 0xd0, 0xaa, 0xe0, 0x0f, 0x22, 0xab, 0x62,
+  0xf3, 0xbf, 0x6a, 0x01, 0x3f, 0xef, 0x62, 0x6b, 0x3b, 0x02, 0x98, 0xd7,
+  0x46, 0x1a, 0x40, 0x4b, 0x04, 0x9c, 0x5b, 0x00, 0x02, 0x2a, 0xff, 0x01,
+  0xd1, 0x01, 0x23, 0x13, 0x43, 0x0f, 0x22, 0xf7, 0x77, 0x69, 0x3a, 0x15,
+  0x00, 0x03, 0xd0, 0x02, 0x2a, 0xff, 0x03, 0xd1, 0x1e, 0x32, 0x13, 0x43,
+  0x10, 0x22, 0xae, 0x15, 0x04, 0xf0, 0x69, 0x02, 0x15, 0x00, 0x04, 0x15,
+  0x00, 0x05, 0xef, 0xd1, 0xff, 0x32, 0xff, 0x17, 0x00, 0x80, 0x22, 0x52,
+  0xff, 0x00, 0x13, 0x43, 0x72, 0x6a, 0x94, 0x46, 0x0f, 0xef, 0x22, 0x61,
+  0x46, 0x0a, 0x1d, 0x18, 0x80, 0x22, 0x92, 0xf9, 0x01, 0x1d, 0x08, 0x05,
+  0x00, 0x22, 0x7e, 0x00, 0x2a, 0x48, 0xff, 0xd0, 0xf0, 0x22, 0x41, 0x46,
+  0x11, 0x40, 0x10, 0xff, 0x29, 0x03, 0xd0, 0x20, 0x29, 0x03, 0xd1, 0xe8,
+  0xef, 0x3a, 0x13, 0x43, 0x04, 0x53, 0x00, 0xf0, 0x22, 0x17, 0xf7, 0x40,
+  0x10, 0x2f, 0x13, 0x00, 0x2f, 0x03, 0xd1, 0x70, 0xfa, 0x13, 0x00, 0x40,
+  0x13, 0x08, 0x10, 0x40, 0x10, 0x28, 0x04, 0xaf, 0xd0, 0x20, 0x28, 0x4c,
+  0x47, 0x00, 0x12, 0x47, 0x08, 0xd2, 0xf7, 0x00, 0x61, 0x46, 0x19, 0x04,
+  0x11, 0x40, 0x0a, 0x00, 0x33, 0x10, 0x29, 0x1b, 0x00, 0x63, 0x08, 0x12,
+  0x02, 0x1b, 0x08, 0x21, 0x00, 0xff, 0x2b, 0x62, 0x01, 0x23, 0x6b, 0x61,
+  0x00, 0x23, 0xff, 0xff, 0x22, 0x2b, 0x61, 0x73, 0x6b, 0x93, 0x43, 0x7f,
+  0xeb, 0x60, 0x80, 0x23, 0x32, 0x6b, 0x1b, 0x1f, 0x00, 0xff, 0x6b, 0x64,
+  0x12, 0xe0, 0x36, 0x4b, 0x9c, 0x42, 0xfb, 0x50, 0xd0, 0x05, 0x04, 0x31,
+  0xd0, 0xe5, 0x69, 0x35, 0x7f, 0x4b, 0xab, 0x61, 0xeb, 0x61, 0x68, 0xe7,
+  0x33, 0x0c, 0xef, 0x2a, 0x61, 0xff, 0x22, 0x31, 0x0c, 0x85, 0x23, 0x2b,
+  0xff, 0x60, 0x83, 0x3b, 0x23, 0x70, 0x2e, 0x4b, 0x9a, 0xff, 0x6d, 0x00,
+  0x2a, 0x19, 0xd1, 0xd9, 0x6d, 0x00, 0xbf, 0x29, 0x16, 0xdd, 0xda, 0x65,
+  0x1a, 0xc5, 0x01, 0x29, 0xfe, 0x0f, 0x02, 0xc0, 0xbc, 0xb9, 0x46, 0xb0,
+  0x46, 0xf8, 0x3b, 0xbd, 0x27, 0xcf, 0x01, 0x12, 0xfe, 0x61, 0xcd, 0x00,
+  0x8b, 0x04, 0xff, 0xb9, 0xd1, 0xbd, 0xe7, 0x00, 0x22, 0x63, 0xe7, 0xed,
+  0x22, 0x15, 0x00, 0x07, 0xfe, 0x05, 0x04, 0x04, 0xfe, 0x02, 0xff, 0x21,
+  0x21, 0x4b, 0x10, 0x20, 0xda, 0x69, 0x0a, 0xbf, 0x43, 0xda, 0x61, 0xda,
+  0x69, 0x1a, 0x07, 0x00, 0x1a, 0xef, 0x61, 0x1a, 0x69, 0x8a, 0x05, 0x00,
+  0x01, 0x31, 0x1b, 0xff, 0x69, 0xfd, 0xf7, 0x0b, 0xfe, 0x1a, 0x4b, 0x63,
+  0xff, 0x61, 0xb9, 0xe7, 0xdb, 0x68, 0x99, 0x68, 0x93, 0xbf, 0x68, 0x99,
+  0x42, 0xd0, 0xd2, 0x17, 0x37, 0x00, 0xe8, 0xfe, 0xaf, 0x01, 0x13, 0x4b,
+  0x12, 0x01, 0x99, 0x69, 0x0d, 0xff, 0x20, 0x11, 0x43, 0x99, 0x61, 0x99,
+  0x69, 0xd9, 0xfd, 0x68, 0x41, 0x00, 0x60, 0xda, 0x68, 0x10, 0x49, 0x0a,
+  0xff, 0x40, 0xda, 0x60, 0x03, 0x21, 0xdb, 0x68, 0xfd, 0xff, 0xf7, 0xed,
+  0xfd, 0x03, 0x21, 0x0e, 0x20, 0xfd, 0xef, 0xf7, 0xe9, 0xfd, 0x09, 0x43,
+  0x00, 0x97, 0xe7, 0x7c, 0x7a, 0x93, 0x03, 0x9c, 0x03, 0x00, 0x68, 0x68,
+  0x00, 0x00, 0x5f, 0x06, 0xf5, 0x34, 0x57, 0x03, 0xa8, 0x5b, 0x12, 0x00,
+  0x10, 0x02, 0x40, 0xdf, 0x00, 0x6c, 0xdc, 0x02, 0x28, 0x13, 0x00, 0xff,
+  0xf7, 0xff, 0xff, 0xff, 0x15, 0x4b, 0x10, 0xb5, 0x18, 0x68, 0xff, 0xd9,
+  0x68, 0x02, 0x68, 0x53, 0x60, 0x1a, 0x60, 0xff, 0x01, 0x22, 0xd8, 0x60,
+  0x02, 0x76, 0x0b, 0x7e, 0xff, 0x00, 0x2b, 0x1a, 0xd0, 0x0f, 0x2b, 0x18,
+  0xd0, 0xef, 0x00, 0x23, 0x8c, 0x68, 0x37, 0x0f, 0x9a, 0x68, 0xa2, 0xa7,
+  0x42, 0xfb, 0xd8, 0x37, 0x1f, 0x31, 0x1f, 0x02, 0x31, 0x03, 0x68, 0xef,
+  0xfc, 0x10, 0xbd, 0x04, 0xaf, 0x00, 0x90, 0xfd, 0x03, 0x1e, 0x05, 0x00,
+  0x8d, 0xfd, 0xc0, 0x46, 0x77, 0x04, 0xd3, 0x16, 0xc7, 0x06, 0xbe, 0x00,
+  0x14, 0x10, 0xb5, 0x72, 0xb6, 0x08, 0x4d, 0x01, 0xd9, 0xff, 0x6d, 0x0a,
+  0x43, 0x09, 0xd1, 0x01, 0x22, 0xda, 0xff, 0x65, 0xdb, 0x68, 0xd8, 0x61,
+  0x0f, 0x20, 0xfe, 0x6b, 0xf7, 0x4a, 0x3b, 0x08, 0x6f, 0x05, 0x08, 0x6c,
+  0xfd, 0x3f, 0x04, 0xe5, 0x10, 0xa3, 0x00, 0x6c, 0xb3, 0x04, 0x00, 0x20,
+  0x70, 0x47, 0xc0, 0xed, 0x46, 0x0f, 0x64, 0xfe, 0xe7, 0x0f, 0x2c, 0xf8,
+  0xb5, 0x13, 0xff, 0x4c, 0x13, 0x4f, 0x25, 0x00, 0x13, 0x4a, 0x14, 0xff,
+  0x48, 0x14, 0x49, 0x80, 0x35, 0x82, 0x42, 0x0a, 0xff, 0xd9, 0x03, 0x00,
+  0x40, 0xc9, 0x40, 0xc3, 0x9a, 0xfe, 0xcf, 0x00, 0x01, 0x3a, 0x13, 0x1a,
+  0x9b, 0x08, 0x01, 0xff, 0x33, 0x9b, 0x00, 0xc0, 0x18, 0x87, 0x42, 0x07,
+  0xff, 0xd9, 0x01, 0x3f, 0x3a, 0x1a, 0x92, 0x08, 0x01, 0xff, 0x32, 0x00,
+  0x21, 0x92, 0x00, 0x01, 0xf0, 0xff, 0xff, 0xf8, 0x10, 0x34, 0xac, 0x42,
+  0x04, 0xd0, 0x21, 0xff, 0x68, 0x60, 0x68, 0xa2, 0x68, 0xe7, 0x68, 0xe0,
+  0xef, 0xe7, 0xf8, 0xbd, 0xa4, 0x93, 0x00, 0xd8, 0x17, 0x00, 0xed, 0x20,
+  0x03, 0x14, 0xb8, 0x68, 0x9f, 0x30, 0xb5, 0x76, 0x46, 0xff, 0x72, 0xb6,
+  0x1d, 0x4c, 0xa3, 0x6d, 0x00, 0x2b, 0xf7, 0x30, 0xdb, 0xe2, 0x35, 0x02,
+  0x2d, 0xd1, 0x01, 0x33, 0xff, 0xa3, 0x65, 0x62, 0xb6, 0x19, 0x4d, 0x28,
+  0x00, 0xff, 0x10, 0x30, 0xfd, 0xf7, 0x3e, 0xfd, 0x28, 0x00, 0xbd, 0x20,
+  0x07, 0x00, 0x3a, 0xfd, 0x72, 0xb6, 0x25, 0x04, 0x20, 0xbd, 0xdd, 0x25,
+  0x04, 0x1d, 0xd1, 0x01, 0x3b, 0x25, 0x04, 0x0f, 0x7f, 0x36, 0x00, 0xd1,
+  0x70, 0xbd, 0x72, 0xb6, 0x5f, 0x05, 0xbf, 0x20, 0x3b, 0x83, 0xf3, 0x09,
+  0x88, 0x31, 0x03, 0x04, 0xff, 0x21, 0x68, 0xda, 0x61, 0xe2, 0x68, 0x89,
+  0x68, 0xff, 0x92, 0x68, 0x91, 0x42, 0x02, 0xd9, 0x07, 0x4a, 0xef, 0x9a,
+  0x61, 0xec, 0xe7, 0x05, 0x04, 0xe9, 0xe7, 0x06, 0xb6, 0x2d, 0x01, 0xd5,
+  0xfc, 0x05, 0x04, 0xd2, 0xfc, 0x33, 0x05, 0x40, 0xbe, 0x9f, 0x00, 0xdb,
+  0x19, 0x00, 0x08, 0xe6, 0x03, 0x00, 0xbc, 0xd2, 0x3b, 0x01, 0xc4, 0x3f,
+  0x35, 0x9f, 0x68, 0x30, 0x97, 0x00, 0xee, 0xfc, 0x37, 0x28, 0x00, 0x40,
+  0x07, 0x00, 0xea, 0xfc, 0x9f, 0xfc, 0x9f, 0x0c, 0xf5, 0x85, 0x9f, 0x08,
+  0x82, 0x9f, 0x88, 0xf0, 0xb5, 0x47, 0x46, 0x7f, 0x76, 0x46, 0x80, 0xb4,
+  0x72, 0xb6, 0x43, 0xa3, 0x08, 0xef, 0x00, 0xda, 0x6f, 0xe0, 0x7f, 0x04,
+  0x00, 0xd0, 0x6b, 0xfd, 0xe0, 0xa7, 0x0c, 0x3e, 0x4d, 0xa8, 0x69, 0x2f,
+  0x69, 0xff, 0x03, 0x68, 0x03, 0x60, 0x00, 0x2f, 0x2e, 0xd0, 0xff, 0xda,
+  0x06, 0x4d, 0xd5, 0xe9, 0x69, 0x4a, 0x68, 0xff, 0x52, 0x68, 0x00, 0x2a,
+  0x51, 0xd1, 0x1b, 0x06, 0xff, 0x25, 0xd5, 0x04, 0x23, 0x98, 0x46, 0xfd,
+  0xf7, 0xff, 0x83, 0xfe, 0xbb, 0x68, 0x00, 0x2b, 0x57, 0xd0, 0xff, 0x05,
+  0x22, 0x41, 0x46, 0x28, 0x00, 0x2a, 0x70, 0xff, 0x98, 0x47, 0x2b, 0x78,
+  0x05, 0x2b, 0x4f, 0xd0, 0xfe, 0xd3, 0x0c, 0x50, 0xdd, 0xe7, 0x6d, 0x00,
+  0x2f, 0x4d, 0xff, 0xd1, 0x28, 0x00, 0x01, 0x21, 0x01, 0x23, 0x14, 0xff,
+  0x30, 0x49, 0x42, 0xe3, 0x65, 0xfd, 0xf7, 0x39, 0xdd, 0xff, 0x1b, 0x04,
+  0x45, 0xdd, 0xe3, 0x05, 0x00, 0x42, 0xdd, 0xa9, 0xe7, 0x6b, 0x00, 0x2d,
+  0x0c, 0x31, 0x01, 0x09, 0x2e, 0x01, 0x19, 0x02, 0xbf, 0xd1, 0x80, 0xbc,
+  0xb8, 0x46, 0xf0, 0x05, 0x69, 0x08, 0xfb, 0xd9, 0x15, 0xff, 0x00, 0xea,
+  0xe7, 0x1b, 0x06, 0xdc, 0xfe, 0x91, 0x00, 0xe9, 0x69, 0x98, 0x46, 0xb4,
+  0xe7, 0x11, 0xfe, 0x11, 0x00, 0xe1, 0xe7, 0x04, 0x22, 0x1b, 0x06, 0xdb,
+  0xff, 0x17, 0x1a, 0x40, 0x02, 0x23, 0x90, 0x46, 0x9c, 0xbf, 0x46, 0xe0,
+  0x44, 0xa8, 0xe7, 0x0c, 0x1d, 0x01, 0xf3, 0xfd, 0xfb, 0x05, 0x04, 0xf0,
+  0xfb, 0x02, 0x23, 0x2b, 0x70, 0x7f, 0x00, 0x23, 0x2b, 0x61, 0xaa, 0xe7,
+  0x09, 0xff, 0x07, 0x5b, 0xfb, 0x08, 0x05, 0x00, 0xe5, 0xfb, 0x4f, 0x0f,
+  0x18, 0xd3, 0x03, 0xca, 0x3b, 0x35, 0x5c, 0x03, 0x00, 0x64, 0x43, 0x21,
+  0x3f, 0x05, 0x80, 0xb4, 0x55, 0x77, 0xe3, 0x01, 0xa4, 0x3f, 0x11, 0xc6,
+  0x3f, 0x11, 0xc2, 0x3f, 0x11, 0x7f, 0x9f, 0x4d, 0xea, 0x6b, 0x93, 0x68,
+  0x93, 0xeb, 0x03, 0xdf, 0x16, 0x00, 0x1e, 0x40, 0x1a, 0xdf, 0x02, 0x0b,
+  0x32, 0xff, 0x1a, 0x42, 0x01, 0xd0, 0x80, 0x26, 0x76, 0x02, 0xff, 0xda,
+  0x05, 0x07, 0xd5, 0xc0, 0x22, 0x12, 0x01, 0xff, 0x13, 0x42, 0x00, 0xd1,
+  0x6a, 0xe0, 0x80, 0x22, 0xff, 0x92, 0x02, 0x16, 0x43, 0xda, 0x03, 0x57,
+  0xd4, 0xea, 0x07, 0x0d, 0x5b, 0x19, 0x09, 0x58, 0x35, 0x05, 0x33, 0x08,
+  0x30, 0xff, 0xe3, 0x65, 0xfe, 0xf7, 0x70, 0xfa, 0x6b, 0x6a, 0xff, 0x1e,
+  0x43, 0xab, 0x6a, 0x6e, 0x62, 0x00, 0x2b, 0xff, 0x02, 0xd0, 0x28, 0x00,
+  0x24, 0x30, 0x98, 0x47, 0xee, 0x75, 0x08, 0xdc, 0x88, 0xe0, 0x2b, 0x04,
+  0x00, 0xdc, 0x84, 0xef, 0xe0, 0x00, 0x23, 0xe3, 0x75, 0x00, 0xeb, 0x6b,
+  0xde, 0xff, 0x68, 0xb2, 0x07, 0x00, 0xd0, 0x82, 0xe0, 0x10, 0x7f, 0x22,
+  0x32, 0x42, 0x60, 0xd1, 0x1e, 0x69, 0x0d, 0x04, 0xfd, 0xa7, 0x0d, 0x08,
+  0x00, 0xd0, 0xcb, 0xe0, 0x5a, 0x68, 0xdf, 0x5a, 0x60, 0x52, 0x07, 0x36,
+  0x69, 0x10, 0x00, 0xdc, 0x6d, 0xe5, 0xb5, 0x10, 0xe1, 0xe0, 0x75, 0x11,
+  0x37, 0x11, 0xbb, 0x01, 0x3e, 0x6f, 0x5d, 0x00, 0xd8, 0xc9, 0xe0, 0x69,
+  0x5f, 0x01, 0x99, 0x0d, 0xfe, 0xc3, 0x00, 0x03, 0x13, 0x42, 0x06, 0xd0,
+  0x80, 0x23, 0x7f, 0xdb, 0x02, 0x1e, 0x43, 0x9f, 0xe7, 0x64, 0x45, 0x01,
+  0xff, 0x42, 0xfb, 0x04, 0x23, 0x1e, 0x43, 0x99, 0xe7, 0xfb, 0x02, 0x22,
+  0xd3, 0x04, 0x00, 0xd4, 0x94, 0xe7, 0xeb, 0xbf, 0xe7, 0x9b, 0x69, 0x72,
+  0xb6, 0xa2, 0x67, 0x00, 0xee, 0xfe, 0xe1, 0x09, 0xeb, 0xd1, 0x01, 0x32,
+  0xe2, 0x65, 0x2a, 0xff, 0x6b, 0x1b, 0x04, 0x13, 0x43, 0x2b, 0x63, 0x6b,
+  0xaf, 0x6b, 0x00, 0x2b, 0x08, 0xd3, 0x00, 0x30, 0xd3, 0x10, 0x1f, 0xf6,
+  0xfd, 0x08, 0x1c, 0xdd, 0xcf, 0x0c, 0xaa, 0xe7, 0xda, 0x60, 0xea, 0xab,
+  0x0c, 0xd0, 0x17, 0x08, 0xcd, 0x45, 0x03, 0xe3, 0x65, 0x2b, 0xd5, 0x6b,
+  0x39, 0x14, 0x35, 0x39, 0x20, 0x02, 0x21, 0x08, 0x2c, 0xdc, 0xed, 0x43,
+  0x85, 0x00, 0xff, 0xfa, 0x05, 0x04, 0xfc, 0xfa, 0x02, 0x7f, 0x21, 0x5a,
+  0x69, 0x8a, 0x43, 0x5a, 0x61, 0x43, 0x0c, 0xf5, 0xae, 0x21, 0x08, 0xab,
+  0x43, 0x00, 0x28, 0x00, 0x98, 0x46, 0xfd, 0x10, 0x5b, 0x09, 0xc2, 0xf9,
+  0x42, 0x46, 0xab, 0x69, 0xbf, 0x13, 0x43, 0xab, 0x61, 0xeb, 0x69, 0x5d,
+  0x0d, 0x18, 0xea, 0x4f, 0x10, 0xda, 0x2d, 0x08, 0xd7, 0x89, 0x10, 0xeb,
+  0x6b, 0x55, 0xdd, 0xe7, 0x09, 0x14, 0x53, 0xe7, 0x10, 0x57, 0x28, 0x00,
+  0xdc, 0x3b, 0x81, 0xe7, 0x87, 0x09, 0xd0, 0x7d, 0xe7, 0xb5, 0x05, 0x59,
+  0x0c, 0xaf, 0x95, 0xf9, 0x02, 0x22, 0x59, 0x4c, 0xad, 0x59, 0x08, 0xaa,
+  0xae, 0x59, 0x18, 0x2f, 0xe7, 0x1a, 0x49, 0x18, 0x5c, 0x49, 0x10, 0x58,
+  0xa9, 0xe7, 0xe9, 0x2c, 0x23, 0x25, 0x8d, 0x3f, 0x08, 0x8a, 0x3f, 0x18,
+  0x13, 0xdb, 0xe7, 0x08, 0x93, 0x01, 0x34, 0xe7, 0xc5, 0x06, 0x82, 0xfa,
+  0x02, 0xc3, 0x06, 0x3c, 0xc3, 0x12, 0xb7, 0x16, 0xc7, 0x06, 0xcf, 0x06,
+  0xcb, 0x06, 0xbf, 0x06, 0xd7, 0x70, 0xb5, 0x75, 0xbb, 0x02, 0x1a, 0xbb,
+  0x0a, 0x2a, 0xdb, 0xd2, 0x95, 0x05, 0x27, 0x15, 0x01, 0x01, 0x06, 0x16,
+  0x43, 0x00, 0xa0, 0xfa, 0xea, 0x8d, 0x0c, 0x20, 0xaf, 0x09, 0x1d, 0x91,
+  0x17, 0x35, 0x00, 0xd1, 0xdd, 0x70, 0x8d, 0x6b, 0x02, 0xd9, 0x07, 0x87,
+  0x00, 0xec, 0xe7, 0x6e, 0x05, 0x04, 0xe9, 0xe7, 0x06, 0x49, 0x00, 0x3b,
+  0xfa, 0x05, 0x04, 0x3d, 0x38, 0x93, 0x08, 0x40, 0x67, 0x00, 0x08, 0x57,
+  0x37, 0x4f, 0x1f, 0xff, 0x4e, 0x46, 0x57, 0x46, 0x45, 0x46, 0xe0, 0xb4,
+  0x55, 0x76, 0x97, 0x00, 0x64, 0x53, 0x13, 0x95, 0x9d, 0x12, 0x91, 0x53,
+  0x13, 0xff, 0x80, 0x25, 0xed, 0x05, 0x2a, 0x69, 0xeb, 0x68, 0xff, 0x13,
+  0x40, 0xff, 0x22, 0x1a, 0x40, 0xd2, 0x43, 0x5f, 0x2a, 0x61, 0x9b, 0x07,
+  0x23, 0xcb, 0x1a, 0x7b, 0x2d, 0x10, 0xed, 0x77, 0xcb, 0x16, 0x36, 0x10,
+  0xcb, 0x6a, 0x60, 0xd9, 0x4b, 0xfe, 0xa7, 0x00, 0xe0, 0xbc, 0xba, 0x46,
+  0xb1, 0x46, 0xa8, 0xd4, 0xcd, 0x02, 0x47, 0x0c, 0x5e, 0x5b, 0x09, 0x5b,
+  0x67, 0x0a, 0x00, 0x23, 0xff, 0x99, 0x46, 0x10, 0x23, 0x9a, 0x46, 0xa2,
+  0x44, 0xff, 0x27, 0x69, 0x68, 0x6a, 0xe3, 0x69, 0xba, 0x68, 0xff, 0xc1,
+  0x1a, 0x91, 0x42, 0x56, 0xd3, 0x98, 0x46, 0xff, 0x90, 0x44, 0x43, 0x46,
+  0x7a, 0x68, 0xe3, 0x61, 0xff, 0x3b, 0x68, 0x13, 0x60, 0x5a, 0x60, 0x4b,
+  0x46, 0xff, 0x3b, 0x60, 0x23, 0x69, 0x53, 0x45, 0x46, 0xd0, 0x7a, 0x41,
+  0x04, 0x40, 0x41, 0x08, 0x3d, 0xdd, 0x4b, 0x46, 0x9d, 0x05, 0xff, 0x38,
+  0x00, 0x39, 0x69, 0xfb, 0x68, 0x98, 0x47, 0xd2, 0x5d, 0x0c, 0x2f, 0xa3,
+  0x0e, 0x5d, 0x08, 0x7b, 0x15, 0x02, 0xd2, 0xd0, 0xff, 0x42, 0x46, 0x69,
+  0x6a, 0x8a, 0x1a, 0x93, 0x42, 0xff, 0x3f, 0xd3, 0x20, 0x00, 0x22, 0x69,
+  0x10, 0x30, 0xff, 0x82, 0x42, 0x04, 0xd1, 0x3f, 0xe0, 0x97, 0x42, 0xff,
+  0x3a, 0xd0, 0x12, 0x68, 0x5b, 0x1a, 0x91, 0x68, 0xff, 0x8b, 0x42, 0xf8,
+  0xd8, 0x51, 0x68, 0xbb, 0x60, 0xff, 0x79, 0x60, 0x3a, 0x60, 0x0f, 0x60,
+  0x91, 0x68, 0xff, 0x57, 0x60, 0xcb, 0x1a, 0x93, 0x60, 0x01, 0x23, 0x7f,
+  0x5b, 0x42, 0xa3, 0x61, 0xb0, 0xe7, 0x1b, 0xc1, 0x00, 0x77, 0x9d, 0xe7,
+  0x1b, 0x63, 0x01, 0x86, 0xf9, 0x1a, 0x05, 0x00, 0xdd, 0x83, 0x05, 0x08,
+  0x80, 0xf9, 0x19, 0x05, 0x00, 0x7d, 0xf9, 0xff, 0x4b, 0x46, 0xeb, 0x60,
+  0xb5, 0xe7, 0x21, 0x00, 0xff, 0x10, 0x31, 0x8f, 0x42, 0x05, 0xd0, 0x11,
+  0x1a, 0xff, 0xc9, 0x18, 0xe0, 0x61, 0xb9, 0x60, 0xfd, 0xf7, 0xab, 0x00,
+  0xfc, 0x8b, 0x04, 0xec, 0x8b, 0x08, 0xe9, 0x45, 0x12, 0x5b, 0xdb, 0xe7,
+  0x0d, 0x33, 0x00, 0x63, 0xf9, 0x05, 0x04, 0x60, 0xf9, 0xff, 0x5b, 0x1a,
+  0x43, 0x44, 0x1a, 0x00, 0x38, 0x00, 0xff, 0xfe, 0xf7, 0x6a, 0xf8, 0xe8,
+  0xe7, 0xc0, 0x46, 0x60, 0xbf, 0x05, 0xbb, 0x15, 0xb7, 0x05, 0xbf, 0x05,
+  0x5b, 0x16, 0xe4, 0x65, 0x13, 0x00, 0x99, 0x66, 0xcb, 0x1d, 0x5f, 0x7e,
+  0x90, 0xf9, 0x5f, 0xfe, 0x5f, 0x0e, 0x0b, 0x2d, 0xf9, 0x05, 0x04, 0x08,
+  0xf9, 0x9f, 0x04, 0x7c, 0xf3, 0x12, 0x5f, 0x46, 0xff, 0x10, 0xb5, 0xff,
+  0xf7, 0xb5, 0xff, 0x10, 0xbd, 0xb2, 0x9f, 0x8c, 0x40, 0x9f, 0xfc, 0x9f,
+  0x10, 0xbb, 0xf8, 0x05, 0x04, 0xb8, 0xa5, 0xf8, 0x9f, 0x04, 0x9c, 0x9f,
+  0x60, 0x53, 0x08, 0x33, 0x53, 0x04, 0x62, 0xff, 0xb6, 0x70, 0x47, 0xc0,
+  0x46, 0x9c, 0x22, 0x46, 0xff, 0x4b, 0xd2, 0x03, 0x99, 0x6a, 0x10, 0xb5,
+  0x11, 0xff, 0x43, 0x99, 0x62, 0x99, 0x6a, 0x43, 0x48, 0xa8, 0xf7, 0x24,
+  0x01, 0x40, 0x09, 0x04, 0x59, 0x69, 0x41, 0x48, 0xff, 0x0a, 0x43, 0x5a,
+  0x61, 0x90, 0x21, 0x5a, 0x69, 0xff, 0x00, 0x22, 0xc9, 0x05, 0x4a, 0x60,
+  0x88, 0x60, 0xff, 0x3e, 0x48, 0xe4, 0x01, 0xc8, 0x60, 0x84, 0x20, 0xff,
+  0x80, 0x05, 0x4a, 0x61, 0x08, 0x62, 0x3b, 0x48, 0xfd, 0x48, 0x03, 0x00,
+  0x08, 0x60, 0x3b, 0x49, 0x3c, 0x48, 0xfe, 0x1d, 0x04, 0xc8, 0x60, 0x4a,
+  0x61, 0x0a, 0x62, 0x4a, 0x7f, 0x62, 0x0c, 0x60, 0x39, 0x49, 0x39, 0x4c,
+  0x11, 0x0c, 0xbd, 0x4c, 0x11, 0x08, 0x0a, 0x60, 0x36, 0x49, 0x0f, 0x2c,
+  0x01, 0xff, 0x21, 0x1a, 0x68, 0x0a, 0x43, 0x1a, 0x60, 0x01, 0xff, 0x31,
+  0x1a, 0x68, 0x11, 0x42, 0xfc, 0xd0, 0x03, 0xff, 0x21, 0x5a, 0x68, 0x8a,
+  0x43, 0x5a, 0x60, 0x0c, 0xff, 0x22, 0x22, 0x49, 0x10, 0x00, 0x4b, 0x68,
+  0x18, 0xff, 0x40, 0x1a, 0x42, 0xfa, 0xd1, 0xf9, 0x23, 0x0a, 0xfe, 0x83,
+  0x03, 0x01, 0x22, 0x0b, 0x60, 0x48, 0x60, 0x4b, 0xff, 0x6b, 0x13, 0x43,
+  0x4b, 0x63, 0x02, 0x21, 0x1a, 0xef, 0x4a, 0x53, 0x6b, 0x19, 0x31, 0x00,
+  0x01, 0x21, 0x53, 0xff, 0x6a, 0x0b, 0x43, 0x53, 0x62, 0x16, 0x4a, 0x01,
+  0xf7, 0x31, 0x53, 0x6a, 0x11, 0x04, 0x84, 0x21, 0x00, 0x23, 0xff, 0x49,
+  0x03, 0xd3, 0x62, 0x51, 0x60, 0x13, 0x63, 0xff, 0x80, 0x23, 0x11, 0x68,
+  0x5b, 0x04, 0x0b, 0x43, 0xff, 0x13, 0x60, 0x80, 0x22, 0x0d, 0x49, 0x92,
+  0x04, 0xf7, 0x0b, 0x68, 0x13, 0x21, 0x00, 0x11, 0x23, 0x01, 0x21, 0xbf,
+  0x15, 0x4a, 0x13, 0x60, 0x13, 0x68, 0x2f, 0x04, 0x02, 0xdf, 0x21, 0x07,
+  0x4a, 0x53, 0x68, 0x43, 0x00, 0x60, 0x0a, 0xfd, 0x31, 0x07, 0x00, 0x40,
+  0x08, 0x2b, 0xfb, 0xd1, 0x01, 0xff, 0x21, 0x93, 0x69, 0x0b, 0x43, 0x93,
+  0x61, 0x93, 0xfd, 0x69, 0xc3, 0x01, 0x10, 0x02, 0x40, 0xff, 0xff, 0xb1,
+  0xff, 0xff, 0x55, 0x55, 0xfd, 0x7f, 0x55, 0x55, 0x55, 0xff, 0x25, 0x11,
+  0x40, 0x04, 0x00, 0xff, 0xa0, 0xa8, 0x5f, 0xaa, 0x00, 0x04, 0x00, 0x48,
+  0x0f, 0x00, 0x55, 0x55, 0x01, 0xf7, 0x48, 0xff, 0xff, 0x54, 0x01, 0x14,
+  0x00, 0x48, 0x00, 0xf7, 0x20, 0x02, 0x40, 0x5f, 0x05, 0xf3, 0x4b, 0xf0,
+  0xb5, 0xff, 0x99, 0x6a, 0xde, 0x46, 0x57, 0x46, 0x4e, 0x46, 0xff, 0x45,
+  0x46, 0xf1, 0x4a, 0xe0, 0xb5, 0x0a, 0x43, 0xff, 0x9c, 0x21, 0x9a, 0x62,
+  0x9a, 0x6a, 0xc9, 0x03, 0xfb, 0x0a, 0x40, 0x07, 0x04, 0x1a, 0x69, 0x01,
+  0x22, 0x00, 0xff, 0x20, 0x52, 0x42, 0x1a, 0x61, 0x1a, 0x69, 0x18, 0xfe,
+  0x03, 0x00, 0xd9, 0x68, 0xe8, 0x4a, 0x83, 0xb0, 0x0a, 0x7f, 0x43, 0x80,
+  0x21, 0xda, 0x60, 0xda, 0x68, 0x25, 0x04, 0xfe, 0x07, 0x04, 0x80, 0x22,
+  0xd9, 0x69, 0x52, 0x05, 0x0a, 0xff, 0x43, 0xda, 0x61, 0xda, 0x69, 0x80,
+  0x22, 0xe1, 0xff, 0x49, 0x52, 0x00, 0x0c, 0x68, 0x22, 0x43, 0x0a, 0xff,
+  0x60, 0xc0, 0x21, 0x1a, 0x6a, 0x89, 0x00, 0x0a, 0xff, 0x40, 0x01, 0x39,
+  0xff, 0x39, 0x8a, 0x42, 0x03, 0xfd, 0xd0, 0x19, 0x02, 0x02, 0x1a, 0x62,
+  0x18, 0x62, 0x80, 0xff, 0x22, 0xd5, 0x4b, 0x12, 0x02, 0x19, 0x6a, 0x11,
+  0xbf, 0x42, 0x07, 0xd1, 0x80, 0x21, 0x18, 0x23, 0x00, 0x01, 0xdf, 0x43,
+  0x19, 0x62, 0x19, 0x6a, 0x63, 0x01, 0x62, 0x00, 0xff, 0x24, 0xd2, 0x4b,
+  0x01, 0x27, 0x9b, 0x46, 0x1c, 0xff, 0x60, 0x5c, 0x60, 0xd0, 0x4b, 0x7f,
+  0x42, 0x1c, 0xff, 0x60, 0x5b, 0x46, 0x9c, 0x60, 0xcf, 0x4b, 0x03, 0xfd,
+  0x21, 0x09, 0x04, 0x1c, 0x61, 0xcd, 0x4b, 0x05, 0x20, 0xbe, 0x13, 0x08,
+  0x61, 0xcc, 0x4b, 0xcc, 0x4d, 0x13, 0x08, 0x62, 0xef, 0xcb, 0x4b, 0x80,
+  0x26, 0x13, 0x08, 0x62, 0xca, 0x4b, 0xff, 0xf6, 0x05, 0x5f, 0x60, 0xfc,
+  0xf7, 0xa2, 0xff, 0x7f, 0x03, 0x21, 0x06, 0x20, 0xfc, 0xf7, 0x9e, 0x07,
+  0x00, 0xfd, 0x07, 0x07, 0x00, 0x9a, 0xff, 0xc4, 0x4b, 0x02, 0x21, 0xff,
+  0x9a, 0x46, 0x01, 0x23, 0x99, 0x46, 0x53, 0x46, 0xff, 0x4a, 0x46, 0x1a,
+  0x70, 0x52, 0x46, 0x5c, 0x60, 0xff, 0x9c, 0x60, 0xdc, 0x60, 0x1c, 0x61,
+  0x5c, 0x61, 0xdf, 0xbe, 0x4b, 0x0c, 0x20, 0x93, 0x05, 0x00, 0xd4, 0x61,
+  0xff, 0x13, 0x62, 0xfc, 0xf7, 0x84, 0xff, 0xbc, 0x4b, 0xd7, 0x4a, 0x46,
+  0x98, 0x23, 0x00, 0x42, 0x23, 0x00, 0x08, 0x33, 0xff, 0x93, 0x60, 0xd3,
+  0x60, 0x43, 0x46, 0x10, 0x33, 0xff, 0x94, 0x61, 0x13, 0x61, 0x53, 0x61,
+  0x54, 0x62, 0xff, 0x03, 0x21, 0x1e, 0x20, 0xd4, 0x61, 0x14, 0x62, 0xff,
+  0x94, 0x62, 0xd4, 0x62, 0x14, 0x63, 0x54, 0x63, 0xff, 0x94, 0x63, 0xd5,
+  0x63, 0xfc, 0xf7, 0x69, 0xff, 0xff, 0x80, 0x22, 0x9f, 0x4b, 0x92, 0x04,
+  0xd9, 0x69, 0xfb, 0x48, 0x46, 0x1f, 0x09, 0x61, 0x89, 0x00, 0xda, 0x69,
+  0xff, 0x6a, 0x58, 0x12, 0x0c, 0x12, 0x04, 0x02, 0x43, 0xbf, 0x6a, 0x50,
+  0x6a, 0x58, 0xa8, 0x48, 0x0b, 0x14, 0x90, 0xff, 0x22, 0x48, 0x46, 0x92,
+  0x00, 0xac, 0x50, 0x04, 0xff, 0x32, 0xac, 0x50, 0x40, 0x3a, 0xac, 0x50,
+  0x10, 0xae, 0x07, 0x00, 0x08, 0x3a, 0xa8, 0x07, 0x00, 0xa8, 0x27, 0x00,
+  0x82, 0x9e, 0x21, 0x00, 0xda, 0x69, 0x9d, 0x49, 0x5b, 0x01, 0x4f, 0x01,
+  0x9c, 0xff, 0x4a, 0x49, 0x46, 0x10, 0x70, 0x9c, 0x48, 0x03, 0xff, 0x31,
+  0xd0, 0x61, 0x48, 0x46, 0x11, 0x74, 0x10, 0xff, 0x76, 0x54, 0x60, 0xd4,
+  0x60, 0x99, 0x4a, 0x11, 0xff, 0x74, 0x99, 0x49, 0x10, 0x70, 0xd1, 0x61,
+  0x49, 0xff, 0x46, 0xd4, 0x60, 0x54, 0x60, 0x14, 0x76, 0xda, 0xef, 0x69,
+  0x01, 0x31, 0x02, 0x81, 0x01, 0x94, 0x4a, 0xdb, 0xff, 0x69, 0x93, 0x68,
+  0x03, 0x43, 0x93, 0x60, 0x93, 0xff, 0x4b, 0xb3, 0x62, 0xf7, 0x62, 0xb4,
+  0x61, 0x74, 0xff, 0x63, 0xf4, 0x60, 0x74, 0x60, 0x70, 0x61, 0x30, 0xff,
+  0x60, 0x0e, 0x30, 0xfc, 0xf7, 0x15, 0xff, 0x8e, 0xff, 0x4d, 0x8e, 0x4b,
+  0x8f, 0x4a, 0x01, 0x93, 0x5d, 0xff, 0x60, 0x8e, 0x4b, 0xac, 0x62, 0x2b,
+  0x63, 0x8e, 0xff, 0x49, 0x13, 0x6a, 0x0b, 0x40, 0x13, 0x62, 0x2b, 0xff,
+  0x00, 0xaf, 0x61, 0x10, 0x33, 0xac, 0x60, 0xec, 0xff, 0x62, 0xec, 0x61,
+  0x2b, 0x61, 0x6b, 0x61, 0x73, 0xff, 0x6a, 0x00, 0x27, 0x1e, 0x00, 0x80,
+  0x23, 0xeb, 0xff, 0x63, 0x2b, 0x00, 0x34, 0x33, 0xeb, 0x60, 0x85, 0xff,
+  0x4b, 0x49, 0x46, 0xab, 0x64, 0x4c, 0x23, 0x2e, 0xff, 0x62, 0x6f, 0x62,
+  0xe9, 0x52, 0xe9, 0x65, 0x2d, 0xff, 0x60, 0x6d, 0x60, 0x6f, 0x65, 0xaf,
+  0x65, 0x6d, 0xff, 0x64, 0xfd, 0xf7, 0x52, 0xf9, 0x7e, 0x48, 0xac, 0xff,
+  0x23, 0x02, 0x00, 0xc0, 0x50, 0x74, 0x32, 0x08, 0xbf, 0x3b, 0xc2, 0x50,
+  0x84, 0x22, 0x7b, 0x2d, 0x00, 0x83, 0xff, 0x50, 0x88, 0x23, 0xc7, 0x50,
+  0x7a, 0x4b, 0x10, 0xff, 0x32, 0x83, 0x50, 0xa0, 0x23, 0x92, 0x3a, 0xc1,
+  0xff, 0x50, 0x10, 0x33, 0xc2, 0x52, 0x08, 0x3b, 0xc5, 0xff, 0x50, 0x98,
+  0x30, 0xfd, 0xf7, 0x20, 0xfe, 0x02, 0xff, 0x23, 0x01, 0x9a, 0x13, 0x70,
+  0xfe, 0xf7, 0x2b, 0xff, 0xfc, 0x2b, 0x68, 0xab, 0x42, 0x00, 0xd0, 0x5e,
+  0xbf, 0xe1, 0x62, 0xb6, 0x6f, 0x48, 0x18, 0x1b, 0x00, 0xb2, 0xff, 0xfa,
+  0x72, 0xb6, 0xfe, 0xf7, 0x37, 0xfc, 0x53, 0xff, 0x46, 0x1c, 0x78, 0x63,
+  0x1e, 0x01, 0x2b, 0x00, 0xff, 0xd9, 0x4a, 0xe1, 0x00, 0x26, 0x53, 0x46,
+  0x5e, 0xff, 0x60, 0x01, 0x2c, 0x00, 0xd1, 0x0d, 0xe1, 0x53, 0xff, 0x46,
+  0x02, 0x26, 0x1e, 0x70, 0xfd, 0xf7, 0xf6, 0xff, 0xf8, 0xd4, 0x21, 0x80,
+  0x27, 0x85, 0x22, 0x63, 0xff, 0x4b, 0x63, 0x48, 0x49, 0x00, 0xfe, 0xf7,
+  0x1e, 0xff, 0xff, 0x62, 0x4c, 0x63, 0x4b, 0x20, 0x68, 0xff, 0xff, 0x00,
+  0x62, 0x49, 0x63, 0x60, 0x27, 0x81, 0xfe, 0xff, 0xf7, 0x9d, 0xff, 0xfc,
+  0x22, 0x20, 0x00, 0x92, 0xff, 0x05, 0x00, 0x21, 0xfd, 0xf7, 0x77, 0xfb,
+  0x5e, 0xeb, 0x4c, 0x5e, 0x1d, 0x00, 0x5e, 0x1b, 0x10, 0x8f, 0xff, 0x60,
+  0xff, 0x22, 0x5c, 0x4b, 0x20, 0x00, 0x99, 0x5c, 0x00, 0xff, 0x22, 0xfd,
+  0xf7, 0x68, 0xfb, 0xd4, 0x21, 0x81, 0xef, 0x22, 0x59, 0x4b, 0x5a, 0x49,
+  0x08, 0xf9, 0xfe, 0xd4, 0xff, 0x21, 0x84, 0x22, 0x58, 0x4b, 0x49, 0x00,
+  0x58, 0xff, 0x48, 0xfe, 0xf7, 0xf2, 0xfe, 0xfd, 0xf7, 0xe0, 0xdf, 0xff,
+  0x56, 0x4b, 0x18, 0x60, 0x97, 0x04, 0xeb, 0xfb, 0xff, 0x43, 0x46, 0x1a,
+  0x78, 0x01, 0x2a, 0x00, 0xd0, 0xff, 0x0d, 0xe1, 0x41, 0x46, 0x1e, 0x70,
+  0x51, 0x4b, 0xff, 0x4b, 0x60, 0x80, 0x21, 0x20, 0x4b, 0x89, 0x04, 0xff,
+  0xd8, 0x69, 0x01, 0x43, 0xd9, 0x61, 0xdb, 0x69, 0xff, 0x43, 0x46, 0xdb,
+  0x6b, 0x1a, 0x60, 0x59, 0x68, 0xf7, 0x11, 0x42, 0x08, 0xa5, 0x03, 0x08,
+  0x20, 0xfd, 0xf7, 0xfb, 0x51, 0xfe, 0x13, 0x04, 0x5a, 0x68, 0xd2, 0x07,
+  0xf6, 0xff, 0xd5, 0x42, 0x46, 0x52, 0x68, 0x51, 0x68, 0x12, 0xff, 0x68,
+  0xd9, 0x61, 0x1a, 0x60, 0x43, 0x4a, 0x5a, 0xff, 0x61, 0x04, 0x23, 0x42,
+  0x46, 0x13, 0x70, 0xab, 0xff, 0x6d, 0x00, 0x2b, 0x00, 0xd0, 0xd3, 0xe0,
+  0xea, 0xff, 0x6d, 0x00, 0x2a, 0x00, 0xdc, 0xcf, 0xe0, 0xeb, 0xfd, 0x65,
+  0x15, 0x0d, 0xe6, 0xe0, 0x62, 0xb6, 0xaa, 0x21, 0x7f, 0x80, 0x22, 0x3a,
+  0x4b, 0x3a, 0x48, 0x89, 0x99, 0x00, 0xff, 0xac, 0xfe, 0xaa, 0x21, 0x01,
+  0x26, 0x7c, 0x22, 0xf7, 0x38, 0x4b, 0x38, 0x0f, 0x08, 0xa4, 0xfe, 0x37,
+  0x4c, 0xff, 0x23, 0x78, 0x37, 0x4a, 0x6f, 0xe0, 0x00, 0x10, 0xff, 0x02,
+  0x40, 0xff, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x00, 0x70,
+  0x00, 0x40, 0x40, 0x17, 0x7f, 0x00, 0x20, 0x08, 0x00, 0x02, 0x40, 0x1c,
+  0x03, 0x00, 0xf5, 0x30, 0x03, 0x00, 0x44, 0x03, 0x00, 0x00, 0x64, 0x00,
+  0x40, 0xf9, 0x58, 0x07, 0x04, 0x03, 0x00, 0x18, 0x09, 0x00, 0x20, 0x00,
+  0xff, 0x24, 0x01, 0x40, 0x8a, 0x25, 0x00, 0x00, 0x3c, 0xde, 0x0b, 0x00,
+  0x01, 0x0e, 0x00, 0x00, 0x3c, 0x00, 0xfd, 0x7c, 0xde, 0x17, 0x04, 0x2c,
+  0x01, 0x40, 0x9c, 0x07, 0x04, 0x04, 0x00, 0xff, 0x40, 0x00, 0x58, 0x01,
+  0x40, 0xbf, 0x12, 0x00, 0xbf, 0x00, 0x20, 0x16, 0x00, 0x20, 0x38, 0x53,
+  0x00, 0x00, 0xff, 0xed, 0x00, 0xe0, 0x90, 0x67, 0x00, 0x08, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0x00, 0x05, 0x00, 0x20, 0x80, 0xfe, 0x17, 0x00, 0x21,
+  0x1c, 0x00, 0x08, 0xc9, 0x19, 0x00, 0xff, 0x08, 0x50, 0x15, 0x00, 0x20,
+  0xb1, 0x3a, 0x00, 0xbf, 0x08, 0x78, 0x12, 0x00, 0x20, 0x34, 0x0b, 0x00,
+  0x00, 0xff, 0x6c, 0xdc, 0x02, 0x18, 0x64, 0x00, 0x08, 0x00, 0xbe, 0x23,
+  0x00, 0x80, 0x1a, 0x06, 0x00, 0x60, 0x0b, 0x00, 0x70, 0xfe, 0x43, 0x00,
+  0x51, 0x32, 0x00, 0x08, 0xc0, 0x10, 0x00, 0xe7, 0x20, 0xf1, 0x30, 0x07,
+  0x00, 0x67, 0x00, 0x68, 0x0b, 0x00, 0xff, 0x20, 0xd0, 0x63, 0x00, 0x08,
+  0x5b, 0x87, 0x01, 0xff, 0x00, 0x41, 0x37, 0x00, 0x08, 0x18, 0x0e, 0x00,
+  0x27, 0x20, 0x11, 0x33, 0x2b, 0x00, 0x17, 0x00, 0x6c, 0x03, 0x00, 0x87,
+  0x00, 0xff, 0x48, 0x02, 0x2b, 0x1b, 0xd8, 0x20, 0x21, 0x51, 0xff, 0x83,
+  0x50, 0x69, 0x49, 0x18, 0x41, 0x40, 0x02, 0xff, 0x3b, 0x51, 0x61, 0x5a,
+  0x42, 0x53, 0x41, 0x58, 0xff, 0x42, 0x53, 0x4b, 0x18, 0x40, 0xf5, 0x30,
+  0xff, 0xfe, 0x37, 0x02, 0x46, 0xfe, 0x79, 0xe7, 0xfd, 0xf7, 0x0b, 0xff,
+  0xf8, 0x5b, 0x46, 0x1b, 0x68, 0x23, 0x42, 0x52, 0xff, 0xd0, 0x53, 0x46,
+  0x4d, 0x48, 0xde, 0x61, 0xfc, 0xff, 0xf7, 0x82, 0xfd, 0x5b, 0x00, 0x98,
+  0x46, 0x20, 0xff, 0x23, 0x40, 0x21, 0x00, 0x27, 0x99, 0x46, 0x51, 0xff,
+  0x83, 0x49, 0x46, 0x48, 0x4a, 0x53, 0x69, 0x4b, 0xff, 0x40, 0x53, 0x61,
+  0x72, 0xb6, 0xab, 0x6d, 0xea, 0xff, 0x6d, 0x13, 0x43, 0x1d, 0xd1, 0x08,
+  0x20, 0x44, 0x7f, 0x49, 0xee, 0x65, 0xfd, 0xf7, 0x7c, 0xfd, 0x89, 0x05,
+  0xdb, 0x0f, 0xd1, 0x87, 0x05, 0x0c, 0xdd, 0x85, 0x0d, 0x1c, 0xd1, 0xff,
+  0x62, 0xb6, 0x01, 0x37, 0xff, 0xb2, 0x47, 0x45, 0xff, 0xe1, 0xdb, 0x3c,
+  0x48, 0xfd, 0xf7, 0x12, 0xfe, 0xff, 0x45, 0xe7, 0x3b, 0x48, 0xfc, 0xf7,
+  0x56, 0xfd, 0xf5, 0x3a, 0x05, 0x00, 0x53, 0x05, 0x08, 0x50, 0xfd, 0xea,
+  0x6b, 0xff, 0x9b, 0x68, 0x9a, 0x42, 0x00, 0xd3, 0x9b, 0xe6, 0xdd, 0x37,
+  0x0f, 0x00, 0x48, 0xfd, 0x36, 0x05, 0x00, 0x45, 0xfd, 0xdf, 0xea, 0x68,
+  0x9b, 0x68, 0x92, 0x17, 0x00, 0xdd, 0xd2, 0xf5, 0x33, 0x0f, 0x00, 0x3d,
+  0x0f, 0x18, 0x00, 0xd3, 0x12, 0xe7, 0xfd, 0x30, 0x11, 0x00, 0x34, 0xfd,
+  0x59, 0x46, 0x2f, 0x4a, 0xff, 0x23, 0x43, 0x8a, 0x60, 0x5a, 0x46, 0x51,
+  0x46, 0xff, 0x13, 0x60, 0x2d, 0x4b, 0xd1, 0x60, 0x5a, 0x69, 0xff, 0x22,
+  0x43, 0x5a, 0x61, 0x5b, 0x69, 0x5b, 0x46, 0xff, 0x5e, 0x68, 0x26, 0x42,
+  0x31, 0xd0, 0x01, 0x23, 0xff, 0x5a, 0x46, 0x0f, 0x21, 0x33, 0x43, 0x53,
+  0x60, 0xff, 0x26, 0x4a, 0x00, 0x20, 0x13, 0x68, 0x26, 0x4e, 0xff, 0x8b,
+  0x43, 0x13, 0x60, 0x25, 0x4b, 0x01, 0x39, 0xff, 0x59, 0x60, 0x51, 0x46,
+  0x24, 0x4b, 0x10, 0x60, 0xff, 0xcb, 0x61, 0x80, 0x21, 0x1e, 0x4b, 0x89,
+  0x00, 0xff, 0xdc, 0x68, 0x0c, 0x43, 0xdc, 0x60, 0xdc, 0x68, 0xfb, 0x34,
+  0x40, 0x05, 0x04, 0x9c, 0x69, 0x21, 0x43, 0x99, 0xff, 0x61, 0x9b, 0x69,
+  0x1d, 0x4b, 0x93, 0x60, 0x1d, 0x7e, 0xbd, 0x02, 0x53, 0x46, 0x9c, 0x69,
+  0x20, 0x61, 0xaf, 0x03, 0xff, 0xfc, 0x80, 0x23, 0xa2, 0x68, 0x1b, 0x06,
+  0x13, 0xff, 0x43, 0xa3, 0x60, 0xa3, 0x68, 0x00, 0x2b, 0xfc, 0xff, 0xdb,
+  0x55, 0xe6, 0x02, 0x21, 0x09, 0x20, 0xfc, 0xff, 0xf7, 0x05, 0xfd, 0xc8,
+  0xe7, 0x64, 0x19, 0x00, 0x67, 0x00, 0x00, 0x66, 0xb3, 0x01, 0x73, 0x01,
+  0xb8, 0x0b, 0xf7, 0x01, 0xaf, 0x4e, 0x00, 0x00, 0x4c, 0x9b, 0x01, 0xe0,
+  0x13, 0x00, 0x6c, 0xbe, 0x07, 0x00, 0xd8, 0x65, 0x00, 0x08, 0x04, 0xff,
+  0x01, 0x10, 0x1a, 0x0f, 0x00, 0xec, 0x03, 0x00, 0x71, 0x22, 0x2b, 0x00,
+  0x7b, 0x02, 0x6b, 0x06, 0x53, 0xff, 0xfd, 0x15, 0x02, 0x07, 0x00, 0x40,
+  0x1f, 0x00, 0x40, 0x5b, 0x02, 0xe7, 0x08, 0x27, 0x01, 0x6b, 0x02, 0x00,
+  0x10, 0xb5, 0x89, 0xb0, 0xff, 0x01, 0x00, 0x20, 0x22, 0x68, 0x46, 0x00,
+  0xf0, 0xff, 0xe3, 0xf8, 0xef, 0xf3, 0x05, 0x83, 0x00, 0xbe, 0xff, 0xbf,
+  0xf3, 0x4f, 0x8f, 0x03, 0x4b, 0x04, 0x4a, 0xfb, 0xda, 0x60, 0x09, 0x04,
+  0xc0, 0x46, 0xfd, 0xe7, 0xc0, 0xfd, 0x46, 0x5f, 0x06, 0x04, 0x00, 0xfa,
+  0x05, 0x10, 0xb5, 0x8f, 0xff, 0xf7, 0xe5, 0xff, 0x0f, 0x00, 0x00, 0x10,
+  0x0f, 0x04, 0xdd, 0xfe, 0x0f, 0x20, 0x70, 0xb5, 0x00, 0x24, 0x00, 0x25,
+  0x28, 0xff, 0x21, 0x24, 0x4b, 0x25, 0x4a, 0x5c, 0x60, 0x1a, 0xff, 0x60,
+  0x1c, 0x81, 0x24, 0x4b, 0x24, 0x4a, 0x25, 0xff, 0x4e, 0x5d, 0x54, 0x23,
+  0x39, 0x5a, 0x60, 0xd9, 0xff, 0x62, 0x23, 0x4a, 0x37, 0x31, 0x08, 0x36,
+  0x1e, 0xff, 0x60, 0x19, 0x63, 0x60, 0x26, 0xf0, 0x21, 0x00, 0xff, 0x20,
+  0x9a, 0x60, 0x00, 0x22, 0x09, 0x06, 0x9d, 0xff, 0x55, 0x1e, 0x4e, 0x98,
+  0x63, 0xd9, 0x63, 0x18, 0xff, 0x64, 0x59, 0x64, 0x98, 0x64, 0xd9, 0x64,
+  0x18, 0xff, 0x65, 0x59, 0x65, 0x98, 0x65, 0xd9, 0x65, 0xda, 0xff, 0x60,
+  0x1a, 0x61, 0x5a, 0x61, 0x9a, 0x61, 0xdc, 0x7f, 0x61, 0x1a, 0x62, 0x5a,
+  0x62, 0x16, 0x4b, 0x39, 0x04, 0xff, 0x5a, 0x60, 0x9a, 0x60, 0xda, 0x60,
+  0x98, 0x61, 0xfe, 0xa9, 0x03, 0x61, 0x13, 0x49, 0x5a, 0x61, 0x13, 0x4b,
+  0x7f, 0x19, 0x60, 0x13, 0x49, 0x9a, 0x60, 0x59, 0x15, 0x00, 0xd7, 0x12,
+  0x4b, 0x12, 0x75, 0x10, 0x11, 0x09, 0x00, 0x1b, 0x60, 0xff, 0x5b, 0x60,
+  0x9c, 0x60, 0x11, 0x4b, 0x1d, 0x71, 0x0f, 0x1a, 0x60, 0x70, 0xbd, 0xa3,
+  0x00, 0xef, 0x02, 0x47, 0x07, 0xeb, 0x06, 0xf5, 0x50, 0xf3, 0x02, 0xf4,
+  0x03, 0x00, 0xcd, 0xcc, 0x4c, 0x3d, 0xe9, 0x14, 0x3b, 0x01, 0x23, 0x07,
+  0x04, 0x1b, 0x00, 0x24, 0x14, 0x00, 0x9f, 0x20, 0x6f, 0x12, 0x03, 0x3b,
+  0x27, 0x07, 0x6b, 0x07, 0x68, 0xbe, 0x33, 0x03, 0x01, 0xbe, 0xad, 0xde,
+  0x34, 0x17, 0x00, 0xf0, 0xff, 0xb5, 0x05, 0x00, 0x83, 0x07, 0x49, 0xd0,
+  0x54, 0xff, 0x1e, 0x00, 0x2a, 0x45, 0xd0, 0x03, 0x00, 0x03, 0xff, 0x26,
+  0xca, 0xb2, 0x02, 0xe0, 0x01, 0x35, 0x01, 0xff, 0x3c, 0x3e, 0xd3, 0x01,
+  0x33, 0x2a, 0x70, 0x33, 0xff, 0x42, 0xf8, 0xd1, 0x03, 0x2c, 0x30, 0xd9,
+  0xff, 0xff, 0x25, 0x0d, 0x40, 0x2a, 0x02, 0x2a, 0x43, 0x15, 0xff, 0x04,
+  0x15, 0x43, 0x0f, 0x2c, 0x34, 0xd9, 0x27, 0xff, 0x00, 0x10, 0x3f, 0x3f,
+  0x09, 0x3e, 0x01, 0xb4, 0xff, 0x46, 0x1e, 0x00, 0x1a, 0x00, 0x10, 0x36,
+  0x66, 0xff, 0x44, 0x15, 0x60, 0x55, 0x60, 0x95, 0x60, 0xd5, 0xef, 0x60,
+  0x10, 0x32, 0xb2, 0x33, 0x00, 0x01, 0x37, 0x3f, 0xff, 0x01, 0xdb, 0x19,
+  0x0f, 0x27, 0x0c, 0x22, 0x27, 0xff, 0x40, 0x22, 0x40, 0x3c, 0x00, 0x00,
+  0x2a, 0x0e, 0xff, 0xd0, 0x3e, 0x1f, 0xb6, 0x08, 0xb4, 0x00, 0xa4, 0xff,
+  0x46, 0x1a, 0x00, 0x1c, 0x1d, 0x64, 0x44, 0x20, 0xff, 0xc2, 0xa2, 0x42,
+  0xfc, 0xd1, 0x03, 0x24, 0x01, 0xff, 0x36, 0xb6, 0x00, 0x9b, 0x19, 0x3c,
+  0x40, 0x00, 0xff, 0x2c, 0x05, 0xd0, 0xc9, 0xb2, 0x1c, 0x19, 0x19, 0xff,
+  0x70, 0x01, 0x33, 0x9c, 0x42, 0xfb, 0xd1, 0xf0, 0xff, 0xbd, 0x03, 0x00,
+  0x14, 0x00, 0xc0, 0xe7, 0x27, 0xfb, 0x00, 0xe2, 0xab, 0x01, 0xf0, 0xb5,
+  0xc6, 0x46, 0x00, 0xff, 0xb5, 0x0f, 0x2a, 0x41, 0xd9, 0x03, 0x24, 0x03,
+  0xff, 0x00, 0x26, 0x00, 0x0b, 0x43, 0x1e, 0x40, 0x1c, 0xff, 0x42, 0x3f,
+  0xd1, 0x15, 0x00, 0x10, 0x3d, 0x2d, 0xff, 0x09, 0xa8, 0x46, 0x2d, 0x01,
+  0xac, 0x46, 0x03, 0xff, 0x00, 0x0c, 0x00, 0x84, 0x44, 0x27, 0x68, 0x1d,
+  0xff, 0x00, 0x1f, 0x60, 0x67, 0x68, 0x5f, 0x60, 0xa7, 0xff, 0x68, 0x9f,
+  0x60, 0xe7, 0x68, 0x10, 0x34, 0xdf, 0xff, 0x60, 0x10, 0x33, 0x65, 0x45,
+  0xf2, 0xd1, 0x45, 0xff, 0x46, 0x0f, 0x23, 0x0c, 0x24, 0x01, 0x35, 0x2d,
+  0xff, 0x01, 0x49, 0x19, 0x13, 0x40, 0x45, 0x19, 0x14, 0xff, 0x42, 0x22,
+  0xd0, 0x8c, 0x59, 0xac, 0x51, 0x04, 0xff, 0x36, 0x9c, 0x1b, 0x03, 0x2c,
+  0xf9, 0xd8, 0x04, 0xff, 0x3b, 0x9b, 0x08, 0x01, 0x33, 0x9b, 0x00, 0xed,
+  0xff, 0x18, 0xc9, 0x18, 0x03, 0x23, 0x1a, 0x40, 0x56, 0xfe, 0x13, 0x01,
+  0x06, 0xd0, 0x00, 0x23, 0xcc, 0x5c, 0x1a, 0xff, 0x00, 0xec, 0x54, 0x01,
+  0x33, 0x96, 0x42, 0xf9, 0xff, 0xd1, 0x80, 0xbc, 0xb8, 0x46, 0xf0, 0xbd,
+  0x05, 0xbd, 0x00, 0x1b, 0x04, 0xf1, 0xd1, 0xf7, 0xe7, 0x09, 0x04, 0xed,
+  0xef, 0xe7, 0x1a, 0x00, 0xf6, 0xa3, 0x00, 0x9e, 0x21, 0x10, 0xff, 0xb5,
+  0xc9, 0x05, 0x04, 0x1c, 0xfc, 0xf7, 0x52, 0xff, 0xfb, 0x00, 0x28, 0x03,
+  0xd1, 0x20, 0x1c, 0x00, 0xff, 0xf0, 0x65, 0xfe, 0x10, 0xbd, 0x9e, 0x21,
+  0x20, 0xff, 0x1c, 0xc9, 0x05, 0x00, 0xf0, 0xbf, 0xfc, 0x00, 0xff, 0xf0,
+  0x5d, 0xfe, 0x80, 0x23, 0x1b, 0x06, 0x9c, 0xff, 0x46, 0x60, 0x44, 0xf2,
+  0xe7, 0xf8, 0xb5, 0x47, 0xff, 0x46, 0xce, 0x46, 0x4a, 0x02, 0x43, 0x02,
+  0x45, 0xff, 0x00, 0xc4, 0x0f, 0x50, 0x0a, 0x80, 0x46, 0x48, 0xff, 0x00,
+  0x5b, 0x0a, 0x00, 0x0e, 0x92, 0x09, 0x94, 0xff, 0x46, 0x80, 0xb5, 0x1e,
+  0x00, 0x81, 0x46, 0x02, 0xff, 0x00, 0x2d, 0x0e, 0xdf, 0x00, 0xc9, 0x0f,
+  0x8c, 0xff, 0x42, 0x24, 0xd0, 0x28, 0x1a, 0x00, 0x28, 0x0e, 0xff, 0xdd,
+  0x00, 0x2a, 0x3e, 0xd1, 0x62, 0x46, 0x00, 0xff, 0x2a, 0x00, 0xd1, 0xfd,
+  0xe0, 0x42, 0x1e, 0x01, 0xbf, 0x28, 0x00, 0xd1, 0x37, 0xe1, 0xff, 0x05,
+  0x00, 0xa9, 0xff, 0xe0, 0x10, 0x00, 0x39, 0xe0, 0x00, 0x28, 0x63, 0xff,
+  0xd0, 0x4b, 0x46, 0x52, 0x1b, 0x00, 0x2d, 0x00, 0xff, 0xd0, 0xe0, 0xe0,
+  0x00, 0x2f, 0x00, 0xd1, 0xce, 0xef, 0xe0, 0x53, 0x1e, 0x01, 0x2d, 0x00,
+  0x55, 0xe1, 0xff, 0xfe, 0x05, 0x00, 0x94, 0xe0, 0x1a, 0x00, 0xd9, 0xe0,
+  0x2a, 0xed, 0x1a, 0x3f, 0x00, 0xdc, 0x99, 0x2d, 0x00, 0x62, 0xd0, 0xff,
+  0xff, 0x2d, 0x00, 0xd1, 0x8b, 0xe0, 0x80, 0x23, 0x61, 0xff, 0x46, 0xdb,
+  0x04, 0x19, 0x43, 0x8c, 0x46, 0x1b, 0xfe, 0x19, 0x00, 0xd2, 0xe0, 0x01,
+  0x23, 0xdb, 0x19, 0x5a, 0xff, 0x01, 0x6a, 0xd5, 0x01, 0x35, 0xff, 0x2d,
+  0x5b, 0xff, 0xd0, 0x01, 0x22, 0xa3, 0x49, 0x1a, 0x40, 0x5b, 0x7f, 0x08,
+  0x0b, 0x40, 0x13, 0x43, 0x1c, 0xe0, 0x31, 0x04, 0xf5, 0x72, 0x31, 0x00,
+  0x62, 0x31, 0x00, 0x1a, 0x43, 0x94, 0x46, 0xdf, 0x1b, 0x28, 0x00, 0xdc,
+  0x90, 0x31, 0x00, 0xfb, 0x1a, 0xff, 0x5a, 0x01, 0x51, 0xd5, 0x9b, 0x01,
+  0x9e, 0x09, 0xff, 0x30, 0x00, 0xfc, 0xf7, 0xdb, 0xfa, 0x33, 0x00, 0xff,
+  0x05, 0x38, 0x83, 0x40, 0x85, 0x42, 0x00, 0xdc, 0xff, 0x75, 0xe0, 0x94,
+  0x4a, 0x2d, 0x1a, 0x13, 0x40, 0xff, 0x5a, 0x07, 0x04, 0xd0, 0x0f, 0x22,
+  0x1a, 0x40, 0xff, 0x04, 0x2a, 0x00, 0xd0, 0x04, 0x33, 0x5a, 0x01, 0xff,
+  0x3c, 0xd5, 0x68, 0x1c, 0xfe, 0x2d, 0x2b, 0xd0, 0xff, 0x9b, 0x01, 0x5e,
+  0x0a, 0xc0, 0xb2, 0xc0, 0x05, 0xff, 0x30, 0x43, 0xe4, 0x07, 0x20, 0x43,
+  0xc0, 0xbc, 0xff, 0xb9, 0x46, 0xb0, 0x46, 0xf8, 0xbd, 0xfe, 0x20, 0xbf,
+  0x6a, 0x1c, 0x10, 0x42, 0x72, 0xd1, 0xcb, 0x04, 0xae, 0xfe, 0xcb, 0x08,
+  0xec, 0xe0, 0x63, 0x46, 0x00, 0x20, 0x00, 0x77, 0x2b, 0xe9, 0xd0, 0x6b,
+  0x04, 0x00, 0xd4, 0xf3, 0x0f, 0x00, 0xff, 0x0c, 0x00, 0xdb, 0x1b, 0xd2,
+  0xe7, 0x61, 0x46, 0xdf, 0x00, 0x29, 0x5b, 0xd0, 0x51, 0xe9, 0x08, 0xa7,
+  0xe0, 0xff, 0xff, 0x2a, 0x22, 0xd0, 0x0a, 0x00, 0x99, 0xe7, 0xff, 0xff,
+  0x20, 0x00, 0x26, 0xd3, 0xe7, 0xfe, 0x21, 0xff, 0x6a, 0x1c, 0x11, 0x42,
+  0x73, 0xd0, 0xff, 0x2a, 0xff, 0xf6, 0xd0, 0x15, 0x00, 0x67, 0x44, 0x7b,
+  0x08, 0xff, 0x5a, 0x07, 0xbb, 0xd1, 0xdb, 0x08, 0xff, 0x2d, 0xff, 0x0f,
+  0xd0, 0x5b, 0x02, 0x5e, 0x0a, 0xe8, 0xb2, 0xfb, 0xc1, 0xe7, 0x51, 0x05,
+  0x08, 0xd0, 0x80, 0x22, 0xd2, 0xff, 0x03, 0x13, 0x42, 0x04, 0xd0, 0x40,
+  0x46, 0x10, 0xff, 0x42, 0x01, 0xd1, 0x0c, 0x00, 0x43, 0x46, 0x00, 0xff,
+  0x2b, 0xdc, 0xd0, 0x80, 0x26, 0xf6, 0x03, 0x1e, 0xff, 0x43, 0x76, 0x02,
+  0xff, 0x20, 0x76, 0x0a, 0xac, 0xbf, 0xe7, 0x00, 0x2a, 0xd6, 0xd0, 0x42,
+  0x5f, 0x01, 0x5c, 0xff, 0xd0, 0xff, 0x28, 0xee, 0xd0, 0x80, 0x23, 0xdb,
+  0xd7, 0x04, 0x1f, 0x43, 0x33, 0x05, 0x82, 0x01, 0x01, 0x4d, 0x46, 0xff,
+  0x63, 0x44, 0x63, 0xe7, 0x20, 0x22, 0x40, 0x1b, 0xff, 0x01, 0x30, 0x12,
+  0x1a, 0x19, 0x00, 0x93, 0x40, 0xff, 0xc1, 0x40, 0x5a, 0x1e, 0x93, 0x41,
+  0x00, 0x25, 0xdf, 0x0b, 0x43, 0x80, 0xe7, 0x20, 0x63, 0x01, 0x1b, 0x1a,
+  0xff, 0x99, 0x40, 0x62, 0x46, 0x0b, 0x00, 0xc2, 0x40, 0xff, 0x59, 0x1e,
+  0x8b, 0x41, 0x13, 0x43, 0x64, 0xe7, 0xfe, 0x65, 0x04, 0x15, 0x00, 0xb8,
+  0xe7, 0x63, 0x46, 0xfe, 0xff, 0x1a, 0x73, 0x01, 0x45, 0xd4, 0x00, 0x2e,
+  0x00, 0xdf, 0xd0, 0x5e, 0xe7, 0x00, 0x24, 0xe7, 0x00, 0x26, 0x75, 0xef,
+  0xe7, 0xff, 0x2b, 0xbb, 0x63, 0x18, 0x47, 0xdd, 0x01, 0xfe, 0x73, 0x01,
+  0x0c, 0x00, 0x4d, 0x46, 0xd3, 0x1a, 0x49, 0xfa, 0x77, 0x02, 0x9e, 0xf5,
+  0x00, 0x20, 0x23, 0xd1, 0x40, 0x9b, 0x7f, 0x1a, 0x62, 0x46, 0x9a, 0x40,
+  0x13, 0x00, 0x69, 0x04, 0xff, 0x0b, 0x43, 0x22, 0xe7, 0x00, 0x2d, 0x46,
+  0xd1, 0xef, 0x00, 0x2f, 0x62, 0xd0, 0x2b, 0x0d, 0x00, 0xd1, 0x52, 0xff,
+  0xe7, 0x3b, 0x00, 0x63, 0x44, 0x5a, 0x01, 0x83, 0xff, 0xd5, 0x32, 0x4a,
+  0x01, 0x35, 0x13, 0x40, 0x7f, 0x5f, 0xe7, 0x00, 0x2f, 0xc4, 0xd0, 0x15,
+  0x06, 0x12, 0x13, 0x01, 0x67, 0x8c, 0xd0, 0x1a, 0x49, 0x00, 0x5d, 0x01,
+  0xd0, 0x7c, 0x83, 0x00, 0xff, 0x00, 0x2b, 0x83, 0xd1, 0x80, 0x26, 0x00,
+  0x24, 0xdf, 0xff, 0x20, 0xf6, 0x03, 0x36, 0x0f, 0x00, 0x0c, 0x00, 0xb7,
+  0xde, 0x1b, 0x17, 0x3f, 0x08, 0x01, 0x25, 0x71, 0x05, 0x61, 0xff, 0xe7,
+  0x02, 0x25, 0xf7, 0xe6, 0x63, 0x46, 0x01, 0xef, 0x25, 0xfb, 0x1a, 0x07,
+  0xd1, 0x00, 0x9b, 0x1a, 0x38, 0xbf, 0x00, 0x9f, 0x40, 0x3b, 0x00, 0xd0,
+  0xe7, 0x08, 0x03, 0xab, 0x43, 0xae, 0x13, 0x08, 0x39, 0x13, 0x08, 0xd1,
+  0x13, 0x08, 0x0b, 0x9b, 0x43, 0x73, 0x5d, 0x04, 0xd1, 0x58, 0x63, 0x09,
+  0x87, 0x02, 0xe7, 0xfe, 0x65, 0x0d, 0x00, 0xd1, 0x50, 0xe7, 0x41, 0x46,
+  0x11, 0xff, 0x42, 0x00, 0xd0, 0x4c, 0xe7, 0x43, 0x46, 0x4a, 0x5e, 0x7b,
+  0x0c, 0xd0, 0x0c, 0x00, 0x46, 0xb5, 0x00, 0xf9, 0x61, 0x00, 0xde, 0xd7,
+  0x05, 0x01, 0x35, 0xd5, 0xe6, 0x0f, 0x04, 0xf1, 0xe6, 0xf6, 0xc7, 0x00,
+  0xd0, 0x23, 0x15, 0x05, 0x26, 0xeb, 0xe6, 0xc0, 0xdf, 0x46, 0xff, 0xff,
+  0xff, 0x7d, 0x03, 0x00, 0xfb, 0xf0, 0xff, 0xb5, 0x4f, 0x46, 0x46, 0x46,
+  0xd6, 0x46, 0x45, 0xff, 0x02, 0xc0, 0xb5, 0x47, 0x00, 0x0c, 0x1c, 0x6d,
+  0xdf, 0x0a, 0x3f, 0x0e, 0xc6, 0x0f, 0x6d, 0x04, 0x6f, 0xe0, 0xfd, 0xff,
+  0x05, 0x00, 0x74, 0xe0, 0x00, 0x23, 0x80, 0x22, 0xff, 0x99, 0x46, 0x9a,
+  0x46, 0xed, 0x00, 0xd2, 0x04, 0xff, 0x15, 0x43, 0x7f, 0x3f, 0x63, 0x02,
+  0x5b, 0x0a, 0xff, 0x98, 0x46, 0x63, 0x00, 0x1b, 0x0e, 0xe4, 0x0f, 0xff,
+  0x00, 0x2b, 0x4d, 0xd0, 0xff, 0x2b, 0x45, 0xd0, 0xff, 0x42, 0x46, 0x80,
+  0x21, 0xd2, 0x00, 0xc9, 0x04, 0xff, 0x11, 0x43, 0x88, 0x46, 0x00, 0x22,
+  0x7f, 0x3b, 0xff, 0x31, 0x00, 0xff, 0x1a, 0x4b, 0x46, 0x61, 0x40, 0xff,
+  0xc9, 0xb2, 0x0f, 0x2b, 0x00, 0xd9, 0xb8, 0xe0, 0xff, 0x70, 0x48, 0x9b,
+  0x00, 0xc3, 0x58, 0x9f, 0x46, 0xff, 0x00, 0x23, 0x98, 0x46, 0x26, 0x00,
+  0x45, 0x46, 0xdf, 0x92, 0x46, 0x53, 0x46, 0x02, 0x57, 0x01, 0x8d, 0xe0,
+  0xfd, 0x03, 0x05, 0x00, 0xa1, 0xe0, 0x01, 0x2b, 0x18, 0xd0, 0xff, 0x3b,
+  0x00, 0x7f, 0x33, 0x00, 0x2b, 0x6d, 0xdd, 0xf5, 0x6a, 0xe1, 0x0a, 0x2a,
+  0xe1, 0x0e, 0x35, 0x2a, 0x01, 0x03, 0xef, 0xd5, 0x61, 0x4b, 0x1d, 0x0b,
+  0x01, 0x80, 0x33, 0xfe, 0xff, 0x2b, 0x00, 0xdd, 0x74, 0xe0, 0xaa, 0x01,
+  0x52, 0x7f, 0x0a, 0xd8, 0xb2, 0x02, 0xe0, 0x0e, 0x00, 0x9b, 0x01, 0xff,
+  0x22, 0xc0, 0x05, 0xf6, 0x07, 0x10, 0x43, 0x30, 0xff, 0x43, 0xe0, 0xbc,
+  0xba, 0x46, 0xb1, 0x46, 0xa8, 0xf7, 0x46, 0xf0, 0xbd, 0x71, 0x06, 0x3f,
+  0xd1, 0x02, 0x22, 0xef, 0xff, 0x3f, 0x03, 0xe0, 0x0b, 0x04, 0x2d, 0xd1,
+  0x01, 0xf7, 0x22, 0x31, 0x00, 0x8d, 0x0c, 0x13, 0x43, 0x0f, 0x2b, 0xf7,
+  0x38, 0xd8, 0x4e, 0x8d, 0x14, 0x2d, 0x13, 0xd1, 0x04, 0xff, 0x23, 0x99,
+  0x46, 0x03, 0x3b, 0x00, 0x27, 0x9a, 0xbb, 0x46, 0x92, 0xf5, 0x01, 0x05,
+  0xd1, 0x08, 0x0f, 0x00, 0x06, 0xbb, 0x3b, 0xff, 0x0f, 0x00, 0x8a, 0xe7,
+  0x0c, 0x0b, 0x00, 0x09, 0xee, 0x0b, 0x08, 0x84, 0xe7, 0x28, 0x8f, 0x03,
+  0x13, 0xf9, 0x76, 0xff, 0x27, 0x43, 0x1f, 0x9d, 0x40, 0x00, 0x23, 0x7f,
+  0xfd, 0x42, 0x11, 0x05, 0x3f, 0x1a, 0x78, 0xe7, 0x40, 0x46, 0xff, 0xfc,
+  0xf7, 0x07, 0xf9, 0x42, 0x46, 0x43, 0x1f, 0x7f, 0x9a, 0x40, 0x76, 0x23,
+  0x5b, 0x42, 0x90, 0x9f, 0x02, 0xff, 0x00, 0x22, 0x7e, 0xe7, 0x03, 0x23,
+  0x4a, 0x46, 0xff, 0x1a, 0x43, 0x91, 0x46, 0xfc, 0x33, 0x03, 0x22, 0xef,
+  0x77, 0xe7, 0x0e, 0x00, 0x47, 0x03, 0x22, 0xa8, 0xe7, 0xff, 0x01, 0x22,
+  0xd3, 0x1a, 0x1b, 0x2b, 0xa2, 0xdc, 0xff, 0x9e, 0x37, 0x2a, 0x00, 0xbd,
+  0x40, 0xda, 0x40, 0xbf, 0x6b, 0x1e, 0x9d, 0x41, 0x15, 0x43, 0xf1, 0x2c,
+  0x6a, 0xaf, 0x01, 0x44, 0xd5, 0x01, 0x2d, 0x00, 0x91, 0x7b, 0x07, 0x22,
+  0xfd, 0x8e, 0xeb, 0x01, 0x00, 0x26, 0xff, 0x20, 0xd2, 0x03, 0xf3, 0x89,
+  0xe7, 0x3d, 0x05, 0xf9, 0x05, 0x15, 0x42, 0x08, 0xd0, 0xff, 0x43, 0x46,
+  0x13, 0x42, 0x05, 0xd1, 0x1a, 0x43, 0x77, 0x52, 0x02, 0x26, 0x5b, 0x00,
+  0x52, 0x0a, 0x7a, 0x13, 0x0a, 0xf9, 0x2a, 0x0f, 0x00, 0x0d, 0x04, 0x73,
+  0xe7, 0x42, 0x46, 0x6b, 0xff, 0x01, 0x55, 0x01, 0xab, 0x42, 0x1a, 0xd2,
+  0x1b, 0xfe, 0x45, 0x00, 0x01, 0x3f, 0x01, 0x26, 0x1c, 0x00, 0x52, 0xff,
+  0x00, 0x5b, 0x00, 0x00, 0x2c, 0x01, 0xdb, 0x9d, 0xff, 0x42, 0x01, 0xd8,
+  0x5b, 0x1b, 0x32, 0x43, 0x01, 0xff, 0x38, 0x00, 0x28, 0xf3, 0xd1, 0x58,
+  0x1e, 0x83, 0xc6, 0x45, 0x03, 0x1d, 0x00, 0x7f, 0x05, 0x53, 0x01, 0x63,
+  0x01, 0x3d, 0xe7, 0xff, 0xaa, 0xe7, 0x1a, 0x20, 0x01, 0x22, 0x5b, 0x1b,
+  0xdf, 0xe3, 0xe7, 0xaa, 0x01, 0x00, 0x4f, 0x00, 0x4b, 0xe7, 0x6f, 0x24,
+  0x68, 0x00, 0x08, 0x2f, 0x02, 0xf7, 0x64, 0x07, 0x00, 0xff, 0x70, 0xb5,
+  0x42, 0x00, 0x45, 0x02, 0x4e, 0x02, 0xff, 0x4c, 0x00, 0xc3, 0x0f, 0x6d,
+  0x0a, 0x01, 0x20, 0xff, 0x12, 0x0e, 0x76, 0x0a, 0x24, 0x0e, 0xc9, 0x0f,
+  0xff, 0xff, 0x2a, 0x06, 0xd0, 0xff, 0x2c, 0x03, 0xd0, 0xfd, 0xa2, 0xf9,
+  0x03, 0xb5, 0x42, 0x06, 0xd0, 0x70, 0xbd, 0xff, 0x00, 0x2d, 0xfc, 0xd1,
+  0xff, 0x2c, 0xfa, 0xd1, 0x9f, 0x00, 0x2e, 0xf8, 0xd1, 0x8b, 0x11, 0x00,
+  0xd7, 0x00, 0x2a, 0xff, 0xf3, 0xd1, 0x28, 0x00, 0x43, 0x1e, 0x98, 0x41,
+  0x3f, 0xef, 0xe7, 0x00, 0x20, 0xed, 0xe7, 0x4b, 0x2c, 0x49, 0x0c, 0xf5,
+  0xc8, 0x49, 0x00, 0x1b, 0x49, 0x00, 0x0e, 0xd0, 0x00, 0x2a, 0xf3, 0x1b,
+  0xd1, 0xb1, 0x00, 0x3f, 0x00, 0x1c, 0xd0, 0x00, 0x2d, 0xff, 0x0c, 0xd0,
+  0x83, 0x42, 0x1c, 0xd0, 0x02, 0x21, 0xbf, 0x58, 0x1e, 0x08, 0x40, 0x01,
+  0x38, 0x5d, 0x00, 0x2e, 0xff, 0x22, 0xd1, 0x00, 0x2a, 0xf4, 0xd1, 0x00,
+  0x2d, 0xff, 0xf2, 0xd1, 0x00, 0x28, 0xf6, 0xd1, 0x01, 0x20, 0xd7, 0x40,
+  0x42, 0xf3, 0xc5, 0x01, 0x17, 0x73, 0x00, 0xf0, 0xd0, 0x77, 0x00, 0x2c,
+  0xe7, 0x37, 0x00, 0xe5, 0xd1, 0xe6, 0x67, 0x00, 0xff, 0x00, 0x2d, 0xe7,
+  0xd0, 0xe2, 0xe7, 0xa2, 0x42, 0xff, 0x05, 0xdc, 0xea, 0xdb, 0xb5, 0x42,
+  0x02, 0xd8, 0xff, 0xe7, 0xd3, 0x00, 0x20, 0xde, 0xe7, 0x43, 0x42, 0xff,
+  0x58, 0x41, 0x40, 0x00, 0x01, 0x38, 0xd9, 0xe7, 0x55, 0x02, 0x39, 0x00,
+  0xd6, 0x8b, 0x58, 0x0b, 0x8b, 0x00, 0x0d, 0x8b, 0x00, 0xb5, 0x1f, 0x8b,
+  0x00, 0x16, 0x53, 0x00, 0x14, 0xd1, 0x51, 0x04, 0x10, 0xa7, 0xd0, 0x09,
+  0xe0, 0x93, 0x00, 0x6b, 0x00, 0x13, 0x13, 0x00, 0x08, 0xea, 0x89, 0x00,
+  0x08, 0x9f, 0x00, 0x12, 0x9f, 0x18, 0x00, 0xe0, 0x02, 0xd9, 0x20, 0x01,
+  0x05, 0x9f, 0x00, 0x28, 0xfa, 0x9b, 0x08, 0xf7, 0xe7, 0x77, 0x00, 0x2c,
+  0xed, 0x2b, 0x00, 0xeb, 0xd1, 0xec, 0x8b, 0x08, 0xd5, 0xf2, 0x8b, 0x08,
+  0xef, 0x8b, 0x00, 0xea, 0x8b, 0x18, 0xe5, 0xe7, 0xa7, 0xc0, 0x46, 0x43,
+  0x61, 0x03, 0x97, 0x0f, 0x99, 0x99, 0x03, 0xc3, 0xff, 0x0f, 0x45, 0x00,
+  0x98, 0x46, 0xc0, 0xb5, 0x4b, 0xff, 0x46, 0x0f, 0x1c, 0x2d, 0x0e, 0x00,
+  0xd1, 0xcb, 0xff, 0xe0, 0xff, 0x2d, 0x00, 0xd1, 0xcf, 0xe0, 0x80, 0xfb,
+  0x22, 0xdb, 0x91, 0x03, 0x1a, 0x43, 0x00, 0x23, 0x91, 0xff, 0x46, 0x00,
+  0x26, 0x9a, 0x46, 0x7f, 0x3d, 0x7c, 0xff, 0x02, 0x7b, 0x00, 0x64, 0x0a,
+  0x1b, 0x0e, 0xff, 0xfe, 0x97, 0x03, 0x00, 0xd1, 0xa9, 0xe0, 0xff, 0x2b,
+  0x11, 0xef, 0xd0, 0x80, 0x22, 0xe4, 0x25, 0x00, 0x14, 0x43, 0x42, 0xff,
+  0x46, 0x7f, 0x3b, 0x5b, 0x19, 0x7a, 0x40, 0x00, 0xff, 0x20, 0xd2, 0xb2,
+  0x5d, 0x1c, 0x0a, 0x2e, 0x13, 0xff, 0xdd, 0x3a, 0x00, 0x0b, 0x2e, 0x47,
+  0xd0, 0x47, 0xff, 0x46, 0x3f, 0xe0, 0x2b, 0x00, 0xff, 0x33, 0x00, 0xeb,
+  0x2c, 0x1e, 0x33, 0x03, 0x16, 0x27, 0x00, 0x01, 0x35, 0x7a, 0xff, 0x40,
+  0xd2, 0xb2, 0xff, 0x35, 0x0a, 0x2e, 0x00, 0xfb, 0xdd, 0xe4, 0xc3, 0x00,
+  0x02, 0x2e, 0x1c, 0xdc, 0x01, 0xff, 0x3e, 0x01, 0x2e, 0x42, 0xd8, 0x02,
+  0x28, 0x3d, 0xef, 0xd0, 0x01, 0x28, 0x66, 0xfd, 0x04, 0x21, 0xc0, 0x05,
+  0xa7, 0x08, 0x43, 0xd2, 0x79, 0x03, 0x77, 0x1f, 0x03, 0x3d, 0x40, 0x03,
+  0xff, 0x20, 0x01, 0x21, 0xb1, 0x40, 0xa6, 0x26, 0xf6, 0xff, 0x00, 0x31,
+  0x42, 0x0a, 0xd1, 0x90, 0x26, 0xb6, 0xfe, 0x07, 0x00, 0x16, 0xd1, 0xb9,
+  0x3e, 0xff, 0x3e, 0x0e, 0xff, 0x42, 0x1a, 0xd0, 0xa1, 0x46, 0x82, 0x46,
+  0x00, 0xff, 0xe0, 0x17, 0x00, 0x53, 0x46, 0x3a, 0x00, 0x02, 0xff, 0x2b,
+  0x0f, 0xd0, 0x4c, 0x46, 0x50, 0x46, 0x03, 0xff, 0x28, 0xcd, 0xd1, 0x80,
+  0x21, 0xc9, 0x03, 0x21, 0xfb, 0x43, 0x49, 0xc9, 0x02, 0x49, 0x0a, 0xca,
+  0xe7, 0x80, 0xff, 0x21, 0x00, 0x22, 0xff, 0x20, 0xc9, 0x03, 0xc5, 0xfe,
+  0x0f, 0x07, 0x21, 0xc2, 0xe7, 0x20, 0x0c, 0x49, 0x46, 0xff, 0x24, 0x04,
+  0x24, 0x0c, 0x27, 0x00, 0x0e, 0x0c, 0xff, 0x09, 0x04, 0x09, 0x0c, 0x74,
+  0x43, 0x4f, 0x43, 0xff, 0x46, 0x43, 0x48, 0x43, 0x39, 0x0c, 0x00, 0x19,
+  0xff, 0x09, 0x18, 0x8c, 0x42, 0x03, 0xd9, 0x80, 0x20, 0xff, 0x40, 0x02,
+  0x84, 0x46, 0x66, 0x44, 0x3f, 0x04, 0xff, 0x08, 0x04, 0x3f, 0x0c, 0xc0,
+  0x19, 0x84, 0x01, 0xff, 0x67, 0x1e, 0xbc, 0x41, 0x09, 0x0c, 0x80, 0x0e,
+  0xff, 0x89, 0x19, 0x04, 0x43, 0x89, 0x01, 0x0c, 0x43, 0xff, 0x09, 0x01,
+  0x71, 0xd5, 0x01, 0x23, 0x61, 0x08, 0xdf, 0x1c, 0x40, 0x0c, 0x43, 0x2b,
+  0xf7, 0x02, 0x00, 0x2b, 0xf7, 0x51, 0xdd, 0x61, 0x85, 0x07, 0x21, 0x21,
+  0x40, 0x04, 0xfd, 0x29, 0x85, 0x03, 0x34, 0x21, 0x01, 0x03, 0xd5, 0x43,
+  0xff, 0x4b, 0x1c, 0x40, 0x2b, 0x00, 0x80, 0x33, 0xfe, 0xff, 0x2b, 0xc1,
+  0xdc, 0xa1, 0x01, 0x49, 0x0a, 0xd8, 0xfb, 0xb2, 0x83, 0xc1, 0x01, 0x2c,
+  0xd1, 0x01, 0x23, 0x42, 0xbb, 0x46, 0x1e, 0x37, 0x00, 0x7a, 0x40, 0x01,
+  0x4d, 0x11, 0x00, 0xff, 0xdd, 0x57, 0xe7, 0x6a, 0xe7, 0x00, 0x2b, 0x10,
+  0xfe, 0x1b, 0x00, 0x04, 0x26, 0x00, 0x25, 0x9a, 0x46, 0x38, 0xfe, 0x0d,
+  0x00, 0x04, 0xd1, 0x02, 0x23, 0x08, 0x26, 0xff, 0xbe, 0x0d, 0x00, 0x31,
+  0xe7, 0x03, 0x23, 0x0c, 0x09, 0x08, 0x2c, 0xff, 0xe7, 0x48, 0x46, 0xfb,
+  0xf7, 0xee, 0xfe, 0x4a, 0xff, 0x46, 0x43, 0x1f, 0x76, 0x25, 0x9a, 0x40,
+  0x00, 0xf7, 0x23, 0x6d, 0x42, 0xbf, 0x0d, 0x2d, 0x1a, 0x1e, 0xe7, 0x7f,
+  0x20, 0x00, 0xfb, 0xf7, 0xe0, 0xfe, 0x42, 0x1b, 0x00, 0xbf, 0x9c, 0x40,
+  0x2b, 0x1a, 0x76, 0x3b, 0xaf, 0x1d, 0x00, 0xff, 0xdd, 0x26, 0xe7, 0x39,
+  0xe7, 0x01, 0x21, 0xcb, 0xfb, 0x1a, 0x1b, 0xa1, 0x0b, 0x9e, 0x35, 0x21,
+  0x00, 0xac, 0xff, 0x40, 0xd9, 0x40, 0x63, 0x1e, 0x9c, 0x41, 0x21, 0xfb,
+  0x43, 0x4b, 0xbb, 0x04, 0x23, 0x0b, 0x40, 0x04, 0x2b, 0xbe, 0xbb, 0x00,
+  0x31, 0x4b, 0x01, 0x04, 0xd5, 0x69, 0x03, 0x21, 0x7f, 0x2c, 0xe7, 0x1d,
+  0x00, 0x8f, 0xe7, 0x89, 0xc1, 0x03, 0xff, 0x49, 0x0a, 0x26, 0xe7, 0x02,
+  0x23, 0x0f, 0x2e, 0xfd, 0x0c, 0x5b, 0x01, 0x4b, 0x46, 0xc9, 0x03, 0x0b,
+  0x42, 0xbf, 0x0d, 0xd0, 0x0c, 0x42, 0x0b, 0xd1, 0x65, 0x05, 0x3a, 0xfd,
+  0x00, 0x67, 0x05, 0x16, 0xe7, 0x0b, 0x2e, 0x00, 0xd0, 0x7f, 0xf7, 0xe6,
+  0xa1, 0x46, 0x9a, 0x46, 0x36, 0x73, 0x01, 0x5a, 0x25, 0x04, 0x19, 0x1d,
+  0x00, 0x42, 0x46, 0x1d, 0x04, 0x07, 0xbf, 0x00, 0xbb, 0xdf, 0xe7, 0xff,
+  0x07, 0xf0, 0xb5, 0xc6, 0x9f, 0x0a, 0x45, 0xff, 0x00, 0xda, 0x00, 0xc4,
+  0x0f, 0x48, 0x02, 0x4f, 0xff, 0x00, 0x94, 0x46, 0x42, 0x0a, 0x1e, 0x00,
+  0x90, 0xff, 0x46, 0x00, 0xb5, 0x2d, 0x0e, 0x3f, 0x0e, 0xc9, 0xff, 0x0f,
+  0x80, 0x09, 0xff, 0x2f, 0x59, 0xd0, 0x01, 0xff, 0x22, 0x51, 0x40, 0x8c,
+  0x42, 0x39, 0xd0, 0xea, 0xff, 0x1b, 0x00, 0x2a, 0x58, 0xdd, 0x00, 0x2f,
+  0x68, 0xfd, 0xd0, 0xb5, 0x06, 0xd1, 0xe0, 0x80, 0x23, 0xdb, 0x04, 0xff,
+  0x18, 0x43, 0x1b, 0x2a, 0x00, 0xdc, 0xe3, 0xe0, 0xff, 0x01, 0x23, 0x62,
+  0x46, 0xd3, 0x1a, 0x5a, 0x01, 0xff, 0x00, 0xd4, 0xac, 0xe0, 0x9b, 0x01,
+  0x9e, 0x09, 0xfd, 0x30, 0xfd, 0x00, 0x61, 0xfe, 0x33, 0x00, 0x05, 0x38,
+  0xff, 0x83, 0x40, 0x85, 0x42, 0x00, 0xdc, 0xc6, 0xe0, 0x7f, 0xb2, 0x4a,
+  0x2d, 0x1a, 0x13, 0x40, 0x5a, 0xdd, 0x04, 0x5f, 0x22, 0x1a, 0x40, 0x04,
+  0x2a, 0xdd, 0x00, 0x33, 0x2f, 0x04, 0x5f, 0x97, 0xe0, 0x6a, 0x1c, 0xfe,
+  0x4f, 0x00, 0x84, 0x37, 0x00, 0xff, 0x5e, 0x0a, 0xd2, 0xb2, 0xd0, 0x05,
+  0x30, 0x43, 0x7f, 0xe4, 0x07, 0x20, 0x43, 0x80, 0xbc, 0xb8, 0x89, 0x02,
+  0xaa, 0x73, 0x04, 0x41, 0x73, 0x00, 0x6b, 0x73, 0x08, 0x97, 0x73, 0x20,
+  0xcc, 0xfe, 0x73, 0x00, 0x63, 0x44, 0x5a, 0x01, 0x74, 0xd5, 0x01, 0xef,
+  0x35, 0xff, 0x2d, 0x65, 0xa5, 0x00, 0x9a, 0x49, 0x1a, 0xff, 0x40, 0x5b,
+  0x08, 0x0b, 0x40, 0x13, 0x43, 0xcb, 0xff, 0xe7, 0x00, 0x28, 0x1f, 0xd0,
+  0x8c, 0x42, 0x22, 0xff, 0xd0, 0x2a, 0x00, 0xff, 0x3a, 0x00, 0x2a, 0x35,
+  0xff, 0xd0, 0x7a, 0x1b, 0x00, 0x2d, 0x00, 0xd0, 0x99, 0xf7, 0xe0, 0x63,
+  0x46, 0x4f, 0x07, 0xdd, 0xe0, 0x53, 0x1e, 0xff, 0x01, 0x2a, 0x00, 0xd1,
+  0x05, 0xe1, 0xff, 0x2a, 0xff, 0x6b, 0xd0, 0x1a, 0x00, 0x94, 0xe0, 0x00,
+  0x28, 0xf7, 0x73, 0xd0, 0x51, 0x13, 0x08, 0xdf, 0xe0, 0xff, 0x2a, 0xbf,
+  0x63, 0xd0, 0x0a, 0x00, 0x92, 0xe7, 0xf7, 0x04, 0xa1, 0x5f, 0x42, 0x00,
+  0xd0, 0x82, 0xe7, 0x45, 0x0c, 0x36, 0x45, 0x0c, 0xff, 0xd1, 0xaa, 0xe0,
+  0xff, 0x2f, 0x00, 0xd1, 0xda, 0xfe, 0x8b, 0x00, 0x61, 0x46, 0xdb, 0x04,
+  0x19, 0x43, 0x8c, 0xf5, 0x46, 0x8f, 0x04, 0xd4, 0x8f, 0x00, 0x3d, 0x00,
+  0x1b, 0x18, 0xff, 0xb5, 0xe7, 0xfe, 0x27, 0x6a, 0x1c, 0x17, 0x42, 0xeb,
+  0x71, 0xd1, 0x71, 0x04, 0x9e, 0x71, 0x10, 0xd5, 0xe0, 0x00, 0xff, 0x22,
+  0x00, 0x28, 0x00, 0xd1, 0x8f, 0xe7, 0x1b, 0xeb, 0x1a, 0x5e, 0xf5, 0x00,
+  0xd6, 0x17, 0x00, 0x0c, 0x00, 0xc3, 0xab, 0x1a, 0x76, 0xa9, 0x00, 0x36,
+  0x79, 0x10, 0x9a, 0x79, 0x00, 0x26, 0xfe, 0x79, 0x00, 0x8f, 0xe7, 0xff,
+  0x22, 0x00, 0x26, 0x7a, 0xfe, 0x47, 0x10, 0x62, 0xd0, 0xff, 0x2a, 0xf6,
+  0xd0, 0x15, 0xff, 0x00, 0x60, 0x44, 0x43, 0x08, 0x5a, 0x07, 0x00, 0xff,
+  0xd0, 0x5f, 0xe7, 0xdb, 0x08, 0xff, 0x2d, 0x12, 0xff, 0xd0, 0x5b, 0x02,
+  0x5e, 0x0a, 0xea, 0xb2, 0x67, 0xaf, 0xe7, 0x62, 0x46, 0x00, 0x3b, 0x00,
+  0x93, 0xc1, 0x00, 0x08, 0xff, 0xd0, 0x80, 0x22, 0xd2, 0x03, 0x13, 0x42,
+  0x04, 0xff, 0xd0, 0x40, 0x46, 0x10, 0x42, 0x01, 0xd1, 0x0c, 0xfb, 0x00,
+  0x43, 0x7b, 0x00, 0xd8, 0xd0, 0x80, 0x26, 0xf6, 0xff, 0x03, 0x1e, 0x43,
+  0x76, 0x02, 0xff, 0x22, 0x76, 0xff, 0x0a, 0x4f, 0xe7, 0x43, 0x46, 0x15,
+  0x00, 0xde, 0xff, 0xe7, 0x20, 0x22, 0x40, 0x1b, 0x01, 0x30, 0x12, 0xff,
+  0x1a, 0x19, 0x00, 0x93, 0x40, 0xc1, 0x40, 0x5a, 0xff, 0x1e, 0x93, 0x41,
+  0x00, 0x25, 0x0b, 0x43, 0x2f, 0xff, 0xe7, 0x20, 0x23, 0x9b, 0x1a, 0x01,
+  0x00, 0x98, 0xef, 0x40, 0x03, 0x00, 0xd1, 0x15, 0x08, 0x0b, 0x43, 0x12,
+  0xff, 0xe7, 0xff, 0x2f, 0xd9, 0xd0, 0x80, 0x23, 0x64, 0xee, 0xeb, 0x00,
+  0x1c, 0x43, 0xa4, 0xeb, 0x00, 0x52, 0xdd, 0x01, 0xef, 0x23, 0x0c, 0x00,
+  0x3d, 0xbd, 0x00, 0x06, 0xe7, 0x63, 0xff, 0x46, 0x1e, 0x1a, 0x73, 0x01,
+  0x39, 0xd4, 0x00, 0xde, 0x71, 0x02, 0x04, 0xe7, 0x00, 0x24, 0xe5, 0x00,
+  0x26, 0x1d, 0x7e, 0x45, 0x40, 0x29, 0xe7, 0x00, 0x2d, 0xa9, 0xd1, 0x0b,
+  0x05, 0x7b, 0x56, 0xd0, 0x09, 0x0d, 0x0a, 0xe7, 0x03, 0x00, 0xbf, 0x05,
+  0xff, 0x94, 0xd5, 0x2b, 0x4a, 0x01, 0x35, 0x13, 0x40, 0xbd, 0x90, 0x4b,
+  0x00, 0x00, 0x2b, 0xaf, 0xd0, 0x99, 0x05, 0x15, 0xea, 0xf3, 0x00, 0x2a,
+  0x97, 0x01, 0x52, 0xdd, 0x08, 0x91, 0xd1, 0x00, 0xff, 0x28, 0x98, 0xd1,
+  0x80, 0x26, 0x00, 0x24, 0xff, 0xdf, 0x22, 0xf6, 0x03, 0xee, 0xe6, 0xd7,
+  0x04, 0x15, 0x00, 0xfd, 0x7c, 0x2f, 0x00, 0x0c, 0x00, 0xc6, 0x1a, 0xc9,
+  0xe6, 0xf6, 0x47, 0x04, 0x01, 0x25, 0x4b, 0x06, 0x6e, 0xe7, 0x02, 0x25,
+  0xff, 0xfa, 0xe6, 0x63, 0x46, 0x01, 0x25, 0x1b, 0x1a, 0xff, 0xb8, 0xe6,
+  0x64, 0x46, 0x20, 0x23, 0xd4, 0x40, 0xff, 0x9b, 0x1a, 0x62, 0x46, 0x9a,
+  0x40, 0x13, 0x00, 0xee, 0x87, 0x04, 0x23, 0x43, 0xa2, 0xff, 0x00, 0x74,
+  0xe7, 0x61, 0xba, 0x19, 0x00, 0xd1, 0x19, 0x28, 0x0b, 0x43, 0x20, 0x4f,
+  0x08, 0x01, 0xff, 0x25, 0xc3, 0x1a, 0x9b, 0xe6, 0x00, 0x28, 0x99, 0xff,
+  0xd0, 0x0c, 0x00, 0x46, 0x46, 0x00, 0x22, 0xb7, 0x6d, 0xe6, 0x05, 0x04,
+  0xb4, 0xe6, 0xc3, 0x01, 0xd0, 0x3f, 0xdf, 0x04, 0xd7, 0x26, 0xae, 0xe6,
+  0x3b, 0x03, 0xfb, 0x03, 0x00, 0x7d, 0x41, 0xff, 0x02, 0x42, 0x00, 0xc3,
+  0x0f, 0x49, 0x0a, 0x00, 0xff, 0x20, 0x12, 0x0e, 0x7e, 0x2a, 0x03, 0xdd,
+  0x9d, 0xff, 0x2a, 0x02, 0xdd, 0x09, 0x4a, 0x98, 0x18, 0x70, 0xff, 0x47,
+  0x80, 0x20, 0x00, 0x04, 0x01, 0x43, 0x95, 0xff, 0x2a, 0x07, 0xdc, 0x96,
+  0x20, 0x82, 0x1a, 0xd1, 0xff, 0x40, 0x48, 0x42, 0x00, 0x2b, 0xf3, 0xd1,
+  0x08, 0xff, 0x00, 0xf1, 0xe7, 0x96, 0x3a, 0x91, 0x40, 0xf7, 0xf7, 0xe7,
+  0xc0, 0x46, 0x3f, 0x00, 0x7f, 0x70, 0xb5, 0x00, 0xff, 0x28, 0x13, 0xd0,
+  0xc3, 0x17, 0xc5, 0x18, 0x5d, 0xef, 0x40, 0xc4, 0x0f, 0x28, 0x31, 0x03,
+  0xc8, 0xfc, 0x9e, 0xff, 0x23, 0x01, 0x00, 0x1b, 0x1a, 0x96, 0x2b, 0x0f,
+  0xff, 0xdc, 0x08, 0x28, 0x31, 0xd0, 0x08, 0x39, 0x8d, 0xff, 0x40, 0x6d,
+  0x02, 0x6d, 0x0a, 0xd8, 0xb2, 0x02, 0xfd, 0xe0, 0x7b, 0x00, 0x20, 0x00,
+  0x25, 0xc0, 0x05, 0x28, 0xfe, 0x1d, 0x0b, 0x70, 0xbd, 0x99, 0x2b, 0x0c,
+  0xdd, 0x05, 0xff, 0x22, 0x12, 0x1a, 0x28, 0x00, 0xd0, 0x40, 0x02, 0xff,
+  0x00, 0x08, 0x00, 0x1b, 0x30, 0x85, 0x40, 0x28, 0xff, 0x00, 0x45, 0x1e,
+  0xa8, 0x41, 0x02, 0x43, 0x15, 0x7f, 0x00, 0x05, 0x29, 0x16, 0xdc, 0x2a,
+  0x00, 0xd4, 0x03, 0xff, 0x40, 0x6e, 0x07, 0x09, 0xd0, 0x0f, 0x26, 0x35,
+  0xff, 0x40, 0x04, 0x2d, 0x05, 0xd0, 0x04, 0x32, 0x55, 0xff, 0x01, 0x02,
+  0xd5, 0x9f, 0x23, 0x02, 0x40, 0x5b, 0xef, 0x1a, 0x92, 0x01, 0x55, 0x57,
+  0x00, 0xd6, 0xe7, 0x6d, 0xff, 0x02, 0x96, 0x20, 0x6d, 0x0a, 0xd2, 0xe7,
+  0x4a, 0xbf, 0x1f, 0x95, 0x40, 0x2a, 0x00, 0x02, 0x31, 0x08, 0xf0, 0xfb,
+  0xd0, 0xe5, 0xa3, 0x0c, 0xfb, 0x70, 0xb5, 0x04, 0x1e, 0x5f, 0x0e, 0xd0,
+  0xfb, 0xf7, 0x7b, 0x99, 0x18, 0x0c, 0x99, 0x00, 0x7d, 0x2c, 0x99, 0x00,
+  0x8c, 0x40, 0x64, 0x02, 0x64, 0x41, 0x00, 0xbb, 0x01, 0xe0, 0x97, 0x00,
+  0x24, 0xc0, 0x05, 0x93, 0x0c, 0x0a, 0xbb, 0xdd, 0x02, 0x0e, 0x00, 0x1b,
+  0x32, 0x90, 0x93, 0x00, 0x50, 0xff, 0x1e, 0x82, 0x41, 0x05, 0x20, 0x40,
+  0x1a, 0xc4, 0x57, 0x40, 0x14, 0x43, 0x8f, 0x04, 0x22, 0x8f, 0x08, 0x65,
+  0x8f, 0x04, 0x5f, 0x25, 0x2c, 0x40, 0x04, 0x2c, 0x8f, 0x04, 0x54, 0x8f,
+  0x20, 0xdd, 0x54, 0x4d, 0x00, 0xda, 0xe7, 0x64, 0x8f, 0x00, 0x64, 0x0a,
+  0x5d, 0xd6, 0x8f, 0x00, 0x94, 0x40, 0x22, 0x8f, 0x08, 0x65, 0x8f, 0x20,
+  0x9f, 0x53, 0x56, 0x23, 0x35, 0x00, 0x00, 0x00, 0x07, 0x00, 0x31, 0x55,
+  0x30, 0x07, 0x0c, 0x36, 0x0f, 0x10, 0x37, 0x07, 0x10, 0x34, 0x07, 0x04,
+  0xff, 0x63, 0x68, 0x53, 0x79, 0x73, 0x55, 0x6e, 0x6c, 0xd7, 0x6f, 0x63,
+  0x6b, 0x2b, 0x08, 0x31, 0x13, 0x00, 0x73, 0x74, 0xff, 0x61, 0x63, 0x6b,
+  0x20, 0x6f, 0x76, 0x65, 0x72, 0xff, 0x66, 0x6c, 0x6f, 0x77, 0x00, 0x00,
+  0x3e, 0x2f, 0x57, 0x00, 0x08, 0x4c, 0x03, 0x00, 0x52, 0x03, 0x00, 0x58,
+  0x03, 0x00, 0x55, 0x42, 0x03, 0x00, 0x5e, 0x03, 0x00, 0x64, 0x03, 0x00,
+  0x6a, 0x03, 0x00, 0x29, 0x46, 0x03, 0x00, 0x3b, 0x00, 0x38, 0x57, 0x10,
+  0x39, 0x57, 0x08, 0x74, 0x00, 0xdd, 0x64, 0x07, 0x00, 0x05, 0x00, 0x1c,
+  0x05, 0x00, 0xa0, 0x42, 0xf7, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x16, 0x43,
+  0x00, 0x00, 0x55, 0x48, 0x03, 0x00, 0x7a, 0x03, 0x00, 0x96, 0x03, 0x00,
+  0xaf, 0x03, 0x00, 0xfd, 0xc8, 0x03, 0x00, 0xe1, 0x43, 0x00, 0x80, 0x09,
+  0x44, 0x4f, 0x00, 0x80, 0x22, 0x44, 0x1f, 0x00, 0x03, 0x00, 0x7a, 0x03,
+  0x00, 0xff, 0x96, 0x44, 0x00, 0x40, 0x1c, 0x45, 0x00, 0xa0, 0xff, 0x8c,
+  0x45, 0x00, 0x6c, 0xdc, 0x02, 0x00, 0x04, 0x8e, 0x55, 0x04, 0x00, 0x00,
+  0x21, 0x06, 0x0c, 0x07, 0x58, 0x00, 0x24, 0x9a, 0xf7, 0x99, 0x99, 0x3e,
+  0x03, 0x04, 0x0a, 0xd7, 0x23, 0x3c, 0xff, 0x00, 0x00, 0x40, 0x40, 0x80,
+  0x1a, 0x06, 0x00, 0xae, 0x47, 0xc4, 0x00, 0xc0, 0x80, 0x8f, 0x00, 0x73,
+  0x03, 0x00, 0x5e, 0xaa, 0x03, 0x00, 0x52, 0xa7, 0x00, 0x49, 0x07, 0x00,
+  0x43, 0x9f, 0x00, 0x3e, 0xfa, 0x07, 0x00, 0x3a, 0x07, 0x00, 0x36, 0x44,
+  0x00, 0xc0, 0x2f, 0xaa, 0x17, 0x00, 0x2b, 0x0b, 0x00, 0x26, 0x07, 0x00,
+  0x20, 0x17, 0x00, 0x1d, 0xea, 0x13, 0x00, 0x0d, 0x07, 0x00, 0xfa, 0xdf,
+  0x00, 0x03, 0x00, 0x31, 0xa9, 0x2b, 0x7a, 0x02, 0x00, 0x04, 0x20, 0x52,
+  0x0c, 0x01, 0x03, 0x00, 0x0d, 0xfe, 0x62, 0x20, 0xd1, 0x26, 0x00, 0x08,
+  0xb1, 0x1f, 0x00, 0xab, 0x08, 0xd1, 0x03, 0x00, 0xe1, 0x03, 0x00, 0xc1,
+  0x03, 0x00, 0xb1, 0xa4, 0x13, 0x00, 0x1f, 0x18, 0x1d, 0x17, 0x00, 0x03,
+  0x00, 0xf1, 0x03, 0x00, 0x71, 0xff, 0x23, 0x00, 0x08, 0x51, 0x1e, 0x00,
+  0x08, 0x01, 0xfe, 0x03, 0x00, 0x63, 0x61, 0x6e, 0x52, 0x65, 0x63, 0x65,
+  0xff, 0x69, 0x76, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0xfb, 0x75, 0x74,
+  0xd3, 0x15, 0x47, 0x65, 0x74, 0x49, 0x64, 0xff, 0x6c, 0x65, 0x54, 0x68,
+  0x72, 0x65, 0x61, 0x64, 0xcd, 0x58, 0x13, 0x00, 0x56, 0x54, 0x12, 0x00,
+  0x24, 0x04, 0x53, 0x74, 0xef, 0x61, 0x6d, 0x70, 0x49, 0x27, 0x00, 0x5f,
+  0x5f, 0x73, 0xf7, 0x63, 0x68, 0x5f, 0x1f, 0x04, 0x79, 0x5f, 0x61, 0x68,
+  0xfc, 0x06, 0x00, 0x3b, 0x08, 0x54, 0x68, 0x64, 0x44, 0x6f, 0x44, 0xff,
+  0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x4e, 0x65, 0xff, 0x78, 0x74, 0x49,
+  0x00, 0x61, 0x64, 0x63, 0x5f, 0xff, 0x6c, 0x6c, 0x64, 0x5f, 0x76, 0x72,
+  0x65, 0x67, 0x7f, 0x5f, 0x6f, 0x6e, 0x00, 0x70, 0x77, 0x6d, 0x0f, 0x08,
+  0xfa, 0x27, 0x02, 0x72, 0x6f, 0x04, 0x73, 0x74, 0x53, 0x65, 0x74, 0xdf,
+  0x41, 0x6c, 0x61, 0x72, 0x6d, 0x3f, 0x00, 0x61, 0x6e, 0x7f, 0x54, 0x72,
+  0x61, 0x6e, 0x73, 0x6d, 0x69, 0x6b, 0x08, 0xf8, 0x90, 0x08, 0x63, 0x26,
+  0x87, 0x04, 0x44, 0x6f, 0x54, 0x69, 0x63, 0xfb, 0x6b, 0x49, 0x17, 0x04,
+  0x63, 0x68, 0x57, 0x61, 0x6b, 0x0f, 0x65, 0x75, 0x70, 0x53, 0xe3, 0x04,
+  0x67, 0x14, 0x57, 0x14, 0x37, 0x24, 0xf0, 0x63, 0x00, 0x15, 0x04, 0x65,
+  0x10, 0x1b, 0x08, 0x63, 0x68, 0x47, 0x6f, 0xcf, 0x53, 0x6c, 0x65, 0x65,
+  0x3c, 0x08, 0xb7, 0x08, 0x52, 0x65, 0xcf, 0x73, 0x75, 0x6d, 0x65, 0xda,
+  0x04, 0x1f, 0x04, 0x65, 0x6d, 0x3f, 0x53, 0x69, 0x67, 0x6e, 0x61, 0x6c,
+  0x0f, 0x08, 0x5b, 0x00, 0xee, 0x40, 0x08, 0x43, 0x6f, 0x6e, 0xd7, 0x02,
+  0x73, 0x69, 0x6f, 0xfb, 0x6e, 0x49, 0xff, 0x28, 0x62, 0x65, 0x68, 0x69,
+  0x6e, 0xe4, 0x00, 0x01, 0x57, 0x08, 0x52, 0x12, 0x04, 0x9f, 0x08, 0x65,
+  0x6d, 0x57, 0xe1, 0x61, 0xc9, 0x18, 0x67, 0x0c, 0x93, 0x1c, 0x07, 0x01,
+  0x45, 0x6e, 0x61, 0xff, 0x62, 0x6c, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x6e,
+  0xfb, 0x65, 0x6c, 0x77, 0x0c, 0x5f, 0x64, 0x6c, 0x69, 0x73, 0x3f, 0x74,
+  0x5f, 0x69, 0x6e, 0x73, 0x65, 0xc5, 0x00, 0x97, 0x08, 0x00, 0xa5, 0x10,
+  0x83, 0x14, 0x77, 0x37, 0x13, 0x0d, 0x43, 0x01, 0xa9, 0x00, 0x3f, 0x01,
+  0x23, 0x20, 0x0e, 0x3b, 0x00, 0x45, 0x78, 0x69, 0x78, 0x04, 0x2f, 0x2c,
+  0x83, 0x28, 0x2f, 0x18, 0x1f, 0x00, 0x00, 0x02, 0x40, 0x08, 0x03, 0x00,
+  0x5b, 0x06, 0x00, 0x00, 0xc5, 0x09, 0x0f, 0x04, 0x1c, 0x03, 0x00, 0xf5,
+  0x02, 0xf7, 0x02, 0x01, 0x0a, 0x5a, 0x0f, 0x04, 0x30, 0x0f, 0x14, 0x08,
+  0x02, 0x0f, 0x08, 0x44, 0x03, 0x00, 0x5d, 0x78, 0x0f, 0x04, 0x0c, 0x03,
+  0x0b, 0x0f, 0x04, 0x58, 0x0f, 0x14, 0x5f, 0x10, 0x04, 0x0b, 0xcc, 0x63,
+  0x7f, 0x02, 0x05, 0xb1, 0x02, 0xff, 0x09, 0x00, 0x20, 0x80, 0x16, 0x00,
+  0x20, 0x38, 0xff, 0x17, 0x00, 0x20, 0xb8, 0x68, 0x00, 0x08, 0xd8, 0xc0,
+  0x07, 0x00, 0x03, 0x14, 0x0f, 0x04, 0x2a, 0x27, 0x0f, 0xfc, 0x0f, 0x6c,
+  0x40, 0x5a, 0x7f, 0x00, 0x08, 0xce, 0x59, 0x00, 0x08, 0x22, 0x03, 0x00,
+  0x0b, 0xda, 0x58, 0x07, 0x0c, 0x0a, 0x13, 0x00, 0x0f, 0x14, 0x1b, 0x04,
+  0x03, 0x04, 0x94, 0x13, 0x04, 0x0f, 0x04, 0xe0, 0x03, 0x20, 0x18, 0x3b,
+  0x10, 0x3f, 0x14, 0xd6, 0xa0, 0x3f, 0x30, 0x0f, 0x04, 0x3f, 0x24, 0x0f,
+  0x04, 0x3f, 0x24, 0x14, 0x13, 0x00, 0x00, 0xff, 0x00, 0x80, 0x3f, 0x00,
+  0x00, 0x48, 0x42, 0x00, 0x77, 0x40, 0x1c, 0x46, 0x91, 0x0c, 0x20, 0x41,
+  0xff, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00,
+  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00,
+  0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00,
+  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00,
+  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00,
+  0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0xfc,
+  0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0xfc,
+  0x3c, 0x00, 0xfc, 0x00, 0xb0, 0x0e, 0x5f, 0x0b, 0xc2
+};
+unsigned int build_wideband_image_lz_bin_len = 17865;
@@ -0,0 +1,531 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "bl_block.h"
+#include "page_diff.h"
+#include "can_stats.h"
+#include "../for_rusefi/wideband_can.h"
+
+static uint8_t Pattern(size_t i)
+{
+    return (i * 37 + (i >> 8)) & 0xFF;
+}
+
+static void SendBlock(BlockReceiver& rx, uint8_t frameCount, int skip = -1)
+{
+    for (uint8_t seq = 0; seq < frameCount; seq++)
+    {
+        if (seq == skip)
+        {
+            continue;
+        }
+
+        uint8_t data[8];
+        for (size_t i = 0; i < 8; i++)
+        {
+            data[i] = Pattern(seq * 8 + i);
+        }
+
+        EXPECT_TRUE(rx.OnData(seq, data, 8));
+    }
+}
+
+TEST(BlBlock, CompleteBlock)
+{
+    BlockReceiver rx;
+
+    uint8_t data[8] = {};
+    EXPECT_FALSE(rx.OnData(0, data, 8));
+
+    rx.Begin(3);
+    SendBlock(rx, BL_BLOCK_FRAMES);
+
+    EXPECT_EQ(BlockEndResult::Program, rx.OnEnd(3, BL_BLOCK_FRAMES));
+    EXPECT_EQ(3, rx.GetBlockIndex());
+
+    for (size_t i = 0; i < BL_BLOCK_SIZE; i++)
+    {
+        ASSERT_EQ(Pattern(i), rx.GetBuffer()[i]);
+    }
+
+    rx.Finish();
+
+    // Our ack got lost and the host asks again
+    EXPECT_EQ(BlockEndResult::AlreadyDone, rx.OnEnd(3, BL_BLOCK_FRAMES));
+
+    // After an erase, nothing counts as done anymore
+    rx.Reset();
+    EXPECT_EQ(BlockEndResult::Missing, rx.OnEnd(3, BL_BLOCK_FRAMES));
+}
+
+TEST(BlBlock, MissingFrames)
+{
+    BlockReceiver rx;
+
+    rx.Begin(0);
+    SendBlock(rx, BL_BLOCK_FRAMES, 70);
+
+    EXPECT_EQ(BlockEndResult::Missing, rx.OnEnd(0, BL_BLOCK_FRAMES));
+    EXPECT_EQ(0u, rx.GetMissing(0, BL_BLOCK_FRAMES));
+    EXPECT_EQ(1ull << 6, rx.GetMissing(1, BL_BLOCK_FRAMES));
+
+    // Retransmit just that frame
+    uint8_t data[8];
+    for (size_t i = 0; i < 8; i++)
+    {
+        data[i] = Pattern(70 * 8 + i);
+    }
+    rx.OnData(70, data, 8);
+
+    EXPECT_EQ(BlockEndResult::Program, rx.OnEnd(0, BL_BLOCK_FRAMES));
+}
+
+TEST(BlBlock, ShortLastBlock)
+{
+    BlockReceiver rx;
+
+    rx.Begin(24);
+    SendBlock(rx, 10);
+
+    // Frames past the end of the block aren't expected
+    EXPECT_EQ(0u, rx.GetMissing(1, 10));
+    EXPECT_EQ(BlockEndResult::Program, rx.OnEnd(24, 10));
+
+    // The rest of the page is left erased
+    EXPECT_EQ(0xFF, rx.GetBuffer()[80]);
+    EXPECT_EQ(0xFF, rx.GetBuffer()[BL_BLOCK_SIZE - 1]);
+}
+
+TEST(BlBlock, BlockBounds)
+{
+    const uint32_t area = APP_PAGE_COUNT * APP_PAGE_SIZE;
+
+    EXPECT_TRUE(IsBlockInArea(0, BL_BLOCK_FRAMES, area));
+    EXPECT_TRUE(IsBlockInArea(APP_PAGE_COUNT - 1, BL_BLOCK_FRAMES, area));
+
+    // One page past the app would be the config page on the F0
+    EXPECT_FALSE(IsBlockInArea(APP_PAGE_COUNT, 1, area));
+    EXPECT_FALSE(IsBlockInArea(APP_PAGE_COUNT, BL_BLOCK_FRAMES, area));
+}
+
+TEST(BlBlock, RejectsBadFrames)
+{
+    BlockReceiver rx;
+    uint8_t data[8] = {};
+
+    rx.Begin(0);
+    EXPECT_FALSE(rx.OnData(BL_BLOCK_FRAMES, data, 8));
+    EXPECT_FALSE(rx.OnData(0, data, 4));
+
+    EXPECT_EQ(BlockEndResult::Invalid, rx.OnEnd(0, 0));
+    EXPECT_EQ(BlockEndResult::Invalid, rx.OnEnd(0, BL_BLOCK_FRAMES + 1));
+}
+
+TEST(BlBlock, LostBegin)
+{
+    BlockReceiver rx;
+
+    rx.Begin(1);
+    SendBlock(rx, BL_BLOCK_FRAMES);
+    rx.OnEnd(1, BL_BLOCK_FRAMES);
+    rx.Finish();
+
+    // BEGIN for block 2 never arrived, so neither did any of its data
+    EXPECT_EQ(BlockEndResult::Missing, rx.OnEnd(2, BL_BLOCK_FRAMES));
+    EXPECT_EQ(~0ull, rx.GetMissing(0, BL_BLOCK_FRAMES));
+    EXPECT_EQ(~0ull, rx.GetMissing(1, BL_BLOCK_FRAMES));
+
+    // END started the block, so a full resend completes it
+    SendBlock(rx, BL_BLOCK_FRAMES);
+    EXPECT_EQ(BlockEndResult::Program, rx.OnEnd(2, BL_BLOCK_FRAMES));
+}
+
+/**
+ * Simulated bus and F0 bootloader, to compare how long an update takes with both protocols.
+ * Time only moves forward as frames go over the bus, the bootloader programs flash,
+ * or the host waits for a reply.
+ */
+struct UpdateSim
+{
+    // Bus runs at CAN_STATS_BITRATE
+    static constexpr float bitUs = 1e6f / CAN_STATS_BITRATE;
+    // STM32F0 halfword program time
+    static constexpr float halfwordUs = 53.5f;
+    // Time for the bootloader to pick up and handle one frame
+    static constexpr float bootloaderFrameUs = 20;
+    // Time for the host to notice a reply and send the next frame
+    static constexpr float hostTurnaroundUs = 500;
+
+    float timeUs = 0;
+    uint32_t framesSent = 0;
+
+    // Drop every Nth frame from the host, 0 = lossless bus
+    uint32_t dropEvery = 0;
+
+    std::vector<uint8_t> flash = std::vector<uint8_t>(26 * 1024, 0xFF);
+    BlockReceiver rx;
+
+    // Returns false if the frame was lost on the bus
+    bool HostSend(bool extended, uint8_t dlc)
+    {
+        framesSent++;
+        timeUs += GetCanFrameBits(extended, dlc) * bitUs;
+
+        return dropEvery == 0 || framesSent % dropEvery != 0;
+    }
+
+    void BootloaderReply(uint8_t dlc)
+    {
+        timeUs += bootloaderFrameUs + GetCanFrameBits(true, dlc) * bitUs + hostTurnaroundUs;
+    }
+
+    void Program(uint32_t offset, const uint8_t* data, size_t size)
+    {
+        memcpy(&flash[offset], data, size);
+        timeUs += halfwordUs * (size / 2);
+    }
+
+    // One WB_BL_DATA_BASE frame per 8 bytes, each acked before the next one is sent
+    void RunLegacy(const std::vector<uint8_t>& image)
+    {
+        for (size_t offset = 0; offset < image.size(); offset += 8)
+        {
+            while (!HostSend(true, 8))
+            {
+                // No ack, the host times out and resends
+                timeUs += 10000;
+            }
+
+            timeUs += bootloaderFrameUs;
+            Program(offset, &image[offset], 8);
+            BootloaderReply(0);
+        }
+    }
+
+    void RunBlocks(const std::vector<uint8_t>& image)
+    {
+        for (size_t offset = 0; offset < image.size(); offset += BL_BLOCK_SIZE)
+        {
+            uint16_t block = offset / BL_BLOCK_SIZE;
+            size_t size = std::min<size_t>(BL_BLOCK_SIZE, image.size() - offset);
+            uint8_t frameCount = (size + BL_BLOCK_FRAME_SIZE - 1) / BL_BLOCK_FRAME_SIZE;
+
+            if (HostSend(true, 0))
+            {
+                rx.Begin(block);
+            }
+
+            uint64_t resend[BL_BLOCK_STATUS_COUNT];
+            for (size_t g = 0; g < BL_BLOCK_STATUS_COUNT; g++)
+            {
+                resend[g] = ~0ull;
+            }
+
+            while (true)
+            {
+                for (uint8_t seq = 0; seq < frameCount; seq++)
+                {
+                    if (!(resend[seq / 64] & (1ull << (seq % 64))))
+                    {
+                        continue;
+                    }
+
+                    if (HostSend(true, 8))
+                    {
+                        rx.OnData(seq, &image[offset + seq * 8], 8);
+                    }
+                }
+
+                if (!HostSend(true, 1))
+                {
+                    // Nothing comes back, the host times out and sends END again
+                    timeUs += 10000;
+                    for (size_t g = 0; g < BL_BLOCK_STATUS_COUNT; g++)
+                    {
+                        resend[g] = 0;
+                    }
+                    continue;
+                }
+
+                timeUs += bootloaderFrameUs;
+                auto result = rx.OnEnd(block, frameCount);
+
+                if (result == BlockEndResult::Program)
+                {
+                    Program(offset, rx.GetBuffer(), size);
+                    rx.Finish();
+                    BootloaderReply(0);
+                    break;
+                }
+
+                ASSERT_EQ(BlockEndResult::Missing, result);
+
+                for (uint8_t g = 0; g < BL_BLOCK_STATUS_COUNT; g++)
+                {
+                    resend[g] = rx.GetMissing(g, frameCount);
+
+                    if (resend[g])
+                    {
+                        BootloaderReply(8);
+                    }
+                }
+            }
+        }
+    }
+};
+
+static std::vector<uint8_t> MakeImage()
+{
+    // Full app area, the last word would be the CRC
+    std::vector<uint8_t> image(25600);
+
+    for (size_t i = 0; i < image.size(); i++)
+    {
+        image[i] = Pattern(i);
+    }
+
+    return image;
+}
+
+static bool ImageMatches(const UpdateSim& sim, const std::vector<uint8_t>& image)
+{
+    return 0 == memcmp(sim.flash.data(), image.data(), image.size());
+}
+
+TEST(BlBlock, UpdateTimeLossless)
+{
+    auto image = MakeImage();
+
+    UpdateSim legacy;
+    legacy.RunLegacy(image);
+
+    UpdateSim blocks;
+    blocks.RunBlocks(image);
+
+    EXPECT_TRUE(ImageMatches(legacy, image));
+    EXPECT_TRUE(ImageMatches(blocks, image));
+
+    printf("Legacy: %.0f ms, %u frames\n", legacy.timeUs / 1000, legacy.framesSent);
+    printf("Blocks: %.0f ms, %u frames\n", blocks.timeUs / 1000, blocks.framesSent);
+
+    // Both spend the same ~0.7s programming flash, the rest of the legacy time is per frame round trips
+    EXPECT_LT(blocks.timeUs * 2, legacy.timeUs);
+}
+
+TEST(BlBlock, UpdateTimeLossy)
+{
+    auto image = MakeImage();
+
+    UpdateSim blocks;
+    blocks.dropEvery = 50;
+    blocks.RunBlocks(image);
+
+    EXPECT_TRUE(ImageMatches(blocks, image));
+
+    printf("Blocks, 2%% loss: %.0f ms, %u frames\n", blocks.timeUs / 1000, blocks.framesSent);
+}
+
+TEST(BlBlock, MulticastTracker)
+{
+    MulticastBlockTracker tracker;
+    tracker.Begin(0b1011);
+
+    EXPECT_FALSE(tracker.IsDone());
+
+    tracker.OnAck(0);
+    tracker.OnStatus(1, 0, 0b0110);
+    tracker.OnStatus(3, 0, 0b1100);
+    tracker.OnStatus(3, 1, 1);
+    // Not part of this transfer
+    tracker.OnStatus(2, 0, 0xF0);
+
+    EXPECT_EQ(0b1010u, tracker.GetPending());
+    EXPECT_EQ(0b1110u, tracker.TakeResend(0));
+    EXPECT_EQ(1u, tracker.TakeResend(1));
+    EXPECT_EQ(0u, tracker.TakeResend(0));
+
+    tracker.OnAck(1);
+    tracker.OnAck(3);
+    EXPECT_TRUE(tracker.IsDone());
+}
+
+/**
+ * Several bootloaders on one bus, all taking the same block stream. Each one loses
+ * different frames, replies go out one after another.
+ */
+struct MulticastSim
+{
+    struct Node
+    {
+        BlockReceiver rx;
+        std::vector<uint8_t> flash = std::vector<uint8_t>(26 * 1024, 0xFF);
+        uint32_t lossPhase;
+    };
+
+    std::vector<Node> nodes;
+    float timeUs = 0;
+    uint32_t framesSent = 0;
+    uint32_t dropEvery = 0;
+
+    MulticastSim(size_t count, uint32_t dropEvery)
+        : nodes(count)
+        , dropEvery(dropEvery)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            nodes[i].lossPhase = i * 7;
+        }
+    }
+
+    void HostSend(uint8_t dlc)
+    {
+        framesSent++;
+        timeUs += GetCanFrameBits(true, dlc) * UpdateSim::bitUs;
+    }
+
+    bool NodeGets(const Node& node) const
+    {
+        return dropEvery == 0 || (framesSent + node.lossPhase) % dropEvery != 0;
+    }
+
+    void NodeReply(uint8_t dlc)
+    {
+        timeUs += GetCanFrameBits(true, dlc) * UpdateSim::bitUs;
+    }
+
+    void Run(const std::vector<uint8_t>& image)
+    {
+        uint32_t allNodes = (1u << nodes.size()) - 1;
+
+        for (size_t offset = 0; offset < image.size(); offset += BL_BLOCK_SIZE)
+        {
+            uint16_t block = offset / BL_BLOCK_SIZE;
+            uint8_t frameCount = BL_BLOCK_FRAMES;
+
+            MulticastBlockTracker tracker;
+            tracker.Begin(allNodes);
+
+            HostSend(0);
+            for (auto& node : nodes)
+            {
+                if (NodeGets(node))
+                {
+                    node.rx.Begin(block);
+                }
+            }
+
+            uint64_t resend[BL_BLOCK_STATUS_COUNT] = {~0ull, ~0ull};
+
+            while (!tracker.IsDone())
+            {
+                for (uint8_t seq = 0; seq < frameCount; seq++)
+                {
+                    if (!(resend[seq / 64] & (1ull << (seq % 64))))
+                    {
+                        continue;
+                    }
+
+                    HostSend(8);
+                    for (auto& node : nodes)
+                    {
+                        if (NodeGets(node))
+                        {
+                            node.rx.OnData(seq, &image[offset + seq * 8], 8);
+                        }
+                    }
+                }
+
+                HostSend(1);
+                bool anyLostEnd = false;
+                bool anyProgrammed = false;
+
+                for (size_t i = 0; i < nodes.size(); i++)
+                {
+                    auto& node = nodes[i];
+
+                    if (!NodeGets(node))
+                    {
+                        anyLostEnd = true;
+                        continue;
+                    }
+
+                    switch (node.rx.OnEnd(block, frameCount))
+                    {
+                        case BlockEndResult::Program:
+                            memcpy(&node.flash[offset], node.rx.GetBuffer(), BL_BLOCK_SIZE);
+                            node.rx.Finish();
+                            // Nodes program in parallel, so this only adds up once below
+                            anyProgrammed = true;
+                            [[fallthrough]];
+                        case BlockEndResult::AlreadyDone:
+                            NodeReply(0);
+                            tracker.OnAck(i);
+                            break;
+                        case BlockEndResult::Missing:
+                            for (uint8_t g = 0; g < BL_BLOCK_STATUS_COUNT; g++)
+                            {
+                                uint64_t missing = node.rx.GetMissing(g, frameCount);
+                                if (missing)
+                                {
+                                    NodeReply(8);
+                                    tracker.OnStatus(i, g, missing);
+                                }
+                            }
+                            break;
+                        case BlockEndResult::Invalid:
+                            FAIL();
+                    }
+                }
+
+                // Programming a page, then the host collects replies (or times out waiting for a node)
+                if (anyProgrammed)
+                {
+                    timeUs += UpdateSim::halfwordUs * BL_BLOCK_SIZE / 2;
+                }
+                timeUs += UpdateSim::hostTurnaroundUs;
+                if (anyLostEnd)
+                {
+                    timeUs += 10000;
+                }
+
+                for (uint8_t g = 0; g < BL_BLOCK_STATUS_COUNT; g++)
+                {
+                    resend[g] = tracker.TakeResend(g);
+                }
+            }
+        }
+    }
+};
+
+TEST(BlBlock, MulticastUpdateTime)
+{
+    auto image = MakeImage();
+
+    float singleTime = 0;
+
+    for (size_t count : {1, 2, 4, 8})
+    {
+        MulticastSim sim(count, 50);
+        sim.Run(image);
+
+        for (const auto& node : sim.nodes)
+        {
+            EXPECT_TRUE(0 == memcmp(node.flash.data(), image.data(), image.size()));
+        }
+
+        printf("Multicast, %zu nodes, 2%% loss: %.0f ms, %u frames\n", count, sim.timeUs / 1000, sim.framesSent);
+
+        if (count == 1)
+        {
+            singleTime = sim.timeUs;
+        }
+        else
+        {
+            // Flashing them one after another would take count times as long
+            EXPECT_LT(sim.timeUs, singleTime * 1.5f);
+        }
+    }
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "can_encoder.h"
+#include "../for_rusefi/wideband_can.h"
+
+static CanSnapshot MakeSnapshot()
+{
+    CanSnapshot s;
+
+    s[CanSource::Lambda] = 0.85f;
+    s[CanSource::LambdaValid] = 1;
+    s[CanSource::Valid] = 1;
+    s[CanSource::TemperatureC] = 780;
+    s[CanSource::SampleTime] = 0x1234;
+    s[CanSource::Esr] = 300;
+    s[CanSource::NernstDc] = 0.5f;
+    s[CanSource::PumpDuty] = 0.5f;
+    s[CanSource::HeaterDuty] = 0.25f;
+    s[CanSource::Status] = static_cast<uint8_t>(wbo::Status::RunningClosedLoop);
+    s[CanSource::Fault] = 0;
+    s[CanSource::SupplyVoltage] = 13.8f;
+
+    return s;
+}
+
+TEST(CanEncoder, RusefiReferenceBytes)
+{
+    const auto& protocol = GetCanProtocol(CanProtocolId::RusEfi);
+    ASSERT_EQ(2, protocol.frameCount);
+
+    auto snapshot = MakeSnapshot();
+    uint8_t data[8];
+
+    EXPECT_EQ(0x190u, GetCanFrameId(protocol.frames[0], 0));
+    EXPECT_EQ(0x194u, GetCanFrameId(protocol.frames[0], 2));
+    EXPECT_EQ(0x195u, GetCanFrameId(protocol.frames[1], 2));
+
+    EncodeCanFrame(protocol.frames[0], snapshot, data);
+    const uint8_t standard[] = {0xA0, 0x01, 0x34, 0x21, 0x0C, 0x03, 0x34, 0x12};
+    EXPECT_EQ(0, memcmp(standard, data, 8));
+
+    EncodeCanFrame(protocol.frames[1], snapshot, data);
+    const uint8_t diag[] = {0x2C, 0x01, 0xF4, 0x01, 0x7F, 0x02, 0x3F, 0x00};
+    EXPECT_EQ(0, memcmp(diag, data, 8));
+}
+
+TEST(CanEncoder, RusefiMatchesStructLayout)
+{
+    // Encode the way SendRusefiFormat always has, straight into the structs shared with rusEFI
+    auto snapshot = MakeSnapshot();
+
+    wbo::StandardData standard = {};
+    standard.Version = RUSEFI_WIDEBAND_VERSION;
+    standard.Valid = 1;
+    standard.Lambda = snapshot[CanSource::Lambda] * 10000;
+    standard.TemperatureC = snapshot[CanSource::TemperatureC];
+    standard.SampleTime = snapshot[CanSource::SampleTime];
+
+    wbo::DiagData diag = {};
+    diag.Esr = snapshot[CanSource::Esr];
+    diag.NernstDc = snapshot[CanSource::NernstDc] * 1000;
+    diag.PumpDuty = snapshot[CanSource::PumpDuty] * 255;
+    diag.status = wbo::Status::RunningClosedLoop;
+    diag.HeaterDuty = snapshot[CanSource::HeaterDuty] * 255;
+
+    const auto& protocol = GetCanProtocol(CanProtocolId::RusEfi);
+    uint8_t data[8];
+
+    EncodeCanFrame(protocol.frames[0], snapshot, data);
+    EXPECT_EQ(0, memcmp(&standard, data, sizeof(standard)));
+
+    EncodeCanFrame(protocol.frames[1], snapshot, data);
+    EXPECT_EQ(0, memcmp(&diag, data, sizeof(diag)));
+}
+
+TEST(CanEncoder, AemReferenceBytes)
+{
+    const auto& protocol = GetCanProtocol(CanProtocolId::AemXSeries);
+    ASSERT_EQ(1, protocol.frameCount);
+
+    const auto& format = protocol.frames[0];
+    EXPECT_TRUE(format.extended);
+    EXPECT_EQ(0x180u, GetCanFrameId(format, 0));
+    EXPECT_EQ(0x181u, GetCanFrameId(format, 1));
+
+    auto snapshot = MakeSnapshot();
+    uint8_t data[8];
+
+    EncodeCanFrame(format, snapshot, data);
+    const uint8_t valid[] = {0x21, 0x34, 0x00, 0x00, 0x8A, 0x00, 0x80, 0x00};
+    EXPECT_EQ(0, memcmp(valid, data, 8));
+
+    // Faulted sensor: no lambda, fault flag set
+    snapshot[CanSource::Lambda] = 0;
+    snapshot[CanSource::Valid] = 0;
+    snapshot[CanSource::Fault] = 1;
+
+    EncodeCanFrame(format, snapshot, data);
+    const uint8_t fault[] = {0x00, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x40};
+    EXPECT_EQ(0, memcmp(fault, data, 8));
+}
+
+TEST(CanEncoder, ClampsAndSigns)
+{
+    static constexpr CanSignal signals[] = {
+        {CanSource::Esr, 0, 8},
+        {CanSource::NernstDc, 8, 16, 0.001, 0, false, true},
+        {CanSource::TemperatureC, 31, 12, 1, 0, true},
+    };
+    static constexpr CanFrameFormat format = {0x100, 1, false, 8, signals, 3};
+
+    CanSnapshot snapshot;
+    snapshot[CanSource::Esr] = 1000;
+    snapshot[CanSource::NernstDc] = -0.5f;
+    snapshot[CanSource::TemperatureC] = 0xABC;
+
+    uint8_t data[8];
+    EncodeCanFrame(format, snapshot, data);
+
+    // 8 bit unsigned clamps to 255
+    EXPECT_EQ(0xFF, data[0]);
+    // -500 little endian two's complement
+    EXPECT_EQ(0x0C, data[1]);
+    EXPECT_EQ(0xFE, data[2]);
+    // 12 bit big endian starting at bit 31: 0xAB in byte 3, 0xC in the top of byte 4
+    EXPECT_EQ(0xAB, data[3]);
+    EXPECT_EQ(0xC0, data[4]);
+}
+
+TEST(CanEncoder, BytePathMatchesBitPath)
+{
+    // Worked out at compile time
+    static_assert(CanSignal(CanSource::Lambda, 16, 16).byteCount == 2);
+    static_assert(CanSignal(CanSource::Lambda, 7, 16, 1, 0, true).byteCount == 2);
+    static_assert(CanSignal(CanSource::Lambda, 4, 16).byteCount == 0);
+    static_assert(CanSignal(CanSource::Lambda, 8, 12).byteCount == 0);
+    static_assert(CanSignal(CanSource::Lambda, 8, 16, 1, 0, true).byteCount == 0);
+
+    // Same 24 bit values, byte aligned and shifted by one bit (which goes bit by bit), both endians
+    static constexpr CanSignal aligned[] = {
+        {CanSource::Esr, 8, 24},
+        {CanSource::TemperatureC, 39, 24, 1, 0, true},
+    };
+    static constexpr CanSignal shifted[] = {
+        {CanSource::Esr, 9, 24},
+        {CanSource::TemperatureC, 38, 24, 1, 0, true},
+    };
+    static constexpr CanFrameFormat alignedFormat = {0x100, 1, false, 8, aligned, 2};
+    static constexpr CanFrameFormat shiftedFormat = {0x100, 1, false, 8, shifted, 2};
+
+    CanSnapshot snapshot;
+    snapshot[CanSource::Esr] = 0x123456;
+    snapshot[CanSource::TemperatureC] = 0x654321;
+
+    uint8_t data[8];
+    EncodeCanFrame(alignedFormat, snapshot, data);
+    const uint8_t expected[] = {0x00, 0x56, 0x34, 0x12, 0x65, 0x43, 0x21, 0x00};
+    EXPECT_EQ(0, memcmp(expected, data, 8));
+
+    // Little endian moves up a bit, big endian's MSB moves down a bit: everything shifts one bit
+    // towards the LSB of each byte chain
+    EncodeCanFrame(shiftedFormat, snapshot, data);
+    EXPECT_EQ(0xAC, data[1]);
+    EXPECT_EQ(0x68, data[2]);
+    EXPECT_EQ(0x24, data[3]);
+    EXPECT_EQ(0x32, data[4]);
+    EXPECT_EQ(0xA1, data[5]);
+    EXPECT_EQ(0x90, data[6]);
+    EXPECT_EQ(0x80, data[7]);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include "can_stats.h"
+#include "../for_rusefi/wideband_can.h"
+
+TEST(CanStats, Classify)
+{
+    EXPECT_EQ(CanTxClass::Data, ClassifyCanTx(WB_DATA_BASE_ADDR, false));
+    EXPECT_EQ(CanTxClass::Data, ClassifyCanTx(WB_DATA_BASE_ADDR + 3, false));
+    EXPECT_EQ(CanTxClass::ExtraFormat, ClassifyCanTx(0x180, true));
+    EXPECT_EQ(CanTxClass::Telemetry, ClassifyCanTx(WB_MSG_TELEMETRY(WB_TELEMETRY_CAN_STATS, 0), true));
+    EXPECT_EQ(CanTxClass::Protocol, ClassifyCanTx(WB_ACK, true));
+}
+
+TEST(CanStats, FrameBits)
+{
+    // 8 byte standard frame: 98 stuffable bits, 19 stuff bits, 13 fixed
+    EXPECT_EQ(130u, GetCanFrameBits(false, 8));
+    // Empty extended frame: 54 stuffable bits, 10 stuff bits, 13 fixed
+    EXPECT_EQ(77u, GetCanFrameBits(true, 0));
+}
+
+TEST(CanStats, RatesAndLoad)
+{
+    CanStats stats;
+
+    // 100 data frames and 20 telemetry frames in half a second
+    for (int i = 0; i < 100; i++)
+    {
+        stats.OnTx(WB_DATA_BASE_ADDR, false, 8, true);
+    }
+    for (int i = 0; i < 20; i++)
+    {
+        stats.OnTx(WB_MSG_TELEMETRY(WB_TELEMETRY_CYL_LAMBDA, 0), true, 8, true);
+    }
+    for (int i = 0; i < 50; i++)
+    {
+        stats.OnRx(false, 8, false);
+    }
+    stats.OnRx(true, 8, true);
+
+    stats.UpdateWindow(0.5f);
+
+    EXPECT_EQ(200, stats.txRate[static_cast<uint8_t>(CanTxClass::Data)]);
+    EXPECT_EQ(40, stats.txRate[static_cast<uint8_t>(CanTxClass::Telemetry)]);
+    EXPECT_EQ(0, stats.txRate[static_cast<uint8_t>(CanTxClass::Protocol)]);
+
+    float ownBits = 100 * 130 + 20 * GetCanFrameBits(true, 8);
+    float allBits = ownBits + 50 * 130 + GetCanFrameBits(true, 8);
+    EXPECT_NEAR(100 * ownBits / 250000, stats.busLoadOwn, 1e-3);
+    EXPECT_NEAR(100 * allBits / 250000, stats.busLoadTotal, 1e-3);
+
+    EXPECT_EQ(120u, stats.txFrames);
+    EXPECT_EQ(1u, stats.rxAccepted);
+    EXPECT_EQ(50u, stats.rxFiltered);
+
+    // Next window is empty, totals are kept
+    stats.UpdateWindow(0.5f);
+    EXPECT_EQ(0, stats.txRate[static_cast<uint8_t>(CanTxClass::Data)]);
+    EXPECT_EQ(0, stats.busLoadTotal);
+    EXPECT_EQ(120u, stats.txFrames);
+}
+
+TEST(CanStats, TimeoutsDontCountAsTraffic)
+{
+    CanStats stats;
+
+    stats.OnTx(WB_DATA_BASE_ADDR, false, 8, false);
+    stats.OnTx(WB_DATA_BASE_ADDR, false, 8, false);
+    stats.UpdateWindow(1);
+
+    EXPECT_EQ(2u, stats.txTimeouts);
+    EXPECT_EQ(0u, stats.txFrames);
+    EXPECT_EQ(0, stats.busLoadOwn);
+}
+
+TEST(CanStats, ErrorStateEdges)
+{
+    CanStats stats;
+
+    stats.OnErrorState(false, true, 130, 5);
+    EXPECT_TRUE(stats.errorPassive);
+    EXPECT_EQ(1, stats.errorPassiveCount);
+    EXPECT_EQ(130, stats.txErrors);
+
+    // Staying error passive is not a new event
+    stats.OnErrorState(false, true, 140, 5);
+    EXPECT_EQ(1, stats.errorPassiveCount);
+
+    stats.OnErrorState(true, true, 255, 5);
+    stats.OnErrorState(true, true, 255, 5);
+    EXPECT_EQ(1, stats.busOffCount);
+
+    // Recover, then go bus off again
+    stats.OnErrorState(false, false, 0, 0);
+    EXPECT_FALSE(stats.busOff);
+    stats.OnErrorState(true, true, 255, 0);
+    EXPECT_EQ(2, stats.busOffCount);
+    EXPECT_EQ(2, stats.errorPassiveCount);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "config_burn.h"
+
+static void SetTimeMs(uint32_t ms)
+{
+    Timer::setMockTime(ms * 1000);
+}
+
+TEST(ConfigBurn, CoalescesRequests)
+{
+    SetTimeMs(0);
+
+    BurnQueue q;
+    q.SetStored(0x1111);
+
+    EXPECT_FALSE(q.IsDue());
+
+    // TS hammering burn while the user drags a value
+    for (uint32_t t = 0; t < 1000; t += 50)
+    {
+        SetTimeMs(t);
+        q.Request();
+        SetTimeMs(t + 10);
+        EXPECT_FALSE(q.IsDue());
+    }
+
+    EXPECT_EQ(BurnState::Pending, q.GetState());
+    SetTimeMs(950 + BURN_COALESCE_MS - 1);
+    EXPECT_FALSE(q.IsDue());
+    SetTimeMs(950 + BURN_COALESCE_MS + 1);
+    EXPECT_TRUE(q.IsDue());
+
+    EXPECT_TRUE(q.Begin(0x2222));
+    EXPECT_EQ(BurnState::Writing, q.GetState());
+    q.End(true);
+
+    EXPECT_EQ(BurnState::Idle, q.GetState());
+    SetTimeMs(5000);
+    EXPECT_FALSE(q.IsDue());
+    EXPECT_EQ(20, q.requestCount);
+    EXPECT_EQ(1, q.writeCount);
+}
+
+TEST(ConfigBurn, UnchangedIsSkipped)
+{
+    SetTimeMs(0);
+
+    BurnQueue q;
+    q.SetStored(0x1234);
+
+    q.Request();
+    SetTimeMs(1000);
+    ASSERT_TRUE(q.IsDue());
+    EXPECT_FALSE(q.Begin(0x1234));
+
+    EXPECT_EQ(BurnState::Idle, q.GetState());
+    EXPECT_EQ(0, q.writeCount);
+    EXPECT_EQ(1, q.skipCount);
+
+    // Change, burn, then burn again with no change
+    q.Request();
+    EXPECT_TRUE(q.Begin(0x5678));
+    q.End(true);
+    q.Request();
+    EXPECT_FALSE(q.Begin(0x5678));
+    EXPECT_EQ(1, q.writeCount);
+    EXPECT_EQ(2, q.skipCount);
+}
+
+TEST(ConfigBurn, NothingStoredAlwaysWrites)
+{
+    // Defaults were loaded, flash has nothing valid
+    BurnQueue q;
+    q.Request();
+    EXPECT_TRUE(q.Begin(0));
+}
+
+TEST(ConfigBurn, RequestDuringWrite)
+{
+    SetTimeMs(0);
+
+    BurnQueue q;
+    q.Request();
+    EXPECT_TRUE(q.Begin(0xA));
+
+    // Another burn comes in while flash is busy
+    SetTimeMs(10);
+    q.Request();
+    SetTimeMs(10 + BURN_COALESCE_MS + 1);
+    EXPECT_FALSE(q.IsDue());
+    q.End(true);
+
+    EXPECT_EQ(BurnState::Pending, q.GetState());
+    EXPECT_TRUE(q.IsDue());
+}
+
+TEST(ConfigBurn, ErrorRetries)
+{
+    BurnQueue q;
+    q.SetStored(0xA);
+
+    q.Request();
+    EXPECT_TRUE(q.Begin(0xB));
+    q.End(false);
+
+    EXPECT_EQ(BurnState::Error, q.GetState());
+    EXPECT_EQ(1, q.errorCount);
+
+    // Flash content unknown now, even the old content gets written
+    q.Request();
+    EXPECT_TRUE(q.Begin(0xA));
+    q.End(true);
+    EXPECT_EQ(BurnState::Idle, q.GetState());
+}
+
+TEST(ConfigBurn, FlushBeforeDue)
+{
+    SetTimeMs(0);
+
+    BurnQueue q;
+    q.SetStored(0xA);
+    EXPECT_FALSE(q.HasPending());
+
+    // Burn, then reset right away
+    q.Request();
+    SetTimeMs(10);
+    EXPECT_FALSE(q.IsDue());
+    ASSERT_TRUE(q.HasPending());
+
+    EXPECT_TRUE(q.Begin(0xB));
+    q.End(true);
+
+    EXPECT_FALSE(q.HasPending());
+    EXPECT_EQ(BurnState::Idle, q.GetState());
+    EXPECT_EQ(1, q.writeCount);
+
+    // The burn thread has nothing left to do
+    SetTimeMs(10 + BURN_COALESCE_MS + 1);
+    EXPECT_FALSE(q.IsDue());
+}
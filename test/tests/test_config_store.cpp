@@ -0,0 +1,286 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "config_store.h"
+
+struct MapStorage : public ConfigStorage
+{
+    std::map<uint16_t, std::vector<uint8_t>> records;
+    std::vector<uint16_t> writes;
+
+    bool Read(uint16_t id, uint8_t* buffer, size_t& size) override
+    {
+        auto it = records.find(id);
+        if (it == records.end() || it->second.size() > size)
+        {
+            return false;
+        }
+
+        memcpy(buffer, it->second.data(), it->second.size());
+        size = it->second.size();
+        return true;
+    }
+
+    bool Write(uint16_t id, const uint8_t* data, size_t size) override
+    {
+        records[id] = std::vector<uint8_t>(data, data + size);
+        writes.push_back(id);
+        return true;
+    }
+
+    void Erase(uint16_t id) override
+    {
+        records.erase(id);
+    }
+};
+
+static Configuration MakeDefaults()
+{
+    Configuration cfg;
+    memset(cfg.pad, 0, sizeof(cfg.pad));
+
+    cfg.CanIndexOffset = 0;
+    cfg.sensorType = SensorType::LSU49;
+    for (int i = 0; i < 8; i++)
+    {
+        cfg.auxOutBins[0][i] = cfg.auxOutBins[1][i] = 8.5f + i;
+        cfg.auxOutValues[0][i] = cfg.auxOutValues[1][i] = i * 0.7f;
+    }
+    cfg.auxOutputSource[0] = AuxOutputMode::Afr0;
+    cfg.auxOutputSource[1] = AuxOutputMode::Afr1;
+
+    return cfg;
+}
+
+static std::vector<uint8_t> Bytes(const Configuration& cfg)
+{
+    auto p = reinterpret_cast<const uint8_t*>(&cfg);
+    return std::vector<uint8_t>(p, p + sizeof(cfg));
+}
+
+TEST(ConfigStore, SectionsMatchIni)
+{
+    Configuration cfg = MakeDefaults();
+    cfg.CanIndexOffset = 0x11;
+    cfg.sensorType = SensorType::LSU42;
+    cfg.extraCanFormats = 0x22;
+    cfg.canStatsPeriod = 0x33;
+    cfg.egtAveraging = 0x55;
+    cfg.egtNotch = 0x66;
+
+    auto bytes = Bytes(cfg);
+    EXPECT_EQ(0x11, bytes[4]);
+    EXPECT_EQ(1, bytes[135]);
+    EXPECT_EQ(0x22, bytes[136]);
+    EXPECT_EQ(0x33, bytes[137]);
+    EXPECT_EQ(0x55, bytes[138]);
+    EXPECT_EQ(0x66, bytes[139]);
+
+    // Sections are in order and don't overlap, and cover every field
+    size_t count;
+    auto sections = GetConfigSections(count);
+    uint16_t end = 4;
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(end, sections[i].offset);
+        end = sections[i].offset + sections[i].size;
+    }
+    EXPECT_EQ(140, end);
+}
+
+TEST(ConfigStore, Empty)
+{
+    MapStorage storage;
+    ConfigStore store(storage);
+
+    Configuration cfg = MakeDefaults();
+    EXPECT_EQ(ConfigLoadResult::Defaults, store.Load(cfg));
+    EXPECT_EQ(Bytes(MakeDefaults()), Bytes(cfg));
+
+    // Everything gets written the first time
+    size_t count;
+    GetConfigSections(count);
+    EXPECT_EQ((int)count + 1, store.Save(cfg));
+
+    // Then nothing, until something changes
+    EXPECT_EQ(0, store.Save(cfg));
+}
+
+// Schema 0 as written by the released firmware, ending at sensorType
+TEST(ConfigStore, MigrateLegacyOriginal)
+{
+    Configuration old = MakeDefaults();
+    old.CanIndexOffset = 3;
+    old.sensorType = SensorType::LSUADV;
+    old.auxOutBins[1][7] = 42;
+    old.auxOutputSource[0] = AuxOutputMode::Egt0;
+
+    MapStorage storage;
+    storage.records[CONFIG_RECORD_LEGACY] = Bytes(old);
+
+    ConfigStore store(storage);
+    Configuration cfg = MakeDefaults();
+    EXPECT_EQ(ConfigLoadResult::Migrated, store.Load(cfg));
+
+    EXPECT_EQ(3, cfg.CanIndexOffset);
+    EXPECT_EQ(SensorType::LSUADV, cfg.sensorType);
+    EXPECT_EQ(42, cfg.auxOutBins[1][7]);
+    EXPECT_EQ(AuxOutputMode::Egt0, cfg.auxOutputSource[0]);
+    EXPECT_EQ(0, cfg.extraCanFormats);
+    EXPECT_EQ(0, cfg.canStatsPeriod);
+
+    // Saving stores the new layout and drops the old record
+    EXPECT_GT(store.Save(cfg), 0);
+    EXPECT_EQ(0u, storage.records.count(CONFIG_RECORD_LEGACY));
+
+    // Which loads back the same
+    ConfigStore store2(storage);
+    Configuration cfg2 = MakeDefaults();
+    EXPECT_EQ(ConfigLoadResult::Loaded, store2.Load(cfg2));
+    EXPECT_EQ(Bytes(cfg), Bytes(cfg2));
+    EXPECT_EQ(0, store2.Save(cfg2));
+}
+
+// Everything after sensorType was padding in schema 0, whatever is in it isn't read
+TEST(ConfigStore, MigrateLegacyKeepsNewDefaults)
+{
+    Configuration old = MakeDefaults();
+    old.CanIndexOffset = 2;
+    memset(old.pad + 136 - 4, 0x5A, sizeof(old.pad) - (136 - 4));
+
+    MapStorage storage;
+    storage.records[CONFIG_RECORD_LEGACY] = Bytes(old);
+
+    ConfigStore store(storage);
+    Configuration cfg = MakeDefaults();
+    cfg.extraCanFormats = 0;
+    cfg.canStatsPeriod = 10;
+    cfg.egtAveraging = 2;
+    cfg.egtNotch = 1;
+    EXPECT_EQ(ConfigLoadResult::Migrated, store.Load(cfg));
+
+    EXPECT_EQ(2, cfg.CanIndexOffset);
+    EXPECT_EQ(0, cfg.extraCanFormats);
+    EXPECT_EQ(10, cfg.canStatsPeriod);
+    EXPECT_EQ(2, cfg.egtAveraging);
+    EXPECT_EQ(1, cfg.egtNotch);
+}
+
+TEST(ConfigStore, MigrateLegacyOutOfRange)
+{
+    Configuration old = MakeDefaults();
+    old.CanIndexOffset = 5;
+    reinterpret_cast<uint8_t*>(&old)[135] = 0x7;
+    reinterpret_cast<uint8_t*>(&old)[133] = 0xFF;
+
+    MapStorage storage;
+    storage.records[CONFIG_RECORD_LEGACY] = Bytes(old);
+
+    ConfigStore store(storage);
+    Configuration cfg = MakeDefaults();
+    EXPECT_EQ(ConfigLoadResult::Migrated, store.Load(cfg));
+
+    // Bad values go back to defaults, good ones stay
+    EXPECT_EQ(SensorType::LSU49, cfg.sensorType);
+    EXPECT_EQ(AuxOutputMode::Afr0, cfg.auxOutputSource[0]);
+    EXPECT_EQ(5, cfg.CanIndexOffset);
+}
+
+TEST(ConfigStore, LegacyWrongTagOrSize)
+{
+    Configuration cfg = MakeDefaults();
+
+    MapStorage storage;
+    auto bytes = Bytes(MakeDefaults());
+    bytes[4] = 7;
+    bytes[0] ^= 1;
+    storage.records[CONFIG_RECORD_LEGACY] = bytes;
+
+    ConfigStore store(storage);
+    EXPECT_EQ(ConfigLoadResult::Defaults, store.Load(cfg));
+    EXPECT_EQ(0, cfg.CanIndexOffset);
+
+    bytes[0] ^= 1;
+    bytes.resize(200);
+    storage.records[CONFIG_RECORD_LEGACY] = bytes;
+    ConfigStore store2(storage);
+    EXPECT_EQ(ConfigLoadResult::Defaults, store2.Load(cfg));
+
+    // The unusable record is dropped on the first save
+    store2.Save(cfg);
+    EXPECT_EQ(0u, storage.records.count(CONFIG_RECORD_LEGACY));
+}
+
+TEST(ConfigStore, SmallEditWritesOneRecord)
+{
+    MapStorage storage;
+    ConfigStore store(storage);
+
+    Configuration cfg = MakeDefaults();
+    store.Load(cfg);
+    store.Save(cfg);
+
+    storage.writes.clear();
+    cfg.CanIndexOffset = 4;
+    EXPECT_EQ(1, store.Save(cfg));
+    ASSERT_EQ(1u, storage.writes.size());
+    EXPECT_EQ(CONFIG_RECORD_FIRST_SECTION, storage.writes[0]);
+    EXPECT_EQ(1u, storage.records[CONFIG_RECORD_FIRST_SECTION].size());
+
+    storage.writes.clear();
+    cfg.auxOutValues[0][3] = 1.5f;
+    EXPECT_EQ(1, store.Save(cfg));
+    EXPECT_EQ(CONFIG_RECORD_FIRST_SECTION + 1, storage.writes[0]);
+}
+
+TEST(ConfigStore, ShortRecordKeepsAppendedDefaults)
+{
+    // A section record from before a field was appended to it
+    MapStorage storage;
+    {
+        ConfigStore store(storage);
+        Configuration cfg = MakeDefaults();
+        cfg.sensorType = SensorType::LSU42;
+        cfg.canStatsPeriod = 50;
+        store.Load(cfg);
+        store.Save(cfg);
+    }
+
+    storage.records[CONFIG_RECORD_FIRST_SECTION + 2].resize(2);
+
+    ConfigStore store(storage);
+    Configuration cfg = MakeDefaults();
+    cfg.canStatsPeriod = 7;
+    EXPECT_EQ(ConfigLoadResult::Loaded, store.Load(cfg));
+
+    EXPECT_EQ(SensorType::LSU42, cfg.sensorType);
+    // Not in the record, default stays
+    EXPECT_EQ(7, cfg.canStatsPeriod);
+
+    // Rewritten at full size on the next save
+    EXPECT_EQ(1, store.Save(cfg));
+    EXPECT_EQ(5u, storage.records[CONFIG_RECORD_FIRST_SECTION + 2].size());
+}
+
+TEST(ConfigStore, NewerHeaderIgnored)
+{
+    MapStorage storage;
+    {
+        ConfigStore store(storage);
+        Configuration cfg = MakeDefaults();
+        cfg.CanIndexOffset = 2;
+        store.Load(cfg);
+        store.Save(cfg);
+    }
+
+    // Written by a newer firmware with a schema this one doesn't know
+    storage.records[CONFIG_RECORD_HEADER][4] = CONFIG_SCHEMA_VERSION + 1;
+
+    ConfigStore store(storage);
+    Configuration cfg = MakeDefaults();
+    EXPECT_EQ(ConfigLoadResult::Defaults, store.Load(cfg));
+    EXPECT_EQ(0, cfg.CanIndexOffset);
+}
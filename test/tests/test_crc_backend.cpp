@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <rusefi/crc.h>
+
+#include "crc_backend.h"
+
+// Model of the STM32 CRC unit as F1 has it: reset to all ones, 32 bit words MSB first,
+// fixed polynomial. The bit reversal the F1 driver does in software is done here too.
+struct ModelCrcUnit
+{
+    uint32_t reg = 0;
+    size_t writes = 0;
+
+    static uint32_t Reverse(uint32_t x)
+    {
+        uint32_t r = 0;
+        for (int i = 0; i < 32; i++)
+        {
+            r = (r << 1) | ((x >> i) & 1);
+        }
+        return r;
+    }
+
+    void Reset()
+    {
+        reg = 0xFFFFFFFF;
+    }
+
+    void Write(uint32_t w)
+    {
+        reg ^= Reverse(w);
+        for (int i = 0; i < 32; i++)
+        {
+            reg = (reg & 0x80000000) ? (reg << 1) ^ 0x04C11DB7 : reg << 1;
+        }
+        writes++;
+    }
+
+    uint32_t Read()
+    {
+        return Reverse(reg);
+    }
+};
+
+static std::vector<uint8_t> MakeData(size_t size)
+{
+    std::vector<uint8_t> data(size);
+
+    uint32_t seed = 7;
+    for (auto& b : data)
+    {
+        seed = seed * 1103515245 + 12345;
+        b = seed >> 16;
+    }
+
+    return data;
+}
+
+TEST(CrcBackend, SoftwareMatchesLibrary)
+{
+    auto data = MakeData(1000);
+
+    for (size_t size : {0, 1, 3, 4, 5, 63, 64, 1000})
+    {
+        EXPECT_EQ(crc32(data.data(), size), SoftwareCrc32Update(0, data.data(), size)) << size;
+    }
+
+    // Known answer
+    EXPECT_EQ(0xCBF43926u, SoftwareCrc32Update(0, reinterpret_cast<const uint8_t*>("123456789"), 9));
+}
+
+TEST(CrcBackend, UnitMatchesSoftware)
+{
+    auto data = MakeData(1030);
+
+    // Every alignment, and a few lengths
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+        for (size_t words : {1, 2, 7, 64, 256})
+        {
+            ModelCrcUnit unit;
+            uint32_t hw = UnitCrc32Update(unit, 0, &data[offset], words);
+            EXPECT_EQ(SoftwareCrc32Update(0, &data[offset], words * 4), hw) << offset << " " << words;
+
+            // Fresh start needs no load word
+            EXPECT_EQ(words, unit.writes);
+        }
+    }
+}
+
+TEST(CrcBackend, UnitContinuesFromAnyCrc)
+{
+    auto data = MakeData(600);
+
+    for (size_t split : {1, 5, 6, 100, 599})
+    {
+        uint32_t first = SoftwareCrc32Update(0, data.data(), split);
+
+        ModelCrcUnit unit;
+        size_t words = (data.size() - split) / 4;
+        uint32_t hw = UnitCrc32Update(unit, first, &data[split], words);
+
+        EXPECT_EQ(SoftwareCrc32Update(first, &data[split], words * 4), hw) << split;
+        EXPECT_EQ(crc32(data.data(), split + words * 4), hw) << split;
+    }
+}
+
+TEST(CrcBackend, LoadWord)
+{
+    for (uint32_t state : {0x00000000u, 0x12345678u, 0x80000001u, 0xFFFFFFFEu})
+    {
+        ModelCrcUnit unit;
+        unit.Reset();
+        unit.Write(GetCrcUnitLoadWord(state));
+
+        EXPECT_EQ(state, unit.Read());
+    }
+}
+
+TEST(CrcBackend, Incremental)
+{
+    // Same as crc32inc, in any number of pieces, like TS packets are built
+    auto data = MakeData(3000);
+
+    uint32_t crc = 0;
+    size_t pos = 0;
+    for (size_t piece : {1, 3, 300, 1, 2000, 695})
+    {
+        crc = Crc32Update(crc, &data[pos], piece);
+        EXPECT_EQ(crc32inc(data.data(), 0, pos + piece), crc);
+        pos += piece;
+    }
+
+    EXPECT_EQ(crc32(data.data(), data.size()), Crc32(data.data(), data.size()));
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "cylinder_lambda.h"
+
+static void Samples(CylinderLambda& dut, float pumpCurrent, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        dut.OnSample(pumpCurrent);
+    }
+}
+
+TEST(CylinderLambda, InactiveWithoutEvents)
+{
+    Timer::setMockTime(0);
+    CylinderLambda dut;
+
+    Samples(dut, 1, 100);
+
+    float pumpCurrent;
+    EXPECT_FALSE(dut.IsActive());
+    EXPECT_FALSE(dut.GetAveragePumpCurrent(0, pumpCurrent));
+}
+
+TEST(CylinderLambda, AttributesWindows)
+{
+    Timer::setMockTime(0);
+    CylinderLambda dut;
+
+    // Two cycles of a 4 cylinder engine, each cylinder with its own pump current
+    for (int cycle = 0; cycle < 2; cycle++)
+    {
+        for (int cyl = 0; cyl < 4; cyl++)
+        {
+            dut.PostEngineEvent(cyl, 4);
+            Samples(dut, 0.1f * cyl, 10);
+        }
+    }
+
+    // Close the last window
+    dut.PostEngineEvent(0, 4);
+    dut.OnSample(0);
+
+    EXPECT_TRUE(dut.IsActive());
+    EXPECT_EQ(4, dut.GetCylinderCount());
+    EXPECT_EQ(0, dut.GetCurrentCylinder());
+
+    for (int cyl = 0; cyl < 4; cyl++)
+    {
+        float pumpCurrent;
+        ASSERT_TRUE(dut.GetAveragePumpCurrent(cyl, pumpCurrent));
+        EXPECT_FLOAT_EQ(0.1f * cyl, pumpCurrent);
+    }
+
+    // Out of range cylinder
+    float pumpCurrent;
+    EXPECT_FALSE(dut.GetAveragePumpCurrent(4, pumpCurrent));
+}
+
+TEST(CylinderLambda, AveragesHistory)
+{
+    Timer::setMockTime(0);
+    CylinderLambda dut;
+
+    // Cylinder 0 alternates between 1 and 3 each cycle
+    for (int cycle = 0; cycle < CYL_LAMBDA_HISTORY * 2; cycle++)
+    {
+        dut.PostEngineEvent(0, 2);
+        Samples(dut, (cycle & 1) ? 3 : 1, 5);
+        dut.PostEngineEvent(1, 2);
+        Samples(dut, 0, 5);
+    }
+
+    dut.PostEngineEvent(0, 2);
+    dut.OnSample(0);
+
+    float pumpCurrent;
+    ASSERT_TRUE(dut.GetAveragePumpCurrent(0, pumpCurrent));
+    EXPECT_FLOAT_EQ(2, pumpCurrent);
+}
+
+TEST(CylinderLambda, TimeoutResets)
+{
+    Timer::setMockTime(0);
+    CylinderLambda dut;
+
+    dut.PostEngineEvent(0, 2);
+    Samples(dut, 1, 5);
+    dut.PostEngineEvent(1, 2);
+    Samples(dut, 1, 5);
+
+    float pumpCurrent;
+    EXPECT_TRUE(dut.GetAveragePumpCurrent(0, pumpCurrent));
+
+    // Engine stops
+    Timer::advanceMockTime((CYL_LAMBDA_TIMEOUT_MS + 1) * 1000);
+    Samples(dut, 5, 5);
+    EXPECT_FALSE(dut.IsActive());
+
+    // Engine starts again, old data is thrown away
+    dut.PostEngineEvent(0, 2);
+    dut.OnSample(0);
+    EXPECT_TRUE(dut.IsActive());
+    EXPECT_FALSE(dut.GetAveragePumpCurrent(0, pumpCurrent));
+}
+
+TEST(CylinderLambda, RejectsBadEvents)
+{
+    Timer::setMockTime(0);
+    CylinderLambda dut;
+
+    dut.PostEngineEvent(4, 4);
+    dut.PostEngineEvent(0, 0);
+    dut.PostEngineEvent(0, CYL_LAMBDA_MAX_CYLINDERS + 1);
+    dut.OnSample(0);
+
+    EXPECT_FALSE(dut.IsActive());
+}
+
+TEST(CylinderLambda, ResultMatches)
+{
+    CylinderLambda dut;
+    float pumpCurrent;
+
+    CylinderLambdaResult result;
+    dut.GetResult(result);
+    EXPECT_FALSE(result.IsActive());
+    EXPECT_FALSE(result.GetAveragePumpCurrent(0, pumpCurrent));
+
+    for (int cycle = 0; cycle < 3; cycle++)
+    {
+        for (uint8_t cyl = 0; cyl < 3; cyl++)
+        {
+            dut.PostEngineEvent(cyl, 3);
+            Samples(dut, cyl * 0.1f, 10);
+        }
+    }
+
+    dut.GetResult(result);
+    EXPECT_TRUE(result.IsActive());
+    EXPECT_EQ(3, result.cylinderCount);
+    EXPECT_EQ(dut.GetCurrentCylinder(), result.currentCylinder);
+
+    for (uint8_t cyl = 0; cyl < CYL_LAMBDA_MAX_CYLINDERS; cyl++)
+    {
+        float expected;
+        bool valid = dut.GetAveragePumpCurrent(cyl, expected);
+        ASSERT_EQ(valid, result.GetAveragePumpCurrent(cyl, pumpCurrent)) << (int)cyl;
+
+        if (valid)
+        {
+            EXPECT_FLOAT_EQ(expected, pumpCurrent);
+        }
+    }
+
+    // Samples within a window don't change what was published
+    dut.OnSample(5);
+    CylinderLambdaResult again;
+    dut.GetResult(again);
+    EXPECT_EQ(0, memcmp(result.pumpCurrent, again.pumpCurrent, sizeof(result.pumpCurrent)));
+}
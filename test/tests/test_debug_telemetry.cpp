@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "debug_telemetry.h"
+
+static std::vector<uint8_t> Encode(const std::vector<uint8_t>& in)
+{
+    std::vector<uint8_t> out(in.size() + in.size() / 254 + 1);
+    out.resize(CobsEncode(in.data(), in.size(), out.data()));
+    return out;
+}
+
+static std::vector<uint8_t> Decode(const std::vector<uint8_t>& in)
+{
+    std::vector<uint8_t> out(in.size());
+    out.resize(CobsDecode(in.data(), in.size(), out.data()));
+    return out;
+}
+
+static DebugTelemetryHeader MakeHeader(uint8_t sequence, uint8_t channelCount)
+{
+    DebugTelemetryHeader header = {};
+    header.version = DEBUG_TELEMETRY_VERSION;
+    header.sequence = sequence;
+    header.timeUs = 123456789;
+    header.supplyVoltage = 13800;
+    header.mcuTemp = -5;
+    header.channelCount = channelCount;
+    return header;
+}
+
+static DebugTelemetryChannel MakeChannel(uint16_t lambda)
+{
+    DebugTelemetryChannel ch = {};
+    ch.lambda = lambda;
+    ch.pumpCurrent = -512;
+    ch.nernstDc = 450;
+    ch.nernstAc = 0;
+    ch.esr = 300;
+    ch.sensorTemp = 780;
+    ch.pumpDuty = 500;
+    ch.heaterDuty = 0;
+    ch.heaterVoltage = 8500;
+    ch.heaterState = 3;
+    ch.status = 0;
+    return ch;
+}
+
+TEST(Cobs, KnownVectors)
+{
+    EXPECT_EQ((std::vector<uint8_t>{ 0x01, 0x01 }), Encode({ 0x00 }));
+    EXPECT_EQ((std::vector<uint8_t>{ 0x03, 0x11, 0x22, 0x02, 0x33 }), Encode({ 0x11, 0x22, 0x00, 0x33 }));
+    EXPECT_EQ((std::vector<uint8_t>{ 0x01, 0x01, 0x01 }), Encode({ 0x00, 0x00 }));
+    EXPECT_EQ((std::vector<uint8_t>{ 0x01 }), Encode({}));
+}
+
+TEST(Cobs, RoundTrip)
+{
+    // Around the 254 byte block length, with and without zeros
+    for (size_t size : { 1, 2, 253, 254, 255, 508, 600 })
+    {
+        for (int zeroEvery : { 0, 1, 7, 254 })
+        {
+            std::vector<uint8_t> data(size);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                data[i] = (zeroEvery && (i % zeroEvery) == 0) ? 0 : (i % 255) + 1;
+            }
+
+            auto encoded = Encode(data);
+            EXPECT_LE(encoded.size(), size + size / 254 + 1);
+
+            for (auto b : encoded)
+            {
+                ASSERT_NE(0, b) << size << " " << zeroEvery;
+            }
+
+            EXPECT_EQ(data, Decode(encoded)) << size << " " << zeroEvery;
+        }
+    }
+}
+
+TEST(Cobs, RejectsInvalid)
+{
+    // Zero inside, block running past the end, nothing at all
+    EXPECT_TRUE(Decode({ 0x03, 0x11, 0x00 }).empty());
+    EXPECT_TRUE(Decode({ 0x05, 0x11, 0x22 }).empty());
+    EXPECT_TRUE(Decode({}).empty());
+}
+
+TEST(DebugTelemetry, FrameRoundTrip)
+{
+    DebugTelemetryChannel channels[] = { MakeChannel(10000), MakeChannel(8500) };
+    auto header = MakeHeader(42, 2);
+
+    uint8_t frame[DEBUG_TELEMETRY_MAX_FRAME];
+    size_t size = BuildDebugTelemetryFrame(header, channels, frame);
+
+    ASSERT_LE(size, sizeof(frame));
+    EXPECT_EQ(56u, size);
+
+    // One delimiter, at the end
+    EXPECT_EQ(0, frame[size - 1]);
+    EXPECT_EQ(nullptr, memchr(frame, 0, size - 1));
+
+    DebugTelemetryHeader outHeader;
+    DebugTelemetryChannel outChannels[DEBUG_TELEMETRY_MAX_CHANNELS];
+    ASSERT_TRUE(ParseDebugTelemetryFrame(frame, size - 1, outHeader, outChannels));
+
+    EXPECT_EQ(0, memcmp(&header, &outHeader, sizeof(header)));
+    EXPECT_EQ(0, memcmp(channels, outChannels, sizeof(channels)));
+}
+
+TEST(DebugTelemetry, SingleChannel)
+{
+    DebugTelemetryChannel channel = MakeChannel(10000);
+    auto header = MakeHeader(0, 1);
+
+    uint8_t frame[DEBUG_TELEMETRY_MAX_FRAME];
+    size_t size = BuildDebugTelemetryFrame(header, &channel, frame);
+
+    DebugTelemetryHeader outHeader;
+    DebugTelemetryChannel outChannels[DEBUG_TELEMETRY_MAX_CHANNELS];
+    ASSERT_TRUE(ParseDebugTelemetryFrame(frame, size - 1, outHeader, outChannels));
+    EXPECT_EQ(1, outHeader.channelCount);
+    EXPECT_EQ(10000, outChannels[0].lambda);
+}
+
+TEST(DebugTelemetry, RejectsDamage)
+{
+    DebugTelemetryChannel channels[] = { MakeChannel(10000), MakeChannel(8500) };
+    auto header = MakeHeader(1, 2);
+
+    uint8_t frame[DEBUG_TELEMETRY_MAX_FRAME];
+    size_t size = BuildDebugTelemetryFrame(header, channels, frame) - 1;
+
+    DebugTelemetryHeader outHeader;
+    DebugTelemetryChannel outChannels[DEBUG_TELEMETRY_MAX_CHANNELS];
+
+    // Any single flipped bit is caught, by COBS or the CRC
+    for (size_t i = 0; i < size; i++)
+    {
+        for (int bit = 0; bit < 8; bit++)
+        {
+            uint8_t damaged[DEBUG_TELEMETRY_MAX_FRAME];
+            memcpy(damaged, frame, size);
+            damaged[i] ^= 1 << bit;
+
+            EXPECT_FALSE(ParseDebugTelemetryFrame(damaged, size, outHeader, outChannels)) << i << " " << bit;
+        }
+    }
+
+    // Cut short, from the middle of a stream
+    EXPECT_FALSE(ParseDebugTelemetryFrame(frame + 10, size - 10, outHeader, outChannels));
+    EXPECT_FALSE(ParseDebugTelemetryFrame(frame, size - 3, outHeader, outChannels));
+}
+
+TEST(DebugTelemetry, RejectsOtherVersion)
+{
+    DebugTelemetryChannel channel = MakeChannel(10000);
+    auto header = MakeHeader(0, 1);
+    header.version = DEBUG_TELEMETRY_VERSION + 1;
+
+    uint8_t frame[DEBUG_TELEMETRY_MAX_FRAME];
+    size_t size = BuildDebugTelemetryFrame(header, &channel, frame);
+
+    DebugTelemetryHeader outHeader;
+    DebugTelemetryChannel outChannels[DEBUG_TELEMETRY_MAX_CHANNELS];
+    EXPECT_FALSE(ParseDebugTelemetryFrame(frame, size - 1, outHeader, outChannels));
+}
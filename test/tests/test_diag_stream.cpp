@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "diag_stream.h"
+#include "spsc_fifo.h"
+#include "../for_rusefi/wideband_can.h"
+
+static DiagStreamSample MakeSample(int i)
+{
+    DiagStreamSample s;
+    s.nernstDc = 450 + (i % 7) - 3;
+    s.nernstAc = 200 + (i % 3);
+    s.pumpCurrent = -150 + 20 * (i % 5);
+    s.pumpDuty = 500 + i % 10;
+    s.heaterDuty = 300;
+    return s;
+}
+
+static std::vector<DiagStreamFrame> EncodeAll(DiagStreamEncoder& enc, const std::vector<DiagStreamSample>& samples)
+{
+    std::vector<DiagStreamFrame> frames;
+
+    for (const auto& s : samples)
+    {
+        DiagStreamFrame out[2];
+        size_t n = enc.Encode(s, 4, out);
+        frames.insert(frames.end(), out, out + n);
+    }
+
+    return frames;
+}
+
+TEST(DiagStream, RoundTrip)
+{
+    std::vector<DiagStreamSample> samples;
+    for (int i = 0; i < 200; i++)
+    {
+        samples.push_back(MakeSample(i));
+    }
+
+    DiagStreamEncoder enc;
+    auto frames = EncodeAll(enc, samples);
+
+    // Mostly deltas: one frame per sample, plus an extra one per keyframe
+    EXPECT_EQ(samples.size() + 200 / (DIAG_STREAM_KEYFRAME_INTERVAL + 1) + 1, frames.size());
+
+    DiagStreamDecoder dec;
+    std::vector<DiagStreamSample> decoded;
+
+    for (const auto& f : frames)
+    {
+        DiagStreamSample s;
+        if (dec.Decode(f.data, f.dlc, s))
+        {
+            decoded.push_back(s);
+        }
+    }
+
+    EXPECT_EQ(samples, decoded);
+    EXPECT_EQ(4, dec.GetDivider());
+    EXPECT_EQ(0u, dec.GetLostCount());
+}
+
+TEST(DiagStream, FirstFrameIsKeyframe)
+{
+    DiagStreamEncoder enc;
+    DiagStreamFrame out[2];
+
+    ASSERT_EQ(2u, enc.Encode(MakeSample(0), 1, out));
+    EXPECT_EQ(WB_DIAG_FRAME_KEY_A, out[0].data[0] & 0x07);
+    EXPECT_EQ(WB_DIAG_FRAME_KEY_B, out[1].data[0] & 0x07);
+
+    // Reference bytes: seq 1, nernst DC 447mV, AC 200mV, pump -150uA
+    const uint8_t expectA[] = {0x09, 0xBF, 0x01, 0xC8, 0x00, 0x6A, 0xFF};
+    ASSERT_EQ(7, out[0].dlc);
+    EXPECT_EQ(0, memcmp(expectA, out[0].data, 7));
+
+    // Next small change is a delta
+    ASSERT_EQ(1u, enc.Encode(MakeSample(1), 1, out));
+    const uint8_t expectDelta[] = {0x10, 1, 1, 20, 1, 0};
+    ASSERT_EQ(6, out[0].dlc);
+    EXPECT_EQ(0, memcmp(expectDelta, out[0].data, 6));
+}
+
+TEST(DiagStream, LargeStepForcesKeyframe)
+{
+    DiagStreamEncoder enc;
+    DiagStreamFrame out[2];
+
+    auto s = MakeSample(0);
+    enc.Encode(s, 1, out);
+
+    s.pumpCurrent += 1000;
+    EXPECT_EQ(2u, enc.Encode(s, 1, out));
+}
+
+TEST(DiagStream, RecoversFromLostFrame)
+{
+    std::vector<DiagStreamSample> samples;
+    for (int i = 0; i < 120; i++)
+    {
+        samples.push_back(MakeSample(i));
+    }
+
+    DiagStreamEncoder enc;
+    auto frames = EncodeAll(enc, samples);
+
+    // Drop a delta frame in the middle of the first keyframe interval
+    frames.erase(frames.begin() + 10);
+
+    DiagStreamDecoder dec;
+    std::vector<DiagStreamSample> decoded;
+
+    for (const auto& f : frames)
+    {
+        DiagStreamSample s;
+        if (dec.Decode(f.data, f.dlc, s))
+        {
+            decoded.push_back(s);
+        }
+    }
+
+    EXPECT_EQ(1u, dec.GetLostCount());
+
+    // Everything after the next keyframe decodes correctly again
+    ASSERT_GT(decoded.size(), 60u);
+    EXPECT_EQ(samples.back(), decoded.back());
+    EXPECT_EQ(samples[DIAG_STREAM_KEYFRAME_INTERVAL + 1], decoded[9]);
+}
+
+TEST(SpscFifo, PushPop)
+{
+    SpscFifo<int, 4> fifo;
+
+    EXPECT_EQ(4u, fifo.GetFree());
+
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(fifo.Push(i));
+    }
+
+    // Full
+    EXPECT_FALSE(fifo.Push(5));
+    EXPECT_EQ(0u, fifo.GetFree());
+
+    int value;
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(fifo.Pop(value));
+        EXPECT_EQ(i, value);
+    }
+
+    EXPECT_FALSE(fifo.Pop(value));
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "dma_rx_ring.h"
+
+// Stands in for a DMA channel in circular mode
+struct FakeDma
+{
+    uint8_t buffer[16] = {};
+    size_t pos = 0;
+
+    void Receive(uint8_t b)
+    {
+        buffer[pos] = b;
+        pos = (pos + 1) % sizeof(buffer);
+    }
+
+    // What the counter register reads
+    size_t GetRemaining() const
+    {
+        return sizeof(buffer) - pos;
+    }
+};
+
+static std::vector<uint8_t> Read(DmaRxRing& ring, const FakeDma& dma, size_t maxSize = 100)
+{
+    std::vector<uint8_t> out(maxSize);
+    out.resize(ring.Read(dma.GetRemaining(), out.data(), maxSize));
+    return out;
+}
+
+TEST(DmaRxRing, NothingNew)
+{
+    FakeDma dma;
+    DmaRxRing ring(dma.buffer, sizeof(dma.buffer));
+
+    EXPECT_EQ(0u, ring.GetAvailable(dma.GetRemaining()));
+    EXPECT_TRUE(Read(ring, dma).empty());
+}
+
+TEST(DmaRxRing, Sequential)
+{
+    FakeDma dma;
+    DmaRxRing ring(dma.buffer, sizeof(dma.buffer));
+
+    dma.Receive(1);
+    dma.Receive(2);
+    dma.Receive(3);
+    EXPECT_EQ(3u, ring.GetAvailable(dma.GetRemaining()));
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3}), Read(ring, dma));
+
+    dma.Receive(4);
+    EXPECT_EQ(std::vector<uint8_t>({4}), Read(ring, dma));
+    EXPECT_TRUE(Read(ring, dma).empty());
+}
+
+TEST(DmaRxRing, Wraps)
+{
+    FakeDma dma;
+    DmaRxRing ring(dma.buffer, sizeof(dma.buffer));
+
+    for (int i = 0; i < 12; i++)
+    {
+        dma.Receive(i);
+    }
+    EXPECT_EQ(12u, Read(ring, dma).size());
+
+    // 4 to the end of the buffer, 3 more from the start
+    for (int i = 12; i < 19; i++)
+    {
+        dma.Receive(i);
+    }
+    EXPECT_EQ(7u, ring.GetAvailable(dma.GetRemaining()));
+    EXPECT_EQ(std::vector<uint8_t>({12, 13, 14, 15, 16, 17, 18}), Read(ring, dma));
+}
+
+TEST(DmaRxRing, ExactlyAtEnd)
+{
+    FakeDma dma;
+    DmaRxRing ring(dma.buffer, sizeof(dma.buffer));
+
+    // Fill right up to the end, the counter has reloaded to the full size
+    for (int i = 0; i < 15; i++)
+    {
+        dma.Receive(i);
+    }
+    EXPECT_EQ(15u, Read(ring, dma).size());
+
+    dma.Receive(15);
+    EXPECT_EQ(std::vector<uint8_t>({15}), Read(ring, dma));
+
+    dma.Receive(99);
+    EXPECT_EQ(std::vector<uint8_t>({99}), Read(ring, dma));
+}
+
+TEST(DmaRxRing, PartialReads)
+{
+    FakeDma dma;
+    DmaRxRing ring(dma.buffer, sizeof(dma.buffer));
+
+    // TS reads the header, then the rest of the command
+    std::vector<uint8_t> received;
+    for (int i = 0; i < 200; i++)
+    {
+        dma.Receive(i);
+
+        if (i % 5 == 4)
+        {
+            auto head = Read(ring, dma, 2);
+            auto rest = Read(ring, dma);
+            EXPECT_EQ(2u, head.size());
+            received.insert(received.end(), head.begin(), head.end());
+            received.insert(received.end(), rest.begin(), rest.end());
+        }
+    }
+
+    ASSERT_EQ(200u, received.size());
+    for (int i = 0; i < 200; i++)
+    {
+        EXPECT_EQ((uint8_t)i, received[i]);
+    }
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include "egt_schedule.h"
+
+TEST(EgtSchedule, DueAtPeriod)
+{
+    EgtSchedule schedule;
+
+    // Read right away the first time
+    EXPECT_TRUE(schedule.IsDue(0));
+    EXPECT_EQ(0u, schedule.TimeUntilDue(0));
+
+    schedule.Done(1000, 230, true);
+    EXPECT_FALSE(schedule.IsDue(1229));
+    EXPECT_EQ(30u, schedule.TimeUntilDue(1200));
+    EXPECT_TRUE(schedule.IsDue(1230));
+    EXPECT_TRUE(schedule.IsDue(5000));
+}
+
+TEST(EgtSchedule, BacksOff)
+{
+    EgtSchedule schedule;
+    uint32_t t = 0;
+
+    // Retries at the period, then 2x, 4x... up to the cap
+    const uint32_t expected[] = { 100, 200, 400, 800, 1600, 3200, EGT_BACKOFF_MAX_MS, EGT_BACKOFF_MAX_MS };
+    for (uint32_t delay : expected)
+    {
+        schedule.Done(t, 100, false);
+        EXPECT_EQ(delay, schedule.TimeUntilDue(t));
+        t += delay;
+        EXPECT_TRUE(schedule.IsDue(t));
+    }
+
+    EXPECT_EQ(8, schedule.GetErrorStreak());
+
+    // Answers again: straight back to the period
+    schedule.Done(t, 100, true);
+    EXPECT_EQ(0, schedule.GetErrorStreak());
+    EXPECT_EQ(100u, schedule.TimeUntilDue(t));
+}
+
+TEST(EgtSchedule, LongStreak)
+{
+    EgtSchedule schedule;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        schedule.Done(0, 100, false);
+    }
+
+    EXPECT_EQ(255, schedule.GetErrorStreak());
+    EXPECT_EQ((uint32_t)EGT_BACKOFF_MAX_MS, schedule.TimeUntilDue(0));
+}
+
+TEST(EgtSchedule, Wraps)
+{
+    EgtSchedule schedule;
+
+    schedule.Done(0xFFFFFFF0, 100, true);
+    EXPECT_FALSE(schedule.IsDue(0xFFFFFFFF));
+    EXPECT_FALSE(schedule.IsDue(10));
+    EXPECT_EQ(10u, schedule.TimeUntilDue(74));
+    EXPECT_TRUE(schedule.IsDue(84));
+}
+
+TEST(EgtSchedule, MissingChipCostsLittle)
+{
+    // Eight chips on a bus, one missing: count its detection attempts over a minute
+    EgtSchedule missing;
+    int attempts = 0;
+
+    for (uint32_t t = 0; t < 60000; t += 10)
+    {
+        if (missing.IsDue(t))
+        {
+            attempts++;
+            missing.Done(t, 100, false);
+        }
+    }
+
+    // vs 600 without backoff
+    EXPECT_LT(attempts, 25);
+}
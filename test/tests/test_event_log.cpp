@@ -0,0 +1,350 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "event_log.h"
+
+struct EventRecordStorage : public ConfigStorage
+{
+    std::map<uint16_t, std::vector<uint8_t>> records;
+    size_t writes = 0;
+    bool fail = false;
+
+    bool Read(uint16_t id, uint8_t* buffer, size_t& size) override
+    {
+        auto it = records.find(id);
+        if (it == records.end() || it->second.size() > size)
+        {
+            return false;
+        }
+
+        memcpy(buffer, it->second.data(), it->second.size());
+        size = it->second.size();
+        return true;
+    }
+
+    bool Write(uint16_t id, const uint8_t* data, size_t size) override
+    {
+        if (fail)
+        {
+            return false;
+        }
+
+        records[id] = std::vector<uint8_t>(data, data + size);
+        writes++;
+        return true;
+    }
+
+    void Erase(uint16_t id) override
+    {
+        records.erase(id);
+    }
+};
+
+// What the firmware's flush does, minus the locking
+static size_t Flush(EventLog& log, ConfigStorage& storage, uint32_t nowMs)
+{
+    EventLogRecord record;
+    size_t written = 0;
+
+    while (size_t size = log.TakeFlush(nowMs, record))
+    {
+        if (!storage.Write(EVENT_LOG_RECORD_FIRST + record.slot, reinterpret_cast<uint8_t*>(&record), size))
+        {
+            log.FlushFailed(record.slot);
+            break;
+        }
+
+        written++;
+    }
+
+    return written;
+}
+
+static EventLogEntry MakeEntry(uint32_t timeMs, uint8_t from = 0, uint8_t to = 0)
+{
+    EventLogEntry entry = {};
+    entry.timeMs = timeMs;
+    entry.type = static_cast<uint8_t>(EventType::Status);
+    entry.channel = 1;
+    entry.from = from;
+    entry.to = to;
+    entry.supplyVoltage = 13500;
+    entry.sensorTemp = 780;
+    entry.esr = 300;
+    return entry;
+}
+
+TEST(EventLog, Empty)
+{
+    EventRecordStorage storage;
+    EventLog log;
+    log.Load(storage);
+
+    EXPECT_EQ(0u, log.GetCount());
+    EXPECT_EQ(0, log.GetBoot());
+    EXPECT_EQ(0u, Flush(log, storage, 1000000));
+
+    EventLogEntry entry;
+    EXPECT_EQ(0u, log.Read(0, &entry, 1));
+}
+
+TEST(EventLog, FlushWaitsForDelay)
+{
+    EventRecordStorage storage;
+    EventLog log;
+    log.Load(storage);
+
+    log.Add(MakeEntry(100), 100);
+    log.Add(MakeEntry(200), 200);
+
+    EXPECT_EQ(0u, Flush(log, storage, 100 + EVENT_LOG_FLUSH_DELAY_MS - 1));
+    EXPECT_EQ(1u, Flush(log, storage, 100 + EVENT_LOG_FLUSH_DELAY_MS));
+    EXPECT_EQ(0, log.GetDirty());
+
+    // Both in one record
+    ASSERT_EQ(1u, storage.records.count(EVENT_LOG_RECORD_FIRST));
+    EXPECT_EQ(EVENT_LOG_RECORD_HEADER_SIZE + 2 * sizeof(EventLogEntry), storage.records[EVENT_LOG_RECORD_FIRST].size());
+}
+
+TEST(EventLog, UrgentFlushRateLimited)
+{
+    EventRecordStorage storage;
+    EventLog log;
+    log.Load(storage);
+
+    log.Add(MakeEntry(0), 0, true);
+    EXPECT_EQ(0u, Flush(log, storage, EVENT_LOG_URGENT_FLUSH_DELAY_MS - 1));
+    EXPECT_EQ(1u, Flush(log, storage, EVENT_LOG_URGENT_FLUSH_DELAY_MS));
+
+    // A flapping fault: no more than one write per interval
+    uint32_t t = EVENT_LOG_URGENT_FLUSH_DELAY_MS;
+    size_t writes = storage.writes;
+    for (int i = 0; i < 100; i++)
+    {
+        t += 100;
+        log.Add(MakeEntry(t, 2, 5), t, true);
+        Flush(log, storage, t);
+    }
+
+    // 10 s of flapping
+    EXPECT_LE(storage.writes - writes, 10000u / EVENT_LOG_MIN_FLUSH_INTERVAL_MS + EVENT_LOG_SLOTS);
+}
+
+TEST(EventLog, FlappingWritesLimitedPerBoot)
+{
+    EventRecordStorage storage;
+    EventLog log;
+    log.Load(storage);
+
+    // An hour of a fault coming and going every second
+    uint32_t t = 0;
+    for (int i = 0; i < 3600; i++)
+    {
+        t += 1000;
+        log.Add(MakeEntry(t, i % 2 ? 5 : 2, i % 2 ? 2 : 5), t, true);
+        Flush(log, storage, t);
+    }
+
+    EXPECT_EQ(EVENT_LOG_BOOT_WRITE_LIMIT, storage.writes);
+    EXPECT_NE(0, log.GetDirty());
+
+    // Still all there to read
+    EXPECT_EQ(EVENT_LOG_ENTRIES, log.GetCount());
+
+    // Next boot gets a fresh budget
+    EventLog next;
+    next.Load(storage);
+    next.Add(MakeEntry(0), 0, true);
+    EXPECT_EQ(1u, Flush(next, storage, EVENT_LOG_URGENT_FLUSH_DELAY_MS));
+}
+
+TEST(EventLog, FullSlotFlushedWithoutDelay)
+{
+    EventRecordStorage storage;
+    EventLog log;
+    log.Load(storage);
+
+    for (uint32_t i = 0; i <= EVENT_LOG_SLOT_ENTRIES; i++)
+    {
+        log.Add(MakeEntry(i), 0);
+    }
+
+    // First slot is full, the second is still filling
+    EXPECT_EQ(2u, Flush(log, storage, 1));
+    EXPECT_EQ(2u, storage.records.size());
+}
+
+TEST(EventLog, RingWrapsOldestFirst)
+{
+    EventLog log;
+    EventRecordStorage storage;
+    log.Load(storage);
+
+    const uint32_t total = EVENT_LOG_ENTRIES + EVENT_LOG_SLOT_ENTRIES / 2;
+    for (uint32_t i = 0; i < total; i++)
+    {
+        log.Add(MakeEntry(i), i);
+    }
+
+    // The oldest slot went to make room
+    size_t count = log.GetCount();
+    EXPECT_EQ(EVENT_LOG_ENTRIES - EVENT_LOG_SLOT_ENTRIES / 2u, count);
+
+    std::vector<EventLogEntry> entries(EVENT_LOG_ENTRIES);
+    ASSERT_EQ(count, log.Read(0, entries.data(), entries.size()));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        EXPECT_EQ(total - count + i, entries[i].timeMs) << i;
+    }
+
+    // Reads from the middle, and cut at the end
+    EventLogEntry entry;
+    ASSERT_EQ(1u, log.Read(5, &entry, 1));
+    EXPECT_EQ(total - count + 5, entry.timeMs);
+    EXPECT_EQ(2u, log.Read(count - 2, entries.data(), 10));
+    EXPECT_EQ(0u, log.Read(count, entries.data(), 1));
+}
+
+TEST(EventLog, SurvivesReboot)
+{
+    EventRecordStorage storage;
+
+    {
+        EventLog log;
+        log.Load(storage);
+
+        for (uint32_t i = 0; i < EVENT_LOG_SLOT_ENTRIES * 2 + 3; i++)
+        {
+            log.Add(MakeEntry(i, 1, 2), i);
+        }
+
+        Flush(log, storage, 1000000);
+    }
+
+    EventLog log;
+    log.Load(storage);
+
+    EXPECT_EQ(1, log.GetBoot());
+    ASSERT_EQ(EVENT_LOG_SLOT_ENTRIES * 2u + 3, log.GetCount());
+
+    // New boot carries on in the same slot, after the old entries
+    log.Add(MakeEntry(7, 2, 5), 0);
+
+    std::vector<EventLogEntry> entries(EVENT_LOG_ENTRIES);
+    size_t count = log.Read(0, entries.data(), entries.size());
+    ASSERT_EQ(EVENT_LOG_SLOT_ENTRIES * 2u + 4, count);
+
+    EXPECT_EQ(0u, entries[0].timeMs);
+    EXPECT_EQ(0, entries[0].boot);
+    EXPECT_EQ(300, entries[0].esr);
+    EXPECT_EQ(7u, entries[count - 1].timeMs);
+    EXPECT_EQ(1, entries[count - 1].boot);
+    EXPECT_EQ(5, entries[count - 1].to);
+
+    // Only the slot that changed is written
+    size_t writes = storage.writes;
+    EXPECT_EQ(1u, Flush(log, storage, 1000000));
+    EXPECT_EQ(writes + 1, storage.writes);
+
+    EventLog again;
+    again.Load(storage);
+    EXPECT_EQ(2, again.GetBoot());
+    EXPECT_EQ(count, again.GetCount());
+}
+
+TEST(EventLog, IgnoresBadRecords)
+{
+    EventRecordStorage storage;
+
+    // Wrong slot, count past the size, garbage
+    EventLogRecord record = {};
+    record.slot = 2;
+    record.count = 1;
+    storage.Write(EVENT_LOG_RECORD_FIRST, reinterpret_cast<uint8_t*>(&record), EVENT_LOG_RECORD_HEADER_SIZE + sizeof(EventLogEntry));
+
+    record.slot = 1;
+    record.count = 3;
+    storage.Write(EVENT_LOG_RECORD_FIRST + 1, reinterpret_cast<uint8_t*>(&record), EVENT_LOG_RECORD_HEADER_SIZE + sizeof(EventLogEntry));
+
+    const uint8_t junk[] = { 1, 2, 3 };
+    storage.Write(EVENT_LOG_RECORD_FIRST + 2, junk, sizeof(junk));
+
+    EventLog log;
+    log.Load(storage);
+    EXPECT_EQ(0u, log.GetCount());
+    EXPECT_EQ(0, log.GetBoot());
+}
+
+TEST(EventLog, FailedWriteRetried)
+{
+    EventRecordStorage storage;
+    EventLog log;
+    log.Load(storage);
+
+    log.Add(MakeEntry(0), 0, true);
+
+    storage.fail = true;
+    EXPECT_EQ(0u, Flush(log, storage, EVENT_LOG_URGENT_FLUSH_DELAY_MS));
+    EXPECT_NE(0, log.GetDirty());
+
+    storage.fail = false;
+    EXPECT_EQ(0u, Flush(log, storage, EVENT_LOG_URGENT_FLUSH_DELAY_MS + 1));
+    EXPECT_EQ(1u, Flush(log, storage, EVENT_LOG_URGENT_FLUSH_DELAY_MS + EVENT_LOG_MIN_FLUSH_INTERVAL_MS));
+    EXPECT_EQ(0, log.GetDirty());
+}
+
+TEST(EventLog, ClearErasesStored)
+{
+    EventRecordStorage storage;
+
+    {
+        EventLog log;
+        log.Load(storage);
+
+        for (uint32_t i = 0; i < EVENT_LOG_SLOT_ENTRIES * 3; i++)
+        {
+            log.Add(MakeEntry(i), i);
+        }
+
+        Flush(log, storage, 1000000);
+        log.Clear(2000000);
+        EXPECT_EQ(0u, log.GetCount());
+        EXPECT_EQ((size_t)EVENT_LOG_SLOTS, Flush(log, storage, 2000000));
+    }
+
+    EventLog log;
+    log.Load(storage);
+    EXPECT_EQ(0u, log.GetCount());
+    // Still counts boots
+    EXPECT_EQ(1, log.GetBoot());
+}
+
+TEST(EventLog, SupplyMonitor)
+{
+    SupplyMonitor monitor;
+    EventType event;
+
+    EXPECT_FALSE(monitor.Update(13.5f, event));
+
+    EXPECT_TRUE(monitor.Update(8.9f, event));
+    EXPECT_EQ(EventType::SupplyLow, event);
+
+    // Ripple around the threshold stays quiet
+    EXPECT_FALSE(monitor.Update(9.2f, event));
+    EXPECT_FALSE(monitor.Update(8.8f, event));
+
+    EXPECT_TRUE(monitor.Update(9.6f, event));
+    EXPECT_EQ(EventType::SupplyNormal, event);
+
+    EXPECT_TRUE(monitor.Update(16.5f, event));
+    EXPECT_EQ(EventType::SupplyHigh, event);
+    EXPECT_FALSE(monitor.Update(15.8f, event));
+
+    // Straight from high to low
+    EXPECT_TRUE(monitor.Update(5, event));
+    EXPECT_EQ(EventType::SupplyLow, event);
+}
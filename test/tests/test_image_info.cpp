@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+#include <rusefi/crc.h>
+
+#include "image_info.h"
+
+// The generated header has a non static length variable, test_lzss.cpp includes it too
+namespace shipped
+{
+#include "../for_rusefi/wideband_image.h"
+}
+
+#define AREA_SIZE (25 * 1024)
+
+static uint32_t Crc(const uint8_t* data, size_t size)
+{
+    return crc32(data, size);
+}
+
+// Counts how much the check actually reads
+static size_t crcBytes = 0;
+static uint32_t CountingCrc(const uint8_t* data, size_t size)
+{
+    crcBytes += size;
+    return crc32(data, size);
+}
+
+// Same layout tools/wb_image produces
+static std::vector<uint8_t> MakeImage(size_t size)
+{
+    std::vector<uint8_t> area(AREA_SIZE, 0xFF);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        area[i] = i * 13 + 5;
+    }
+
+    ImageInfo info;
+    info.magic = IMAGE_INFO_MAGIC;
+    info.size = size;
+    info.crc = crc32(area.data(), size);
+    info.version = 0x1234abcd;
+    memcpy(&area[GetImageInfoOffset(AREA_SIZE)], &info, sizeof(info));
+
+    uint32_t areaCrc = __builtin_bswap32(crc32(area.data(), AREA_SIZE - 4));
+    memcpy(&area[AREA_SIZE - 4], &areaCrc, sizeof(areaCrc));
+
+    return area;
+}
+
+TEST(ImageInfo, OnlyChecksImage)
+{
+    auto area = MakeImage(9000);
+
+    crcBytes = 0;
+    EXPECT_TRUE(IsImageValid(area.data(), AREA_SIZE, CountingCrc));
+    EXPECT_EQ(9000u, crcBytes);
+
+    // Corrupt image
+    area[100] ^= 1;
+    EXPECT_FALSE(IsImageValid(area.data(), AREA_SIZE, Crc));
+}
+
+TEST(ImageInfo, LegacyImage)
+{
+    // The shipped image has no info, just the CRC over the whole area
+    std::vector<uint8_t> area(shipped::build_wideband_image_bin, shipped::build_wideband_image_bin + shipped::build_wideband_image_bin_len);
+    ASSERT_EQ(AREA_SIZE, area.size());
+
+    crcBytes = 0;
+    EXPECT_TRUE(IsImageValid(area.data(), AREA_SIZE, CountingCrc));
+    EXPECT_EQ(AREA_SIZE - 4u, crcBytes);
+
+    area[2000] ^= 0x80;
+    EXPECT_FALSE(IsImageValid(area.data(), AREA_SIZE, Crc));
+}
+
+TEST(ImageInfo, BadInfoFallsBack)
+{
+    // Size past the info: ignored, whole area CRC is still good
+    auto area = MakeImage(9000);
+    ImageInfo info;
+    memcpy(&info, &area[GetImageInfoOffset(AREA_SIZE)], sizeof(info));
+    info.size = AREA_SIZE;
+    memcpy(&area[GetImageInfoOffset(AREA_SIZE)], &info, sizeof(info));
+    uint32_t areaCrc = __builtin_bswap32(crc32(area.data(), AREA_SIZE - 4));
+    memcpy(&area[AREA_SIZE - 4], &areaCrc, sizeof(areaCrc));
+
+    crcBytes = 0;
+    EXPECT_TRUE(IsImageValid(area.data(), AREA_SIZE, CountingCrc));
+    EXPECT_EQ(AREA_SIZE - 4u, crcBytes);
+
+    // Erased flash is never valid
+    std::vector<uint8_t> erased(AREA_SIZE, 0xFF);
+    EXPECT_FALSE(IsImageValid(erased.data(), AREA_SIZE, Crc));
+}
+
+TEST(ImageInfo, Token)
+{
+    auto a = MakeImage(9000);
+    auto b = MakeImage(9002);
+
+    EXPECT_EQ(GetImageToken(a.data(), AREA_SIZE), GetImageToken(a.data(), AREA_SIZE));
+    EXPECT_NE(GetImageToken(a.data(), AREA_SIZE), GetImageToken(b.data(), AREA_SIZE));
+
+    std::vector<uint8_t> erased(AREA_SIZE, 0xFF);
+    EXPECT_NE(0u, GetImageToken(erased.data(), AREA_SIZE));
+    EXPECT_NE(GetImageToken(a.data(), AREA_SIZE), GetImageToken(erased.data(), AREA_SIZE));
+}
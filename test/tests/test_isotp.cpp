@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "isotp.h"
+
+static std::vector<uint8_t> MakeMessage(size_t size)
+{
+    std::vector<uint8_t> message(size);
+
+    for (size_t i = 0; i < size; i++)
+    {
+        message[i] = i * 7 + 3;
+    }
+
+    return message;
+}
+
+struct Transfer
+{
+    size_t dataFrames = 0;
+    size_t flowControlFrames = 0;
+    // Bus bits, worst case stuffing, 29 bit IDs
+    size_t bits = 0;
+
+    void Count(const IsoTpFrame& frame)
+    {
+        size_t stuffable = 54 + 8 * frame.dlc;
+        bits += 67 + 8 * frame.dlc + (stuffable - 1) / 4;
+    }
+};
+
+// Runs a whole message through a sender and a receiver, like two ends of the bus
+static bool RunTransfer(const std::vector<uint8_t>& message, IsoTpReceiver& receiver, Transfer& transfer)
+{
+    IsoTpSender sender;
+    IsoTpFrame frame;
+    IsoTpFrame reply;
+
+    if (!sender.Start(message.data(), message.size(), frame))
+    {
+        return false;
+    }
+
+    while (true)
+    {
+        transfer.dataFrames++;
+        transfer.Count(frame);
+
+        auto result = receiver.OnFrame(frame.data, frame.dlc, reply);
+
+        if (reply.dlc)
+        {
+            transfer.flowControlFrames++;
+            transfer.Count(reply);
+            sender.OnFlowControl(reply.data, reply.dlc);
+        }
+
+        if (result == IsoTpRxResult::Complete)
+        {
+            return sender.IsDone();
+        }
+
+        if (result == IsoTpRxResult::Error || !sender.NextFrame(frame))
+        {
+            return false;
+        }
+    }
+}
+
+TEST(IsoTp, SingleFrame)
+{
+    uint8_t buffer[64];
+    IsoTpReceiver receiver(buffer, sizeof(buffer));
+
+    auto message = MakeMessage(7);
+    Transfer transfer;
+    ASSERT_TRUE(RunTransfer(message, receiver, transfer));
+
+    EXPECT_EQ(1u, transfer.dataFrames);
+    EXPECT_EQ(0u, transfer.flowControlFrames);
+    ASSERT_EQ(7u, receiver.GetSize());
+    EXPECT_EQ(0, memcmp(message.data(), receiver.GetData(), 7));
+}
+
+TEST(IsoTp, RoundTripSizes)
+{
+    uint8_t buffer[ISOTP_MAX_MESSAGE_SIZE];
+
+    // Around the frame boundaries, and past the sequence number wrapping
+    for (size_t size : { 1, 7, 8, 13, 14, 20, 263, 1000, ISOTP_MAX_MESSAGE_SIZE })
+    {
+        IsoTpReceiver receiver(buffer, sizeof(buffer));
+        auto message = MakeMessage(size);
+
+        Transfer transfer;
+        ASSERT_TRUE(RunTransfer(message, receiver, transfer)) << size;
+        ASSERT_EQ(size, receiver.GetSize());
+        EXPECT_EQ(0, memcmp(message.data(), receiver.GetData(), size)) << size;
+
+        size_t expectedFrames = size <= 7 ? 1 : 1 + (size - 6 + 6) / 7;
+        EXPECT_EQ(expectedFrames, transfer.dataFrames) << size;
+    }
+}
+
+TEST(IsoTp, BlockSize)
+{
+    uint8_t buffer[512];
+    IsoTpReceiver receiver(buffer, sizeof(buffer), 4);
+
+    // First frame + 38 consecutive frames, flow control after the first frame and every 4
+    auto message = MakeMessage(6 + 38 * 7);
+    Transfer transfer;
+    ASSERT_TRUE(RunTransfer(message, receiver, transfer));
+
+    EXPECT_EQ(39u, transfer.dataFrames);
+    EXPECT_EQ(1u + 38 / 4, transfer.flowControlFrames);
+}
+
+TEST(IsoTp, SenderWaitsForFlowControl)
+{
+    auto message = MakeMessage(30);
+
+    IsoTpSender sender;
+    IsoTpFrame frame;
+    ASSERT_TRUE(sender.Start(message.data(), message.size(), frame));
+    EXPECT_EQ(0x10, frame.data[0]);
+    EXPECT_EQ(30, frame.data[1]);
+
+    EXPECT_TRUE(sender.IsWaitingForFlowControl());
+    EXPECT_FALSE(sender.NextFrame(frame));
+
+    // Wait keeps it waiting
+    const uint8_t wait[] = { 0x31, 0, 0 };
+    EXPECT_TRUE(sender.OnFlowControl(wait, 3));
+    EXPECT_TRUE(sender.IsWaitingForFlowControl());
+
+    // Two frames, 500 us apart
+    const uint8_t cts[] = { 0x30, 2, 0xF5 };
+    EXPECT_TRUE(sender.OnFlowControl(cts, 3));
+    EXPECT_EQ(500u, sender.GetSeparationTimeUs());
+
+    ASSERT_TRUE(sender.NextFrame(frame));
+    EXPECT_EQ(0x21, frame.data[0]);
+    ASSERT_TRUE(sender.NextFrame(frame));
+    EXPECT_EQ(0x22, frame.data[0]);
+    EXPECT_FALSE(sender.NextFrame(frame));
+
+    // Receiver gives up
+    const uint8_t overflow[] = { 0x32, 0, 0 };
+    EXPECT_FALSE(sender.OnFlowControl(overflow, 3));
+    EXPECT_TRUE(sender.IsDone());
+}
+
+TEST(IsoTp, SeparationTime)
+{
+    EXPECT_EQ(0u, IsoTpSeparationTimeUs(0));
+    EXPECT_EQ(127000u, IsoTpSeparationTimeUs(0x7F));
+    EXPECT_EQ(100u, IsoTpSeparationTimeUs(0xF1));
+    EXPECT_EQ(900u, IsoTpSeparationTimeUs(0xF9));
+    // Reserved
+    EXPECT_EQ(127000u, IsoTpSeparationTimeUs(0x80));
+}
+
+TEST(IsoTp, ReceiverOverflow)
+{
+    uint8_t buffer[16];
+    IsoTpReceiver receiver(buffer, sizeof(buffer));
+
+    auto message = MakeMessage(17);
+    IsoTpSender sender;
+    IsoTpFrame frame;
+    IsoTpFrame reply;
+    sender.Start(message.data(), message.size(), frame);
+
+    EXPECT_EQ(IsoTpRxResult::Error, receiver.OnFrame(frame.data, frame.dlc, reply));
+    ASSERT_EQ(3, reply.dlc);
+    EXPECT_EQ(0x32, reply.data[0]);
+    EXPECT_EQ(1u, receiver.errorCount);
+
+    // Consecutive frames with no first frame are dropped
+    const uint8_t cf[] = { 0x21, 1, 2, 3, 4, 5, 6, 7 };
+    EXPECT_EQ(IsoTpRxResult::Ignored, receiver.OnFrame(cf, 8, reply));
+}
+
+TEST(IsoTp, ReceiverLostFrame)
+{
+    uint8_t buffer[64];
+    IsoTpReceiver receiver(buffer, sizeof(buffer));
+
+    auto message = MakeMessage(30);
+    IsoTpSender sender;
+    IsoTpFrame frame;
+    IsoTpFrame reply;
+    sender.Start(message.data(), message.size(), frame);
+
+    EXPECT_EQ(IsoTpRxResult::SendFlowControl, receiver.OnFrame(frame.data, frame.dlc, reply));
+    sender.OnFlowControl(reply.data, reply.dlc);
+
+    // Frame 1 never makes it
+    ASSERT_TRUE(sender.NextFrame(frame));
+    ASSERT_TRUE(sender.NextFrame(frame));
+    EXPECT_EQ(IsoTpRxResult::Error, receiver.OnFrame(frame.data, frame.dlc, reply));
+
+    // The rest of that message is ignored, the next one goes through
+    ASSERT_TRUE(sender.NextFrame(frame));
+    EXPECT_EQ(IsoTpRxResult::Ignored, receiver.OnFrame(frame.data, frame.dlc, reply));
+
+    auto next = MakeMessage(5);
+    Transfer transfer;
+    ASSERT_TRUE(RunTransfer(next, receiver, transfer));
+    EXPECT_EQ(5u, receiver.GetSize());
+}
+
+TEST(IsoTp, ShortFrames)
+{
+    uint8_t buffer[64];
+    IsoTpReceiver receiver(buffer, sizeof(buffer));
+    IsoTpFrame reply;
+
+    // Single frame claiming more data than it has
+    const uint8_t single[] = { 0x05, 1, 2 };
+    EXPECT_EQ(IsoTpRxResult::Error, receiver.OnFrame(single, sizeof(single), reply));
+
+    // First frame for a message that would fit a single frame
+    const uint8_t first[] = { 0x10, 5, 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(IsoTpRxResult::Error, receiver.OnFrame(first, sizeof(first), reply));
+
+    EXPECT_EQ(IsoTpRxResult::Ignored, receiver.OnFrame(single, 0, reply));
+}
+
+TEST(IsoTp, Throughput)
+{
+    uint8_t buffer[ISOTP_MAX_MESSAGE_SIZE];
+    const float bitRate = 500000;
+    // 115200 8N1, for comparison with the serial channels
+    const float serialBytesPerSecond = 115200 / 10.0f;
+
+    // TS output channel response, then longer messages to see the first frame overhead go away
+    for (size_t size : { 263, 1031, ISOTP_MAX_MESSAGE_SIZE })
+    {
+        for (uint8_t blockSize : { 0, 8 })
+        {
+            IsoTpReceiver receiver(buffer, sizeof(buffer), blockSize);
+            auto message = MakeMessage(size);
+
+            Transfer transfer;
+            ASSERT_TRUE(RunTransfer(message, receiver, transfer));
+
+            float seconds = transfer.bits / bitRate;
+            float bytesPerSecond = size / seconds;
+
+            printf("isotp: %4zu bytes BS %d: %3zu frames + %2zu flow control, %5.2f ms at 500k, %.0f B/s (%.1fx 115200 serial)\n",
+                size, blockSize, transfer.dataFrames, transfer.flowControlFrames, seconds * 1000,
+                bytesPerSecond, bytesPerSecond / serialBytesPerSecond);
+
+            // Bus time only (with worst case stuffing), flow control round trips and mailbox gaps come on top
+            EXPECT_GT(bytesPerSecond, 1.5f * serialBytesPerSecond);
+        }
+    }
+}
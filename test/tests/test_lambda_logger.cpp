@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include "lambda_logger.h"
+#include "../for_rusefi/wideband_can.h"
+
+static LambdaLogSample MakeSample(float lambda, wbo::Status status = wbo::Status::RunningClosedLoop)
+{
+    LambdaLogSample s;
+    s.lambda = lambda;
+    s.pumpCurrent = -0.5f;
+    s.nernstDc = 0.45f;
+    s.heaterDuty = 0.3f;
+    s.status = static_cast<uint8_t>(status);
+    return s;
+}
+
+static LambdaLogRecord ReadOne(const LambdaLogger& logger, size_t index)
+{
+    LambdaLogRecord record = {};
+    EXPECT_EQ(1u, logger.Read(index, &record, 1));
+    return record;
+}
+
+TEST(LambdaLogger, RejectsBadArm)
+{
+    LambdaLogger logger;
+
+    // No channels, channels past the end
+    EXPECT_FALSE(logger.Arm(LambdaLogTrigger::Manual, 0, 0, 0));
+    EXPECT_FALSE(logger.Arm(LambdaLogTrigger::Manual, 0x10, 0, 0));
+    // No room left for the trigger
+    EXPECT_FALSE(logger.Arm(LambdaLogTrigger::Manual, 1, LAMBDA_LOG_RECORDS, 0));
+    // Step needs a threshold
+    EXPECT_FALSE(logger.Arm(LambdaLogTrigger::LambdaStep, 1, 0, 0));
+    EXPECT_FALSE(logger.Arm(static_cast<LambdaLogTrigger>(9), 1, 0, 0));
+
+    EXPECT_EQ(LambdaLogState::Idle, logger.GetState());
+}
+
+TEST(LambdaLogger, RecordFormat)
+{
+    LambdaLogger logger;
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::Manual, 0x02, 0, 0));
+
+    // Channel 0 isn't logged
+    logger.OnSample(0, MakeSample(1.0f), 100);
+    logger.OnSample(1, MakeSample(0.85f, wbo::Status::Warmup), 100);
+    EXPECT_EQ(1u, logger.GetRecordCount());
+
+    logger.Stop();
+    EXPECT_EQ(LambdaLogState::Idle, logger.GetState());
+
+    auto r = ReadOne(logger, 0);
+    EXPECT_EQ(8500, r.lambda);
+    EXPECT_EQ(-500, r.pumpCurrent);
+    EXPECT_EQ(4500, r.nernstDc);
+    EXPECT_EQ(60, r.heaterDuty);
+    EXPECT_EQ(0x11, r.channelStatus);
+
+    // Clamped, not wrapped
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::Manual, 0x01, 0, 0));
+    auto s = MakeSample(9.0f);
+    s.pumpCurrent = -40;
+    s.heaterDuty = 2;
+    logger.OnSample(0, s, 0);
+    logger.Stop();
+
+    r = ReadOne(logger, 0);
+    EXPECT_EQ(UINT16_MAX, r.lambda);
+    EXPECT_EQ(INT16_MIN, r.pumpCurrent);
+    EXPECT_EQ(UINT8_MAX, r.heaterDuty);
+}
+
+TEST(LambdaLogger, NoReadWhileRecording)
+{
+    LambdaLogger logger;
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::Manual, 1, 0, 0));
+    logger.OnSample(0, MakeSample(1), 0);
+
+    LambdaLogRecord record;
+    EXPECT_EQ(0u, logger.Read(0, &record, 1));
+}
+
+TEST(LambdaLogger, ManualTriggerKeepsPreTrigger)
+{
+    LambdaLogger logger;
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::Manual, 1, 10, 0));
+
+    // Way more history than asked for, ring wraps
+    for (int i = 0; i < 1000; i++)
+    {
+        logger.OnSample(0, MakeSample(i / 10000.0f), i);
+    }
+
+    EXPECT_EQ(LambdaLogState::Armed, logger.GetState());
+    logger.Trigger();
+
+    for (int i = 1000; logger.GetState() != LambdaLogState::Done; i++)
+    {
+        ASSERT_LT(i, 5000);
+        logger.OnSample(0, MakeSample(i / 10000.0f), i);
+    }
+
+    ASSERT_EQ((size_t)LAMBDA_LOG_RECORDS, logger.GetRecordCount());
+    EXPECT_EQ(10u, logger.GetTriggerIndex());
+    EXPECT_EQ(1000u, logger.GetTriggerTimeUs());
+    EXPECT_EQ(1000u + LAMBDA_LOG_RECORDS - 10 - 1, logger.GetLastTimeUs());
+
+    // Oldest first, contiguous across the trigger and the ring wrap
+    LambdaLogRecord records[LAMBDA_LOG_RECORDS];
+    ASSERT_EQ((size_t)LAMBDA_LOG_RECORDS, logger.Read(0, records, LAMBDA_LOG_RECORDS));
+
+    for (size_t i = 0; i < LAMBDA_LOG_RECORDS; i++)
+    {
+        EXPECT_EQ(990 + i, records[i].lambda) << i;
+    }
+
+    // Done holds still
+    logger.OnSample(0, MakeSample(0), 0);
+    EXPECT_EQ(990, ReadOne(logger, 0).lambda);
+
+    // Reads are cut at the end
+    EXPECT_EQ(2u, logger.Read(LAMBDA_LOG_RECORDS - 2, records, 32));
+    EXPECT_EQ(0u, logger.Read(LAMBDA_LOG_RECORDS, records, 1));
+}
+
+TEST(LambdaLogger, ShortHistory)
+{
+    LambdaLogger logger;
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::Manual, 1, 100, 0));
+
+    // Triggered before there were 100 records of history
+    for (int i = 0; i < 5; i++)
+    {
+        logger.OnSample(0, MakeSample(1), i);
+    }
+
+    logger.Trigger();
+    logger.OnSample(0, MakeSample(1), 5);
+
+    EXPECT_EQ(LambdaLogState::Triggered, logger.GetState());
+    EXPECT_EQ(5u, logger.GetTriggerIndex());
+    EXPECT_EQ(6u, logger.GetRecordCount());
+}
+
+TEST(LambdaLogger, LambdaStepTrigger)
+{
+    LambdaLogger logger;
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::LambdaStep, 0x03, 4, 0.05f));
+
+    // Warmup doesn't count, even with lambda all over the place
+    for (int i = 0; i < 10; i++)
+    {
+        logger.OnSample(0, MakeSample(i % 2 ? 0.5f : 1.5f, wbo::Status::Warmup), i);
+    }
+
+    // Steady, with some noise
+    for (int i = 10; i < 200; i++)
+    {
+        logger.OnSample(0, MakeSample(1.0f + ((i % 3) - 1) * 0.01f), i);
+        logger.OnSample(1, MakeSample(1.0f), i);
+    }
+
+    EXPECT_EQ(LambdaLogState::Armed, logger.GetState());
+
+    // Channel 1 goes rich
+    logger.OnSample(0, MakeSample(1.0f), 200);
+    logger.OnSample(1, MakeSample(0.9f), 200);
+
+    EXPECT_EQ(LambdaLogState::Triggered, logger.GetState());
+    EXPECT_EQ(200u, logger.GetTriggerTimeUs());
+    EXPECT_EQ(4u, logger.GetTriggerIndex());
+
+    logger.Stop();
+    EXPECT_EQ(0x12, ReadOne(logger, logger.GetTriggerIndex()).channelStatus);
+    EXPECT_EQ(9000, ReadOne(logger, logger.GetTriggerIndex()).lambda);
+}
+
+TEST(LambdaLogger, FaultTrigger)
+{
+    LambdaLogger logger;
+
+    // Already faulted when armed: not a trigger
+    ASSERT_TRUE(logger.Arm(LambdaLogTrigger::Fault, 1, 0, 0));
+    logger.OnSample(0, MakeSample(1, wbo::Status::SensorOverheat), 0);
+    logger.OnSample(0, MakeSample(1, wbo::Status::SensorOverheat), 1);
+    EXPECT_EQ(LambdaLogState::Armed, logger.GetState());
+
+    // Recovers, then faults again
+    logger.OnSample(0, MakeSample(1), 2);
+    EXPECT_EQ(LambdaLogState::Armed, logger.GetState());
+    logger.OnSample(0, MakeSample(1, wbo::Status::SensorUnderheat), 3);
+    EXPECT_EQ(LambdaLogState::Triggered, logger.GetState());
+    EXPECT_EQ(3u, logger.GetTriggerTimeUs());
+}
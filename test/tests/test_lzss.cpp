@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+#include <rusefi/crc.h>
+
+#include "lzss.h"
+#include "../for_rusefi/wideband_image.h"
+
+struct VectorSink : public LzssSink
+{
+    std::vector<uint8_t> data;
+
+    void Put(uint8_t b) override
+    {
+        data.push_back(b);
+    }
+
+    uint8_t Peek(size_t distance) const override
+    {
+        return data[data.size() - distance];
+    }
+
+    size_t GetWritten() const override
+    {
+        return data.size();
+    }
+};
+
+struct FakeFlash : public ImageFlash
+{
+    std::vector<uint8_t> flash = std::vector<uint8_t>(26 * 1024, 0xFF);
+    size_t writes = 0;
+
+    void Write(uint32_t offset, const uint8_t* data, size_t size) override
+    {
+        // Pages come in order, each written once
+        EXPECT_EQ(writes * LZSS_PAGE_SIZE, offset);
+        EXPECT_EQ(0u, size % 2);
+
+        memcpy(&flash[offset], data, size);
+        writes++;
+    }
+
+    const uint8_t* GetBase() const override
+    {
+        return flash.data();
+    }
+};
+
+static std::vector<uint8_t> MakeData(size_t size)
+{
+    std::vector<uint8_t> data(size);
+
+    // Some repeats, some runs, some noise
+    uint32_t seed = 1;
+    for (size_t i = 0; i < size; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        if (i % 300 < 100)
+        {
+            data[i] = 0xFF;
+        }
+        else if (i % 300 < 200)
+        {
+            data[i] = "wideband"[i % 8];
+        }
+        else
+        {
+            data[i] = seed >> 16;
+        }
+    }
+
+    return data;
+}
+
+static std::vector<uint8_t> Compress(const std::vector<uint8_t>& raw)
+{
+    std::vector<uint8_t> out(raw.size() + raw.size() / 8 + 1);
+    out.resize(LzssCompress(raw.data(), raw.size(), out.data(), out.size()));
+    return out;
+}
+
+static std::vector<uint8_t> MakeImage(const std::vector<uint8_t>& raw)
+{
+    auto compressed = Compress(raw);
+
+    CompressedImageHeader header;
+    header.magic = LZSS_IMAGE_MAGIC;
+    header.rawSize = raw.size();
+    header.rawCrc = crc32(raw.data(), raw.size());
+    header.compressedSize = compressed.size();
+
+    std::vector<uint8_t> image(sizeof(header));
+    memcpy(image.data(), &header, sizeof(header));
+    image.insert(image.end(), compressed.begin(), compressed.end());
+
+    // Padded out to whole CAN frames
+    while (image.size() % 8)
+    {
+        image.push_back(0);
+    }
+
+    return image;
+}
+
+TEST(Lzss, RoundTrip)
+{
+    auto raw = MakeData(5000);
+    auto compressed = Compress(raw);
+
+    EXPECT_LT(compressed.size(), raw.size() / 2);
+
+    VectorSink sink;
+    LzssDecoder decoder;
+    decoder.Reset();
+    EXPECT_TRUE(decoder.Feed(compressed.data(), compressed.size(), sink, raw.size()));
+
+    EXPECT_EQ(raw, sink.data);
+}
+
+TEST(Lzss, AnyChunkSize)
+{
+    auto raw = MakeData(2000);
+    auto compressed = Compress(raw);
+
+    for (size_t chunk : {1, 2, 3, 7, 8, 64})
+    {
+        VectorSink sink;
+        LzssDecoder decoder;
+        decoder.Reset();
+
+        for (size_t pos = 0; pos < compressed.size(); pos += chunk)
+        {
+            size_t n = std::min(chunk, compressed.size() - pos);
+            ASSERT_TRUE(decoder.Feed(&compressed[pos], n, sink, raw.size()));
+        }
+
+        EXPECT_EQ(raw, sink.data) << "chunk " << chunk;
+    }
+}
+
+TEST(Lzss, Incompressible)
+{
+    std::vector<uint8_t> raw(64);
+    for (size_t i = 0; i < raw.size(); i++)
+    {
+        raw[i] = i * 7;
+    }
+
+    // One flag byte per 8 literals
+    auto compressed = Compress(raw);
+    EXPECT_EQ(72u, compressed.size());
+
+    // Not enough room
+    uint8_t small[40];
+    EXPECT_EQ(0u, LzssCompress(raw.data(), raw.size(), small, sizeof(small)));
+}
+
+TEST(Lzss, CorruptStream)
+{
+    // Match reaching back before the start of the output
+    const uint8_t bad[] = {0x00, 0x05, 0x00};
+
+    VectorSink sink;
+    LzssDecoder decoder;
+    decoder.Reset();
+    EXPECT_FALSE(decoder.Feed(bad, sizeof(bad), sink, 100));
+}
+
+TEST(Lzss, WriterRealImage)
+{
+    std::vector<uint8_t> raw(build_wideband_image_bin, build_wideband_image_bin + build_wideband_image_bin_len);
+    auto image = MakeImage(raw);
+
+    // Real firmware should come out noticeably smaller
+    EXPECT_LT(image.size(), raw.size() * 8 / 10);
+
+    FakeFlash flash;
+    CompressedImageWriter writer;
+    writer.Begin(flash, 25 * 1024);
+
+    // Fed in 1k blocks, as the bootloader would
+    ImageWriteResult result = ImageWriteResult::NeedMore;
+    for (size_t pos = 0; pos < image.size(); pos += 1024)
+    {
+        EXPECT_EQ(ImageWriteResult::NeedMore, result);
+        result = writer.Feed(&image[pos], std::min<size_t>(1024, image.size() - pos));
+    }
+
+    EXPECT_EQ(ImageWriteResult::Done, result);
+    EXPECT_EQ(0, memcmp(flash.flash.data(), raw.data(), raw.size()));
+    EXPECT_EQ(25u, flash.writes);
+}
+
+TEST(Lzss, WriterOddSize)
+{
+    auto raw = MakeData(1500 + 1);
+    auto image = MakeImage(raw);
+
+    FakeFlash flash;
+    CompressedImageWriter writer;
+    writer.Begin(flash, 25 * 1024);
+
+    EXPECT_EQ(ImageWriteResult::Done, writer.Feed(image.data(), image.size()));
+    EXPECT_EQ(0, memcmp(flash.flash.data(), raw.data(), raw.size()));
+    // Tail is padded to a whole halfword with the erased value
+    EXPECT_EQ(0xFF, flash.flash[raw.size()]);
+}
+
+TEST(Lzss, WriterRejectsBadImages)
+{
+    auto raw = MakeData(3000);
+
+    FakeFlash flash;
+    CompressedImageWriter writer;
+
+    // Bad magic
+    auto image = MakeImage(raw);
+    image[0] ^= 1;
+    writer.Begin(flash, 25 * 1024);
+    EXPECT_EQ(ImageWriteResult::Error, writer.Feed(image.data(), image.size()));
+
+    // Too big for the app area
+    image = MakeImage(raw);
+    writer.Begin(flash, 2048);
+    EXPECT_EQ(ImageWriteResult::Error, writer.Feed(image.data(), image.size()));
+
+    // Corrupted payload fails the CRC check
+    image = MakeImage(raw);
+    image[sizeof(CompressedImageHeader) + 1] ^= 0x40;
+    writer.Begin(flash, 25 * 1024);
+    EXPECT_EQ(ImageWriteResult::Error, writer.Feed(image.data(), image.size()));
+
+    // Once failed, stays failed
+    EXPECT_EQ(ImageWriteResult::Error, writer.Feed(image.data(), 8));
+}
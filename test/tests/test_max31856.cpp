@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include "max31856.h"
+
+TEST(Max31856, Registers)
+{
+    // What the driver always wrote: 50 Hz, 4 samples, K type
+    EXPECT_EQ(0x01, Max31856Cr0Stopped(Max31856Notch::Hz50));
+    EXPECT_EQ(0xA1, Max31856Cr0Auto(Max31856Notch::Hz50));
+    EXPECT_EQ(0x23, Max31856Cr1(Max31856Averaging::Samples4));
+
+    EXPECT_EQ(0x00, Max31856Cr0Stopped(Max31856Notch::Hz60));
+    EXPECT_EQ(0xA0, Max31856Cr0Auto(Max31856Notch::Hz60));
+    EXPECT_EQ(0x03, Max31856Cr1(Max31856Averaging::Samples1));
+    EXPECT_EQ(0x43, Max31856Cr1(Max31856Averaging::Samples16));
+
+    // Garbage from the configuration
+    EXPECT_EQ(0x43, Max31856Cr1(static_cast<Max31856Averaging>(7)));
+    EXPECT_EQ(16, Max31856SampleCount(static_cast<Max31856Averaging>(200)));
+}
+
+TEST(Max31856, ConversionPeriod)
+{
+    EXPECT_EQ(110u, Max31856ConversionPeriodMs(Max31856Averaging::Samples1, Max31856Notch::Hz50));
+    EXPECT_EQ(90u, Max31856ConversionPeriodMs(Max31856Averaging::Samples1, Max31856Notch::Hz60));
+
+    EXPECT_EQ(230u, Max31856ConversionPeriodMs(Max31856Averaging::Samples4, Max31856Notch::Hz50));
+    EXPECT_EQ(190u, Max31856ConversionPeriodMs(Max31856Averaging::Samples4, Max31856Notch::Hz60));
+
+    EXPECT_EQ(710u, Max31856ConversionPeriodMs(Max31856Averaging::Samples16, Max31856Notch::Hz50));
+    EXPECT_EQ(590u, Max31856ConversionPeriodMs(Max31856Averaging::Samples16, Max31856Notch::Hz60));
+
+    // Never faster with more averaging
+    for (uint8_t notch = 0; notch < 2; notch++)
+    {
+        uint32_t last = 0;
+        for (uint8_t avg = 0; avg <= 4; avg++)
+        {
+            uint32_t period = Max31856ConversionPeriodMs(static_cast<Max31856Averaging>(avg), static_cast<Max31856Notch>(notch));
+            EXPECT_GT(period, last);
+            last = period;
+        }
+    }
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "och_delta.h"
+
+template <typename T>
+static void Put(uint8_t* block, size_t offset, T value)
+{
+    memcpy(block + offset, &value, sizeof(value));
+}
+
+static void ExpectBlock(const uint8_t* expected, const OchDeltaDecoder& decoder)
+{
+    ASSERT_TRUE(decoder.HasBlock());
+    EXPECT_EQ(0, memcmp(expected, decoder.GetBlock(), OCH_BLOCK_SIZE));
+}
+
+TEST(OchDelta, FirstIsKeyframe)
+{
+    uint8_t block[OCH_BLOCK_SIZE];
+    for (size_t i = 0; i < sizeof(block); i++)
+    {
+        block[i] = i;
+    }
+
+    OchDeltaEncoder encoder;
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+
+    ASSERT_EQ((size_t)OCH_DELTA_MAX_SIZE, encoder.Encode(block, frame));
+    EXPECT_EQ(OCH_DELTA_KEYFRAME, frame[0]);
+    EXPECT_EQ(0, memcmp(block, frame + 1, OCH_BLOCK_SIZE));
+
+    OchDeltaDecoder decoder;
+    ASSERT_TRUE(decoder.Decode(frame, OCH_DELTA_MAX_SIZE));
+    ExpectBlock(block, decoder);
+}
+
+TEST(OchDelta, OnlyChangedWords)
+{
+    uint8_t block[OCH_BLOCK_SIZE] = {};
+
+    OchDeltaEncoder encoder;
+    OchDeltaDecoder decoder;
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+
+    ASSERT_TRUE(decoder.Decode(frame, encoder.Encode(block, frame)));
+
+    // Nothing changed, just the bitmap
+    size_t size = encoder.Encode(block, frame);
+    ASSERT_EQ(1u + OCH_DELTA_BITMAP_SIZE, size);
+    EXPECT_EQ(0, frame[0]);
+    ASSERT_TRUE(decoder.Decode(frame, size));
+    ExpectBlock(block, decoder);
+
+    // One byte in word 1, and the last word
+    block[5] = 0x55;
+    block[OCH_BLOCK_SIZE - 1] = 0xAA;
+
+    size = encoder.Encode(block, frame);
+    ASSERT_EQ(1u + OCH_DELTA_BITMAP_SIZE + 2 * 4, size);
+    EXPECT_EQ(0x02, frame[1]);
+    EXPECT_EQ(0x80, frame[OCH_DELTA_BITMAP_SIZE]);
+    // Whole words go out
+    const uint8_t word1[] = { 0x00, 0x55, 0x00, 0x00 };
+    EXPECT_EQ(0, memcmp(word1, frame + 1 + OCH_DELTA_BITMAP_SIZE, 4));
+
+    ASSERT_TRUE(decoder.Decode(frame, size));
+    ExpectBlock(block, decoder);
+
+    EXPECT_EQ(1u, encoder.keyframeCount);
+    EXPECT_EQ(2u, encoder.deltaCount);
+}
+
+TEST(OchDelta, KeyframeWhenSmaller)
+{
+    uint8_t block[OCH_BLOCK_SIZE] = {};
+
+    OchDeltaEncoder encoder;
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+    encoder.Encode(block, frame);
+
+    // Every word changed, a delta would be bigger than the block
+    memset(block, 0xFF, sizeof(block));
+
+    EXPECT_EQ((size_t)OCH_DELTA_MAX_SIZE, encoder.Encode(block, frame));
+    EXPECT_EQ(OCH_DELTA_KEYFRAME, frame[0]);
+}
+
+TEST(OchDelta, PeriodicKeyframe)
+{
+    uint8_t block[OCH_BLOCK_SIZE] = {};
+
+    OchDeltaEncoder encoder;
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+
+    for (int i = 0; i < 3 * OCH_DELTA_KEYFRAME_INTERVAL + 3; i++)
+    {
+        bool keyframe = encoder.Encode(block, frame) == OCH_DELTA_MAX_SIZE;
+        EXPECT_EQ(i % (OCH_DELTA_KEYFRAME_INTERVAL + 1) == 0, keyframe) << i;
+    }
+
+    // Restarted stream opens with a keyframe
+    encoder.Reset();
+    EXPECT_EQ((size_t)OCH_DELTA_MAX_SIZE, encoder.Encode(block, frame));
+}
+
+TEST(OchDelta, DecoderRejects)
+{
+    uint8_t block[OCH_BLOCK_SIZE] = {};
+
+    OchDeltaEncoder encoder;
+    OchDeltaDecoder decoder;
+    uint8_t keyframe[OCH_DELTA_MAX_SIZE];
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+
+    encoder.Encode(block, keyframe);
+    block[0] = 1;
+    size_t size = encoder.Encode(block, frame);
+
+    // Delta with nothing to apply it to, say the keyframe was lost
+    EXPECT_FALSE(decoder.Decode(frame, size));
+    EXPECT_FALSE(decoder.HasBlock());
+
+    // Short keyframe
+    EXPECT_FALSE(decoder.Decode(keyframe, OCH_DELTA_MAX_SIZE - 1));
+    EXPECT_FALSE(decoder.Decode(keyframe, 0));
+
+    ASSERT_TRUE(decoder.Decode(keyframe, OCH_DELTA_MAX_SIZE));
+
+    // Bitmap doesn't match the length, block is left alone
+    EXPECT_FALSE(decoder.Decode(frame, size - 1));
+    EXPECT_FALSE(decoder.Decode(frame, size + 4));
+    EXPECT_FALSE(decoder.Decode(frame, 3));
+    EXPECT_EQ(0, decoder.GetBlock()[0]);
+
+    ASSERT_TRUE(decoder.Decode(frame, size));
+    ExpectBlock(block, decoder);
+
+    // Resynchronized by the next keyframe after a reset
+    decoder.Reset();
+    EXPECT_FALSE(decoder.Decode(frame, size));
+}
+
+/**
+ * Drive trace for the bandwidth comparison, laid out like the real output channel block
+ * (common @ 0, AFR @ 32/64, EGT @ 96/112, cylinder lambda @ 128/160, CAN @ 192), 200 Hz records
+ * like OCH_PUBLISH_PERIOD_MS: warm up, then idle, cruise and a few throttle blips.
+ */
+static void BuildTraceBlock(uint8_t* block, int n)
+{
+    float t = n * 0.005f;
+    bool warm = t > 10;
+    // Throttle blips every 7 seconds
+    bool transient = warm && std::fmod(t, 7.0f) < 1.0f;
+
+    memset(block, 0, OCH_BLOCK_SIZE);
+
+    // Battery voltage, quantized by the ADC so mostly steady
+    Put<float>(block, 0, std::round((13.8f + 0.05f * std::sin(t)) * 100) / 100);
+    Put<uint16_t>(block, 6, 12);
+
+    for (int ch = 0; ch < 2; ch++)
+    {
+        uint8_t* afr = block + 32 + 32 * ch;
+
+        float lambda = !warm ? 0 : transient ? 0.85f + 0.1f * std::sin(t * 20 + ch) : 1.0f + 0.002f * std::sin(t * 3 + ch);
+        Put<float>(afr, 0, std::round(lambda * 1000) / 1000);
+        Put<uint16_t>(afr, 4, warm ? 780 : 20 + n / 50);
+        Put<uint16_t>(afr, 8, warm ? 450 : 0);
+        Put<uint16_t>(afr, 10, warm ? 300 + (n / 40) % 3 : 0);
+        Put<float>(afr, 12, 0);
+        Put<float>(afr, 16, warm ? std::round((lambda - 1) * 50) / 10 : 0);
+        Put<uint16_t>(afr, 20, warm ? 45 + (n / 100) % 2 : 100);
+        Put<uint16_t>(afr, 22, warm ? 750 : 1200);
+        Put<float>(afr, 24, warm ? 300 : 0);
+        afr[28] = 0;
+        afr[29] = warm ? 3 : 1;
+
+        uint8_t* egt = block + 96 + 16 * ch;
+        Put<float>(egt, 0, std::round(warm ? (transient ? 750 : 550) + 5 * std::sin(t) : 20 + t * 30));
+        Put<float>(egt, 4, 25);
+
+        uint8_t* cyl = block + 128 + 32 * ch;
+        // One cylinder updates per record
+        int cylinder = n % 4;
+        for (int i = 0; i < 4; i++)
+        {
+            uint16_t value = warm ? 10000 + ((i == cylinder) ? n % 50 : 0) : 0;
+            Put<uint16_t>(cyl, i * 2, value);
+        }
+        cyl[24] = 4;
+        cyl[25] = cylinder;
+        cyl[26] = warm;
+    }
+
+    // CAN counters always move
+    uint8_t* can = block + 192;
+    Put<uint32_t>(can, 0, n * 2);
+    Put<uint32_t>(can, 4, n / 2);
+    Put<uint16_t>(can, 12, 400);
+    Put<uint16_t>(can, 30, 120 + (n / 200) % 5);
+}
+
+TEST(OchDelta, Bandwidth)
+{
+    const int records = 60 * 200;
+
+    OchDeltaEncoder encoder;
+    OchDeltaDecoder decoder;
+
+    uint8_t block[OCH_BLOCK_SIZE];
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+    size_t total = 0;
+
+    for (int n = 0; n < records; n++)
+    {
+        BuildTraceBlock(block, n);
+
+        size_t size = encoder.Encode(block, frame);
+        total += size;
+
+        ASSERT_TRUE(decoder.Decode(frame, size));
+        ASSERT_EQ(0, memcmp(block, decoder.GetBlock(), OCH_BLOCK_SIZE)) << n;
+    }
+
+    float full = records * OCH_BLOCK_SIZE;
+    printf("och delta: %d records, %.1f bytes/record vs %d, %.1fx smaller, %u keyframes\n",
+        records, (float)total / records, OCH_BLOCK_SIZE, full / total, (unsigned)encoder.keyframeCount);
+
+    // Most of the block holds still
+    EXPECT_LT(total * 3, full);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <rusefi/crc.h>
+
+#include "och_snapshot.h"
+
+static void PublishFrame(OchSnapshot& och, uint8_t fill)
+{
+    uint8_t* block = och.BeginWrite();
+    ASSERT_NE(nullptr, block);
+
+    memset(block, fill, OCH_BLOCK_SIZE);
+    och.Seal();
+    och.Publish();
+}
+
+TEST(OchSnapshot, NothingBeforeFirstPublish)
+{
+    OchSnapshot och;
+    EXPECT_EQ(nullptr, och.Acquire());
+}
+
+TEST(OchSnapshot, PacketIsFramed)
+{
+    OchSnapshot och;
+    PublishFrame(och, 0x5A);
+
+    const uint8_t* packet = och.Acquire();
+    ASSERT_NE(nullptr, packet);
+
+    // 257 = response code + block
+    EXPECT_EQ(0x01, packet[0]);
+    EXPECT_EQ(0x01, packet[1]);
+    EXPECT_EQ(0x00, packet[2]);
+    EXPECT_EQ(0x5A, GetOchBlock(packet)[0]);
+    EXPECT_EQ(0x5A, GetOchBlock(packet)[OCH_BLOCK_SIZE - 1]);
+
+    uint32_t crc = crc32(packet + 2, OCH_BLOCK_SIZE + 1);
+    const uint8_t* tail = packet + OCH_PACKET_SIZE - 4;
+    EXPECT_EQ(crc, (uint32_t)(tail[0] << 24 | tail[1] << 16 | tail[2] << 8 | tail[3]));
+
+    och.Release(packet);
+}
+
+TEST(OchSnapshot, ReaderGetsLatest)
+{
+    OchSnapshot och;
+    PublishFrame(och, 1);
+    PublishFrame(och, 2);
+    PublishFrame(och, 3);
+
+    const uint8_t* packet = och.Acquire();
+    EXPECT_EQ(3, GetOchBlock(packet)[0]);
+    och.Release(packet);
+
+    EXPECT_EQ(3u, och.publishCount);
+    EXPECT_EQ(0u, och.skipCount);
+}
+
+TEST(OchSnapshot, PinnedFrameIsNeverWritten)
+{
+    OchSnapshot och;
+    PublishFrame(och, 1);
+
+    // Slow reader holds frame 1
+    const uint8_t* slow = och.Acquire();
+
+    // Producer can still use the other buffer once...
+    PublishFrame(och, 2);
+
+    // ...but then would wrap around onto the pinned one, so it skips
+    EXPECT_EQ(nullptr, och.BeginWrite());
+    EXPECT_EQ(1u, och.skipCount);
+
+    // A new reader gets the latest complete frame
+    const uint8_t* fast = och.Acquire();
+    EXPECT_EQ(2, GetOchBlock(fast)[0]);
+    och.Release(fast);
+
+    // The slow reader's frame didn't change under it
+    for (size_t i = 0; i < OCH_BLOCK_SIZE; i++)
+    {
+        ASSERT_EQ(1, GetOchBlock(slow)[i]);
+    }
+
+    och.Release(slow);
+    PublishFrame(och, 3);
+
+    const uint8_t* packet = och.Acquire();
+    EXPECT_EQ(3, GetOchBlock(packet)[0]);
+    och.Release(packet);
+}
+
+TEST(OchSnapshot, TwoReadersSameFrame)
+{
+    OchSnapshot och;
+    PublishFrame(och, 7);
+
+    // Two TS channels sending the same frame
+    const uint8_t* a = och.Acquire();
+    const uint8_t* b = och.Acquire();
+    EXPECT_EQ(a, b);
+
+    PublishFrame(och, 8);
+
+    // Still pinned by one of them
+    och.Release(a);
+    EXPECT_EQ(nullptr, och.BeginWrite());
+
+    och.Release(b);
+    EXPECT_NE(nullptr, och.BeginWrite());
+}
+
+TEST(OchSnapshot, OnlyWantedWhileRead)
+{
+    OchSnapshot och;
+    EXPECT_FALSE(och.IsWanted());
+
+    och.Want();
+    for (int i = 0; i < OCH_WANTED_FRAMES; i++)
+    {
+        ASSERT_TRUE(och.IsWanted()) << i;
+        PublishFrame(och, i);
+    }
+
+    // Nobody asked for a while
+    EXPECT_FALSE(och.IsWanted());
+
+    // A reader polling keeps it going
+    och.Want();
+    PublishFrame(och, 1);
+    och.Want();
+    EXPECT_TRUE(och.IsWanted());
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "och_stream.h"
+
+static void SetTimeMs(uint32_t ms)
+{
+    Timer::setMockTime(ms * 1000);
+}
+
+TEST(OchStream, RejectsBadRequests)
+{
+    OchStream stream;
+
+    // Too fast, too slow
+    EXPECT_FALSE(stream.Start(OchStreamSource::Block, 1, 0, 256, 256));
+    EXPECT_FALSE(stream.Start(OchStreamSource::Block, 60000, 0, 256, 256));
+    // Past the end of the block, empty
+    EXPECT_FALSE(stream.Start(OchStreamSource::Block, 20, 200, 100, 256));
+    EXPECT_FALSE(stream.Start(OchStreamSource::Block, 20, 0, 0, 256));
+    // No scatter list yet
+    EXPECT_FALSE(stream.Start(OchStreamSource::Scatter, 20, 0, 0, 0));
+    // Unknown source
+    EXPECT_FALSE(stream.Start(static_cast<OchStreamSource>(7), 20, 0, 10, 256));
+
+    EXPECT_FALSE(stream.IsActive());
+}
+
+TEST(OchStream, Schedule)
+{
+    SetTimeMs(1000);
+
+    OchStream stream;
+    ASSERT_TRUE(stream.Start(OchStreamSource::Block, 20, 32, 64, 256));
+    EXPECT_EQ(32, stream.GetOffset());
+    EXPECT_EQ(64, stream.GetCount());
+
+    // First record right away
+    EXPECT_TRUE(stream.IsDue());
+    EXPECT_EQ(0u, stream.GetMsUntilDue());
+    EXPECT_EQ(0, stream.NextRecord());
+
+    EXPECT_FALSE(stream.IsDue());
+    EXPECT_EQ(21u, stream.GetMsUntilDue());
+
+    SetTimeMs(1015);
+    EXPECT_FALSE(stream.IsDue());
+    EXPECT_EQ(6u, stream.GetMsUntilDue());
+
+    SetTimeMs(1021);
+    EXPECT_TRUE(stream.IsDue());
+    EXPECT_EQ(1, stream.NextRecord());
+
+    SetTimeMs(1042);
+    EXPECT_EQ(2, stream.NextRecord());
+
+    EXPECT_EQ(3u, stream.recordCount);
+    EXPECT_EQ(0u, stream.lateCount);
+
+    stream.Stop();
+    EXPECT_FALSE(stream.IsActive());
+    EXPECT_FALSE(stream.IsDue());
+}
+
+TEST(OchStream, ScatterTakesWholeRead)
+{
+    OchStream stream;
+    ASSERT_TRUE(stream.Start(OchStreamSource::Scatter, 10, 100, 3, 48));
+
+    EXPECT_EQ(OchStreamSource::Scatter, stream.GetSource());
+    EXPECT_EQ(0, stream.GetOffset());
+    EXPECT_EQ(48, stream.GetCount());
+}
+
+TEST(OchStream, CountsLateRecords)
+{
+    SetTimeMs(0);
+
+    OchStream stream;
+    ASSERT_TRUE(stream.Start(OchStreamSource::Block, 10, 0, 256, 256));
+    stream.NextRecord();
+
+    // Link too slow, the next one goes out 3 periods later
+    SetTimeMs(30);
+    stream.NextRecord();
+    EXPECT_EQ(1u, stream.lateCount);
+
+    // Restarting starts the sequence over, and the first record is never late
+    SetTimeMs(1000);
+    ASSERT_TRUE(stream.Start(OchStreamSource::Block, 10, 0, 256, 256));
+    EXPECT_EQ(0, stream.NextRecord());
+    EXPECT_EQ(1u, stream.lateCount);
+}
+
+TEST(OchStream, DeltaTakesWholeBlock)
+{
+    OchStream stream;
+    ASSERT_TRUE(stream.Start(OchStreamSource::Delta, 10, 32, 4, 256));
+
+    EXPECT_EQ(0, stream.GetOffset());
+    EXPECT_EQ(256, stream.GetCount());
+
+    // Opens with a keyframe, also after a restart
+    uint8_t block[OCH_BLOCK_SIZE] = {};
+    uint8_t frame[OCH_DELTA_MAX_SIZE];
+    EXPECT_EQ((size_t)OCH_DELTA_MAX_SIZE, stream.delta.Encode(block, frame));
+    EXPECT_LT(stream.delta.Encode(block, frame), (size_t)OCH_DELTA_MAX_SIZE);
+
+    ASSERT_TRUE(stream.Start(OchStreamSource::Delta, 10, 0, 0, 256));
+    EXPECT_EQ((size_t)OCH_DELTA_MAX_SIZE, stream.delta.Encode(block, frame));
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "page_diff.h"
+
+static std::vector<uint8_t> MakeImage()
+{
+    std::vector<uint8_t> image(APP_PAGE_SIZE * APP_PAGE_COUNT);
+
+    for (size_t i = 0; i < image.size(); i++)
+    {
+        image[i] = (i * 13) ^ (i >> 10);
+    }
+
+    return image;
+}
+
+static std::vector<uint32_t> GetCrcs(const std::vector<uint8_t>& flash)
+{
+    std::vector<uint32_t> crcs;
+
+    for (size_t i = 0; i < APP_PAGE_COUNT; i++)
+    {
+        crcs.push_back(GetPageCrc(&flash[i * APP_PAGE_SIZE]));
+    }
+
+    return crcs;
+}
+
+TEST(PageDiff, Identical)
+{
+    auto image = MakeImage();
+    auto crcs = GetCrcs(image);
+
+    EXPECT_EQ(0u, GetChangedPages(image.data(), image.size(), crcs.data(), APP_PAGE_COUNT));
+}
+
+TEST(PageDiff, FewPagesChanged)
+{
+    auto device = MakeImage();
+    auto crcs = GetCrcs(device);
+
+    auto image = device;
+    image[5] ^= 1;
+    image[3 * APP_PAGE_SIZE + 100] ^= 1;
+    // Last byte of a page
+    image[11 * APP_PAGE_SIZE - 1] ^= 1;
+    // Image CRC at the very end
+    image[image.size() - 1] ^= 1;
+
+    uint32_t changed = GetChangedPages(image.data(), image.size(), crcs.data(), APP_PAGE_COUNT);
+    EXPECT_EQ((1u << 0) | (1u << 3) | (1u << 10) | (1u << 24), changed);
+
+    // Rewriting just those pages gets the device to the new image
+    for (size_t i = 0; i < APP_PAGE_COUNT; i++)
+    {
+        if (changed & (1u << i))
+        {
+            memcpy(&device[i * APP_PAGE_SIZE], &image[i * APP_PAGE_SIZE], APP_PAGE_SIZE);
+        }
+    }
+
+    EXPECT_EQ(image, device);
+    EXPECT_EQ(0u, GetChangedPages(image.data(), image.size(), GetCrcs(device).data(), APP_PAGE_COUNT));
+}
+
+TEST(PageDiff, ShortImage)
+{
+    // Device has a short image followed by erased flash
+    std::vector<uint8_t> device(APP_PAGE_SIZE * APP_PAGE_COUNT, 0xFF);
+    auto full = MakeImage();
+    size_t size = 2 * APP_PAGE_SIZE + 10;
+    memcpy(device.data(), full.data(), size);
+
+    auto crcs = GetCrcs(device);
+
+    EXPECT_EQ(0u, GetChangedPages(full.data(), size, crcs.data(), APP_PAGE_COUNT));
+
+    // A full size image differs from the partial page on
+    uint32_t changed = GetChangedPages(full.data(), full.size(), crcs.data(), APP_PAGE_COUNT);
+    EXPECT_EQ(~0u << 2 & ((1u << APP_PAGE_COUNT) - 1), changed);
+}
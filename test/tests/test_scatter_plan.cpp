@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#include "scatter_plan.h"
+
+#define BLOCK_SIZE 256
+
+static uint16_t Entry(uint16_t offset, uint8_t size)
+{
+    uint8_t type = 1;
+    while ((1 << (type - 1)) < size)
+    {
+        type++;
+    }
+
+    return (type << 13) | offset;
+}
+
+static std::vector<uint8_t> MakeBlock()
+{
+    std::vector<uint8_t> block(BLOCK_SIZE);
+    for (size_t i = 0; i < block.size(); i++)
+    {
+        block[i] = i;
+    }
+    return block;
+}
+
+// What the '9' command used to do on every poll: decode each entry and copy it
+static size_t GatherNaive(const uint16_t* entries, size_t count, const uint8_t* block, uint8_t* out)
+{
+    size_t total = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        int packed = entries[i];
+        int type = packed >> 13;
+
+        if (type == 0)
+            continue;
+        int size = 1 << (type - 1);
+
+        int offset = packed & 0x1FFF;
+        if (offset + size > BLOCK_SIZE)
+        {
+            memset(out + total, 0, size);
+        }
+        else
+        {
+            memcpy(out + total, block + offset, size);
+        }
+        total += size;
+    }
+
+    return total;
+}
+
+TEST(ScatterPlan, Empty)
+{
+    uint16_t entries[HIGH_SPEED_COUNT] = {};
+
+    ScatterPlan plan;
+    plan.Compile(entries, HIGH_SPEED_COUNT, BLOCK_SIZE, 256);
+
+    EXPECT_EQ(0u, plan.GetTotalSize());
+    EXPECT_EQ(0u, plan.GetRunCount());
+}
+
+TEST(ScatterPlan, MergesAdjacent)
+{
+    // lambda (F32 @32) and temperature (U16 @36) of AFR 0, then vbatt (F32 @0)
+    uint16_t entries[] = {Entry(32, 4), Entry(36, 2), 0, Entry(0, 4)};
+
+    ScatterPlan plan;
+    plan.Compile(entries, 4, BLOCK_SIZE, 256);
+
+    EXPECT_EQ(10u, plan.GetTotalSize());
+    EXPECT_EQ(2u, plan.GetRunCount());
+
+    auto block = MakeBlock();
+    uint8_t out[10];
+    EXPECT_EQ(10u, plan.Gather(block.data(), out));
+
+    const uint8_t expected[] = {32, 33, 34, 35, 36, 37, 0, 1, 2, 3};
+    EXPECT_EQ(0, memcmp(expected, out, sizeof(out)));
+}
+
+TEST(ScatterPlan, PastTheEndReadsZero)
+{
+    uint16_t entries[] = {Entry(254, 2), Entry(256, 4), Entry(300, 2), Entry(0, 1)};
+
+    ScatterPlan plan;
+    plan.Compile(entries, 4, BLOCK_SIZE, 256);
+
+    // The two zero entries become one run
+    EXPECT_EQ(3u, plan.GetRunCount());
+
+    auto block = MakeBlock();
+    uint8_t out[9];
+    memset(out, 0xAA, sizeof(out));
+    EXPECT_EQ(9u, plan.Gather(block.data(), out));
+
+    const uint8_t expected[] = {254, 255, 0, 0, 0, 0, 0, 0, 0};
+    EXPECT_EQ(0, memcmp(expected, out, sizeof(out)));
+}
+
+TEST(ScatterPlan, LimitsResponseSize)
+{
+    // 64 F32 entries would be 256 bytes, only 250 fit
+    uint16_t entries[HIGH_SPEED_COUNT];
+    for (size_t i = 0; i < HIGH_SPEED_COUNT; i++)
+    {
+        entries[i] = Entry((i % 16) * 4, 4);
+    }
+
+    ScatterPlan plan;
+    plan.Compile(entries, HIGH_SPEED_COUNT, BLOCK_SIZE, 250);
+    EXPECT_EQ(248u, plan.GetTotalSize());
+}
+
+// A typical dual channel logging setup
+static size_t MakeRealisticList(uint16_t* entries)
+{
+    size_t n = 0;
+
+    // common: vbatt, burn state
+    entries[n++] = Entry(0, 4);
+    entries[n++] = Entry(4, 1);
+
+    for (int ch = 0; ch < 2; ch++)
+    {
+        uint16_t afr = 32 + ch * 32;
+        // lambda, temperature, nernst DC/AC, pump currents, heater duty and voltage, ESR, fault, heater state
+        entries[n++] = Entry(afr + 0, 4);
+        entries[n++] = Entry(afr + 4, 2);
+        entries[n++] = Entry(afr + 8, 2);
+        entries[n++] = Entry(afr + 10, 2);
+        entries[n++] = Entry(afr + 12, 4);
+        entries[n++] = Entry(afr + 16, 4);
+        entries[n++] = Entry(afr + 20, 2);
+        entries[n++] = Entry(afr + 22, 2);
+        entries[n++] = Entry(afr + 24, 4);
+        entries[n++] = Entry(afr + 28, 1);
+        entries[n++] = Entry(afr + 29, 1);
+
+        uint16_t egt = 96 + ch * 16;
+        entries[n++] = Entry(egt + 0, 4);
+        entries[n++] = Entry(egt + 4, 4);
+        entries[n++] = Entry(egt + 8, 1);
+        entries[n++] = Entry(egt + 12, 4);
+
+        // per cylinder lambda, 8 cylinders
+        uint16_t cyl = 128 + ch * 32;
+        for (int i = 0; i < 8; i++)
+        {
+            entries[n++] = Entry(cyl + i * 2, 2);
+        }
+    }
+
+    // CAN: frame counters, bus load
+    entries[n++] = Entry(192, 4);
+    entries[n++] = Entry(196, 4);
+    entries[n++] = Entry(200, 4);
+    entries[n++] = Entry(224, 2);
+    entries[n++] = Entry(226, 2);
+    entries[n++] = Entry(218, 1);
+    entries[n++] = Entry(219, 1);
+    entries[n++] = Entry(220, 1);
+
+    while (n < HIGH_SPEED_COUNT)
+    {
+        entries[n++] = 0;
+    }
+
+    return n;
+}
+
+TEST(ScatterPlan, Benchmark)
+{
+    uint16_t entries[HIGH_SPEED_COUNT];
+    MakeRealisticList(entries);
+
+    ScatterPlan plan;
+    plan.Compile(entries, HIGH_SPEED_COUNT, BLOCK_SIZE, 256);
+
+    auto block = MakeBlock();
+    uint8_t expected[256];
+    uint8_t out[256];
+
+    size_t expectedSize = GatherNaive(entries, HIGH_SPEED_COUNT, block.data(), expected);
+    ASSERT_EQ(expectedSize, plan.Gather(block.data(), out));
+    ASSERT_EQ(0, memcmp(expected, out, expectedSize));
+
+    // Fewer copies than data points
+    EXPECT_LT(plan.GetRunCount(), 20u);
+
+    constexpr int iterations = 100000;
+    volatile uint8_t sink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        GatherNaive(entries, HIGH_SPEED_COUNT, block.data(), out);
+        sink = sink + out[i % expectedSize];
+    }
+    auto naive = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        plan.Gather(block.data(), out);
+        sink = sink + out[i % expectedSize];
+    }
+    auto planned = std::chrono::steady_clock::now() - start;
+
+    using ns = std::chrono::nanoseconds;
+    printf("scatter read, %zu bytes in %zu runs: decode every poll %lld ns, compiled plan %lld ns\n",
+           expectedSize,
+           plan.GetRunCount(),
+           (long long)(std::chrono::duration_cast<ns>(naive).count() / iterations),
+           (long long)(std::chrono::duration_cast<ns>(planned).count() / iterations));
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "spi_queue.h"
+
+struct SpiQueueLog
+{
+    std::vector<uint8_t> done;
+    std::vector<bool> ok;
+};
+
+struct SpiQueueDevice
+{
+    SpiQueueLog* log;
+    uint8_t device;
+};
+
+static void OnDone(void* context, bool ok)
+{
+    auto device = reinterpret_cast<SpiQueueDevice*>(context);
+    device->log->done.push_back(device->device);
+    device->log->ok.push_back(ok);
+}
+
+static SpiTransaction MakeTransaction(SpiQueueDevice& device)
+{
+    SpiTransaction t = {};
+    t.device = device.device;
+    t.size = 4;
+    t.done = OnDone;
+    t.context = &device;
+    return t;
+}
+
+TEST(SpiQueue, BackToBack)
+{
+    SpiQueueLog log;
+    SpiQueueDevice devices[] = { { &log, 0 }, { &log, 1 }, { &log, 2 } };
+
+    SpiQueue queue;
+    EXPECT_TRUE(queue.IsIdle());
+    EXPECT_EQ(nullptr, queue.StartNext());
+
+    for (auto& device : devices)
+    {
+        ASSERT_TRUE(queue.Push(MakeTransaction(device)));
+    }
+
+    auto t = queue.StartNext();
+    ASSERT_NE(nullptr, t);
+    EXPECT_EQ(0, t->device);
+    EXPECT_EQ(t, queue.GetRunning());
+
+    // Only one at a time
+    EXPECT_EQ(nullptr, queue.StartNext());
+    EXPECT_FALSE(queue.IsIdle());
+
+    // Each completion hands out the next one without going back to the thread
+    t = queue.Complete(true);
+    ASSERT_NE(nullptr, t);
+    EXPECT_EQ(1, t->device);
+
+    t = queue.Complete(true);
+    ASSERT_NE(nullptr, t);
+    EXPECT_EQ(2, t->device);
+
+    EXPECT_EQ(nullptr, queue.Complete(true));
+    EXPECT_TRUE(queue.IsIdle());
+    EXPECT_EQ(nullptr, queue.GetRunning());
+
+    EXPECT_EQ((std::vector<uint8_t>{ 0, 1, 2 }), log.done);
+    EXPECT_EQ(3u, queue.completeCount);
+    EXPECT_EQ(0u, queue.errorCount);
+}
+
+TEST(SpiQueue, Errors)
+{
+    SpiQueueLog log;
+    SpiQueueDevice a = { &log, 0 };
+    SpiQueueDevice b = { &log, 1 };
+
+    SpiQueue queue;
+    queue.Push(MakeTransaction(a));
+    queue.Push(MakeTransaction(b));
+    queue.StartNext();
+
+    // A failed transfer doesn't hold up the rest
+    ASSERT_NE(nullptr, queue.Complete(false));
+    EXPECT_EQ(nullptr, queue.Complete(true));
+
+    EXPECT_EQ((std::vector<bool>{ false, true }), log.ok);
+    EXPECT_EQ(1u, queue.completeCount);
+    EXPECT_EQ(1u, queue.errorCount);
+
+    // Nothing running, nothing to complete
+    EXPECT_EQ(nullptr, queue.Complete(true));
+    EXPECT_EQ(2u, log.done.size());
+}
+
+TEST(SpiQueue, FullAndWrap)
+{
+    SpiQueueLog log;
+    SpiQueueDevice device = { &log, 3 };
+
+    SpiQueue queue;
+
+    for (size_t i = 0; i < SPI_QUEUE_SIZE; i++)
+    {
+        ASSERT_TRUE(queue.Push(MakeTransaction(device)));
+    }
+
+    EXPECT_FALSE(queue.Push(MakeTransaction(device)));
+
+    // Room again once one is done, and the ring wraps
+    queue.StartNext();
+    queue.Complete(true);
+    EXPECT_TRUE(queue.Push(MakeTransaction(device)));
+
+    size_t count = 1;
+    while (queue.Complete(true))
+    {
+        count++;
+    }
+
+    EXPECT_EQ((size_t)SPI_QUEUE_SIZE, count);
+    EXPECT_TRUE(queue.IsIdle());
+}
+
+static void QueueAnother(void* context, bool)
+{
+    auto queue = reinterpret_cast<SpiQueue*>(context);
+
+    SpiTransaction t = {};
+    t.device = 7;
+    queue->Push(t);
+}
+
+TEST(SpiQueue, CallbackQueuesMore)
+{
+    SpiQueue queue;
+
+    SpiTransaction t = {};
+    t.done = QueueAnother;
+    t.context = &queue;
+    queue.Push(t);
+    queue.StartNext();
+
+    // Goes straight on to what the callback queued
+    auto next = queue.Complete(true);
+    ASSERT_NE(nullptr, next);
+    EXPECT_EQ(7, next->device);
+    EXPECT_EQ(nullptr, queue.Complete(true));
+}
+
+TEST(SpiQueue, Reset)
+{
+    SpiQueueLog log;
+    SpiQueueDevice device = { &log, 0 };
+
+    SpiQueue queue;
+    queue.Push(MakeTransaction(device));
+    queue.Push(MakeTransaction(device));
+    queue.StartNext();
+
+    queue.Reset();
+    EXPECT_TRUE(queue.IsIdle());
+    EXPECT_EQ(nullptr, queue.StartNext());
+    EXPECT_TRUE(log.done.empty());
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include "time_sync.h"
+
+TEST(TimeSync, PassthroughBeforeSync)
+{
+    TimeSync dut;
+
+    EXPECT_FALSE(dut.IsSynced());
+    EXPECT_EQ(12345u, dut.ToMaster(12345));
+}
+
+TEST(TimeSync, FirstSyncSteps)
+{
+    TimeSync dut;
+
+    dut.OnSync(1000000, 5000);
+
+    EXPECT_TRUE(dut.IsSynced());
+    EXPECT_EQ(1000000u, dut.ToMaster(5000));
+    EXPECT_EQ(1000100u, dut.ToMaster(5100));
+    EXPECT_EQ(999900u, dut.ToMaster(4900));
+}
+
+TEST(TimeSync, LargeErrorSteps)
+{
+    TimeSync dut;
+
+    dut.OnSync(1000000, 0);
+
+    // Master rebooted, jump to it immediately
+    dut.OnSync(50, 100000);
+    EXPECT_EQ(50u, dut.ToMaster(100000));
+}
+
+TEST(TimeSync, SmallErrorSlews)
+{
+    TimeSync dut;
+
+    dut.OnSync(0, 0);
+
+    // 100us off after 100ms, only correct half of it
+    dut.OnSync(100100, 100000);
+    EXPECT_EQ(100050u, dut.ToMaster(100000));
+}
+
+TEST(TimeSync, TracksDrift)
+{
+    TimeSync dut;
+
+    // Master clock runs 200ppm fast compared to ours
+    const double masterRate = 1.0002;
+
+    uint32_t local = 0;
+    for (int i = 0; i < 200; i++)
+    {
+        dut.OnSync(local * masterRate, local);
+        local += 100000;
+    }
+
+    // Timestamps are whole microseconds, so 1us per 100ms sync period (10ppm) is as good as it gets
+    EXPECT_NEAR(200, dut.GetDriftPpm(), 10);
+
+    // Halfway between sync messages we should still be within a microsecond or two
+    uint32_t halfway = local - 50000;
+    EXPECT_NEAR(halfway * masterRate, dut.ToMaster(halfway), 2);
+}
+
+TEST(TimeSync, Wraparound)
+{
+    TimeSync dut;
+
+    dut.OnSync(0xFFFFFF00, 0xFFFFFFF0);
+
+    // Both clocks wrap, we should carry straight through
+    EXPECT_EQ(0xF0u, dut.ToMaster(0x1E0));
+
+    dut.OnSync(0x100, 0x1F0);
+    EXPECT_EQ(0x100u, dut.ToMaster(0x1F0));
+}
+
+TEST(TimeSync, CloseSyncsIgnored)
+{
+    TimeSync dut;
+
+    dut.OnSync(0, 0);
+    dut.OnSync(100000, 100000);
+
+    // 1ms apart with 1ms of error would be a 20% rate change
+    dut.OnSync(102000, 101000);
+    EXPECT_NEAR(0, dut.GetDriftPpm(), 0.01f);
+    EXPECT_EQ(101000u, dut.ToMaster(101000));
+}
+
+TEST(TimeSync, DriftClamped)
+{
+    TimeSync dut;
+
+    dut.OnSync(0, 0);
+
+    // Just under the step threshold every time, way more than any crystal is off
+    uint32_t local = 0;
+    uint32_t master = 0;
+    for (int i = 0; i < 50; i++)
+    {
+        local += TIME_SYNC_MIN_INTERVAL_US;
+        master = dut.ToMaster(local) + 4000;
+        dut.OnSync(master, local);
+    }
+
+    EXPECT_LE(dut.GetDriftPpm(), 500.01f);
+    EXPECT_GE(dut.GetDriftPpm(), 499.99f);
+}